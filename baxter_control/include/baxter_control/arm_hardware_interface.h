@@ -48,6 +48,7 @@
 
 // Parent class
 #include <baxter_control/arm_interface.h>
+#include <baxter_control/joint_command_publisher.h>
 
 namespace baxter_control
 {
@@ -59,14 +60,13 @@ class ArmHardwareInterface : public ArmInterface
 private:
 
   // Publishers
-  ros::Publisher pub_joint_command_;
+  JointCommandPublisher pub_joint_command_;
   ros::Publisher pub_trajectory_command_;
 
   // Subscriber
   ros::Subscriber cuff_squeezed_sub_; // this is used to update the controllers when manual mode is started
 
   // Messages to send
-  baxter_core_msgs::JointCommand output_msg_;
   trajectory_msgs::JointTrajectory trajectory_command_msg_;
 
   // Track button status
@@ -93,6 +93,7 @@ public:
     hardware_interface::VelocityJointInterface& vj_interface,
     hardware_interface::PositionJointInterface& pj_interface,
     int* joint_mode,
+    ArmStateBlock& state_block,
     sensor_msgs::JointStateConstPtr state_msg
   );
 
@@ -102,11 +103,6 @@ public:
    */
   void stateCallback(const sensor_msgs::JointStateConstPtr& msg);
 
-  /**
-   * \brief Copy the joint state message into our hardware interface datastructures
-   */
-  void read( sensor_msgs::JointStateConstPtr &state_msg );
-
   /**
    * \brief Publish our hardware interface datastructures commands to Baxter hardware
    */
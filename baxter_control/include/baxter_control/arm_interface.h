@@ -54,6 +54,7 @@
 // Baxter
 #include <baxter_core_msgs/JointCommand.h>
 #include <baxter_core_msgs/JointCommand.h>
+#include <baxter_control/arm_state_block.h>
 
 namespace baxter_control
 {
@@ -71,9 +72,12 @@ protected:
   unsigned int n_dof_;
 
   std::vector<std::string> joint_names_;
-  std::vector<double> joint_position_;
-  std::vector<double> joint_velocity_;
-  std::vector<double> joint_effort_;
+
+  // This arm's joints in the state block shared by both arms, set by init
+  double* joint_position_;
+  double* joint_velocity_;
+  double* joint_effort_;
+
   std::vector<double> joint_position_command_;
   std::vector<double> joint_effort_command_;
   std::vector<double> joint_velocity_command_;
@@ -94,7 +98,10 @@ public:
    */
   ArmInterface(const std::string &arm_name, double loop_hz)
     : arm_name_(arm_name),
-      loop_hz_(loop_hz)
+      loop_hz_(loop_hz),
+      joint_position_(NULL),
+      joint_velocity_(NULL),
+      joint_effort_(NULL)
   {};
 
   ~ArmInterface()
@@ -102,6 +109,7 @@ public:
 
   /**
    * \brief Initialice hardware interface
+   * \param state_block - takes this arm's joints, it is gathered from the joint states by the owner every cycle
    * \return false if an error occurred during initialization
    */
   virtual bool init(
@@ -110,16 +118,11 @@ public:
     hardware_interface::VelocityJointInterface& vj_interface,
     hardware_interface::PositionJointInterface& pj_interface,
     int* joint_mode,
+    ArmStateBlock& state_block,
     sensor_msgs::JointStateConstPtr state_msg
   )
   { return true; };
 
-  /**
-   * \brief Copy the joint state message into our hardware interface datastructures
-   */
-  virtual void read( sensor_msgs::JointStateConstPtr &state_msg )
-  {};
-
   /**
    * \brief Publish our hardware interface datastructures commands to Baxter hardware
    */
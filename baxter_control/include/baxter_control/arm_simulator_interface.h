@@ -87,6 +87,7 @@ public:
     hardware_interface::VelocityJointInterface& vj_interface,
     hardware_interface::PositionJointInterface& pj_interface,
     int* joint_mode,
+    ArmStateBlock& state_block,
     sensor_msgs::JointStateConstPtr state_msg
   );
 
@@ -102,11 +103,6 @@ public:
    */
   bool stateExpired();
 
-  /**
-   * \brief Copy the joint state message into our hardware interface datastructures
-   */
-  void read( sensor_msgs::JointStateConstPtr &state_msg );
-
   /**
    * \brief Publish our hardware interface datastructures commands to Baxter hardware
    */
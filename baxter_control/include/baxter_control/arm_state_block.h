@@ -0,0 +1,133 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Desc:   Joint states of both arms in contiguous blocks, gathered from the joint states message in one pass
+*/
+
+#ifndef BAXTER_CONTROL__ARM_STATE_BLOCK_
+#define BAXTER_CONTROL__ARM_STATE_BLOCK_
+
+// C++
+#include <algorithm>
+#include <vector>
+
+// Baxter
+#include <baxter_control/joint_state_snapshot.h>
+
+namespace baxter_control
+{
+
+/**
+ * \brief One position, one velocity and one effort block for the joints of all arms. Each arm takes a consecutive
+ *        range of joints at init, together with the index of each joint in the joint states message, and gather
+ *        fills the joints of all arms from one table in a single pass.
+ */
+class ArmStateBlock
+{
+public:
+
+  static const int NO_SOURCE = -1;
+
+  ArmStateBlock()
+    : num_joints_(0),
+      num_gathered_(0)
+  {
+    std::fill(position_, position_ + MAX_JOINT_STATE_JOINTS, 0.0);
+    std::fill(velocity_, velocity_ + MAX_JOINT_STATE_JOINTS, 0.0);
+    std::fill(effort_, effort_ + MAX_JOINT_STATE_JOINTS, 0.0);
+  }
+
+  /**
+   * \brief Take consecutive joints from the block
+   * \param sources - index of each joint in the joint states message, or NO_SOURCE for joints that are not read
+   *                  from the message
+   * \param first - set to the first joint taken
+   * \return false if the block is full
+   */
+  bool addJoints(const std::vector<int> &sources, std::size_t &first)
+  {
+    if (num_joints_ + sources.size() > MAX_JOINT_STATE_JOINTS)
+      return false;
+
+    first = num_joints_;
+    for (std::size_t i = 0; i < sources.size(); ++i)
+    {
+      const int joint = num_joints_++;
+      if (sources[i] == NO_SOURCE || sources[i] >= static_cast<int>(MAX_JOINT_STATE_JOINTS))
+        continue;
+
+      gather_source_[num_gathered_] = sources[i];
+      gather_joint_[num_gathered_] = joint;
+      ++num_gathered_;
+    }
+    return true;
+  }
+
+  /**
+   * \brief Copy the joint states of all arms out of a snapshot
+   */
+  void gather(const JointStateSnapshot &state)
+  {
+    for (std::size_t i = 0; i < num_gathered_; ++i)
+    {
+      const int source = gather_source_[i];
+      const int joint = gather_joint_[i];
+      position_[joint] = state.position[source];
+      velocity_[joint] = state.velocity[source];
+      effort_[joint] = state.effort[source];
+    }
+  }
+
+  double* position(std::size_t joint) { return position_ + joint; }
+  double* velocity(std::size_t joint) { return velocity_ + joint; }
+  double* effort(std::size_t joint) { return effort_ + joint; }
+
+  std::size_t getNumGathered() const { return num_gathered_; }
+
+private:
+
+  double position_[MAX_JOINT_STATE_JOINTS];
+  double velocity_[MAX_JOINT_STATE_JOINTS];
+  double effort_[MAX_JOINT_STATE_JOINTS];
+  std::size_t num_joints_;
+
+  // For each joint read from the message, its index in the message and in the block
+  int gather_source_[MAX_JOINT_STATE_JOINTS];
+  int gather_joint_[MAX_JOINT_STATE_JOINTS];
+  std::size_t num_gathered_;
+};
+
+} // namespace
+
+#endif
@@ -40,7 +40,9 @@
 #define BAXTER_CONTROL__BAXTER_HARDWARE_INTERFACE_
 
 // Boost
+#include <boost/scoped_ptr.hpp>
 #include <boost/shared_ptr.hpp>
+#include <boost/thread.hpp>
 
 // ROS
 #include <ros/ros.h>
@@ -57,6 +59,8 @@
 #include <baxter_control/arm_interface.h>
 #include <baxter_control/arm_hardware_interface.h>
 #include <baxter_control/arm_simulator_interface.h>
+#include <baxter_control/cycle_timing_monitor.h>
+#include <baxter_control/triple_buffer.h>
 
 namespace baxter_control
 {
@@ -76,6 +80,17 @@ private:
   ros::Duration elapsed_time_;
   double loop_hz_;
 
+  // Real-time control thread
+  boost::thread control_thread_;
+  int run_control_loop_; // cleared with __sync builtins to stop the thread
+  int realtime_priority_; // SCHED_FIFO priority, 0 keeps the default scheduler
+  int cpu_affinity_; // core to pin the control thread to, -1 to let it run anywhere
+  bool lock_memory_;
+
+  // Timing of the current cycle, handed to timing_monitor_ at the end of every cycle
+  CycleTiming cycle_timing_;
+  boost::scoped_ptr<CycleTimingMonitor> timing_monitor_;
+
   // Interfaces
   hardware_interface::JointStateInterface    js_interface_;
   hardware_interface::JointModeInterface     jm_interface_;
@@ -90,18 +105,18 @@ private:
   ArmInterfacePtr right_arm_hw_;
   ArmInterfacePtr left_arm_hw_;
 
-  boost::shared_ptr<controller_manager::ControllerManager> controller_manager_;
+  // Joint states of both arms, gathered from state_buffer_ in one pass every cycle
+  ArmStateBlock arm_state_;
 
-  ros::Timer non_realtime_loop_;
+  boost::shared_ptr<controller_manager::ControllerManager> controller_manager_;
 
   bool in_simulation_;
 
   // Which joint mode are we in
   int joint_mode_;
 
-  // Buffer of joint states to share between arms
-  sensor_msgs::JointStateConstPtr state_msg_;
-  ros::Time state_msg_timestamp_;
+  // Latest joint states shared between arms, written by the subscriber and read by the control thread without locking
+  TripleBuffer<JointStateSnapshot> state_buffer_;
 
   // Subscriber
   ros::Subscriber sub_joint_state_;
@@ -115,14 +130,34 @@ public:
   ~BaxterHardwareInterface();
 
   /**
-   * \brief Checks if the state message from Baxter is out of date
+   * \brief Checks if the state message from Baxter is out of date. Runs on the control thread, so it does not log,
+   *        CycleTimingMonitor warns about the expired cycles.
+   * \param state_age - seconds since the joint states in use were received, negative if there were none
    * \return true if expired
    */
-  bool stateExpired();
+  bool stateExpired(double state_age) const;
 
   void stateCallback(const sensor_msgs::JointStateConstPtr& msg);
 
-  void update(const ros::TimerEvent& e);
+  /**
+   * \brief Runs one read, control and write cycle of both arms
+   * \param time - the time of this cycle
+   * \param elapsed_time - the time since the last cycle
+   */
+  void update(const ros::Time& time, const ros::Duration& elapsed_time);
+
+private:
+
+  /**
+   * \brief Body of the control thread, calls update at loop_hz on absolute deadlines until the destructor stops it
+   */
+  void controlLoop();
+
+  /**
+   * \brief Locks memory and applies the scheduling priority and cpu affinity to the calling thread. Failures are
+   *        logged and the loop continues with the default settings.
+   */
+  void configureRealtimeThread();
 
 };
 
@@ -0,0 +1,128 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Desc:   Fixed size statistics of the timing of a periodic loop, safe to update from a real-time thread
+*/
+
+#ifndef BAXTER_CONTROL__CYCLE_STATISTICS_
+#define BAXTER_CONTROL__CYCLE_STATISTICS_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace baxter_control
+{
+
+// By default 5 us buckets cover wake-up latencies up to 2 ms, a full period at 500 Hz
+static const int CYCLE_STATISTICS_NUM_BUCKETS = 400;
+static const double CYCLE_STATISTICS_BUCKET_WIDTH = 5e-6; // seconds
+
+/**
+ * \brief Count, extremes, mean and histogram of a series of durations in seconds. Adding a sample never allocates,
+ *        so it can be used inside the control loop, and the whole struct can be copied to hand a window to a
+ *        non real-time thread for logging.
+ */
+struct CycleStatistics
+{
+  double bucket_width; // seconds
+  unsigned long count;
+  double min;
+  double max;
+  double sum;
+  double sum_squares;
+  unsigned int histogram[CYCLE_STATISTICS_NUM_BUCKETS + 1]; // the last bucket holds everything beyond the range
+
+  explicit CycleStatistics(double width = CYCLE_STATISTICS_BUCKET_WIDTH)
+    : bucket_width(width)
+  {
+    reset();
+  }
+
+  void reset()
+  {
+    count = 0;
+    min = std::numeric_limits<double>::max();
+    max = 0.0;
+    sum = 0.0;
+    sum_squares = 0.0;
+    std::fill(histogram, histogram + CYCLE_STATISTICS_NUM_BUCKETS + 1, 0);
+  }
+
+  void add(double sample)
+  {
+    ++count;
+    min = std::min(min, sample);
+    max = std::max(max, sample);
+    sum += sample;
+    sum_squares += sample * sample;
+    const int bucket = static_cast<int>(std::max(sample, 0.0) / bucket_width);
+    ++histogram[std::min(bucket, CYCLE_STATISTICS_NUM_BUCKETS)];
+  }
+
+  double mean() const
+  {
+    return count ? sum / count : 0.0;
+  }
+
+  double stddev() const
+  {
+    if (!count)
+      return 0.0;
+    const double m = mean();
+    return std::sqrt(std::max(sum_squares / count - m * m, 0.0));
+  }
+
+  /**
+   * \brief Upper bound of the given fraction of the samples, at the resolution of the histogram
+   * \param fraction - between 0 and 1, e.g. 0.99 for the 99th percentile
+   * \return seconds, or max when the percentile falls into the overflow bucket
+   */
+  double percentile(double fraction) const
+  {
+    const double target = fraction * count;
+    unsigned long seen = 0;
+    for (int i = 0; i < CYCLE_STATISTICS_NUM_BUCKETS; ++i)
+    {
+      seen += histogram[i];
+      if (seen >= target)
+        return std::min((i + 1) * bucket_width, max);
+    }
+    return max;
+  }
+};
+
+} // namespace
+
+#endif
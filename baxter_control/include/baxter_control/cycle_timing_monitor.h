@@ -0,0 +1,149 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Desc:   Collects the timing of every control loop cycle and reports it on /diagnostics
+*/
+
+#ifndef BAXTER_CONTROL__CYCLE_TIMING_MONITOR_
+#define BAXTER_CONTROL__CYCLE_TIMING_MONITOR_
+
+// Boost
+#include <boost/thread.hpp>
+
+// ROS
+#include <ros/ros.h>
+#include <std_srvs/Empty.h>
+
+// Baxter
+#include <baxter_control/cycle_statistics.h>
+#include <baxter_control/ring_buffer.h>
+
+namespace baxter_control
+{
+
+/**
+ * \brief Timing of one control loop cycle, in seconds
+ */
+struct CycleTiming
+{
+  double wake_time; // since the control loop started
+  double period; // since the previous wake-up
+  double jitter; // wake-up latency after the deadline
+  double read;
+  double update; // controller_manager
+  double write;
+  double state_age; // age of the joint states used by the cycle, negative if there were none
+  bool overrun; // the cycle ran past the next deadline
+  bool state_expired; // the joint states were missing or too old, the cycle skipped read, update and write
+};
+
+/**
+ * \brief Receives a CycleTiming from the control loop every cycle through a lock-free ring buffer. A background thread
+ *        keeps a window of statistics and a history of the records, it logs the statistics and publishes them on
+ *        /diagnostics once per report period. The dump_cycle_timing service writes the history to a csv file. The
+ *        warning about expired joint states is also logged here, so the control loop never logs.
+ */
+class CycleTimingMonitor
+{
+public:
+
+  /**
+   * \brief Reads its parameters from nh_private and starts the background thread
+   * \param loop_hz - rate of the control loop, sizes the queue and the histograms
+   */
+  CycleTimingMonitor(ros::NodeHandle &nh, ros::NodeHandle &nh_private, double loop_hz);
+  ~CycleTimingMonitor();
+
+  /**
+   * \brief Hand over the timing of a cycle, safe to call from the control loop
+   */
+  void record(const CycleTiming &timing)
+  {
+    if (!queue_.push(timing))
+      __sync_fetch_and_add(&num_dropped_, 1);
+  }
+
+  /**
+   * \brief Write the history of cycles to the dump file
+   */
+  bool dumpCycleTiming(std_srvs::Empty::Request &req, std_srvs::Empty::Response &res);
+
+private:
+
+  void monitorLoop();
+
+  void addToWindow(const CycleTiming &timing);
+
+  void report();
+
+  void warnStateExpired();
+
+  double loop_hz_;
+  double report_period_;
+  std::string dump_file_;
+
+  RingBuffer<CycleTiming> queue_;
+  unsigned long num_dropped_; // records the queue had no room for
+
+  // Statistics of the current report period, only used by the background thread
+  CycleStatistics period_;
+  CycleStatistics jitter_;
+  CycleStatistics read_;
+  CycleStatistics update_;
+  CycleStatistics write_;
+  CycleStatistics state_age_;
+  unsigned long num_overruns_;
+  unsigned long num_expired_;
+
+  // Cycles with expired joint states since the last warning
+  unsigned long num_expired_unwarned_;
+  double last_expired_state_age_;
+  ros::WallTime last_expired_warning_;
+
+  // The latest cycles, oldest first from history_next_ on
+  std::vector<CycleTiming> history_;
+  std::size_t history_next_;
+  std::size_t history_size_;
+  boost::mutex history_mutex_;
+
+  ros::Publisher diagnostics_pub_;
+  ros::ServiceServer dump_server_;
+
+  boost::thread thread_;
+  int running_;
+};
+
+} // namespace
+
+#endif
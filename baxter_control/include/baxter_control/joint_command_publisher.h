@@ -0,0 +1,161 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Desc:   Publishes Baxter joint commands from the control loop without allocating
+*/
+
+#ifndef BAXTER_CONTROL__JOINT_COMMAND_PUBLISHER_
+#define BAXTER_CONTROL__JOINT_COMMAND_PUBLISHER_
+
+// C++
+#include <cstring>
+#include <semaphore.h>
+
+// Boost
+#include <boost/cstdint.hpp>
+#include <boost/thread.hpp>
+
+// ROS
+#include <ros/ros.h>
+
+// Baxter
+#include <baxter_core_msgs/JointCommand.h>
+#include <baxter_control/triple_buffer.h>
+
+namespace baxter_control
+{
+
+static const std::size_t MAX_SERIALIZED_JOINT_COMMAND = 1024;
+
+/**
+ * \brief A baxter_core_msgs/JointCommand that is already serialized. roscpp publishes it as a JointCommand by copying
+ *        the bytes, so the joint names are encoded once instead of on every publish.
+ */
+struct SerializedJointCommand
+{
+  boost::uint32_t size;
+  boost::uint8_t data[MAX_SERIALIZED_JOINT_COMMAND];
+};
+
+/**
+ * \brief Sends the commands of one arm. The message with the joint names is serialized once at init, the control loop
+ *        only patches the mode and the command values into a copy and hands it to a publishing thread, so the
+ *        allocations of serializing and queueing the message never happen on the control thread.
+ */
+class JointCommandPublisher
+{
+public:
+
+  JointCommandPublisher();
+  ~JointCommandPublisher();
+
+  /**
+   * \brief Advertise the topic, serialize the message with the joint names and start the publishing thread
+   * \return false if the message does not fit into SerializedJointCommand
+   */
+  bool init(ros::NodeHandle &nh, const std::string &topic, const std::vector<std::string> &joint_names);
+
+  /**
+   * \brief Publish a command, safe to call from the control loop. If the publishing thread is still busy with the
+   *        previous command, only the latest one is sent.
+   * \param mode - a baxter_core_msgs::JointCommand mode
+   * \param command - one value per joint
+   */
+  void publish(boost::int32_t mode, const double *command);
+
+private:
+
+  void publishLoop();
+
+  ros::Publisher pub_;
+  std::size_t num_joints_;
+
+  TripleBuffer<SerializedJointCommand> buffer_;
+  sem_t pending_; // posted by publish for every command
+  boost::thread thread_;
+  int running_;
+};
+
+} // namespace
+
+namespace ros
+{
+namespace message_traits
+{
+
+template<>
+struct MD5Sum<baxter_control::SerializedJointCommand>
+{
+  static const char* value() { return MD5Sum<baxter_core_msgs::JointCommand>::value(); }
+  static const char* value(const baxter_control::SerializedJointCommand&) { return value(); }
+};
+
+template<>
+struct DataType<baxter_control::SerializedJointCommand>
+{
+  static const char* value() { return DataType<baxter_core_msgs::JointCommand>::value(); }
+  static const char* value(const baxter_control::SerializedJointCommand&) { return value(); }
+};
+
+template<>
+struct Definition<baxter_control::SerializedJointCommand>
+{
+  static const char* value() { return Definition<baxter_core_msgs::JointCommand>::value(); }
+  static const char* value(const baxter_control::SerializedJointCommand&) { return value(); }
+};
+
+} // namespace
+
+namespace serialization
+{
+
+template<>
+struct Serializer<baxter_control::SerializedJointCommand>
+{
+  template<typename Stream>
+  inline static void write(Stream& stream, const baxter_control::SerializedJointCommand& m)
+  {
+    std::memcpy(stream.advance(m.size), m.data, m.size);
+  }
+
+  inline static boost::uint32_t serializedLength(const baxter_control::SerializedJointCommand& m)
+  {
+    return m.size;
+  }
+};
+
+} // namespace
+} // namespace
+
+#endif
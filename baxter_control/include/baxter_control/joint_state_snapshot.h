@@ -0,0 +1,97 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Desc:   Fixed size copy of a joint states message for the control loop
+*/
+
+#ifndef BAXTER_CONTROL__JOINT_STATE_SNAPSHOT_
+#define BAXTER_CONTROL__JOINT_STATE_SNAPSHOT_
+
+// C++
+#include <algorithm>
+
+// ROS
+#include <ros/ros.h>
+#include <sensor_msgs/JointState.h>
+
+namespace baxter_control
+{
+
+static const std::size_t MAX_JOINT_STATE_JOINTS = 32;
+
+/**
+ * \brief The positions, velocities and efforts of a joint states message in its joint order, with the time it was
+ *        received. Fixed size, so it can be handed to the control loop without allocating.
+ */
+struct JointStateSnapshot
+{
+  ros::Time receive_time;
+  std::size_t num_joints;
+  double position[MAX_JOINT_STATE_JOINTS];
+  double velocity[MAX_JOINT_STATE_JOINTS];
+  double effort[MAX_JOINT_STATE_JOINTS];
+
+  JointStateSnapshot()
+    : num_joints(0)
+  {
+    std::fill(position, position + MAX_JOINT_STATE_JOINTS, 0.0);
+    std::fill(velocity, velocity + MAX_JOINT_STATE_JOINTS, 0.0);
+    std::fill(effort, effort + MAX_JOINT_STATE_JOINTS, 0.0);
+  }
+
+  /**
+   * \brief Copy the values of msg, missing values are set to zero
+   */
+  void fromMsg(const sensor_msgs::JointState &msg, const ros::Time &time)
+  {
+    receive_time = time;
+    num_joints = std::min(msg.name.size(), MAX_JOINT_STATE_JOINTS);
+    copyValues(msg.position, position);
+    copyValues(msg.velocity, velocity);
+    copyValues(msg.effort, effort);
+  }
+
+private:
+
+  void copyValues(const std::vector<double> &from, double *to)
+  {
+    const std::size_t n = std::min(from.size(), num_joints);
+    std::copy(from.begin(), from.begin() + n, to);
+    std::fill(to + n, to + num_joints, 0.0);
+  }
+};
+
+} // namespace
+
+#endif
@@ -0,0 +1,103 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Desc:   Lock-free single producer, single consumer queue for handing records out of a real-time thread
+*/
+
+#ifndef BAXTER_CONTROL__RING_BUFFER_
+#define BAXTER_CONTROL__RING_BUFFER_
+
+#include <vector>
+
+namespace baxter_control
+{
+
+/**
+ * \brief Fixed capacity queue, the storage is allocated once by the constructor. Pushing never blocks or allocates,
+ *        a full queue rejects the value instead. Only one thread may push and only one thread may pop.
+ */
+template <class T>
+class RingBuffer
+{
+public:
+
+  explicit RingBuffer(std::size_t capacity)
+    : buffer_(capacity + 1), // one slot stays empty to tell a full queue from an empty one
+      head_(0),
+      tail_(0)
+  {
+  }
+
+  /**
+   * \brief Append a value, called by the producer
+   * \return false if the queue is full
+   */
+  bool push(const T& value)
+  {
+    const std::size_t head = head_;
+    const std::size_t next = (head + 1) % buffer_.size();
+    if (next == __sync_fetch_and_add(&tail_, 0))
+      return false;
+
+    buffer_[head] = value;
+    // The compare and swap is a full barrier, so the value is visible before the consumer sees the new head
+    __sync_bool_compare_and_swap(&head_, head, next);
+    return true;
+  }
+
+  /**
+   * \brief Take the oldest value, called by the consumer
+   * \return false if the queue is empty
+   */
+  bool pop(T& value)
+  {
+    const std::size_t tail = tail_;
+    if (tail == __sync_fetch_and_add(&head_, 0))
+      return false;
+
+    value = buffer_[tail];
+    __sync_bool_compare_and_swap(&tail_, tail, (tail + 1) % buffer_.size());
+    return true;
+  }
+
+private:
+
+  std::vector<T> buffer_;
+  std::size_t head_; // next slot to push, only written by the producer
+  std::size_t tail_; // next slot to pop, only written by the consumer
+};
+
+} // namespace
+
+#endif
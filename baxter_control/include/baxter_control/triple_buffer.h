@@ -0,0 +1,136 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Desc:   Lock-free single producer, single consumer triple buffer for handing the latest value to a real-time thread
+*/
+
+#ifndef BAXTER_CONTROL__TRIPLE_BUFFER_
+#define BAXTER_CONTROL__TRIPLE_BUFFER_
+
+namespace baxter_control
+{
+
+/**
+ * \brief Three copies of T: the writer fills the back copy, the reader owns the front copy and the middle copy is the
+ *        latest complete value. Publishing and reading swap an index with the middle one, so neither side ever
+ *        waits on the other and the reader always sees a value the writer finished. Only one thread may write and
+ *        only one thread may read.
+ */
+template <class T>
+class TripleBuffer
+{
+public:
+
+  TripleBuffer()
+    : back_(0),
+      middle_(1),
+      front_(2)
+  {
+  }
+
+  /**
+   * \brief Sets all three copies, for values where the writer only updates some fields. Not thread safe, call it
+   *        before the writer and the reader start.
+   */
+  void reset(const T& value)
+  {
+    for (int i = 0; i < 3; ++i)
+      buffers_[i] = value;
+    __sync_fetch_and_and(&middle_, INDEX_MASK);
+  }
+
+  /**
+   * \brief The copy the writer fills before calling publish
+   */
+  T& back()
+  {
+    return buffers_[back_];
+  }
+
+  /**
+   * \brief Makes the back copy the latest value, the writer continues on the previous middle copy
+   */
+  void publish()
+  {
+    back_ = exchangeMiddle(back_ | FRESH) & INDEX_MASK;
+  }
+
+  /**
+   * \brief Takes the latest value if the writer published one since the last call
+   * \return true if front changed
+   */
+  bool update()
+  {
+    if (!(__sync_fetch_and_add(&middle_, 0) & FRESH))
+      return false;
+    front_ = exchangeMiddle(front_) & INDEX_MASK;
+    return true;
+  }
+
+  /**
+   * \brief The copy owned by the reader, valid until its next call to update
+   */
+  const T& front() const
+  {
+    return buffers_[front_];
+  }
+
+private:
+
+  // The middle index carries a flag telling the reader the writer published since the reader last swapped
+  static const int INDEX_MASK = 3;
+  static const int FRESH = 4;
+
+  int exchangeMiddle(int value)
+  {
+    // The compare and swap is a full barrier, so the copy written before publish is visible to the reader
+    int expected = middle_;
+    while (true)
+    {
+      const int seen = __sync_val_compare_and_swap(&middle_, expected, value);
+      if (seen == expected)
+        return seen;
+      expected = seen;
+    }
+  }
+
+  T buffers_[3];
+  int back_; // only used by the writer
+  int middle_; // shared
+  int front_; // only used by the reader
+};
+
+} // namespace
+
+#endif
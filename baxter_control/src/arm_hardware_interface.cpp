@@ -56,22 +56,14 @@ ArmHardwareInterface::ArmHardwareInterface(const std::string &arm_name, double l
   n_dof_ = joint_names_.size();
 
   // Resize vectors
-  joint_position_.resize(n_dof_);
-  joint_velocity_.resize(n_dof_);
-  joint_effort_.resize(n_dof_);
   joint_position_command_.resize(n_dof_);
   joint_effort_command_.resize(n_dof_);
   joint_velocity_command_.resize(n_dof_);
-  output_msg_.command.resize(n_dof_);
-  output_msg_.names.resize(n_dof_);
   trajectory_command_msg_.joint_names.resize(n_dof_);
   joint_id_to_joint_states_id_.resize(n_dof_);
 
   for (std::size_t i = 0; i < n_dof_; ++i)
   {
-    joint_position_[i] = 0.0;
-    joint_velocity_[i] = 0.0;
-    joint_effort_[i] = 0.0;
     joint_position_command_[i] = 0.0;
     joint_effort_command_[i] = 0.0;
     joint_velocity_command_[i] = 0.0;
@@ -100,10 +92,37 @@ bool ArmHardwareInterface::init(
   hardware_interface::VelocityJointInterface& vj_interface,
   hardware_interface::PositionJointInterface& pj_interface,
   int* joint_mode,
+  ArmStateBlock& state_block,
   sensor_msgs::JointStateConstPtr state_msg)
 {
   joint_mode_ = joint_mode;
 
+  // Make a mapping of joint names to indexes in the joint_states message
+  for (std::size_t i = 0; i < n_dof_; ++i)
+  {
+    std::vector<std::string>::const_iterator iter = std::find(state_msg->name.begin(), state_msg->name.end(), joint_names_[i]);
+    size_t joint_states_id = std::distance(state_msg->name.begin(), iter);
+    if(joint_states_id == state_msg->name.size())
+    {
+      ROS_ERROR_STREAM_NAMED(arm_name_,"Unable to find joint " << i << " named " << joint_names_[i] << " in joint state message");
+    }
+
+    joint_id_to_joint_states_id_[i] = joint_states_id;
+
+    ROS_DEBUG_STREAM_NAMED("arm_hardware_interface","Found joint " << i << " at " << joint_states_id << " named " << joint_names_[i]);
+  }
+
+  // Our joint states are gathered from the joint_states message by the owner of the state block with this mapping
+  std::size_t first_joint;
+  if (!state_block.addJoints(joint_id_to_joint_states_id_, first_joint))
+  {
+    ROS_ERROR_STREAM_NAMED(arm_name_,"No room for " << n_dof_ << " joints in the state block");
+    return false;
+  }
+  joint_position_ = state_block.position(first_joint);
+  joint_velocity_ = state_block.velocity(first_joint);
+  joint_effort_ = state_block.effort(first_joint);
+
   for (std::size_t i = 0; i < n_dof_; ++i)
   {
     // Create joint state interface for all joints
@@ -123,9 +142,9 @@ bool ArmHardwareInterface::init(
         js_interface.getHandle(joint_names_[i]),&joint_effort_command_[i]));
   }
 
-  // Start publishers
-  pub_joint_command_ = nh_.advertise<baxter_core_msgs::JointCommand>("/robot/limb/"+arm_name_+
-                       "/joint_command",10);
+  // Start publishers, the joint names are serialized into the joint command just once
+  if (!pub_joint_command_.init(nh_, "/robot/limb/"+arm_name_+"/joint_command", joint_names_))
+    return false;
 
   pub_trajectory_command_ = nh_.advertise<trajectory_msgs::JointTrajectory>("/robot/"+arm_name_+
                             "_trajectory_controller/command",10);
@@ -135,67 +154,31 @@ bool ArmHardwareInterface::init(
                        arm_name_ + "_lower_cuff/state",
                        1, &ArmHardwareInterface::cuffSqueezedCallback, this);
 
-  // Make a mapping of joint names to indexes in the joint_states message
-  for (std::size_t i = 0; i < n_dof_; ++i)
-  {
-    std::vector<std::string>::const_iterator iter = std::find(state_msg->name.begin(), state_msg->name.end(), joint_names_[i]);
-    size_t joint_states_id = std::distance(state_msg->name.begin(), iter);
-    if(joint_states_id == state_msg->name.size())
-    {
-      ROS_ERROR_STREAM_NAMED(arm_name_,"Unable to find joint " << i << " named " << joint_names_[i] << " in joint state message");
-    }
-
-    joint_id_to_joint_states_id_[i] = joint_states_id;
-
-    ROS_DEBUG_STREAM_NAMED("arm_hardware_interface","Found joint " << i << " at " << joint_states_id << " named " << joint_names_[i]);
-  }
-
   // Set the initial command values based on current state
   for (std::size_t i = 0; i < n_dof_; ++i)
   {
     joint_position_command_[i] = state_msg->position[joint_id_to_joint_states_id_[i]];
-
-    // Pre-load the joint names into the output messages just once
-    output_msg_.names[i] = joint_names_[i];
   }
 
   ROS_INFO_NAMED(arm_name_, "Loaded baxter_hardware_interface.");
   return true;
 }
 
-void ArmHardwareInterface::read( sensor_msgs::JointStateConstPtr &state_msg )
-{
-  // Copy state message to our datastructures
-  for (std::size_t i = 0; i < n_dof_; ++i)
-  {
-    //ROS_INFO_STREAM_NAMED("arm_hardware_interface","Joint " << i << "("<< joint_names_[i] << ") -> " << joint_id_to_joint_states_id_[i] << " position= " << state_msg->position[joint_id_to_joint_states_id_[i]]);
-    joint_position_[i] = state_msg->position[joint_id_to_joint_states_id_[i]];
-    joint_velocity_[i] = state_msg->velocity[joint_id_to_joint_states_id_[i]];
-    joint_effort_[i] = state_msg->effort[joint_id_to_joint_states_id_[i]];
-  }
-}
-
 void ArmHardwareInterface::write(ros::Duration elapsed_time)
 {
   // Send commands to baxter in different modes
   switch (*joint_mode_)
   {
     case hardware_interface::MODE_POSITION:
-      output_msg_.command = joint_position_command_;
-      output_msg_.mode = baxter_core_msgs::JointCommand::POSITION_MODE;
+      pub_joint_command_.publish(baxter_core_msgs::JointCommand::POSITION_MODE, &joint_position_command_[0]);
       break;
     case hardware_interface::MODE_VELOCITY:
-      output_msg_.command = joint_velocity_command_;
-      output_msg_.mode = baxter_core_msgs::JointCommand::VELOCITY_MODE;
+      pub_joint_command_.publish(baxter_core_msgs::JointCommand::VELOCITY_MODE, &joint_velocity_command_[0]);
       break;
     case hardware_interface::MODE_EFFORT:
-      output_msg_.command = joint_effort_command_;
-      output_msg_.mode = baxter_core_msgs::JointCommand::TORQUE_MODE;
+      pub_joint_command_.publish(baxter_core_msgs::JointCommand::TORQUE_MODE, &joint_effort_command_[0]);
       break;
   }
-
-  // Publish
-  pub_joint_command_.publish(output_msg_);
 }
 
 void ArmHardwareInterface::cuffSqueezedCallback(const baxter_core_msgs::DigitalIOStateConstPtr& msg)
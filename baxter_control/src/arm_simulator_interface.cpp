@@ -61,12 +61,36 @@ ArmSimulatorInterface::ArmSimulatorInterface(const std::string &arm_name, double
   n_dof_ = joint_names_.size();
 
   // Resize vectors
-  joint_position_.resize(n_dof_);
-  joint_velocity_.resize(n_dof_);
-  joint_effort_.resize(n_dof_);
   joint_position_command_.resize(n_dof_);
   joint_effort_command_.resize(n_dof_);
   joint_velocity_command_.resize(n_dof_);
+}
+
+ArmSimulatorInterface::~ArmSimulatorInterface()
+{
+}
+
+bool ArmSimulatorInterface::init(
+  hardware_interface::JointStateInterface&    js_interface,
+  hardware_interface::EffortJointInterface&   ej_interface,
+  hardware_interface::VelocityJointInterface& vj_interface,
+  hardware_interface::PositionJointInterface& pj_interface,
+  int* joint_mode,
+  ArmStateBlock& state_block,
+  sensor_msgs::JointStateConstPtr state_msg)
+{
+  joint_mode_ = joint_mode;
+
+  // Our joint states are simulated, none of them are gathered from a joint_states message
+  std::size_t first_joint;
+  if (!state_block.addJoints(std::vector<int>(n_dof_, ArmStateBlock::NO_SOURCE), first_joint))
+  {
+    ROS_ERROR_STREAM_NAMED(arm_name_,"No room for " << n_dof_ << " joints in the state block");
+    return false;
+  }
+  joint_position_ = state_block.position(first_joint);
+  joint_velocity_ = state_block.velocity(first_joint);
+  joint_effort_ = state_block.effort(first_joint);
 
   // Start arms in gravity-neutral position
   joint_position_[0] = -0.00123203;
@@ -90,22 +114,6 @@ ArmSimulatorInterface::ArmSimulatorInterface(const std::string &arm_name, double
     joint_velocity_command_[i] = 0.0;
   }
 
-}
-
-ArmSimulatorInterface::~ArmSimulatorInterface()
-{
-}
-
-bool ArmSimulatorInterface::init(
-  hardware_interface::JointStateInterface&    js_interface,
-  hardware_interface::EffortJointInterface&   ej_interface,
-  hardware_interface::VelocityJointInterface& vj_interface,
-  hardware_interface::PositionJointInterface& pj_interface,
-  int* joint_mode,
-  sensor_msgs::JointStateConstPtr state_msg)
-{
-  joint_mode_ = joint_mode;
-
   for (std::size_t i = 0; i < n_dof_; ++i)
   {
     // Create joint state interface for all joints
@@ -129,11 +137,6 @@ bool ArmSimulatorInterface::init(
   return true;
 }
 
-void ArmSimulatorInterface::read( sensor_msgs::JointStateConstPtr &state_msg )
-{
-  // Not used for visualization
-}
-
 void ArmSimulatorInterface::write(ros::Duration elapsed_time)
 {
   // Convert to seconds
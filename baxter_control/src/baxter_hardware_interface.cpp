@@ -37,15 +37,56 @@
 */
 
 #include <baxter_control/baxter_hardware_interface.h>
+#include <ros/topic.h>
+
+// Real-time scheduling
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
 
 namespace baxter_control
 {
 
+namespace
+{
+
+const long NSEC_PER_SEC = 1000000000L;
+
+void addNanoseconds(timespec &t, long nsec)
+{
+  t.tv_sec += nsec / NSEC_PER_SEC;
+  t.tv_nsec += nsec % NSEC_PER_SEC;
+  if (t.tv_nsec >= NSEC_PER_SEC)
+  {
+    t.tv_nsec -= NSEC_PER_SEC;
+    ++t.tv_sec;
+  }
+}
+
+long nanosecondsBetween(const timespec &from, const timespec &to)
+{
+  return (to.tv_sec - from.tv_sec) * NSEC_PER_SEC + (to.tv_nsec - from.tv_nsec);
+}
+
+} // namespace
+
 BaxterHardwareInterface::BaxterHardwareInterface(bool in_simulation)
   : in_simulation_(in_simulation),
     joint_mode_(1),
-    loop_hz_(100)
+    loop_hz_(100),
+    run_control_loop_(1)
 {
+  // Rate and scheduling of the control thread. The arms scale their simulated dynamics by the loop rate, so read it
+  // before creating them.
+  ros::NodeHandle nh_private("~");
+  nh_private.param("loop_hz", loop_hz_, loop_hz_);
+  nh_private.param("realtime_priority", realtime_priority_, 80);
+  nh_private.param("cpu_affinity", cpu_affinity_, -1);
+  nh_private.param("lock_memory", lock_memory_, true);
+
   if( in_simulation_ )
   {
     ROS_INFO_STREAM_NAMED("hardware_interface","Running in simulation mode");
@@ -66,25 +107,24 @@ BaxterHardwareInterface::BaxterHardwareInterface(bool in_simulation)
   sub_joint_state_ = nh_.subscribe<sensor_msgs::JointState>("/robot/joint_states", 1,
                      &BaxterHardwareInterface::stateCallback, this);
 
-  // Wait for first state message to be recieved if we are not in simulation
+  // Wait for first state message to be recieved if we are not in simulation. The arms find their joints by the names
+  // in it, afterwards the control loop only takes the values from state_buffer_.
+  sensor_msgs::JointStateConstPtr state_msg;
   if (!in_simulation_)
   {
     // Loop until we find a joint_state message from Baxter
-    do
+    while (ros::ok() && (!state_msg || state_msg->name.size() != NUM_BAXTER_JOINTS))
     {
-      // Loop until we get our first joint_state message
-      while(ros::ok() && state_msg_timestamp_.toSec() == 0)
-      {
-        ROS_INFO_STREAM_NAMED("hardware_interface","Waiting for first state message to be recieved");
-        ros::spinOnce();
-        ros::Duration(0.25).sleep();
-      }
-    } while (state_msg_->name.size() != NUM_BAXTER_JOINTS);
+      ROS_INFO_STREAM_NAMED("hardware_interface","Waiting for first state message to be recieved");
+      state_msg = ros::topic::waitForMessage<sensor_msgs::JointState>("/robot/joint_states", nh_, ros::Duration(0.25));
+    }
   }
 
   // Initialize right arm
-  right_arm_hw_->init(js_interface_, ej_interface_, vj_interface_, pj_interface_, &joint_mode_, state_msg_);
-  left_arm_hw_->init(js_interface_, ej_interface_, vj_interface_, pj_interface_, &joint_mode_, state_msg_);
+  right_arm_hw_->init(js_interface_, ej_interface_, vj_interface_, pj_interface_, &joint_mode_, arm_state_, state_msg);
+  left_arm_hw_->init(js_interface_, ej_interface_, vj_interface_, pj_interface_, &joint_mode_, arm_state_, state_msg);
+  ROS_DEBUG_STREAM_NAMED("hardware_interface","Gathering " << arm_state_.getNumGathered()
+                         << " arm joints from the joint states");
 
   // Register interfaces
   registerInterface(&js_interface_);
@@ -117,28 +157,107 @@ BaxterHardwareInterface::BaxterHardwareInterface(bool in_simulation)
   ROS_DEBUG_STREAM_NAMED("hardware_interface","Loading controller_manager");
   controller_manager_.reset(new controller_manager::ControllerManager(this, nh_));
 
-  ros::Duration update_freq = ros::Duration(1.0/loop_hz_);
-  non_realtime_loop_ = nh_.createTimer(update_freq, &BaxterHardwareInterface::update, this);
+  // Reports the timing of the control loop on /diagnostics
+  timing_monitor_.reset(new CycleTimingMonitor(nh_, nh_private, loop_hz_));
+
+  // Run the control loop on its own thread so the callbacks on the spinner cannot delay it
+  control_thread_ = boost::thread(&BaxterHardwareInterface::controlLoop, this);
 
   ROS_INFO_NAMED("hardware_interface", "Loaded baxter_hardware_interface.");
 }
 
 BaxterHardwareInterface::~BaxterHardwareInterface()
 {
+  // Let the control thread finish its cycle before the monitor it reports to goes away
+  __sync_fetch_and_and(&run_control_loop_, 0);
+  control_thread_.join();
+  timing_monitor_.reset();
+
   //baxter_util_.disableBaxter();
 }
 
-bool BaxterHardwareInterface::stateExpired()
+void BaxterHardwareInterface::configureRealtimeThread()
 {
-  // Check that we have a non-expired state message
-  // \todo lower the expiration duration
-  if( ros::Time::now() > state_msg_timestamp_ + ros::Duration(STATE_EXPIRED_TIMEOUT)) // check that the message timestamp is no older than 1 second
+  // Keep every page the process has and will have in RAM, so the loop never waits on a page fault
+  if (lock_memory_ && mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
   {
+    ROS_WARN_STREAM_NAMED("hardware_interface","Unable to lock memory: " << strerror(errno));
+  }
 
-    ROS_WARN_STREAM_THROTTLE_NAMED(1,"hardware_interface","State expired. Last recieved state " << (ros::Time::now() - state_msg_timestamp_).toSec() << " seconds ago." );
-    return true;
+  if (cpu_affinity_ >= 0)
+  {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(cpu_affinity_, &cpu_set);
+    const int error = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (error)
+    {
+      ROS_WARN_STREAM_NAMED("hardware_interface","Unable to pin the control thread to cpu " << cpu_affinity_
+                            << ": " << strerror(error));
+    }
   }
-  return false;
+
+  if (realtime_priority_ > 0)
+  {
+    sched_param param;
+    param.sched_priority = realtime_priority_;
+    const int error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (error)
+    {
+      ROS_WARN_STREAM_NAMED("hardware_interface","Unable to give the control thread SCHED_FIFO priority "
+                            << realtime_priority_ << ": " << strerror(error) << ". Check the rtprio limit in "
+                            << "/etc/security/limits.conf, running with the default scheduler.");
+    }
+  }
+
+  ROS_INFO_STREAM_NAMED("hardware_interface","Control loop running at " << loop_hz_ << " Hz");
+}
+
+void BaxterHardwareInterface::controlLoop()
+{
+  configureRealtimeThread();
+
+  const long period = static_cast<long>(NSEC_PER_SEC / loop_hz_ + 0.5);
+
+  timespec start_time, deadline, wake_time, last_wake_time, done_time;
+  clock_gettime(CLOCK_MONOTONIC, &start_time);
+  deadline = start_time;
+  last_wake_time = start_time;
+
+  while (__sync_fetch_and_add(&run_control_loop_, 0) && ros::ok())
+  {
+    // Sleep until an absolute deadline, so the time spent in update does not make the loop drift
+    addNanoseconds(deadline, period);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR)
+    {
+    }
+    clock_gettime(CLOCK_MONOTONIC, &wake_time);
+
+    cycle_timing_.wake_time = nanosecondsBetween(start_time, wake_time) * 1e-9;
+    cycle_timing_.jitter = nanosecondsBetween(deadline, wake_time) * 1e-9;
+    cycle_timing_.period = nanosecondsBetween(last_wake_time, wake_time) * 1e-9;
+    elapsed_time_ = ros::Duration(cycle_timing_.period);
+    last_wake_time = wake_time;
+
+    update(ros::Time::now(), elapsed_time_);
+
+    // A cycle that ran past the next deadline skips the deadlines it missed instead of running late cycles back
+    // to back
+    clock_gettime(CLOCK_MONOTONIC, &done_time);
+    const long late = nanosecondsBetween(deadline, done_time);
+    cycle_timing_.overrun = late >= period;
+    if (cycle_timing_.overrun)
+      addNanoseconds(deadline, (late / period) * period);
+
+    timing_monitor_->record(cycle_timing_);
+  }
+}
+
+bool BaxterHardwareInterface::stateExpired(double state_age) const
+{
+  // Check that we have a non-expired state message
+  // \todo lower the expiration duration
+  return state_age < 0.0 || state_age > STATE_EXPIRED_TIMEOUT;
 }
 
 void BaxterHardwareInterface::stateCallback(const sensor_msgs::JointStateConstPtr& msg)
@@ -149,29 +268,46 @@ void BaxterHardwareInterface::stateCallback(const sensor_msgs::JointStateConstPt
     return;
   }
 
-  // Copy the latest message into a buffer
-  state_msg_ = msg;
-  state_msg_timestamp_ = ros::Time::now();
+  // Copy the latest message into the back buffer and hand it to the control loop. ROS does not run the callbacks of
+  // one subscriber concurrently, so this is the only writer.
+  state_buffer_.back().fromMsg(*msg, ros::Time::now());
+  state_buffer_.publish();
 }
 
-void BaxterHardwareInterface::update(const ros::TimerEvent& e)
+void BaxterHardwareInterface::update(const ros::Time& time, const ros::Duration& elapsed_time)
 {
+  // Take the latest joint states if the subscriber received new ones since the last cycle
+  state_buffer_.update();
+  const JointStateSnapshot &state = state_buffer_.front();
+  cycle_timing_.state_age = state.receive_time.isZero() ? -1.0 : (time - state.receive_time).toSec();
+
+  timespec phase_start, read_done, update_done, write_done;
+  clock_gettime(CLOCK_MONOTONIC, &phase_start);
+
   // Check if state msg from Baxter is expired
-  if( !in_simulation_ && stateExpired() )
+  cycle_timing_.state_expired = !in_simulation_ && stateExpired(cycle_timing_.state_age);
+  if( cycle_timing_.state_expired )
+  {
+    cycle_timing_.read = cycle_timing_.update = cycle_timing_.write = 0.0;
     return;
+  }
 
-  elapsed_time_ = ros::Duration(e.current_real - e.last_real);
-
-  // Input
-  right_arm_hw_->read(state_msg_);
-  left_arm_hw_->read(state_msg_);
+  // Input, both arms in one pass
+  arm_state_.gather(state);
+  clock_gettime(CLOCK_MONOTONIC, &read_done);
 
   // Control
-  controller_manager_->update(ros::Time::now(), elapsed_time_);
+  controller_manager_->update(time, elapsed_time);
+  clock_gettime(CLOCK_MONOTONIC, &update_done);
 
   // Output
-  right_arm_hw_->write(elapsed_time_);
-  left_arm_hw_->write(elapsed_time_);
+  right_arm_hw_->write(elapsed_time);
+  left_arm_hw_->write(elapsed_time);
+  clock_gettime(CLOCK_MONOTONIC, &write_done);
+
+  cycle_timing_.read = nanosecondsBetween(phase_start, read_done) * 1e-9;
+  cycle_timing_.update = nanosecondsBetween(read_done, update_done) * 1e-9;
+  cycle_timing_.write = nanosecondsBetween(update_done, write_done) * 1e-9;
 }
 
 } // namespace
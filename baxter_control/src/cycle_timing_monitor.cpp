@@ -0,0 +1,273 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Desc:   Collects the timing of every control loop cycle and reports it on /diagnostics
+*/
+
+#include <baxter_control/cycle_timing_monitor.h>
+
+#include <diagnostic_msgs/DiagnosticArray.h>
+
+#include <fstream>
+
+namespace baxter_control
+{
+
+namespace
+{
+
+// Interval at which the background thread empties the queue
+const double DRAIN_PERIOD = 0.1; // seconds
+
+// The joint states arrive at 100 Hz, 50 us buckets cover their age up to 20 ms
+const double STATE_AGE_BUCKET_WIDTH = 50e-6; // seconds
+
+// Minimum interval between two warnings about expired joint states
+const double STATE_EXPIRED_WARNING_PERIOD = 1.0; // seconds
+
+void addValue(diagnostic_msgs::DiagnosticStatus &status, const std::string &key, double value)
+{
+  diagnostic_msgs::KeyValue key_value;
+  key_value.key = key;
+  std::stringstream value_stream;
+  value_stream << value;
+  key_value.value = value_stream.str();
+  status.values.push_back(key_value);
+}
+
+// Percentiles and extremes of one series in microseconds
+void addStatistics(diagnostic_msgs::DiagnosticStatus &status, const std::string &name, const CycleStatistics &stats)
+{
+  addValue(status, name + " p50 (us)", stats.percentile(0.5) * 1e6);
+  addValue(status, name + " p99 (us)", stats.percentile(0.99) * 1e6);
+  addValue(status, name + " max (us)", stats.max * 1e6);
+  addValue(status, name + " mean (us)", stats.mean() * 1e6);
+}
+
+} // namespace
+
+CycleTimingMonitor::CycleTimingMonitor(ros::NodeHandle &nh, ros::NodeHandle &nh_private, double loop_hz)
+  : loop_hz_(loop_hz),
+    queue_(std::max(1, static_cast<int>(loop_hz))), // a second of cycles, ten times what one drain takes
+    num_dropped_(0),
+    period_(2.0 / loop_hz / CYCLE_STATISTICS_NUM_BUCKETS), // up to two periods
+    state_age_(STATE_AGE_BUCKET_WIDTH),
+    num_overruns_(0),
+    num_expired_(0),
+    num_expired_unwarned_(0),
+    last_expired_state_age_(-1.0),
+    history_next_(0),
+    history_size_(0),
+    running_(1)
+{
+  int history_length;
+  nh_private.param("timing_report_period", report_period_, 10.0);
+  nh_private.param("timing_history", history_length, static_cast<int>(60 * loop_hz)); // a minute of cycles
+  nh_private.param("timing_dump_file", dump_file_, std::string("/tmp/baxter_cycle_timing.csv"));
+  history_.resize(std::max(history_length, 1));
+
+  diagnostics_pub_ = nh.advertise<diagnostic_msgs::DiagnosticArray>("/diagnostics", 1);
+  dump_server_ = nh_private.advertiseService("dump_cycle_timing", &CycleTimingMonitor::dumpCycleTiming, this);
+
+  thread_ = boost::thread(&CycleTimingMonitor::monitorLoop, this);
+}
+
+CycleTimingMonitor::~CycleTimingMonitor()
+{
+  __sync_fetch_and_and(&running_, 0);
+  thread_.join();
+}
+
+void CycleTimingMonitor::monitorLoop()
+{
+  ros::WallTime next_report = ros::WallTime::now() + ros::WallDuration(report_period_);
+  CycleTiming timing;
+
+  while (__sync_fetch_and_add(&running_, 0))
+  {
+    ros::WallDuration(DRAIN_PERIOD).sleep();
+
+    {
+      boost::mutex::scoped_lock lock(history_mutex_);
+      while (queue_.pop(timing))
+      {
+        addToWindow(timing);
+        history_[history_next_] = timing;
+        history_next_ = (history_next_ + 1) % history_.size();
+        history_size_ = std::min(history_size_ + 1, history_.size());
+      }
+    }
+
+    warnStateExpired();
+
+    if (ros::WallTime::now() >= next_report)
+    {
+      report();
+      next_report += ros::WallDuration(report_period_);
+    }
+  }
+}
+
+void CycleTimingMonitor::addToWindow(const CycleTiming &timing)
+{
+  period_.add(timing.period);
+  jitter_.add(timing.jitter);
+  read_.add(timing.read);
+  update_.add(timing.update);
+  write_.add(timing.write);
+  if (timing.state_age >= 0.0)
+    state_age_.add(timing.state_age);
+  if (timing.overrun)
+    ++num_overruns_;
+  if (timing.state_expired)
+  {
+    ++num_expired_;
+    ++num_expired_unwarned_;
+    last_expired_state_age_ = timing.state_age;
+  }
+}
+
+void CycleTimingMonitor::warnStateExpired()
+{
+  if (!num_expired_unwarned_)
+    return;
+
+  const ros::WallTime now = ros::WallTime::now();
+  if (now < last_expired_warning_ + ros::WallDuration(STATE_EXPIRED_WARNING_PERIOD))
+    return;
+
+  if (last_expired_state_age_ < 0.0)
+  {
+    ROS_WARN_STREAM_NAMED("hardware_interface","State expired. No state received yet, skipped "
+                          << num_expired_unwarned_ << " cycles.");
+  }
+  else
+  {
+    ROS_WARN_STREAM_NAMED("hardware_interface","State expired. Last recieved state " << last_expired_state_age_
+                          << " seconds ago, skipped " << num_expired_unwarned_ << " cycles.");
+  }
+  num_expired_unwarned_ = 0;
+  last_expired_warning_ = now;
+}
+
+void CycleTimingMonitor::report()
+{
+  const unsigned long num_dropped = __sync_fetch_and_and(&num_dropped_, 0);
+
+  std::stringstream summary;
+  summary << "Control loop at " << loop_hz_ << " Hz over " << period_.count << " cycles: wake-up jitter mean "
+          << jitter_.mean() * 1e6 << " us, 99% <= " << jitter_.percentile(0.99) * 1e6 << " us, max "
+          << jitter_.max * 1e6 << " us; read/update/write 99% <= " << read_.percentile(0.99) * 1e6 << "/"
+          << update_.percentile(0.99) * 1e6 << "/" << write_.percentile(0.99) * 1e6 << " us; "
+          << num_overruns_ << " overruns";
+  if (num_expired_)
+    summary << ", " << num_expired_ << " cycles with expired joint states";
+  if (num_dropped)
+    summary << ", " << num_dropped << " cycles not recorded";
+
+  diagnostic_msgs::DiagnosticArray diagnostics;
+  diagnostics.header.stamp = ros::Time::now();
+  diagnostics.status.resize(1);
+  diagnostic_msgs::DiagnosticStatus &status = diagnostics.status[0];
+  status.name = "baxter_hardware_interface: control loop";
+  status.hardware_id = "baxter";
+  status.level = (num_overruns_ || num_expired_ || num_dropped) ? diagnostic_msgs::DiagnosticStatus::WARN :
+    diagnostic_msgs::DiagnosticStatus::OK;
+  status.message = summary.str();
+  addValue(status, "cycles", period_.count);
+  addValue(status, "overruns", num_overruns_);
+  addValue(status, "state expired", num_expired_);
+  addValue(status, "not recorded", num_dropped);
+  addStatistics(status, "period", period_);
+  addStatistics(status, "jitter", jitter_);
+  addStatistics(status, "read", read_);
+  addStatistics(status, "update", update_);
+  addStatistics(status, "write", write_);
+  addStatistics(status, "state age", state_age_);
+  diagnostics_pub_.publish(diagnostics);
+
+  if (status.level == diagnostic_msgs::DiagnosticStatus::OK)
+  {
+    ROS_INFO_STREAM_NAMED("hardware_interface", summary.str());
+  }
+  else
+  {
+    ROS_WARN_STREAM_NAMED("hardware_interface", summary.str());
+  }
+
+  period_.reset();
+  jitter_.reset();
+  read_.reset();
+  update_.reset();
+  write_.reset();
+  state_age_.reset();
+  num_overruns_ = 0;
+  num_expired_ = 0;
+}
+
+bool CycleTimingMonitor::dumpCycleTiming(std_srvs::Empty::Request &req, std_srvs::Empty::Response &res)
+{
+  // Copy the history so the background thread is not held up while writing the file
+  std::vector<CycleTiming> cycles;
+  {
+    boost::mutex::scoped_lock lock(history_mutex_);
+    cycles.reserve(history_size_);
+    const std::size_t oldest = (history_next_ + history_.size() - history_size_) % history_.size();
+    for (std::size_t i = 0; i < history_size_; ++i)
+      cycles.push_back(history_[(oldest + i) % history_.size()]);
+  }
+
+  std::ofstream output_file;
+  output_file.open(dump_file_.c_str());
+  if (!output_file)
+  {
+    ROS_ERROR_STREAM_NAMED("hardware_interface","Unable to open " << dump_file_);
+    return false;
+  }
+
+  output_file.precision(9); // microsecond wake times for the first 1000 seconds of the run
+  output_file << "wake_time,period,jitter,read,update,write,state_age,overrun,state_expired" << std::endl;
+  for (std::size_t i = 0; i < cycles.size(); ++i)
+  {
+    const CycleTiming &timing = cycles[i];
+    output_file << timing.wake_time << "," << timing.period << "," << timing.jitter << "," << timing.read << ","
+                << timing.update << "," << timing.write << "," << timing.state_age << "," << timing.overrun << ","
+                << timing.state_expired << std::endl;
+  }
+  output_file.close();
+  ROS_INFO_STREAM_NAMED("hardware_interface","Wrote " << cycles.size() << " cycles to " << dump_file_);
+  return true;
+}
+
+} // namespace
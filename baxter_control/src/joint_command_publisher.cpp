@@ -0,0 +1,133 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Desc:   Publishes Baxter joint commands from the control loop without allocating
+*/
+
+#include <baxter_control/joint_command_publisher.h>
+
+#include <cerrno>
+
+namespace baxter_control
+{
+
+// A serialized JointCommand starts with the int32 mode, followed by the uint32 length of the command array and the
+// float64 values
+static const std::size_t MODE_OFFSET = 0;
+static const std::size_t COMMAND_LENGTH_OFFSET = sizeof(boost::int32_t);
+static const std::size_t COMMAND_OFFSET = COMMAND_LENGTH_OFFSET + sizeof(boost::uint32_t);
+
+JointCommandPublisher::JointCommandPublisher()
+  : num_joints_(0),
+    running_(0)
+{
+  sem_init(&pending_, 0, 0);
+}
+
+JointCommandPublisher::~JointCommandPublisher()
+{
+  if (__sync_fetch_and_and(&running_, 0))
+  {
+    sem_post(&pending_);
+    thread_.join();
+  }
+  sem_destroy(&pending_);
+}
+
+bool JointCommandPublisher::init(ros::NodeHandle &nh, const std::string &topic,
+                                 const std::vector<std::string> &joint_names)
+{
+  num_joints_ = joint_names.size();
+
+  baxter_core_msgs::JointCommand msg;
+  msg.mode = baxter_core_msgs::JointCommand::POSITION_MODE;
+  msg.command.resize(num_joints_, 0.0);
+  msg.names = joint_names;
+
+  SerializedJointCommand serialized;
+  serialized.size = ros::serialization::serializationLength(msg);
+  if (serialized.size > MAX_SERIALIZED_JOINT_COMMAND)
+  {
+    ROS_ERROR_STREAM_NAMED("joint_command_publisher","A joint command of " << serialized.size << " bytes does not fit "
+                           << "into the " << MAX_SERIALIZED_JOINT_COMMAND << " bytes of SerializedJointCommand");
+    return false;
+  }
+  ros::serialization::OStream stream(serialized.data, serialized.size);
+  ros::serialization::serialize(stream, msg);
+
+  // The values are patched in at fixed offsets, make sure the message still has the layout they assume
+  boost::uint32_t command_length;
+  std::memcpy(&command_length, serialized.data + COMMAND_LENGTH_OFFSET, sizeof(command_length));
+  if (command_length != num_joints_)
+  {
+    ROS_ERROR_STREAM_NAMED("joint_command_publisher","Unexpected layout of serialized baxter_core_msgs::JointCommand");
+    return false;
+  }
+  buffer_.reset(serialized);
+
+  pub_ = nh.advertise<SerializedJointCommand>(topic, 10);
+
+  running_ = 1;
+  thread_ = boost::thread(&JointCommandPublisher::publishLoop, this);
+  return true;
+}
+
+void JointCommandPublisher::publish(boost::int32_t mode, const double *command)
+{
+  SerializedJointCommand &serialized = buffer_.back();
+  std::memcpy(serialized.data + MODE_OFFSET, &mode, sizeof(mode));
+  std::memcpy(serialized.data + COMMAND_OFFSET, command, num_joints_ * sizeof(double));
+  buffer_.publish();
+
+  // Wakes the publishing thread without taking a lock
+  sem_post(&pending_);
+}
+
+void JointCommandPublisher::publishLoop()
+{
+  while (true)
+  {
+    while (sem_wait(&pending_) != 0 && errno == EINTR)
+    {
+    }
+    if (!__sync_fetch_and_add(&running_, 0))
+      break;
+
+    // Several posts may have piled up while publishing, the first of them takes the latest command
+    if (buffer_.update())
+      pub_.publish(buffer_.front());
+  }
+}
+
+} // namespace
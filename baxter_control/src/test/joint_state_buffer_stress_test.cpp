@@ -0,0 +1,165 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Desc:   Hammers the joint state triple buffer from a writer and a reader thread and checks the reader never sees a
+           torn or out of order snapshot
+*/
+
+// ROS
+#include <ros/ros.h>
+#include <sensor_msgs/JointState.h>
+
+// Boost
+#include <boost/thread.hpp>
+
+// Baxter
+#include <baxter_control/joint_state_snapshot.h>
+#include <baxter_control/triple_buffer.h>
+
+namespace baxter_control
+{
+
+typedef TripleBuffer<JointStateSnapshot> JointStateBuffer;
+
+// Every value of message number seq is derived from seq, so the reader can tell a snapshot mixes two messages
+double expectedPosition(double seq, std::size_t joint) { return seq + joint; }
+double expectedVelocity(double seq, std::size_t joint) { return -seq - joint; }
+double expectedEffort(double seq, std::size_t joint) { return seq * 0.5 + joint; }
+
+struct ReaderResult
+{
+  unsigned long num_reads;
+  unsigned long num_updates; // reads that got a newer snapshot
+  unsigned long num_torn;
+  unsigned long num_out_of_order;
+};
+
+// Publishes messages as fast as possible, like stateCallback does with each message from Baxter
+void runWriter(JointStateBuffer *buffer, std::size_t num_joints, volatile int *running, unsigned long *num_writes)
+{
+  sensor_msgs::JointState msg;
+  msg.name.resize(num_joints);
+  msg.position.resize(num_joints);
+  msg.velocity.resize(num_joints);
+  msg.effort.resize(num_joints);
+
+  unsigned long seq = 1;
+  while (__sync_fetch_and_add(running, 0))
+  {
+    for (std::size_t i = 0; i < num_joints; ++i)
+    {
+      msg.position[i] = expectedPosition(seq, i);
+      msg.velocity[i] = expectedVelocity(seq, i);
+      msg.effort[i] = expectedEffort(seq, i);
+    }
+    buffer->back().fromMsg(msg, ros::Time(seq));
+    buffer->publish();
+    ++seq;
+  }
+  *num_writes = seq - 1;
+}
+
+// Reads as fast as possible, like the control loop does every cycle
+void runReader(JointStateBuffer *buffer, volatile int *running, ReaderResult *result)
+{
+  result->num_reads = 0;
+  result->num_updates = 0;
+  result->num_torn = 0;
+  result->num_out_of_order = 0;
+
+  double last_seq = 0;
+  while (__sync_fetch_and_add(running, 0))
+  {
+    ++result->num_reads;
+    const bool updated = buffer->update();
+    const JointStateSnapshot &state = buffer->front();
+    const double seq = state.receive_time.toSec();
+    if (updated)
+    {
+      ++result->num_updates;
+      if (seq <= last_seq)
+        ++result->num_out_of_order;
+    }
+    last_seq = seq;
+
+    // The front copy must stay intact until the next update, so check it on every read and not only after updates.
+    // That also keeps the reader inside the check most of the time, where a writer running on the same core would
+    // show up.
+    for (std::size_t i = 0; i < state.num_joints; ++i)
+    {
+      if (state.position[i] != expectedPosition(seq, i) || state.velocity[i] != expectedVelocity(seq, i) ||
+          state.effort[i] != expectedEffort(seq, i))
+      {
+        ++result->num_torn;
+        break;
+      }
+    }
+  }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  ros::init(argc, argv, "joint_state_buffer_stress_test");
+  ros::NodeHandle nh("~");
+
+  double duration;
+  int num_joints;
+  nh.param("duration", duration, 10.0);
+  nh.param("num_joints", num_joints, 17);
+
+  baxter_control::JointStateBuffer buffer;
+  baxter_control::ReaderResult result;
+  unsigned long num_writes = 0;
+  volatile int running = 1;
+
+  boost::thread writer(boost::bind(&baxter_control::runWriter, &buffer, num_joints, &running, &num_writes));
+  boost::thread reader(boost::bind(&baxter_control::runReader, &buffer, &running, &result));
+  ros::WallDuration(duration).sleep();
+  __sync_fetch_and_and(&running, 0);
+  writer.join();
+  reader.join();
+
+  ROS_INFO_STREAM_NAMED("joint_state_buffer_stress_test", num_writes << " writes and " << result.num_reads
+                        << " reads in " << duration << " s, " << result.num_updates << " reads got a newer snapshot, "
+                        << result.num_torn << " torn, " << result.num_out_of_order << " out of order");
+
+  if (result.num_torn || result.num_out_of_order || !result.num_updates)
+  {
+    ROS_ERROR_STREAM_NAMED("joint_state_buffer_stress_test","The reader saw inconsistent joint states");
+    return 1;
+  }
+  return 0;
+}
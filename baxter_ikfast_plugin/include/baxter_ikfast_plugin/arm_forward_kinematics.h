@@ -0,0 +1,135 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+/* Desc:   Forward kinematics of every frame of a Baxter arm, for batches of joint vectors
+*/
+
+#ifndef BAXTER_IKFAST_PLUGIN__ARM_FORWARD_KINEMATICS_
+#define BAXTER_IKFAST_PLUGIN__ARM_FORWARD_KINEMATICS_
+
+#include <cmath>
+#include <cstddef>
+
+namespace baxter_ikfast_plugin
+{
+
+const int ARM_FK_NUM_JOINTS = 7;
+const int ARM_FK_NUM_FRAMES = 10;
+// Row major rotation followed by the translation, the layout of eerot and eetrans in ComputeFk
+const int ARM_FK_FRAME_SIZE = 12;
+
+// Frames after the arm mount in chain order, without the left_ or right_ prefix. The first
+// ARM_FK_NUM_JOINTS frames are the child links of the joints s0 s1 e0 e1 w0 w1 w2.
+const char* const ARM_FK_FRAME_NAMES[ARM_FK_NUM_FRAMES] = {
+  "upper_shoulder", "lower_shoulder", "upper_elbow", "lower_elbow", "upper_forearm",
+  "lower_forearm", "wrist", "hand", "gripper_base", "gripper"
+};
+
+struct ArmFKOrigin
+{
+  double rotation[9];
+  double translation[3];
+};
+
+// Joint origins relative to the parent frame, from the baxter.urdf the IKFast solver was generated from
+// (the rpy angles are multiples of pi/2, so the rotations are exact). Both arms are the same relative
+// to their mounts. The tip frame reproduces ComputeFk.
+const ArmFKOrigin ARM_FK_ORIGINS[ARM_FK_NUM_FRAMES] = {
+  {{1, 0, 0,  0, 1, 0,  0, 0, 1}, {0.055695, 0, 0.011038}}, // s0
+  {{1, 0, 0,  0, 0, 1,  0,-1, 0}, {0.069, 0, 0.27035}},     // s1
+  {{0, 0, 1,  1, 0, 0,  0, 1, 0}, {0.102, 0, 0}},           // e0
+  {{0, 1, 0,  0, 0, 1,  1, 0, 0}, {0.069, 0, 0.26242}},     // e1
+  {{0, 0, 1,  1, 0, 0,  0, 1, 0}, {0.10359, 0, 0}},         // w0
+  {{0, 1, 0,  0, 0, 1,  1, 0, 0}, {0.01, 0, 0.2707}},       // w1
+  {{0, 0, 1,  1, 0, 0,  0, 1, 0}, {0.115975, 0, 0}},        // w2
+  {{1, 0, 0,  0, 1, 0,  0, 0, 1}, {0, 0, 0.11355}},         // hand
+  {{1, 0, 0,  0, 1, 0,  0, 0, 1}, {0, 0, 0.025}},           // gripper_base
+  {{1, 0, 0,  0, 1, 0,  0, 0, 1}, {0, 0, 0.025}}            // gripper
+};
+
+/**
+ * @brief Poses of all ARM_FK_NUM_FRAMES frames relative to the arm mount, for num_configurations joint vectors
+ * in structure of arrays layout. Each frame is computed for the whole batch before the next one, so every
+ * inner loop streams through contiguous arrays and does not depend on the previous iteration.
+ * @param joints ARM_FK_NUM_JOINTS x num_configurations, joints[j*num_configurations + k] is joint j of configuration k
+ * @param frames ARM_FK_NUM_FRAMES x ARM_FK_FRAME_SIZE x num_configurations, frames[(f*ARM_FK_FRAME_SIZE + c)*num_configurations + k]
+ * is component c of frame f of configuration k. With one configuration this is ARM_FK_NUM_FRAMES frames of
+ * ARM_FK_FRAME_SIZE components.
+ */
+inline void computeArmFK(const double *joints, std::size_t num_configurations, double *frames)
+{
+  const std::size_t n = num_configurations;
+  for (int f = 0; f < ARM_FK_NUM_FRAMES; ++f)
+  {
+    const double *o = ARM_FK_ORIGINS[f].rotation;
+    const double *t = ARM_FK_ORIGINS[f].translation;
+    const double *q = f < ARM_FK_NUM_JOINTS ? joints + f*n : NULL;
+    const double *parent = f > 0 ? frames + (f-1)*ARM_FK_FRAME_SIZE*n : NULL;
+    double *frame = frames + f*ARM_FK_FRAME_SIZE*n;
+
+    for (std::size_t k = 0; k < n; ++k)
+    {
+      // Frame relative to the parent: the origin rotated about the z axis of the joint
+      const double c = q ? std::cos(q[k]) : 1.0;
+      const double s = q ? std::sin(q[k]) : 0.0;
+      double local[9];
+      for (int i = 0; i < 3; ++i)
+      {
+        local[i*3+0] = c*o[i*3+0] + s*o[i*3+1];
+        local[i*3+1] = c*o[i*3+1] - s*o[i*3+0];
+        local[i*3+2] = o[i*3+2];
+      }
+
+      if (f == 0)
+      {
+        for (int i = 0; i < 9; ++i)
+          frame[i*n+k] = local[i];
+        for (int i = 0; i < 3; ++i)
+          frame[(9+i)*n+k] = t[i];
+        continue;
+      }
+
+      for (int i = 0; i < 3; ++i)
+      {
+        const double p0 = parent[(i*3+0)*n+k], p1 = parent[(i*3+1)*n+k], p2 = parent[(i*3+2)*n+k];
+        for (int j = 0; j < 3; ++j)
+          frame[(i*3+j)*n+k] = p0*local[0*3+j] + p1*local[1*3+j] + p2*local[2*3+j];
+        frame[(9+i)*n+k] = p0*t[0] + p1*t[1] + p2*t[2] + parent[(9+i)*n+k];
+      }
+    }
+  }
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,245 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Desc:   Free joint values that solved nearby poses, on a voxel grid over the workspace
+*/
+
+#ifndef BAXTER_IKFAST_PLUGIN__FREE_JOINT_PRIOR_
+#define BAXTER_IKFAST_PLUGIN__FREE_JOINT_PRIOR_
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <boost/cstdint.hpp>
+#include <boost/thread/mutex.hpp>
+
+namespace baxter_ikfast_plugin
+{
+
+/**
+ * @brief Remembers the free joint values that solved recent queries, per cell of a grid over the end effector
+ * position and its approach (z) axis. searchPositionIK tries them before sweeping from the seed, since poses in
+ * the same cell are usually solved by the same values. Each cell keeps the VALUES_PER_CELL most recently
+ * successful values, most recent first. All public methods are serialized by a mutex.
+ */
+class FreeJointPrior
+{
+public:
+
+  static const int VALUES_PER_CELL = 4;
+
+  /**
+   * @param position_resolution edge length of a cell in position, in meters
+   * @param direction_resolution edge length of a cell in the components of the unit approach axis
+   * @param merge_tolerance a value closer than this to one already in the cell replaces it
+   */
+  FreeJointPrior(double position_resolution, double direction_resolution, double merge_tolerance)
+    : position_resolution_(position_resolution)
+    , direction_resolution_(direction_resolution)
+    , merge_tolerance_(merge_tolerance)
+    , num_recorded_(0)
+  {
+  }
+
+  /**
+   * @brief Copies the values of the cell of the pose into values, most recent first
+   * @param position the end effector position
+   * @param direction the unit approach axis of the end effector
+   * @return The number of values copied, at most VALUES_PER_CELL
+   */
+  int lookup(const double *position, const double *direction, double *values)
+  {
+    const boost::uint64_t key = cellKey(position, direction);
+    boost::mutex::scoped_lock lock(mutex_);
+    std::map<boost::uint64_t, Cell>::const_iterator it = cells_.find(key);
+    if (it == cells_.end())
+      return 0;
+    for (int i = 0; i < it->second.size; ++i)
+      values[i] = it->second.values[i];
+    return it->second.size;
+  }
+
+  /**
+   * @brief Makes value the most recent one of the cell of the pose
+   */
+  void record(const double *position, const double *direction, double value)
+  {
+    const boost::uint64_t key = cellKey(position, direction);
+    boost::mutex::scoped_lock lock(mutex_);
+    Cell &cell = cells_[key];
+
+    // Drop the value this one replaces, or the oldest one if the cell is full
+    int drop = -1;
+    for (int i = 0; i < cell.size && drop < 0; ++i)
+      if (std::fabs(cell.values[i] - value) < merge_tolerance_)
+        drop = i;
+    if (drop < 0)
+      drop = cell.size < VALUES_PER_CELL ? cell.size++ : VALUES_PER_CELL-1;
+    for (int i = drop; i > 0; --i)
+      cell.values[i] = cell.values[i-1];
+    cell.values[0] = static_cast<float>(value);
+    ++num_recorded_;
+  }
+
+  std::size_t size()
+  {
+    boost::mutex::scoped_lock lock(mutex_);
+    return cells_.size();
+  }
+
+  /**
+   * @brief Number of values recorded since the prior was created or loaded
+   */
+  std::size_t numRecorded()
+  {
+    boost::mutex::scoped_lock lock(mutex_);
+    return num_recorded_;
+  }
+
+  /**
+   * @brief Writes all cells to filename, through a temporary file so a crash never leaves a truncated table
+   * @return False if the file could not be written
+   */
+  bool save(const std::string &filename)
+  {
+    const std::string tmp_filename = filename + ".tmp";
+    {
+      std::ofstream file(tmp_filename.c_str(), std::ios::binary | std::ios::trunc);
+      if (!file)
+        return false;
+
+      boost::mutex::scoped_lock lock(mutex_);
+      Header header;
+      std::memcpy(header.magic, fileMagic(), sizeof(header.magic));
+      header.position_resolution = position_resolution_;
+      header.direction_resolution = direction_resolution_;
+      header.num_cells = cells_.size();
+      file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+      for (std::map<boost::uint64_t, Cell>::const_iterator it = cells_.begin(); it != cells_.end(); ++it)
+      {
+        file.write(reinterpret_cast<const char*>(&it->first), sizeof(it->first));
+        file.write(reinterpret_cast<const char*>(&it->second), sizeof(it->second));
+      }
+      if (!file)
+        return false;
+    }
+    return std::rename(tmp_filename.c_str(), filename.c_str()) == 0;
+  }
+
+  /**
+   * @brief Replaces all cells with the ones in filename
+   * @return False, leaving the prior unchanged, if the file is missing, damaged or was written with other
+   * resolutions
+   */
+  bool load(const std::string &filename)
+  {
+    std::ifstream file(filename.c_str(), std::ios::binary);
+    Header header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+      return false;
+    if (std::memcmp(header.magic, fileMagic(), sizeof(header.magic)) != 0 ||
+        header.position_resolution != position_resolution_ || header.direction_resolution != direction_resolution_)
+      return false;
+
+    std::map<boost::uint64_t, Cell> cells;
+    for (boost::uint64_t i = 0; i < header.num_cells; ++i)
+    {
+      boost::uint64_t key;
+      Cell cell;
+      if (!file.read(reinterpret_cast<char*>(&key), sizeof(key)) ||
+          !file.read(reinterpret_cast<char*>(&cell), sizeof(cell)) ||
+          cell.size < 0 || cell.size > VALUES_PER_CELL)
+        return false;
+      cells[key] = cell;
+    }
+
+    boost::mutex::scoped_lock lock(mutex_);
+    cells_.swap(cells);
+    num_recorded_ = 0;
+    return true;
+  }
+
+private:
+
+  // Bump the version when the layout of Header or Cell changes
+  static const char* fileMagic() { return "BXFJPR1"; }
+
+  struct Header
+  {
+    char magic[8];
+    double position_resolution;
+    double direction_resolution;
+    boost::uint64_t num_cells;
+  };
+
+  struct Cell
+  {
+    Cell() : size(0) {}
+    boost::int32_t size;
+    float values[VALUES_PER_CELL]; // single precision is plenty for a starting point of the sweep
+  };
+
+  // 12 bits per position component (+-20 m at 1 cm) and 4 per direction component, packed into one key
+  boost::uint64_t cellKey(const double *position, const double *direction) const
+  {
+    boost::uint64_t key = 0;
+    for (int i = 0; i < 3; ++i)
+    {
+      const boost::int64_t index = static_cast<boost::int64_t>(std::floor(position[i] / position_resolution_ + 0.5));
+      key = (key << 12) | (static_cast<boost::uint64_t>(index) & 0xfff);
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+      const boost::int64_t index = static_cast<boost::int64_t>(std::floor(direction[i] / direction_resolution_ + 0.5));
+      key = (key << 4) | (static_cast<boost::uint64_t>(index) & 0xf);
+    }
+    return key;
+  }
+
+  const double position_resolution_;
+  const double direction_resolution_;
+  const double merge_tolerance_;
+
+  std::map<boost::uint64_t, Cell> cells_;
+  std::size_t num_recorded_;
+
+  boost::mutex mutex_;
+};
+
+} // namespace
+
+#endif
@@ -0,0 +1,606 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Desc:   IKFast kinematics plugin of the Baxter arms, the class behind both arm plugins. Linking the plugin
+           library gives access to the entry points beyond kinematics::KinematicsBase and to the IKFast solver.
+*/
+
+#ifndef BAXTER_IKFAST_PLUGIN__IKFAST_KINEMATICS_PLUGIN_
+#define BAXTER_IKFAST_PLUGIN__IKFAST_KINEMATICS_PLUGIN_
+
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <ros/ros.h>
+#include <moveit/kinematics_base/kinematics_base.h>
+#include <kdl/frames.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/tss.hpp>
+#include <baxter_ikfast_plugin/ikfast_config.h>
+#include <baxter_ikfast_plugin/quantized_lru_cache.h>
+#include <baxter_ikfast_plugin/free_joint_prior.h>
+#include <baxter_ikfast_plugin/reachability_map.h>
+
+// The solver functions of the library, IkReal is float with IKFAST_SINGLE_PRECISION
+#define IKFAST_HAS_LIBRARY
+#ifdef IKFAST_SINGLE_PRECISION
+#define IKFAST_REAL float
+#endif
+
+namespace ikfast_kinematics_plugin
+{
+
+#include <ikfast.h>
+
+using ikfast::IkSolutionBase;
+using ikfast::IkSolutionListBase;
+using ikfast::IkSolutionListFixed;
+
+// Largest chain and solution set the plugin keeps on the stack. A 6R subchain has at most 16 IK
+// solutions for a fixed free joint; on the Baxter arm at most 14 have been observed.
+const int IKFAST_MAX_JOINTS = 7;
+const int IKFAST_MAX_SOLUTIONS = 16;
+
+// Solution storage that lives on the stack, so ComputeIk does not touch the allocator
+typedef IkSolutionListFixed<IkReal, IKFAST_MAX_SOLUTIONS, IKFAST_MAX_JOINTS> IKFastSolutionList;
+
+// Largest joint step of a Newton iteration of the refinement, larger steps mean a near singular Jacobian. Single
+// precision solutions can be several hundredths of a radian off near singularities and need larger steps.
+// Continuing a path from the previous solution starts further from the pose than a solver solution does and
+// allows larger steps as well.
+const double REFINE_MAX_STEP = sizeof(IkReal) < sizeof(double) ? 1e-1 : 1e-2;
+const double CONTINUATION_MAX_STEP = 1e-1;
+
+// The IK solution cache is keyed on the position, the rotation matrix and the free joint value
+const int IK_CACHE_KEY_SIZE = 3 + 9 + 1;
+typedef baxter_ikfast_plugin::QuantizedLRUCache<IKFastSolutionList, IK_CACHE_KEY_SIZE> IKSolutionCache;
+
+class IKSearchPool;
+
+class IKFastKinematicsPlugin : public kinematics::KinematicsBase
+{
+  std::vector<std::string> joint_names_;
+  double joint_min_[IKFAST_MAX_JOINTS];
+  double joint_max_[IKFAST_MAX_JOINTS];
+  bool joint_has_limits_[IKFAST_MAX_JOINTS];
+  IkReal solver_min_limits_[IKFAST_MAX_JOINTS]; // Joint limits the solver prunes its branches with, widened by SOLVER_LIMIT_TOLERANCE
+  IkReal solver_max_limits_[IKFAST_MAX_JOINTS];
+  std::vector<std::string> link_names_;
+  size_t num_joints_;
+  std::vector<int> free_params_;
+  bool active_; // Internal variable that indicates whether solvers are configured and ready
+  boost::shared_ptr<IKSearchPool> search_pool_; // Only created when the parallel free joint sweep is enabled
+  boost::shared_ptr<IKSolutionCache> ik_cache_; // Only created when the IK solution cache is enabled
+  boost::shared_ptr<baxter_ikfast_plugin::FreeJointPrior> free_joint_prior_; // Only created when the free joint prior is enabled
+  std::string free_joint_prior_file_; // Where the free joint prior is loaded from and saved to, empty to keep it in memory
+  baxter_ikfast_plugin::ReachabilityMap reachability_map_; // Only loaded when reachability_map_file is set
+  std::vector<double> joint_weights_; // Per joint weights of the distance to the seed state
+  bool closest_solution_ranking_; // Try the solutions closest to the seed first instead of in IKFast order
+  bool refine_solutions_; // Polish the solutions of the solver in double precision before they are used
+  mutable std::size_t num_solver_errors_; // Solver calls that failed a check of IKFast, atomic
+  struct IKScratch;
+  mutable boost::thread_specific_ptr<IKScratch> thread_scratch_; // Working storage of each thread that queried the plugin
+
+  const std::vector<std::string>& getJointNames() const { return joint_names_; }
+  const std::vector<std::string>& getLinkNames() const { return link_names_; }
+
+public:
+
+  /** @class
+   *  @brief Interface for an IKFast kinematics plugin
+   */
+  IKFastKinematicsPlugin():num_joints_(0),active_(false),closest_solution_ranking_(false),refine_solutions_(false),
+    num_solver_errors_(0){}
+
+  ~IKFastKinematicsPlugin()
+  {
+    logStatistics();
+    saveFreeJointPrior();
+  }
+
+  /**
+   * @brief Given a desired pose of the end-effector, compute the joint angles to reach it
+   * @param ik_pose the desired pose of the link
+   * @param ik_seed_state an initial guess solution for the inverse kinematics
+   * @param solution the solution vector
+   * @param error_code an error code that encodes the reason for failure or success
+   * @return True if a valid solution was found, false otherwise
+   */
+
+  // Returns the first IK solution that is within joint limits, this is called by get_ik() service
+  bool getPositionIK(const geometry_msgs::Pose &ik_pose,
+                     const std::vector<double> &ik_seed_state,
+                     std::vector<double> &solution,
+                     moveit_msgs::MoveItErrorCodes &error_code,
+                     const kinematics::KinematicsQueryOptions &options = kinematics::KinematicsQueryOptions()) const;
+
+  /**
+   * @brief Given a desired pose of the end-effector, search for the joint angles required to reach it.
+   * This particular method is intended for "searching" for a solutions by stepping through the redundancy
+   * (or other numerical routines).
+   * @param ik_pose the desired pose of the link
+   * @param ik_seed_state an initial guess solution for the inverse kinematics
+   * @return True if a valid solution was found, false otherwise
+   */
+  bool searchPositionIK(const geometry_msgs::Pose &ik_pose,
+                        const std::vector<double> &ik_seed_state,
+                        double timeout,
+                        std::vector<double> &solution,
+                        moveit_msgs::MoveItErrorCodes &error_code,
+                        const kinematics::KinematicsQueryOptions &options = kinematics::KinematicsQueryOptions()) const;
+
+  /**
+   * @brief Given a desired pose of the end-effector, search for the joint angles required to reach it.
+   * This particular method is intended for "searching" for a solutions by stepping through the redundancy
+   * (or other numerical routines).
+   * @param ik_pose the desired pose of the link
+   * @param ik_seed_state an initial guess solution for the inverse kinematics
+   * @param the distance that the redundancy can be from the current position
+   * @return True if a valid solution was found, false otherwise
+   */
+  bool searchPositionIK(const geometry_msgs::Pose &ik_pose,
+                        const std::vector<double> &ik_seed_state,
+                        double timeout,
+                        const std::vector<double> &consistency_limits,
+                        std::vector<double> &solution,
+                        moveit_msgs::MoveItErrorCodes &error_code,
+                        const kinematics::KinematicsQueryOptions &options = kinematics::KinematicsQueryOptions()) const;
+
+  /**
+   * @brief Given a desired pose of the end-effector, search for the joint angles required to reach it.
+   * This particular method is intended for "searching" for a solutions by stepping through the redundancy
+   * (or other numerical routines).
+   * @param ik_pose the desired pose of the link
+   * @param ik_seed_state an initial guess solution for the inverse kinematics
+   * @return True if a valid solution was found, false otherwise
+   */
+  bool searchPositionIK(const geometry_msgs::Pose &ik_pose,
+                        const std::vector<double> &ik_seed_state,
+                        double timeout,
+                        std::vector<double> &solution,
+                        const IKCallbackFn &solution_callback,
+                        moveit_msgs::MoveItErrorCodes &error_code,
+                        const kinematics::KinematicsQueryOptions &options = kinematics::KinematicsQueryOptions()) const;
+
+  /**
+   * @brief Given a desired pose of the end-effector, search for the joint angles required to reach it.
+   * This particular method is intended for "searching" for a solutions by stepping through the redundancy
+   * (or other numerical routines).  The consistency_limit specifies that only certain redundancy positions
+   * around those specified in the seed state are admissible and need to be searched.
+   * @param ik_pose the desired pose of the link
+   * @param ik_seed_state an initial guess solution for the inverse kinematics
+   * @param consistency_limit the distance that the redundancy can be from the current position
+   * @return True if a valid solution was found, false otherwise
+   */
+  bool searchPositionIK(const geometry_msgs::Pose &ik_pose,
+                        const std::vector<double> &ik_seed_state,
+                        double timeout,
+                        const std::vector<double> &consistency_limits,
+                        std::vector<double> &solution,
+                        const IKCallbackFn &solution_callback,
+                        moveit_msgs::MoveItErrorCodes &error_code,
+                        const kinematics::KinematicsQueryOptions &options = kinematics::KinematicsQueryOptions()) const;
+
+  /**
+   * @brief Given a set of joint angles and a set of links, compute their pose
+   *
+   * This FK routine is only used if 'use_plugin_fk' is set in the 'arm_kinematics_constraint_aware' node,
+   * otherwise ROS TF is used to calculate the forward kinematics
+   *
+   * @param link_names A set of links for which FK needs to be computed, the base frame or any link of the chain up to the tip
+   * @param joint_angles The state for which FK is being computed
+   * @param poses The resultant set of poses (in the frame returned by getBaseFrame())
+   * @return True if a valid solution was found, false otherwise
+   */
+  bool getPositionFK(const std::vector<std::string> &link_names,
+                     const std::vector<double> &joint_angles,
+                     std::vector<geometry_msgs::Pose> &poses) const;
+
+  /**
+   * @brief Caller-owned storage for getPositionIKBatch(). Reusing one buffer for every batch means
+   * the batch path does not allocate once the buffer has been sized for the largest batch.
+   */
+  struct IKBatchBuffer
+  {
+    std::vector<double> solutions;    // num_poses x num_joints, row major
+    std::vector<unsigned char> found; // found[i] is 1 if row i of solutions is valid
+  };
+
+  /**
+   * @brief Given a batch of desired poses of the end-effector, compute the joint angles to reach each
+   * of them. Pose i gets the same answer as getPositionIK would give for it: the first IK solution
+   * within joint limits, with the free joints taken from seed i.
+   * @param ik_poses the desired poses of the link
+   * @param ik_seed_states num_poses x num_joints seed states, row major
+   * @param buffer caller-owned output, the solution for pose i starts at buffer.solutions[i*num_joints]
+   * @return The number of poses for which a solution within joint limits was found
+   */
+  std::size_t getPositionIKBatch(const std::vector<geometry_msgs::Pose> &ik_poses,
+                                 const std::vector<double> &ik_seed_states,
+                                 IKBatchBuffer &buffer) const;
+
+  /**
+   * @brief Caller-owned storage for getAllPositionIK(). Reusing one buffer means the query does not allocate
+   * once the buffer has grown to the largest solution set.
+   */
+  struct IKSolutionsBuffer
+  {
+    std::size_t num_solutions;
+    std::vector<double> solutions; // num_solutions x num_joints, row major, in the order they were found
+    bool complete;                 // false if the sweep was cut short by the timeout
+    std::vector<std::pair<double, std::size_t> > index; // first joint and row of each solution, sorted, for deduplication
+  };
+
+  /**
+   * @brief Given a desired pose of the end-effector, compute every solution within joint limits over the whole
+   * free joint sweep of searchPositionIK, visited in the same order. A solution closer than dedup_tolerance to one
+   * already found in every joint is dropped.
+   * @param ik_pose the desired pose of the link
+   * @param ik_seed_state the free joint sweep starts at the free joint values of the seed
+   * @param timeout the sweep stops early once this many seconds have passed
+   * @param consistency_limits empty, or how far each joint may be from the seed
+   * @param dedup_tolerance largest joint difference, in radians, at which two solutions count as the same
+   * @param buffer caller-owned output
+   * @return The number of solutions found
+   */
+  std::size_t getAllPositionIK(const geometry_msgs::Pose &ik_pose,
+                               const std::vector<double> &ik_seed_state,
+                               double timeout,
+                               const std::vector<double> &consistency_limits,
+                               double dedup_tolerance,
+                               IKSolutionsBuffer &buffer) const;
+
+  /**
+   * @brief Caller-owned storage for getPositionIKPath(). Reusing one buffer means the query does not allocate
+   * once the buffer has been sized for the longest path.
+   */
+  struct IKPathBuffer
+  {
+    std::vector<double> solutions; // num_poses x num_joints, row major, only the first num_solved rows are valid
+    std::size_t num_solved;        // poses solved from the start of the path
+    std::size_t num_continued;     // poses solved by continuing the previous solution, without IKFast
+    std::size_t num_searched;      // poses that needed the free joint search
+  };
+
+  /**
+   * @brief Given a sequence of poses of the end-effector, e.g. a dense Cartesian path, compute a joint path that
+   * follows the branch of the seed. Each pose is first solved by refining the solution of the previous pose with
+   * the free joint held, then by IKFast at the previous free joint value taking the nearest solution, and only
+   * then by searching the free joint around its previous value.
+   * @param ik_poses the poses, in order along the path
+   * @param ik_seed_state the state the path starts from
+   * @param timeout the path is cut short once this many seconds have passed
+   * @param consistency_limits empty, or how far each joint may move from one pose to the next
+   * @param buffer caller-owned output
+   * @return The number of poses solved from the start of the path, the path stops at the first pose it can not solve
+   */
+  std::size_t getPositionIKPath(const std::vector<geometry_msgs::Pose> &ik_poses,
+                                const std::vector<double> &ik_seed_state,
+                                double timeout,
+                                const std::vector<double> &consistency_limits,
+                                IKPathBuffer &buffer) const;
+
+  /**
+   * @brief Given a desired pose of the end-effector, compute the joint solutions for the free joint values of the
+   * seed that are within joint limits, sorted by their weighted distance to the seed
+   * @param ik_pose the desired pose of the link
+   * @param ik_seed_state the seed, also the state distances are measured from
+   * @param max_solutions the number of solutions to return at most
+   * @param solutions the solutions, nearest first
+   * @param distances the weighted squared joint distance of each solution to the seed
+   * @return The number of solutions returned
+   */
+  std::size_t getClosestPositionIK(const geometry_msgs::Pose &ik_pose,
+                                   const std::vector<double> &ik_seed_state,
+                                   std::size_t max_solutions,
+                                   std::vector<std::vector<double> > &solutions,
+                                   std::vector<double> &distances) const;
+
+  /**
+   * @brief Reports the counters of the IK solution cache
+   * @param hits number of solve calls answered from the cache
+   * @param misses number of solve calls that ran IKFast
+   * @param size number of cached solution sets
+   * @return False if the cache is disabled
+   */
+  bool getIKCacheStatistics(std::size_t &hits, std::size_t &misses, std::size_t &size) const;
+
+  /**
+   * @brief Drops all cached solution sets, e.g. after the joint limits or the robot model changed
+   */
+  void clearIKCache();
+
+  /**
+   * @brief Number of solver calls that failed a numerical check of IKFast. They count as calls without solutions.
+   */
+  std::size_t getNumSolverErrors() const;
+
+  /**
+   * @brief Writes the free joint prior to free_joint_prior_file, also done when the plugin is destroyed
+   * @return False if the prior is disabled, has no file or could not be written
+   */
+  bool saveFreeJointPrior() const;
+
+  /**
+   * @brief Logs the counters of the plugin at INFO, also done when the plugin is destroyed
+   */
+  void logStatistics() const;
+
+private:
+
+  bool initialize(const std::string &robot_description,
+                  const std::string& group_name,
+                  const std::string& base_name,
+                  const std::string& tip_name,
+                  double search_discretization);
+
+  /**
+   * @brief Calls the IK solver from IKFast
+   * @return The number of solutions found
+   */
+  int solve(KDL::Frame &pose_frame, const std::vector<double> &vfree, IkSolutionListBase<IkReal> &solutions) const;
+  int solve(KDL::Frame &pose_frame, const IkReal *vfree, IkSolutionListBase<IkReal> &solutions) const;
+
+  /**
+   * @brief The joint values a query admits: the joint limits, narrowed to the consistency limits around the seed
+   */
+  struct JointBounds
+  {
+    double min[IKFAST_MAX_JOINTS];
+    double max[IKFAST_MAX_JOINTS];
+    IkReal solver_min[IKFAST_MAX_JOINTS]; // the same bounds widened like solver_min_limits_, for the pruning of the solver
+    IkReal solver_max[IKFAST_MAX_JOINTS];
+    bool narrowed; // set if a consistency limit is tighter than the joint limits of its joint
+  };
+
+  /**
+   * @brief Fills bounds with the joint limits widened by limit_tolerance, intersected with the consistency limits
+   * around ik_seed_state if there are any
+   */
+  void getJointBounds(const double *ik_seed_state, const std::vector<double> &consistency_limits, double limit_tolerance,
+                      JointBounds &bounds) const;
+
+  /**
+   * @brief Calls the IK solver from IKFast with its branches pruned to bounds. Narrowed bounds bypass the
+   * IK solution cache, its entries hold the solutions within the joint limits.
+   * @return The number of solutions found
+   */
+  int solve(KDL::Frame &pose_frame, const IkReal *vfree, const JointBounds &bounds, IkSolutionListBase<IkReal> &solutions) const;
+
+  /**
+   * @brief Calls the IK solver from IKFast, bypassing the IK solution cache. The solver only follows branches
+   * within [lower, upper].
+   * @return The number of solutions found
+   */
+  int computeIK(KDL::Frame &pose_frame, const IkReal *vfree, const IkReal *lower, const IkReal *upper,
+                IkSolutionListBase<IkReal> &solutions) const;
+
+  /**
+   * @brief computeIK without the error handling, a failed check of IKFast throws unless IKFAST_NO_EXCEPTIONS is set
+   */
+  int runIKFast(KDL::Frame &pose_frame, const IkReal *vfree, const IkReal *lower, const IkReal *upper,
+                IkSolutionListBase<IkReal> &solutions) const;
+
+  /**
+   * @brief The solutions of one solve() call that obey the joint limits, in the order they should be tried
+   */
+  struct RankedSolutions
+  {
+    std::size_t size;
+    double values[IKFAST_MAX_SOLUTIONS][IKFAST_MAX_JOINTS];
+    double distances[IKFAST_MAX_SOLUTIONS]; // weighted squared distance to the seed, only set when ranking by distance
+    int order[IKFAST_MAX_SOLUTIONS];        // indices into values
+  };
+
+  /**
+   * @brief Collects the solutions for pose_frame within bounds. If refine_solutions_ is set they are refined
+   * first, and dropped if the refinement can not move them onto the pose. If closest is set they are ordered by weighted
+   * distance to the seed, otherwise they keep the IKFast order.
+   */
+  void rankSolutions(const KDL::Frame &pose_frame, const IkSolutionListBase<IkReal> &solutions, const double *ik_seed_state,
+                     const JointBounds &bounds, bool closest, RankedSolutions &ranked) const;
+
+  /**
+   * @brief Newton iterations in double precision on the analytic FK of the arm, with the free joint held
+   * fixed, that move solution onto pose_frame
+   * @param max_step Largest joint step of an iteration, the iterations stop near singularities
+   * @return False if neither the iterations converged nor an iterate, the unrefined solution included, reached
+   * the pose within REFINE_ACCEPT_TOLERANCE. solution is then left unchanged.
+   */
+  bool refineSolution(const KDL::Frame &pose_frame, double *solution, double max_step = REFINE_MAX_STEP) const;
+
+  void fillFreeParams(int count, int *array);
+  bool getCount(int &count, const int &max_count, const int &min_count) const;
+
+  /**
+   * @brief Number of search_discretization_ steps free joint index can take above and below initial_guess,
+   * bounded by its joint limits and its consistency limit if there are any
+   */
+  void getFreeJointIncrements(std::size_t index, double initial_guess, const std::vector<double> &consistency_limits,
+                              int &num_positive_increments, int &num_negative_increments) const;
+
+  /**
+   * @brief Position of a search over the values of every free joint. Each free joint steps away from its seed
+   * value in the order of getCount(), the first free joint fastest.
+   */
+  struct FreeJointGrid
+  {
+    double initial_guess[IKFAST_MAX_JOINTS];
+    int num_positive_increments[IKFAST_MAX_JOINTS];
+    int num_negative_increments[IKFAST_MAX_JOINTS];
+    int counter[IKFAST_MAX_JOINTS];
+  };
+
+  /**
+   * @brief Starts grid at the free joint values of ik_seed_state and sets vfree to them
+   */
+  void initFreeJointGrid(const double *ik_seed_state, const std::vector<double> &consistency_limits,
+                         FreeJointGrid &grid, std::vector<double> &vfree) const;
+
+  /**
+   * @brief Moves grid to the next free joint values and sets vfree to them
+   * @return False once every value has been visited
+   */
+  bool nextFreeJointValues(FreeJointGrid &grid, std::vector<double> &vfree) const;
+
+  /**
+   * @brief State shared by the threads of one parallel free joint sweep. Step k is the k-th free joint
+   * value in the order getCount() visits them, so a lower step is closer to the seed.
+   */
+  struct FreeJointSweep
+  {
+    const geometry_msgs::Pose *ik_pose;
+    const double *ik_seed_state;
+    const JointBounds *bounds;
+    KDL::Frame frame;
+    const IKCallbackFn *solution_callback;
+    double initial_guess;
+    int num_positive_increments;
+    int num_negative_increments;
+    int num_steps;
+    ros::Time max_time;
+
+    int next_step;  // next step to hand out, atomic
+    int best_step;  // lowest step with a valid solution so far, num_steps if none, atomic
+    int timed_out;  // set once a worker stopped because of the timeout, atomic
+
+    boost::mutex mutex;                 // serializes the solution callback and protects solution
+    double solution[IKFAST_MAX_JOINTS]; // the solution of best_step
+  };
+
+  /**
+   * @brief Job of the search pool for one sweep, small enough for boost::function to hold without allocating
+   */
+  struct SweepJob
+  {
+    const IKFastKinematicsPlugin *plugin;
+    FreeJointSweep *sweep;
+    void operator()() const { plugin->sweepFreeJoint(*sweep); }
+  };
+
+  /**
+   * @brief Worker of the parallel free joint sweep, takes steps until they are exhausted or a step
+   * closer to the seed has succeeded
+   */
+  void sweepFreeJoint(FreeJointSweep &sweep) const;
+
+  /**
+   * @brief Working storage of the IK queries of one thread, created by its first query and reused by all later
+   * ones, so concurrent queries on one plugin neither allocate nor share working memory. The query members are
+   * taken through a ScratchLease. The sweep members are only used by sweepFreeJoint, which never nests on a
+   * thread since a search only sweeps in parallel once it owns the pool.
+   */
+  struct IKScratch
+  {
+    IKScratch() : in_use(false) {}
+
+    IKFastSolutionList solutions;
+    RankedSolutions ranked;
+    FreeJointGrid grid;
+    std::vector<double> vfree;
+    bool in_use; // a query further up the stack of the thread holds the lease
+
+    IKFastSolutionList sweep_solutions;
+    RankedSolutions sweep_ranked;
+    std::vector<double> sweep_solution; // the candidate handed to the solution callback
+  };
+
+  /**
+   * @brief The scratch of the calling thread for the duration of one query. A query started from a solution
+   * callback while the thread's scratch is leased gets a scratch of its own, so the plugin stays reentrant.
+   */
+  class ScratchLease
+  {
+  public:
+    explicit ScratchLease(const IKFastKinematicsPlugin &plugin);
+    ~ScratchLease() { scratch_->in_use = false; }
+    IKScratch& operator*() const { return *scratch_; }
+    IKScratch* operator->() const { return scratch_; }
+
+  private:
+    IKScratch *scratch_;
+    boost::scoped_ptr<IKScratch> nested_;
+  };
+
+  /**
+   * @brief The scratch of the calling thread, created on its first use
+   */
+  IKScratch& getThreadScratch() const;
+
+  /**
+   * @brief Solves for the free joint values in vfree and passes the solutions within bounds to
+   * solution_callback, in the order of rankSolutions
+   * @return True as soon as a solution is accepted, it is then in solution
+   */
+  bool tryFreeJointValue(const geometry_msgs::Pose &ik_pose, KDL::Frame &frame, const std::vector<double> &ik_seed_state,
+                         const JointBounds &bounds, const std::vector<double> &vfree, const IKCallbackFn &solution_callback,
+                         IKScratch &scratch, std::vector<double> &solution, moveit_msgs::MoveItErrorCodes &error_code) const;
+
+  /**
+   * @brief The free joint values that solved poses in the cell of frame, most recent first
+   * @return The number of values, 0 if the free joint prior is disabled
+   */
+  int lookupFreeJointPrior(const KDL::Frame &frame, double *values) const;
+
+  /**
+   * @brief Fills the joint and link names and the joint limits from arm_chain_constants.h
+   * @return False if the header was not generated, xml is not the URDF it was generated from or it has
+   * no chain from base_frame_ that passes tip_frame_ after its last joint
+   */
+  bool readChainConstants(const std::string &xml);
+
+  /**
+   * @brief Fills the joint and link names and the joint limits by walking the URDF from tip_frame_ to base_frame_
+   */
+  bool readChainFromURDF(const std::string &xml);
+
+  /**
+   * @brief The free joint value of the reachability map seed for frame
+   * @return False if no map is loaded or it has no seed for frame
+   */
+  bool lookupReachabilityMap(const KDL::Frame &frame, double &value) const;
+
+  /**
+   * @brief Records the free joint value of solution for the cell of frame, if the free joint prior is enabled
+   */
+  void recordFreeJointPrior(const KDL::Frame &frame, const std::vector<double> &solution) const;
+
+}; // end class
+
+} // namespace
+
+#endif
@@ -0,0 +1,338 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Desc:   Fixed capacity LRU cache keyed on a quantized vector of reals
+*/
+
+#ifndef BAXTER_IKFAST_PLUGIN__QUANTIZED_LRU_CACHE_
+#define BAXTER_IKFAST_PLUGIN__QUANTIZED_LRU_CACHE_
+
+#include <cmath>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <boost/scoped_array.hpp>
+#include <boost/thread/mutex.hpp>
+
+namespace baxter_ikfast_plugin
+{
+
+/**
+ * @brief Least recently used cache keyed on KeySize reals. Each key component is rounded to a multiple of its
+ * resolution, so keys closer than the resolution usually share an entry (keys on either side of a cell boundary
+ * do not). All entries and the open addressing index are allocated in the constructor, lookups and inserts do
+ * not allocate. The cells are split into shards by their hash, each with its own entries, LRU order and mutex,
+ * so threads working on different cells rarely wait for each other. Eviction is least recently used within the
+ * shard of the inserted cell.
+ */
+template <typename Value, int KeySize>
+class QuantizedLRUCache
+{
+public:
+
+  // The shard of a cell is taken from the top 8 bits of its hash
+  static const std::size_t MAX_SHARDS = 256;
+
+  /**
+   * @param capacity the number of entries kept before the least recently used one is evicted
+   * @param resolution KeySize cell sizes, one per key component
+   * @param num_shards number of independently locked parts of the cache, rounded down to a power of two of at
+   * most MAX_SHARDS and capacity. 1 serializes all methods on a single mutex.
+   */
+  QuantizedLRUCache(std::size_t capacity, const double *resolution, std::size_t num_shards = 1)
+  {
+    if (capacity < 1)
+      capacity = 1;
+    num_shards_ = 1;
+    while (2*num_shards_ <= num_shards && 2*num_shards_ <= MAX_SHARDS && 2*num_shards_ <= capacity)
+      num_shards_ *= 2;
+
+    // Every shard gets an equal part of the capacity, the total may exceed capacity by less than num_shards_
+    shards_.reset(new Shard[num_shards_]);
+    for (std::size_t i = 0; i < num_shards_; ++i)
+      shards_[i].init((capacity + num_shards_ - 1) / num_shards_);
+
+    for (int i = 0; i < KeySize; ++i)
+      inverse_resolution_[i] = 1.0 / resolution[i];
+  }
+
+  /**
+   * @brief Copies the value stored for the cell of key into value
+   * @return True on a hit
+   */
+  bool lookup(const double *key, Value &value)
+  {
+    Cell cell;
+    quantize(key, cell);
+    Shard &shard = shardOf(cell);
+
+    boost::mutex::scoped_lock lock(shard.mutex);
+    bool found;
+    std::size_t slot = shard.findSlot(cell, found);
+    if (!found)
+    {
+      ++shard.misses;
+      return false;
+    }
+    ++shard.hits;
+
+    int entry = shard.slots[slot];
+    shard.unlink(entry);
+    shard.pushNewest(entry);
+    value = shard.entries[entry].value;
+    return true;
+  }
+
+  /**
+   * @brief Stores value for the cell of key, evicting the least recently used entry of its shard if the shard is
+   * full
+   */
+  void insert(const double *key, const Value &value)
+  {
+    Cell cell;
+    quantize(key, cell);
+    Shard &shard = shardOf(cell);
+
+    boost::mutex::scoped_lock lock(shard.mutex);
+    bool found;
+    std::size_t slot = shard.findSlot(cell, found);
+    int entry;
+    if (found)
+    {
+      entry = shard.slots[slot];
+      shard.unlink(entry);
+    }
+    else
+    {
+      if (shard.num_entries < shard.entries.size())
+      {
+        entry = shard.num_entries++;
+      }
+      else
+      {
+        entry = shard.oldest;
+        shard.unlink(entry);
+        shard.eraseSlot(shard.findSlot(shard.entries[entry].cell, found));
+        slot = shard.findSlot(cell, found); // erasing may have moved the free slot
+      }
+      shard.entries[entry].cell = cell;
+      shard.slots[slot] = entry;
+    }
+    shard.entries[entry].value = value;
+    shard.pushNewest(entry);
+  }
+
+  /**
+   * @brief Drops all entries, the hit and miss counters are kept
+   */
+  void clear()
+  {
+    for (std::size_t i = 0; i < num_shards_; ++i)
+    {
+      Shard &shard = shards_[i];
+      boost::mutex::scoped_lock lock(shard.mutex);
+      shard.slots.assign(shard.slots.size(), -1);
+      shard.num_entries = 0;
+      shard.newest = shard.oldest = -1;
+    }
+  }
+
+  /**
+   * @brief Totals over all shards. The shards are read one after the other, so while other threads use the cache
+   * the totals are not a snapshot of a single instant.
+   */
+  void getStatistics(std::size_t &hits, std::size_t &misses, std::size_t &size)
+  {
+    hits = misses = size = 0;
+    for (std::size_t i = 0; i < num_shards_; ++i)
+    {
+      Shard &shard = shards_[i];
+      boost::mutex::scoped_lock lock(shard.mutex);
+      hits += shard.hits;
+      misses += shard.misses;
+      size += shard.num_entries;
+    }
+  }
+
+  std::size_t getNumShards() const
+  {
+    return num_shards_;
+  }
+
+private:
+
+  struct Cell
+  {
+    boost::int64_t index[KeySize];
+    std::size_t hash;
+  };
+
+  struct Entry
+  {
+    Cell cell;
+    int newer; // towards newest, -1 at the end
+    int older; // towards oldest, -1 at the end
+    Value value;
+  };
+
+  // One independently locked LRU cache
+  struct Shard
+  {
+    void init(std::size_t capacity)
+    {
+      entries.resize(capacity);
+      num_entries = 0;
+      newest = oldest = -1;
+      hits = misses = 0;
+
+      // Keep the index at most half full so probe sequences stay short
+      std::size_t num_slots = 1;
+      while (num_slots < 2*entries.size())
+        num_slots *= 2;
+      slots.assign(num_slots, -1);
+      slot_mask = num_slots - 1;
+    }
+
+    // Linear probing, returns the slot holding cell or the empty slot where it would go
+    std::size_t findSlot(const Cell &cell, bool &found) const
+    {
+      std::size_t slot = cell.hash & slot_mask;
+      while (slots[slot] != -1)
+      {
+        if (sameCell(entries[slots[slot]].cell, cell))
+        {
+          found = true;
+          return slot;
+        }
+        slot = (slot + 1) & slot_mask;
+      }
+      found = false;
+      return slot;
+    }
+
+    // Backward shift deletion, keeps every remaining entry reachable from its home slot without tombstones
+    void eraseSlot(std::size_t slot)
+    {
+      std::size_t next = slot;
+      while (true)
+      {
+        slots[slot] = -1;
+        std::size_t home;
+        do
+        {
+          next = (next + 1) & slot_mask;
+          if (slots[next] == -1)
+            return;
+          home = entries[slots[next]].cell.hash & slot_mask;
+        } while (slot <= next ? (slot < home && home <= next) : (slot < home || home <= next));
+        slots[slot] = slots[next];
+        slot = next;
+      }
+    }
+
+    void unlink(int entry)
+    {
+      Entry &e = entries[entry];
+      if (e.newer != -1)
+        entries[e.newer].older = e.older;
+      else
+        newest = e.older;
+      if (e.older != -1)
+        entries[e.older].newer = e.newer;
+      else
+        oldest = e.newer;
+    }
+
+    void pushNewest(int entry)
+    {
+      Entry &e = entries[entry];
+      e.newer = -1;
+      e.older = newest;
+      if (newest != -1)
+        entries[newest].newer = entry;
+      newest = entry;
+      if (oldest == -1)
+        oldest = entry;
+    }
+
+    std::vector<Entry> entries;
+    std::size_t num_entries;
+    int newest;
+    int oldest;
+
+    std::vector<int> slots; // entry index per slot, -1 if empty
+    std::size_t slot_mask;
+
+    std::size_t hits;
+    std::size_t misses;
+
+    boost::mutex mutex; // protects everything above
+  };
+
+  void quantize(const double *key, Cell &cell) const
+  {
+    // FNV-1a over the cell indices
+    boost::uint64_t hash = 14695981039346656037ULL;
+    for (int i = 0; i < KeySize; ++i)
+    {
+      cell.index[i] = static_cast<boost::int64_t>(std::floor(key[i] * inverse_resolution_[i] + 0.5));
+      hash = (hash ^ static_cast<boost::uint64_t>(cell.index[i])) * 1099511628211ULL;
+    }
+    cell.hash = static_cast<std::size_t>(hash ^ (hash >> 32));
+  }
+
+  static bool sameCell(const Cell &a, const Cell &b)
+  {
+    if (a.hash != b.hash)
+      return false;
+    for (int i = 0; i < KeySize; ++i)
+      if (a.index[i] != b.index[i])
+        return false;
+    return true;
+  }
+
+  // The shard is taken from the top bits of the hash, the slots within a shard from the bottom bits
+  Shard& shardOf(const Cell &cell) const
+  {
+    return shards_[(cell.hash >> (8*sizeof(std::size_t) - 8)) & (num_shards_ - 1)];
+  }
+
+  double inverse_resolution_[KeySize];
+
+  boost::scoped_array<Shard> shards_;
+  std::size_t num_shards_;
+};
+
+} // namespace
+
+#endif
@@ -0,0 +1,326 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Desc:   Precomputed reachability of a voxelized workspace for a set of end effector orientations,
+           memory mapped from a file written by build_reachability_map
+*/
+
+#ifndef BAXTER_IKFAST_PLUGIN__REACHABILITY_MAP_
+#define BAXTER_IKFAST_PLUGIN__REACHABILITY_MAP_
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <boost/cstdint.hpp>
+
+namespace baxter_ikfast_plugin
+{
+
+const int REACHABILITY_MAP_MAX_JOINTS = 7;
+
+/**
+ * @brief Start of a reachability map file. It is followed by num_orientations rotations (9 doubles each, row
+ * major), by one byte per voxel with the number of reachable orientations (padded to a multiple of 8 bytes) and
+ * by num_orientations cells per voxel. Voxels are ordered x fastest, then y, then z.
+ */
+struct ReachabilityMapHeader
+{
+  char magic[8];
+  boost::uint32_t num_joints;
+  boost::uint32_t num_orientations;
+  boost::uint32_t dims[3];
+  boost::uint32_t reserved;
+  double origin[3];   // center of voxel (0,0,0) in the base frame
+  double resolution;  // edge length of a voxel
+  double mount[12];   // arm mount in the base frame, row major rotation followed by the translation
+};
+
+/**
+ * @brief Best IK seed for one voxel and orientation. margin is the distance of the seed to the closest joint
+ * limit as a fraction of that joint's range, in [0,0.5]. It is negative if no solution was found.
+ */
+struct ReachabilityMapCell
+{
+  float joints[REACHABILITY_MAP_MAX_JOINTS];
+  float margin;
+};
+
+/**
+ * @brief Read-only view of a reachability map file. The file is memory mapped, so loading takes about as long as
+ * the header check and the pages are shared between processes. All queries take a position in the base frame
+ * and run in constant time, apart from nearestOrientation which compares against every sampled orientation.
+ */
+class ReachabilityMap
+{
+public:
+
+  ReachabilityMap() : data_(NULL), size_(0), header_(NULL), orientations_(NULL), counts_(NULL), cells_(NULL)
+  {
+  }
+
+  ~ReachabilityMap()
+  {
+    unload();
+  }
+
+  /**
+   * @brief Maps filename, replacing any map loaded before
+   * @return False, leaving no map loaded, if the file is missing or is not a complete reachability map
+   */
+  bool load(const std::string &filename)
+  {
+    unload();
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+      return false;
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(ReachabilityMapHeader))
+    {
+      ::close(fd);
+      return false;
+    }
+    void *data = ::mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED)
+      return false;
+    data_ = static_cast<const char*>(data);
+    size_ = st.st_size;
+
+    header_ = reinterpret_cast<const ReachabilityMapHeader*>(data_);
+    if (std::memcmp(header_->magic, fileMagic(), sizeof(header_->magic)) != 0 ||
+        header_->num_joints > static_cast<boost::uint32_t>(REACHABILITY_MAP_MAX_JOINTS) ||
+        size_ != fileSize(*header_))
+    {
+      unload();
+      return false;
+    }
+    orientations_ = reinterpret_cast<const double*>(data_ + sizeof(ReachabilityMapHeader));
+    counts_ = reinterpret_cast<const boost::uint8_t*>(orientations_ + 9*header_->num_orientations);
+    cells_ = reinterpret_cast<const ReachabilityMapCell*>(counts_ + paddedCountsSize(numVoxels(*header_)));
+    return true;
+  }
+
+  void unload()
+  {
+    if (data_)
+      ::munmap(const_cast<char*>(data_), size_);
+    data_ = NULL;
+    size_ = 0;
+    header_ = NULL;
+  }
+
+  bool isLoaded() const
+  {
+    return header_ != NULL;
+  }
+
+  const ReachabilityMapHeader& getHeader() const
+  {
+    return *header_;
+  }
+
+  /**
+   * @brief Rotation of sampled orientation i in the base frame, row major
+   */
+  const double* getOrientation(int i) const
+  {
+    return orientations_ + 9*i;
+  }
+
+  /**
+   * @brief Index of the sampled orientation with the smallest rotation angle to rotation (row major)
+   */
+  int nearestOrientation(const double *rotation) const
+  {
+    int best = 0;
+    double best_trace = -4.0;
+    for (boost::uint32_t i = 0; i < header_->num_orientations; ++i)
+    {
+      // trace(O_i^T R) grows as the angle between them shrinks
+      const double *o = orientations_ + 9*i;
+      double trace = 0;
+      for (int k = 0; k < 9; ++k)
+        trace += o[k]*rotation[k];
+      if (trace > best_trace)
+      {
+        best_trace = trace;
+        best = i;
+      }
+    }
+    return best;
+  }
+
+  /**
+   * @brief Number of sampled orientations that reach the voxel of position, 0 outside the map
+   */
+  int numReachableOrientations(const double *position) const
+  {
+    const long voxel = voxelIndex(position);
+    return voxel < 0 ? 0 : counts_[voxel];
+  }
+
+  bool isReachable(const double *position) const
+  {
+    return numReachableOrientations(position) > 0;
+  }
+
+  /**
+   * @brief The cell of the voxel of position for sampled orientation, NULL outside the map or if it is not reachable
+   */
+  const ReachabilityMapCell* getCell(const double *position, int orientation) const
+  {
+    const long voxel = voxelIndex(position);
+    if (voxel < 0 || orientation < 0 || orientation >= static_cast<int>(header_->num_orientations))
+      return NULL;
+    const ReachabilityMapCell *cell = cells_ + voxel*header_->num_orientations + orientation;
+    return cell->margin < 0 ? NULL : cell;
+  }
+
+  /**
+   * @brief Copies the best seed for position and the sampled orientation nearest to rotation into joints
+   * @return False if the map has no solution there
+   */
+  bool getSeed(const double *position, const double *rotation, double *joints) const
+  {
+    const ReachabilityMapCell *cell = getCell(position, nearestOrientation(rotation));
+    if (!cell)
+      return false;
+    for (boost::uint32_t j = 0; j < header_->num_joints; ++j)
+      joints[j] = cell->joints[j];
+    return true;
+  }
+
+  /**
+   * @brief Transforms a pose in the arm mount frame (the frame of the IKFast solver) into the base frame
+   */
+  void mountToBase(const double *mount_position, const double *mount_rotation, double *position, double *rotation) const
+  {
+    const double *m = header_->mount;
+    for (int i = 0; i < 3; ++i)
+    {
+      position[i] = m[9+i];
+      for (int k = 0; k < 3; ++k)
+        position[i] += m[i*3+k]*mount_position[k];
+      for (int j = 0; j < 3; ++j)
+        rotation[i*3+j] = m[i*3+0]*mount_rotation[0*3+j] + m[i*3+1]*mount_rotation[1*3+j] + m[i*3+2]*mount_rotation[2*3+j];
+    }
+  }
+
+  /**
+   * @brief Writes a map to filename through a temporary file, the counts are derived from the cells
+   * @param orientations header.num_orientations row major rotations
+   * @param cells header.num_orientations cells per voxel, in voxel order
+   */
+  static bool write(const std::string &filename, const ReachabilityMapHeader &header, const double *orientations,
+                    const ReachabilityMapCell *cells)
+  {
+    ReachabilityMapHeader h = header;
+    std::memcpy(h.magic, fileMagic(), sizeof(h.magic));
+    const std::size_t num_voxels = numVoxels(h);
+    std::vector<boost::uint8_t> counts(paddedCountsSize(num_voxels), 0);
+    for (std::size_t v = 0; v < num_voxels; ++v)
+      for (boost::uint32_t o = 0; o < h.num_orientations; ++o)
+        if (cells[v*h.num_orientations + o].margin >= 0 && counts[v] < 255)
+          ++counts[v];
+
+    const std::string tmp_filename = filename + ".tmp";
+    FILE *file = std::fopen(tmp_filename.c_str(), "wb");
+    if (!file)
+      return false;
+    bool ok = std::fwrite(&h, sizeof(h), 1, file) == 1;
+    ok = ok && std::fwrite(orientations, sizeof(double)*9, h.num_orientations, file) == h.num_orientations;
+    ok = ok && std::fwrite(&counts[0], 1, counts.size(), file) == counts.size();
+    ok = ok && std::fwrite(cells, sizeof(ReachabilityMapCell), num_voxels*h.num_orientations, file) == num_voxels*h.num_orientations;
+    ok = (std::fclose(file) == 0) && ok;
+    return ok && std::rename(tmp_filename.c_str(), filename.c_str()) == 0;
+  }
+
+private:
+
+  // Not copyable, each map owns its mapping
+  ReachabilityMap(const ReachabilityMap&);
+  ReachabilityMap& operator=(const ReachabilityMap&);
+
+  // Bump the version when the layout of the header or the cells changes
+  static const char* fileMagic() { return "BXRMAP1"; }
+
+  static std::size_t numVoxels(const ReachabilityMapHeader &header)
+  {
+    return static_cast<std::size_t>(header.dims[0])*header.dims[1]*header.dims[2];
+  }
+
+  // Keeps the doubles and floats after the counts aligned
+  static std::size_t paddedCountsSize(std::size_t num_voxels)
+  {
+    return (num_voxels + 7) & ~static_cast<std::size_t>(7);
+  }
+
+  static std::size_t fileSize(const ReachabilityMapHeader &header)
+  {
+    const std::size_t num_voxels = numVoxels(header);
+    return sizeof(ReachabilityMapHeader) + sizeof(double)*9*header.num_orientations + paddedCountsSize(num_voxels) +
+      sizeof(ReachabilityMapCell)*num_voxels*header.num_orientations;
+  }
+
+  // -1 outside the map
+  long voxelIndex(const double *position) const
+  {
+    long index = 0;
+    for (int i = 2; i >= 0; --i)
+    {
+      const double cell = std::floor((position[i] - header_->origin[i]) / header_->resolution + 0.5);
+      if (!(cell >= 0 && cell < header_->dims[i]))
+        return -1;
+      index = index*header_->dims[i] + static_cast<long>(cell);
+    }
+    return index;
+  }
+
+  const char *data_;
+  std::size_t size_;
+  const ReachabilityMapHeader *header_;
+  const double *orientations_;
+  const boost::uint8_t *counts_;
+  const ReachabilityMapCell *cells_;
+};
+
+} // namespace
+
+#endif
@@ -28,6 +28,7 @@
    - IKFAST_ASSERT - Define in order to get a custom assert called when NaNs, divides by zero, and other invalid conditions are detected.
    - IKFAST_REAL - Use to force a custom real number type for IkReal.
    - IKFAST_NAMESPACE - Enclose all functions and classes in this namespace, the ``main`` function is excluded.
+   - IKFAST_NO_EXCEPTIONS - Count failed checks in \ref GetErrorCount instead of throwing std::runtime_error. The solver functions then return no solutions for the query that failed.
 
  */
 #include <vector>
@@ -42,6 +43,17 @@
 
 namespace ikfast {
 
+#ifdef IKFAST_NO_EXCEPTIONS
+/// \brief number of failed checks in the calling thread, callers compare it before and after a query
+inline unsigned int& GetErrorCount() {
+    static __thread unsigned int count = 0;
+    return count;
+}
+#define IKFAST_THROW(msg) { ++ikfast::GetErrorCount(); }
+#else
+#define IKFAST_THROW(msg) throw std::runtime_error(msg)
+#endif
+
 /// \brief holds the solution for a single dof
 template <typename T>
 class IkSingleDOFSolutionBase
@@ -102,6 +114,13 @@ public:
     /// \param vfree If the solution represents an infinite space, holds free parameters of the solution that users can freely set.
     virtual size_t AddSolution(const std::vector<IkSingleDOFSolutionBase<T> >& vinfos, const std::vector<int>& vfree) = 0;
 
+    /// \brief add one solution given as plain arrays, used by the generated solvers so they do not have to build std::vectors
+    ///
+    /// The default implementation copies into std::vectors, lists that can store the arrays directly should override it.
+    virtual size_t AddSolution(const IkSingleDOFSolutionBase<T>* vinfos, size_t dof, const int* vfree, size_t numfree) {
+        return AddSolution(std::vector<IkSingleDOFSolutionBase<T> >(vinfos, vinfos+dof), std::vector<int>(vfree, vfree+numfree));
+    }
+
     /// \brief returns the solution pointer
     virtual const IkSolutionBase<T>& GetSolution(size_t index) const = 0;
 
@@ -184,14 +203,17 @@ public:
     virtual void Validate() const {
         for(size_t i = 0; i < _vbasesol.size(); ++i) {
             if( _vbasesol[i].maxsolutions == (unsigned char)-1) {
-                throw std::runtime_error("max solutions for joint not initialized");
+                IKFAST_THROW("max solutions for joint not initialized");
+                return;
             }
             if( _vbasesol[i].maxsolutions > 0 ) {
                 if( _vbasesol[i].indices[0] >= _vbasesol[i].maxsolutions ) {
-                    throw std::runtime_error("index >= max solutions for joint");
+                    IKFAST_THROW("index >= max solutions for joint");
+                    return;
                 }
                 if( _vbasesol[i].indices[1] != (unsigned char)-1 && _vbasesol[i].indices[1] >= _vbasesol[i].maxsolutions ) {
-                    throw std::runtime_error("2nd index >= max solutions for joint");
+                    IKFAST_THROW("2nd index >= max solutions for joint");
+                    return;
                 }
             }
         }
@@ -239,7 +261,9 @@ public:
     virtual const IkSolutionBase<T>& GetSolution(size_t index) const
     {
         if( index >= _listsolutions.size() ) {
-            throw std::runtime_error("GetSolution index is invalid");
+            IKFAST_THROW("GetSolution index is invalid");
+            static const IkSolution<T> s_empty = IkSolution<T>(std::vector<IkSingleDOFSolutionBase<T> >(), std::vector<int>());
+            return s_empty;
         }
         typename std::list< IkSolution<T> >::const_iterator it = _listsolutions.begin();
         std::advance(it,index);
@@ -258,12 +282,118 @@ protected:
     std::list< IkSolution<T> > _listsolutions;
 };
 
+/// \brief Implementation of \ref IkSolutionBase with in-place storage for up to MaxDOF joints
+template <typename T, int MaxDOF>
+class IkSolutionFixed : public IkSolutionBase<T>
+{
+public:
+    IkSolutionFixed() : _dof(0) {
+    }
+
+    void Set(const IkSingleDOFSolutionBase<T>* vinfos, size_t dof, const int* vfree, size_t numfree) {
+        _dof = static_cast<int>(dof);
+        for(size_t i = 0; i < dof; ++i) {
+            _vbasesol[i] = vinfos[i];
+        }
+        _vfree.assign(vfree, vfree+numfree);
+    }
+
+    virtual void GetSolution(T* solution, const T* freevalues) const {
+        for(int i = 0; i < _dof; ++i) {
+            if( _vbasesol[i].freeind < 0 )
+                solution[i] = _vbasesol[i].foffset;
+            else {
+                solution[i] = freevalues[_vbasesol[i].freeind]*_vbasesol[i].fmul + _vbasesol[i].foffset;
+                if( solution[i] > T(3.14159265358979) ) {
+                    solution[i] -= T(6.28318530717959);
+                }
+                else if( solution[i] < T(-3.14159265358979) ) {
+                    solution[i] += T(6.28318530717959);
+                }
+            }
+        }
+    }
+
+    virtual void GetSolution(std::vector<T>& solution, const std::vector<T>& freevalues) const {
+        solution.resize(GetDOF());
+        GetSolution(&solution.at(0), freevalues.size() > 0 ? &freevalues.at(0) : NULL);
+    }
+
+    virtual const std::vector<int>& GetFree() const {
+        return _vfree;
+    }
+    virtual const int GetDOF() const {
+        return _dof;
+    }
+
+    IkSingleDOFSolutionBase<T> _vbasesol[MaxDOF]; ///< solution and their offsets if joints are mimiced
+    int _dof;
+    std::vector<int> _vfree; ///< empty, and so never allocated, for solvers without free parameters in their solutions
+};
+
+/// \brief Implementation of \ref IkSolutionListBase that stores up to MaxSolutions solutions in a contiguous array
+///
+/// Adding solutions never allocates and \ref GetSolution is a constant time lookup, so the list can live on the stack of
+/// the caller. Solutions beyond MaxSolutions are dropped and counted in \ref GetNumDropped.
+template <typename T, int MaxSolutions, int MaxDOF>
+class IkSolutionListFixed : public IkSolutionListBase<T>
+{
+public:
+    IkSolutionListFixed() : _numsolutions(0), _numdropped(0) {
+    }
+
+    virtual size_t AddSolution(const std::vector<IkSingleDOFSolutionBase<T> >& vinfos, const std::vector<int>& vfree)
+    {
+        return AddSolution(vinfos.size() > 0 ? &vinfos[0] : NULL, vinfos.size(), vfree.size() > 0 ? &vfree[0] : NULL, vfree.size());
+    }
+
+    virtual size_t AddSolution(const IkSingleDOFSolutionBase<T>* vinfos, size_t dof, const int* vfree, size_t numfree)
+    {
+        if( _numsolutions >= static_cast<size_t>(MaxSolutions) || dof > static_cast<size_t>(MaxDOF) ) {
+            ++_numdropped;
+            return _numsolutions;
+        }
+        _solutions[_numsolutions].Set(vinfos, dof, vfree, numfree);
+        return _numsolutions++;
+    }
+
+    virtual const IkSolutionBase<T>& GetSolution(size_t index) const
+    {
+        if( index >= _numsolutions ) {
+            IKFAST_THROW("GetSolution index is invalid");
+            static const IkSolutionFixed<T, MaxDOF> s_empty;
+            return s_empty;
+        }
+        return _solutions[index];
+    }
+
+    virtual size_t GetNumSolutions() const {
+        return _numsolutions;
+    }
+
+    /// \brief the number of solutions that did not fit since the last \ref Clear
+    size_t GetNumDropped() const {
+        return _numdropped;
+    }
+
+    virtual void Clear() {
+        _numsolutions = 0;
+        _numdropped = 0;
+    }
+
+protected:
+    IkSolutionFixed<T, MaxDOF> _solutions[MaxSolutions];
+    size_t _numsolutions;
+    size_t _numdropped;
+};
+
 }
 
 #endif // OPENRAVE_IKFAST_HEADER
 
 // The following code is dependent on the C++ library linking with.
-#ifdef IKFAST_HAS_LIBRARY
+#if defined(IKFAST_HAS_LIBRARY) && !defined(IKFAST_HEADER_LIBRARY)
+#define IKFAST_HEADER_LIBRARY
 
 // defined when creating a shared object/dll
 #ifdef IKFAST_CLIBRARY
@@ -297,6 +427,9 @@ typedef double IkReal;
  */
 IKFAST_API bool ComputeIk(const IkReal* eetrans, const IkReal* eerot, const IkReal* pfree, ikfast::IkSolutionListBase<IkReal>& solutions);
 
+/// \brief ComputeIk that only follows the branches whose joint values are within [lower, upper]
+IKFAST_API bool ComputeIkLimited(const IkReal* eetrans, const IkReal* eerot, const IkReal* pfree, const IkReal* lower, const IkReal* upper, ikfast::IkSolutionListBase<IkReal>& solutions);
+
 /// \brief Computes the end effector coordinates given the joint values. This function is used to double check ik.
 IKFAST_API void ComputeFk(const IkReal* joints, IkReal* eetrans, IkReal* eerot);
 
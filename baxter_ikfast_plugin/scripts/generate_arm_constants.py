@@ -0,0 +1,187 @@
+#!/usr/bin/env python
+#*********************************************************************
+#* Software License Agreement (BSD License)
+#*
+#*  Copyright (c) 2013, University of Colorado, Boulder
+#*  All rights reserved.
+#*
+#*  Redistribution and use in source and binary forms, with or without
+#*  modification, are permitted provided that the following conditions
+#*  are met:
+#*
+#*   * Redistributions of source code must retain the above copyright
+#*     notice, this list of conditions and the following disclaimer.
+#*   * Redistributions in binary form must reproduce the above
+#*     copyright notice, this list of conditions and the following
+#*     disclaimer in the documentation and/or other materials provided
+#*     with the distribution.
+#*   * Neither the name of the Univ of CO, Boulder nor the names of its
+#*     contributors may be used to endorse or promote products derived
+#*     from this software without specific prior written permission.
+#*
+#*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+#*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+#*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+#*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+#*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+#*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+#*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+#*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+#*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+#*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+#*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#*  POSSIBILITY OF SUCH DAMAGE.
+#*********************************************************************
+
+"""
+Writes arm_chain_constants.h, the joint names, link names and joint limits of the Baxter arm chains
+read from a URDF, together with a hash of the URDF text. IKFastKinematicsPlugin::initialize takes the
+limits from the header instead of parsing robot_description when the hash matches. A chain also serves
+tips on the fixed links at its end, e.g. <arm>_wrist, the last link of the arm groups of the SRDF.
+
+usage: generate_arm_constants.py <urdf> <header> [<base>:<tip> ...]
+"""
+
+import math
+import sys
+import xml.etree.ElementTree as ET
+
+DEFAULT_CHAINS = ['left_arm_mount:left_gripper', 'right_arm_mount:right_gripper']
+
+
+def fnv1a64(data):
+    """ FNV-1a hash of a byte string, the same as hashURDF in the plugin """
+    h = 0xcbf29ce484222325
+    for b in bytearray(data):
+        h ^= b
+        h = (h * 0x100000001b3) & 0xffffffffffffffff
+    return h
+
+
+def read_chain(robot, base, tip):
+    """
+    Joints and links from base to tip in the order initialize reads them from the URDF, and the number of
+    links up to the child of the last joint. The links after it hang on fixed joints, a chain to any of them
+    has the same joints.
+    """
+    parent_joint = {}
+    for joint in robot.findall('joint'):
+        parent_joint[joint.find('child').get('link')] = joint
+
+    joints, links = [], []
+    num_fixed_tip_links = None
+    link = tip
+    while link != base:
+        if link not in parent_joint:
+            raise RuntimeError('%s is not below %s' % (tip, base))
+        links.append(link)
+        joint = parent_joint[link]
+        jtype = joint.get('type')
+        if jtype not in ('fixed', 'floating', 'planar'):
+            if num_fixed_tip_links is None:
+                num_fixed_tip_links = len(links) - 1
+            if jtype == 'continuous':
+                joints.append((joint.get('name'), -math.pi, math.pi, False))
+            else:
+                # Like urdf::Model, a safety_controller takes precedence and missing soft limits are 0
+                safety = joint.find('safety_controller')
+                if safety is not None:
+                    lower = float(safety.get('soft_lower_limit', 0))
+                    upper = float(safety.get('soft_upper_limit', 0))
+                else:
+                    limit = joint.find('limit')
+                    lower = float(limit.get('lower', 0))
+                    upper = float(limit.get('upper', 0))
+                joints.append((joint.get('name'), lower, upper, True))
+        link = joint.find('parent').get('link')
+    joints.reverse()
+    links.reverse()
+    return joints, links, len(links) - (num_fixed_tip_links or 0)
+
+
+def c_string_list(names):
+    return ', '.join('"%s"' % n for n in names)
+
+
+def c_double_list(values):
+    return ', '.join(repr(float(v)) for v in values)
+
+
+def main(argv):
+    if len(argv) < 3:
+        sys.stderr.write(__doc__)
+        return 1
+    urdf_file, header_file = argv[1], argv[2]
+    chains = argv[3:] or DEFAULT_CHAINS
+
+    with open(urdf_file, 'rb') as f:
+        urdf_text = f.read()
+    robot = ET.fromstring(urdf_text)
+
+    entries = []
+    num_joints = None
+    max_links = 0
+    for chain in chains:
+        base, tip = chain.split(':')
+        joints, links, num_joint_links = read_chain(robot, base, tip)
+        if num_joints is not None and len(joints) != num_joints:
+            raise RuntimeError('the chains must have the same number of joints')
+        num_joints = len(joints)
+        max_links = max(max_links, len(links))
+        entries.append((base, tip, joints, links, num_joint_links))
+
+    out = []
+    out.append('// Generated by generate_arm_constants.py from %s, do not edit' % urdf_file)
+    out.append('')
+    out.append('#ifndef BAXTER_IKFAST_PLUGIN__ARM_CHAIN_CONSTANTS_')
+    out.append('#define BAXTER_IKFAST_PLUGIN__ARM_CHAIN_CONSTANTS_')
+    out.append('')
+    out.append('#include <boost/cstdint.hpp>')
+    out.append('')
+    out.append('namespace baxter_ikfast_plugin')
+    out.append('{')
+    out.append('')
+    out.append('// FNV-1a hash of the URDF text the constants were read from')
+    out.append('const boost::uint64_t ARM_CHAIN_URDF_HASH = 0x%016xULL;' % fnv1a64(urdf_text))
+    out.append('')
+    out.append('const int ARM_CHAIN_NUM_JOINTS = %d;' % num_joints)
+    out.append('const int ARM_CHAIN_MAX_LINKS = %d;' % max_links)
+    out.append('const int ARM_CHAIN_COUNT = %d;' % len(entries))
+    out.append('')
+    out.append('struct ArmChainConstants')
+    out.append('{')
+    out.append('  const char* base_frame;')
+    out.append('  const char* tip_frame;')
+    out.append('  const char* joint_names[ARM_CHAIN_NUM_JOINTS];')
+    out.append('  int num_links;')
+    out.append('  int num_joint_links; // links up to the child of the last joint, the tip may be any link from there on')
+    out.append('  const char* link_names[ARM_CHAIN_MAX_LINKS];')
+    out.append('  double joint_min[ARM_CHAIN_NUM_JOINTS];')
+    out.append('  double joint_max[ARM_CHAIN_NUM_JOINTS];')
+    out.append('  bool joint_has_limits[ARM_CHAIN_NUM_JOINTS];')
+    out.append('};')
+    out.append('')
+    out.append('const ArmChainConstants ARM_CHAINS[ARM_CHAIN_COUNT] = {')
+    for i, (base, tip, joints, links, num_joint_links) in enumerate(entries):
+        out.append('  {')
+        out.append('    "%s", "%s",' % (base, tip))
+        out.append('    {%s},' % c_string_list(j[0] for j in joints))
+        out.append('    %d, %d, {%s},' % (len(links), num_joint_links, c_string_list(links)))
+        out.append('    {%s},' % c_double_list(j[1] for j in joints))
+        out.append('    {%s},' % c_double_list(j[2] for j in joints))
+        out.append('    {%s}' % ', '.join('true' if j[3] else 'false' for j in joints))
+        out.append('  }' + (',' if i + 1 < len(entries) else ''))
+    out.append('};')
+    out.append('')
+    out.append('} // namespace baxter_ikfast_plugin')
+    out.append('')
+    out.append('#endif')
+    out.append('')
+
+    with open(header_file, 'w') as f:
+        f.write('\n'.join(out))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
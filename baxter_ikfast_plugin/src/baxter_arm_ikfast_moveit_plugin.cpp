@@ -0,0 +1,1713 @@
+/*********************************************************************
+ *
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2013, Dave Coleman, CU Boulder; Jeremy Zoss, SwRI; David Butterworth, KAIST; Mathias Lüdtke, Fraunhofer IPA
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the all of the author's companies nor the names of its
+ *       contributors may be used to endorse or promote products derived from
+ *       this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************/
+
+/*
+ * IKFast Plugin Template for moveit
+ *
+ * AUTO-GENERATED by create_ikfast_moveit_plugin.py in arm_kinematics_tools
+ * You should run create_ikfast_moveit_plugin.py to generate your own plugin.
+ *
+ * Creates a kinematics plugin using the output of IKFast from OpenRAVE.
+ * This plugin and the move_group node can be used as a general
+ * kinematics service, from within the moveit planning environment, or in
+ * your own ROS node.
+ *
+ */
+
+#include <baxter_ikfast_plugin/ikfast_kinematics_plugin.h>
+#include <urdf/model.h>
+#include <tf_conversions/tf_kdl.h>
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
+#include <boost/thread.hpp>
+#include <algorithm>
+#include <Eigen/LU>
+#include <Eigen/Eigenvalues>
+#include <baxter_ikfast_plugin/arm_forward_kinematics.h>
+#ifdef BAXTER_ARM_CHAIN_CONSTANTS
+#include <baxter_ikfast_plugin/arm_chain_constants.h>
+#endif
+
+// Need a floating point tolerance when checking joint limits, in case the joint starts at limit
+const double LIMIT_TOLERANCE = .0000001;
+
+// Wraps an angle to [-pi,pi) without loops or branches
+inline double wrapAngle(double angle)
+{
+  return angle - 2*M_PI*std::floor((angle + M_PI) / (2*M_PI));
+}
+
+namespace ikfast_kinematics_plugin
+{
+
+#define IKFAST_NO_MAIN // Don't include main() from IKFast
+
+/// \brief The types of inverse kinematics parameterizations supported.
+///
+/// The minimum degree of freedoms required is set in the upper 4 bits of each type.
+/// The number of values used to represent the parameterization ( >= dof ) is the next 4 bits.
+/// The lower bits contain a unique id of the type.
+enum IkParameterizationType {
+    IKP_None=0,
+    IKP_Transform6D=0x67000001,     ///< end effector reaches desired 6D transformation
+    IKP_Rotation3D=0x34000002,     ///< end effector reaches desired 3D rotation
+    IKP_Translation3D=0x33000003,     ///< end effector origin reaches desired 3D translation
+    IKP_Direction3D=0x23000004,     ///< direction on end effector coordinate system reaches desired direction
+    IKP_Ray4D=0x46000005,     ///< ray on end effector coordinate system reaches desired global ray
+    IKP_Lookat3D=0x23000006,     ///< direction on end effector coordinate system points to desired 3D position
+    IKP_TranslationDirection5D=0x56000007,     ///< end effector origin and direction reaches desired 3D translation and direction. Can be thought of as Ray IK where the origin of the ray must coincide.
+    IKP_TranslationXY2D=0x22000008,     ///< 2D translation along XY plane
+    IKP_TranslationXYOrientation3D=0x33000009,     ///< 2D translation along XY plane and 1D rotation around Z axis. The offset of the rotation is measured starting at +X, so at +X is it 0, at +Y it is pi/2.
+    IKP_TranslationLocalGlobal6D=0x3600000a,     ///< local point on end effector origin reaches desired 3D global point
+
+    IKP_TranslationXAxisAngle4D=0x4400000b, ///< end effector origin reaches desired 3D translation, manipulator direction makes a specific angle with x-axis  like a cone, angle is from 0-pi. Axes defined in the manipulator base link's coordinate system)
+    IKP_TranslationYAxisAngle4D=0x4400000c, ///< end effector origin reaches desired 3D translation, manipulator direction makes a specific angle with y-axis  like a cone, angle is from 0-pi. Axes defined in the manipulator base link's coordinate system)
+    IKP_TranslationZAxisAngle4D=0x4400000d, ///< end effector origin reaches desired 3D translation, manipulator direction makes a specific angle with z-axis like a cone, angle is from 0-pi. Axes are defined in the manipulator base link's coordinate system.
+
+    IKP_TranslationXAxisAngleZNorm4D=0x4400000e, ///< end effector origin reaches desired 3D translation, manipulator direction needs to be orthogonal to z-axis and be rotated at a certain angle starting from the x-axis (defined in the manipulator base link's coordinate system)
+    IKP_TranslationYAxisAngleXNorm4D=0x4400000f, ///< end effector origin reaches desired 3D translation, manipulator direction needs to be orthogonal to x-axis and be rotated at a certain angle starting from the y-axis (defined in the manipulator base link's coordinate system)
+    IKP_TranslationZAxisAngleYNorm4D=0x44000010, ///< end effector origin reaches desired 3D translation, manipulator direction needs to be orthogonal to y-axis and be rotated at a certain angle starting from the z-axis (defined in the manipulator base link's coordinate system)
+
+    IKP_NumberOfParameterizations=16,     ///< number of parameterizations (does not count IKP_None)
+
+    IKP_VelocityDataBit = 0x00008000, ///< bit is set if the data represents the time-derivate velocity of an IkParameterization
+    IKP_Transform6DVelocity = IKP_Transform6D|IKP_VelocityDataBit,
+    IKP_Rotation3DVelocity = IKP_Rotation3D|IKP_VelocityDataBit,
+    IKP_Translation3DVelocity = IKP_Translation3D|IKP_VelocityDataBit,
+    IKP_Direction3DVelocity = IKP_Direction3D|IKP_VelocityDataBit,
+    IKP_Ray4DVelocity = IKP_Ray4D|IKP_VelocityDataBit,
+    IKP_Lookat3DVelocity = IKP_Lookat3D|IKP_VelocityDataBit,
+    IKP_TranslationDirection5DVelocity = IKP_TranslationDirection5D|IKP_VelocityDataBit,
+    IKP_TranslationXY2DVelocity = IKP_TranslationXY2D|IKP_VelocityDataBit,
+    IKP_TranslationXYOrientation3DVelocity = IKP_TranslationXYOrientation3D|IKP_VelocityDataBit,
+    IKP_TranslationLocalGlobal6DVelocity = IKP_TranslationLocalGlobal6D|IKP_VelocityDataBit,
+    IKP_TranslationXAxisAngle4DVelocity = IKP_TranslationXAxisAngle4D|IKP_VelocityDataBit,
+    IKP_TranslationYAxisAngle4DVelocity = IKP_TranslationYAxisAngle4D|IKP_VelocityDataBit,
+    IKP_TranslationZAxisAngle4DVelocity = IKP_TranslationZAxisAngle4D|IKP_VelocityDataBit,
+    IKP_TranslationXAxisAngleZNorm4DVelocity = IKP_TranslationXAxisAngleZNorm4D|IKP_VelocityDataBit,
+    IKP_TranslationYAxisAngleXNorm4DVelocity = IKP_TranslationYAxisAngleXNorm4D|IKP_VelocityDataBit,
+    IKP_TranslationZAxisAngleYNorm4DVelocity = IKP_TranslationZAxisAngleYNorm4D|IKP_VelocityDataBit,
+
+    IKP_UniqueIdMask = 0x0000ffff, ///< the mask for the unique ids
+    IKP_CustomDataBit = 0x00010000, ///< bit is set if the ikparameterization contains custom data, this is only used when serializing the ik parameterizations
+};
+
+// Code generated by IKFast56/61
+// Both arms have the same kinematic structure relative to their mount frames, so a single solver
+// (generated for the left arm) serves the two of them.
+#include "baxter_arm_ikfast_solver.cpp"
+
+// The solver prunes with a wider tolerance than LIMIT_TOLERANCE when IkReal is float, so solutions at a limit
+// survive the rounding of the solver and can be refined before they are checked against the limits
+const double SOLVER_LIMIT_TOLERANCE = LIMIT_TOLERANCE + 1000*std::numeric_limits<IkReal>::epsilon();
+
+// Newton refinement of the solutions in double precision stops below this pose error (meters and radians)
+const double REFINE_TOLERANCE = 1e-10;
+const int REFINE_MAX_ITERATIONS = 4;
+// A solution the refinement did not converge on is kept if it is as close to the pose as the solutions of the
+// double precision solver are
+const double REFINE_ACCEPT_TOLERANCE = 1e-6;
+
+/**
+ * @brief FNV-1a hash of the URDF text, compared with ARM_CHAIN_URDF_HASH of generate_arm_constants.py
+ */
+inline boost::uint64_t hashURDF(const std::string &xml)
+{
+  boost::uint64_t hash = 0xcbf29ce484222325ULL;
+  for(std::size_t i = 0; i < xml.size(); ++i)
+  {
+    hash ^= static_cast<unsigned char>(xml[i]);
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+/**
+ * @brief A fixed set of worker threads that all run the same job together with the calling thread.
+ * Used to split the free joint sweep of searchPositionIK across cores without creating threads per query.
+ */
+class IKSearchPool
+{
+public:
+  explicit IKSearchPool(std::size_t num_workers) : generation_(0), busy_workers_(0), shutdown_(false)
+  {
+    for(std::size_t i = 0; i < num_workers; ++i)
+      workers_.create_thread(boost::bind(&IKSearchPool::workerLoop, this));
+  }
+
+  ~IKSearchPool()
+  {
+    {
+      boost::mutex::scoped_lock lock(mutex_);
+      shutdown_ = true;
+    }
+    job_ready_.notify_all();
+    workers_.join_all();
+  }
+
+  /**
+   * @brief Runs job on every worker and on the calling thread and returns once all of them are done
+   * @return False without running the job if another search currently owns the pool
+   */
+  bool run(const boost::function<void()> &job)
+  {
+    boost::mutex::scoped_try_lock run_lock(run_mutex_);
+    if(!run_lock)
+      return false;
+
+    {
+      boost::mutex::scoped_lock lock(mutex_);
+      job_ = job;
+      busy_workers_ = workers_.size();
+      ++generation_;
+    }
+    job_ready_.notify_all();
+
+    job();
+
+    boost::mutex::scoped_lock lock(mutex_);
+    while(busy_workers_ > 0)
+      job_done_.wait(lock);
+    return true;
+  }
+
+private:
+  void workerLoop()
+  {
+    unsigned long seen_generation = 0;
+    boost::mutex::scoped_lock lock(mutex_);
+    while(true)
+    {
+      while(!shutdown_ && generation_ == seen_generation)
+        job_ready_.wait(lock);
+      if(shutdown_)
+        return;
+      seen_generation = generation_;
+
+      lock.unlock();
+      job_();
+      lock.lock();
+
+      if(--busy_workers_ == 0)
+        job_done_.notify_one();
+    }
+  }
+
+  boost::thread_group workers_;
+  boost::mutex run_mutex_; // held by the search that owns the pool
+  boost::mutex mutex_;     // protects everything below
+  boost::condition_variable job_ready_;
+  boost::condition_variable job_done_;
+  boost::function<void()> job_;
+  unsigned long generation_;
+  std::size_t busy_workers_;
+  bool shutdown_;
+};
+
+
+bool IKFastKinematicsPlugin::initialize(const std::string &robot_description,
+                                        const std::string& group_name,
+                                        const std::string& base_name,
+                                        const std::string& tip_name,
+                                        double search_discretization)
+{
+  setValues(robot_description, group_name, base_name, tip_name, search_discretization);
+
+  ros::NodeHandle node_handle("~/"+group_name);
+
+  std::string robot;
+  node_handle.param("robot",robot,std::string());
+
+  // IKFast56/61
+  fillFreeParams( GetNumFreeParameters(), GetFreeParameters() );
+  num_joints_ = GetNumJoints();
+
+  if(num_joints_ != static_cast<size_t>(IKFAST_MAX_JOINTS))
+  {
+    ROS_FATAL_STREAM_NAMED("ikfast","IKFast solver has " << num_joints_ << " joints, the plugin is built for " << IKFAST_MAX_JOINTS);
+    return false;
+  }
+
+  // The search steps through every free joint. The features below that learn or parallelize the free joint
+  // value only handle a single one.
+  if(free_params_.size() > 1)
+    ROS_INFO_STREAM_NAMED("ikfast","Searching over " << free_params_.size() << " free joints");
+
+  // Number of threads, including the calling one, that share the free joint sweep of searchPositionIK
+  int search_threads;
+  node_handle.param("search_threads",search_threads,1);
+  if(search_threads > 1 && free_params_.size() == 1)
+  {
+    ROS_INFO_STREAM_NAMED("ikfast","Sweeping the free joint with " << search_threads << " threads");
+    search_pool_.reset(new IKSearchPool(search_threads-1));
+  }
+
+  // Optional cache of the solution sets of solve(). Poses and free joint values that round to the same
+  // multiple of the tolerances share an entry, so a hit returns solutions for a pose up to a tolerance away.
+  // The cache is split into ik_cache_shards independently locked parts for planners that query from many threads.
+  int ik_cache_size, ik_cache_shards;
+  double ik_cache_position_tolerance, ik_cache_orientation_tolerance;
+  node_handle.param("ik_cache_size",ik_cache_size,0);
+  node_handle.param("ik_cache_shards",ik_cache_shards,16);
+  node_handle.param("ik_cache_position_tolerance",ik_cache_position_tolerance,1e-5);
+  node_handle.param("ik_cache_orientation_tolerance",ik_cache_orientation_tolerance,1e-5);
+  if(ik_cache_size > 0 && free_params_.size() <= 1)
+  {
+    double resolution[IK_CACHE_KEY_SIZE];
+    std::fill(resolution, resolution+3, ik_cache_position_tolerance);
+    std::fill(resolution+3, resolution+IK_CACHE_KEY_SIZE, ik_cache_orientation_tolerance);
+    ik_cache_.reset(new IKSolutionCache(ik_cache_size, resolution, std::max(ik_cache_shards, 1)));
+    ROS_INFO_STREAM_NAMED("ikfast","Caching up to " << ik_cache_size << " IK solution sets in " << ik_cache_->getNumShards() << " shards");
+  }
+
+  // Optional table of the free joint values that solved nearby poses, searchPositionIK tries them before
+  // sweeping from the seed. With free_joint_prior_file it carries over between runs.
+  bool use_free_joint_prior;
+  node_handle.param("free_joint_prior",use_free_joint_prior,false);
+  if(use_free_joint_prior && free_params_.size() == 1)
+  {
+    double position_resolution, direction_resolution;
+    node_handle.param("free_joint_prior_position_resolution",position_resolution,0.05);
+    node_handle.param("free_joint_prior_direction_resolution",direction_resolution,0.25);
+    node_handle.param("free_joint_prior_file",free_joint_prior_file_,std::string());
+    free_joint_prior_.reset(new baxter_ikfast_plugin::FreeJointPrior(position_resolution, direction_resolution,
+                                                                      search_discretization_));
+    if(!free_joint_prior_file_.empty() && free_joint_prior_->load(free_joint_prior_file_))
+      ROS_INFO_STREAM_NAMED("ikfast","Loaded " << free_joint_prior_->size() << " free joint prior cells from " << free_joint_prior_file_);
+  }
+
+  // Optional map written by build_reachability_map for this arm, the free joint of its seed is tried first
+  std::string reachability_map_file;
+  node_handle.param("reachability_map_file",reachability_map_file,std::string());
+  if(!reachability_map_file.empty() && free_params_.size() == 1)
+  {
+    // The seeds of a map written for another chain do not cover every joint of this one
+    if(reachability_map_.load(reachability_map_file) && reachability_map_.getHeader().num_joints == num_joints_)
+      ROS_INFO_STREAM_NAMED("ikfast","Loaded the reachability map " << reachability_map_file);
+    else
+    {
+      reachability_map_.unload();
+      ROS_ERROR_STREAM_NAMED("ikfast","Could not load the reachability map " << reachability_map_file);
+    }
+  }
+
+  std::string xml_string;
+
+  std::string urdf_xml,full_urdf_xml;
+  node_handle.param("urdf_xml",urdf_xml,robot_description);
+  node_handle.searchParam(urdf_xml,full_urdf_xml);
+
+  ROS_DEBUG_NAMED("ikfast","Reading xml file from parameter server");
+  if (!node_handle.getParam(full_urdf_xml, xml_string))
+  {
+    ROS_FATAL_NAMED("ikfast","Could not load the xml from parameter server: %s", urdf_xml.c_str());
+    return false;
+  }
+
+  // The URDF is only parsed when it is not the one the arm chain constants were generated from
+  if(!readChainConstants(xml_string) && !readChainFromURDF(xml_string))
+    return false;
+
+  for(size_t i=0; i <num_joints_; ++i)
+    ROS_INFO_STREAM_NAMED("ikfast",joint_names_[i] << " " << joint_min_[i] << " " << joint_max_[i] << " " << joint_has_limits_[i]);
+
+  for(size_t i=0; i <num_joints_; ++i)
+  {
+    solver_min_limits_[i] = joint_has_limits_[i] ? joint_min_[i]-SOLVER_LIMIT_TOLERANCE : -std::numeric_limits<IkReal>::infinity();
+    solver_max_limits_[i] = joint_has_limits_[i] ? joint_max_[i]+SOLVER_LIMIT_TOLERANCE : std::numeric_limits<IkReal>::infinity();
+  }
+
+  // Either "first", the first solution within limits in IKFast order, or "closest" to the seed state
+  std::string solution_ranking;
+  node_handle.param("solution_ranking",solution_ranking,std::string("first"));
+  closest_solution_ranking_ = (solution_ranking == "closest");
+  if(!closest_solution_ranking_ && solution_ranking != "first")
+    ROS_WARN_STREAM_NAMED("ikfast","Unknown solution_ranking '" << solution_ranking << "', using 'first'");
+
+  // On by default when the solver is built in single precision (IKFAST_REAL=float)
+  node_handle.param("refine_solutions",refine_solutions_,sizeof(IkReal) < sizeof(double));
+  if(refine_solutions_ && free_params_.size() != 1)
+  {
+    ROS_WARN_NAMED("ikfast","The refinement needs exactly one free joint, not refining the solutions");
+    refine_solutions_ = false;
+  }
+
+  if(!node_handle.getParam("joint_weights",joint_weights_))
+    joint_weights_.assign(num_joints_, 1.0);
+  if(joint_weights_.size() != num_joints_)
+  {
+    ROS_ERROR_STREAM_NAMED("ikfast","joint_weights must have " << num_joints_ << " entries, using equal weights");
+    joint_weights_.assign(num_joints_, 1.0);
+  }
+
+  active_ = true;
+  return true;
+}
+
+int IKFastKinematicsPlugin::solve(KDL::Frame &pose_frame, const std::vector<double> &vfree, IkSolutionListBase<IkReal> &solutions) const
+{
+  IkReal values[IKFAST_MAX_JOINTS];
+  for(size_t i = 0; i < vfree.size() && i < static_cast<size_t>(IKFAST_MAX_JOINTS); ++i)
+    values[i] = vfree[i];
+  return solve(pose_frame, vfree.size() > 0 ? values : NULL, solutions);
+}
+
+int IKFastKinematicsPlugin::solve(KDL::Frame &pose_frame, const IkReal *vfree, IkSolutionListBase<IkReal> &solutions) const
+{
+  if(!ik_cache_)
+    return computeIK(pose_frame, vfree, solver_min_limits_, solver_max_limits_, solutions);
+
+  // The seed state only changes the solution set through the free joint value
+  double key[IK_CACHE_KEY_SIZE];
+  for(int i = 0; i < 3; ++i)
+    key[i] = pose_frame.p.data[i];
+  for(int i = 0; i < 9; ++i)
+    key[3+i] = pose_frame.M.data[i];
+  key[12] = free_params_.empty() ? 0.0 : vfree[0];
+
+  IKFastSolutionList cached;
+  if(!ik_cache_->lookup(key, cached))
+  {
+    computeIK(pose_frame, vfree, solver_min_limits_, solver_max_limits_, cached);
+    ik_cache_->insert(key, cached);
+  }
+
+  solutions.Clear();
+  for(size_t s = 0; s < cached.GetNumSolutions(); ++s)
+  {
+    const IkSolutionFixed<IkReal, IKFAST_MAX_JOINTS> &sol =
+      static_cast<const IkSolutionFixed<IkReal, IKFAST_MAX_JOINTS>&>(cached.GetSolution(s));
+    solutions.AddSolution(sol._vbasesol, sol.GetDOF(), sol.GetFree().empty() ? NULL : &sol.GetFree()[0], sol.GetFree().size());
+  }
+  return solutions.GetNumSolutions();
+}
+
+int IKFastKinematicsPlugin::solve(KDL::Frame &pose_frame, const IkReal *vfree, const JointBounds &bounds,
+                                  IkSolutionListBase<IkReal> &solutions) const
+{
+  if(!bounds.narrowed)
+    return solve(pose_frame, vfree, solutions);
+  return computeIK(pose_frame, vfree, bounds.solver_min, bounds.solver_max, solutions);
+}
+
+void IKFastKinematicsPlugin::getJointBounds(const double *ik_seed_state, const std::vector<double> &consistency_limits,
+                                            double limit_tolerance, JointBounds &bounds) const
+{
+  bounds.narrowed = false;
+  for(int i = 0; i < IKFAST_MAX_JOINTS; ++i)
+  {
+    bounds.min[i] = joint_has_limits_[i] ? joint_min_[i]-limit_tolerance : -std::numeric_limits<double>::infinity();
+    bounds.max[i] = joint_has_limits_[i] ? joint_max_[i]+limit_tolerance : std::numeric_limits<double>::infinity();
+    bounds.solver_min[i] = solver_min_limits_[i];
+    bounds.solver_max[i] = solver_max_limits_[i];
+    if(consistency_limits.empty())
+      continue;
+
+    const double lower = ik_seed_state[i]-consistency_limits[i];
+    const double upper = ik_seed_state[i]+consistency_limits[i];
+    if(lower > bounds.min[i])
+    {
+      bounds.min[i] = lower;
+      bounds.solver_min[i] = lower-SOLVER_LIMIT_TOLERANCE;
+      bounds.narrowed = true;
+    }
+    if(upper < bounds.max[i])
+    {
+      bounds.max[i] = upper;
+      bounds.solver_max[i] = upper+SOLVER_LIMIT_TOLERANCE;
+      bounds.narrowed = true;
+    }
+  }
+}
+
+int IKFastKinematicsPlugin::computeIK(KDL::Frame &pose_frame, const IkReal *vfree, const IkReal *lower, const IkReal *upper,
+                                      IkSolutionListBase<IkReal> &solutions) const
+{
+  // A failed check is counted instead of unwinding into the caller. With IKFAST_NO_EXCEPTIONS the solver
+  // returns no solutions for it and there is no exception machinery on the solver path.
+#ifdef IKFAST_NO_EXCEPTIONS
+  const unsigned int num_errors = ikfast::GetErrorCount();
+  const int numsol = runIKFast(pose_frame, vfree, lower, upper, solutions);
+  if(ikfast::GetErrorCount() != num_errors)
+    __sync_fetch_and_add(&num_solver_errors_, 1);
+  return numsol;
+#else
+  try
+  {
+    return runIKFast(pose_frame, vfree, lower, upper, solutions);
+  }
+  catch(const std::exception &e)
+  {
+    __sync_fetch_and_add(&num_solver_errors_, 1);
+    ROS_DEBUG_STREAM_NAMED("ikfast","IKFast failed: " << e.what());
+    solutions.Clear();
+    return 0;
+  }
+#endif
+}
+
+int IKFastKinematicsPlugin::runIKFast(KDL::Frame &pose_frame, const IkReal *vfree, const IkReal *lower, const IkReal *upper,
+                                      IkSolutionListBase<IkReal> &solutions) const
+{
+  // IKFast56/61
+  solutions.Clear();
+
+  IkReal trans[3];
+  trans[0] = pose_frame.p[0];//-.18;
+  trans[1] = pose_frame.p[1];
+  trans[2] = pose_frame.p[2];
+
+  KDL::Rotation mult;
+  KDL::Vector direction;
+
+  switch (GetIkType())
+  {
+    case IKP_Transform6D:
+      // For **Transform6D**, eerot is 9 values for the 3x3 rotation matrix.
+
+      mult = pose_frame.M;
+
+      IkReal vals[9];
+      vals[0] = mult(0,0);
+      vals[1] = mult(0,1);
+      vals[2] = mult(0,2);
+      vals[3] = mult(1,0);
+      vals[4] = mult(1,1);
+      vals[5] = mult(1,2);
+      vals[6] = mult(2,0);
+      vals[7] = mult(2,1);
+      vals[8] = mult(2,2);
+
+      // IKFast56/61, only the branches within joint limits are solved
+      ComputeIkLimited(trans, vals, vfree, lower, upper, solutions);
+      return solutions.GetNumSolutions();
+
+    case IKP_Direction3D:
+    case IKP_Ray4D:
+    case IKP_TranslationDirection5D:
+      // For **Direction3D**, **Ray4D**, and **TranslationDirection5D**, the first 3 values represent the target direction.
+
+      direction = pose_frame.M * KDL::Vector(0, 0, 1);
+      IkReal dir[3];
+      for(int i = 0; i < 3; ++i)
+        dir[i] = direction.data[i];
+      ComputeIk(trans, dir, vfree, solutions);
+      return solutions.GetNumSolutions();
+
+    case IKP_TranslationXAxisAngle4D:
+    case IKP_TranslationYAxisAngle4D:
+    case IKP_TranslationZAxisAngle4D:
+      // For **TranslationXAxisAngle4D**, **TranslationYAxisAngle4D**, and **TranslationZAxisAngle4D**, the first value represents the angle.
+      ROS_ERROR_NAMED("ikfast", "IK for this IkParameterizationType not implemented yet.");
+      return 0;
+
+    case IKP_TranslationLocalGlobal6D:
+      // For **TranslationLocalGlobal6D**, the diagonal elements ([0],[4],[8]) are the local translation inside the end effector coordinate system.
+      ROS_ERROR_NAMED("ikfast", "IK for this IkParameterizationType not implemented yet.");
+      return 0;
+
+    case IKP_Rotation3D:
+    case IKP_Translation3D:
+    case IKP_Lookat3D:
+    case IKP_TranslationXY2D:
+    case IKP_TranslationXYOrientation3D:
+    case IKP_TranslationXAxisAngleZNorm4D:
+    case IKP_TranslationYAxisAngleXNorm4D:
+    case IKP_TranslationZAxisAngleYNorm4D:
+      ROS_ERROR_NAMED("ikfast", "IK for this IkParameterizationType not implemented yet.");
+      return 0;
+
+    default:
+      ROS_ERROR_NAMED("ikfast", "Unknown IkParameterizationType! Was the solver generated with an incompatible version of Openrave?");
+      return 0;
+  }
+}
+
+void IKFastKinematicsPlugin::rankSolutions(const KDL::Frame &pose_frame, const IkSolutionListBase<IkReal> &solutions,
+                                           const double *ik_seed_state, const JointBounds &bounds, bool closest,
+                                           RankedSolutions &ranked) const
+{
+  ranked.size = 0;
+  const std::size_t numsol = std::min(solutions.GetNumSolutions(), static_cast<size_t>(IKFAST_MAX_SOLUTIONS));
+  for(std::size_t s = 0; s < numsol; ++s)
+  {
+    IkReal values[IKFAST_MAX_JOINTS];
+    solutions.GetSolution(s).GetSolution(values, NULL);
+    double *sol = ranked.values[ranked.size];
+    for(std::size_t i = 0; i < num_joints_; ++i)
+      sol[i] = values[i];
+    // A solution the refinement can not move onto the pose is a spurious or badly rounded root of the solver
+    if(refine_solutions_ && !refineSolution(pose_frame, sol))
+      continue;
+
+    // Fixed trip count and no early exit, so the compiler unrolls the check
+    bool obeys_limits = true;
+    for(int i = 0; i < IKFAST_MAX_JOINTS; ++i)
+      obeys_limits &= (sol[i] >= bounds.min[i]) && (sol[i] <= bounds.max[i]);
+    if(obeys_limits)
+    {
+      ranked.order[ranked.size] = ranked.size;
+      ++ranked.size;
+    }
+  }
+
+  if(!closest)
+    return;
+
+  // Joint major and without branches, so the inner loop vectorizes across solutions
+  for(std::size_t s = 0; s < ranked.size; ++s)
+    ranked.distances[s] = 0;
+  for(std::size_t i = 0; i < num_joints_; ++i)
+  {
+    const double seed = ik_seed_state[i];
+    const double weight = joint_weights_[i];
+    for(std::size_t s = 0; s < ranked.size; ++s)
+    {
+      double diff = wrapAngle(ranked.values[s][i] - seed);
+      ranked.distances[s] += weight*diff*diff;
+    }
+  }
+
+  // Insertion sort of at most IKFAST_MAX_SOLUTIONS entries, stable so ties keep the IKFast order
+  for(std::size_t s = 1; s < ranked.size; ++s)
+  {
+    int index = ranked.order[s];
+    std::size_t k = s;
+    while(k > 0 && ranked.distances[ranked.order[k-1]] > ranked.distances[index])
+    {
+      ranked.order[k] = ranked.order[k-1];
+      --k;
+    }
+    ranked.order[k] = index;
+  }
+}
+
+bool IKFastKinematicsPlugin::refineSolution(const KDL::Frame &pose_frame, double *solution, double max_step) const
+{
+  using baxter_ikfast_plugin::ARM_FK_NUM_FRAMES;
+  using baxter_ikfast_plugin::ARM_FK_FRAME_SIZE;
+
+  double joints[IKFAST_MAX_JOINTS];
+  std::copy(solution, solution+num_joints_, joints);
+  const int free_joint = free_params_.empty() ? -1 : free_params_[0];
+
+  // The iterate closest to the pose so far, starting with the unrefined solution
+  double best_joints[IKFAST_MAX_JOINTS];
+  double best_error = std::numeric_limits<double>::infinity();
+
+  double frames[ARM_FK_NUM_FRAMES*ARM_FK_FRAME_SIZE];
+  for(int iteration = 0; iteration <= REFINE_MAX_ITERATIONS; ++iteration)
+  {
+    baxter_ikfast_plugin::computeArmFK(joints, 1, frames);
+    const double *tip = frames + (ARM_FK_NUM_FRAMES-1)*ARM_FK_FRAME_SIZE;
+
+    // Position error, and the rotation error as the rotation vector of target * tip^T for small angles
+    Eigen::Matrix<double,6,1> error;
+    double rotation[9];
+    for(int i = 0; i < 3; ++i)
+    {
+      error(i) = pose_frame.p(i) - tip[9+i];
+      for(int j = 0; j < 3; ++j)
+        rotation[i*3+j] = pose_frame.M(i,0)*tip[j*3+0] + pose_frame.M(i,1)*tip[j*3+1] + pose_frame.M(i,2)*tip[j*3+2];
+    }
+    error(3) = 0.5*(rotation[7] - rotation[5]);
+    error(4) = 0.5*(rotation[2] - rotation[6]);
+    error(5) = 0.5*(rotation[3] - rotation[1]);
+
+    const double error_norm = error.lpNorm<Eigen::Infinity>();
+    if(error_norm < REFINE_TOLERANCE)
+    {
+      std::copy(joints, joints+num_joints_, solution);
+      return true;
+    }
+    if(error_norm < best_error)
+    {
+      best_error = error_norm;
+      std::copy(joints, joints+num_joints_, best_joints);
+    }
+    if(iteration == REFINE_MAX_ITERATIONS)
+      break;
+
+    // Geometric Jacobian of the joints other than the free one, joint j turns about the z axis of frame j
+    Eigen::Matrix<double,6,6> jacobian;
+    int column = 0;
+    for(int j = 0; j < static_cast<int>(num_joints_) && column < 6; ++j)
+    {
+      if(j == free_joint)
+        continue;
+      const double *frame = frames + j*ARM_FK_FRAME_SIZE;
+      const double axis[3] = {frame[2], frame[5], frame[8]};
+      const double arm[3] = {tip[9]-frame[9], tip[10]-frame[10], tip[11]-frame[11]};
+      jacobian(0,column) = axis[1]*arm[2] - axis[2]*arm[1];
+      jacobian(1,column) = axis[2]*arm[0] - axis[0]*arm[2];
+      jacobian(2,column) = axis[0]*arm[1] - axis[1]*arm[0];
+      jacobian(3,column) = axis[0];
+      jacobian(4,column) = axis[1];
+      jacobian(5,column) = axis[2];
+      ++column;
+    }
+
+    const Eigen::Matrix<double,6,1> step = jacobian.partialPivLu().solve(error);
+    // Near a singularity the step is meaningless, stop at the best iterate so far
+    if(!(step.lpNorm<Eigen::Infinity>() < max_step))
+      break;
+    column = 0;
+    for(int j = 0; j < static_cast<int>(num_joints_) && column < 6; ++j)
+    {
+      if(j == free_joint)
+        continue;
+      joints[j] += step(column++);
+    }
+  }
+
+  if(best_error < REFINE_ACCEPT_TOLERANCE)
+  {
+    std::copy(best_joints, best_joints+num_joints_, solution);
+    return true;
+  }
+  return false;
+}
+
+void IKFastKinematicsPlugin::getFreeJointIncrements(std::size_t index, double initial_guess, const std::vector<double> &consistency_limits,
+                                                    int &num_positive_increments, int &num_negative_increments) const
+{
+  // The consistency limits of the other joints are enforced on the solutions, see getJointBounds
+  const int joint = free_params_[index];
+  double max_limit = joint_max_[joint];
+  double min_limit = joint_min_[joint];
+  if(!consistency_limits.empty())
+  {
+    max_limit = fmin(max_limit, initial_guess+consistency_limits[joint]);
+    min_limit = fmax(min_limit, initial_guess-consistency_limits[joint]);
+  }
+  num_positive_increments = (int)((max_limit-initial_guess)/search_discretization_);
+  num_negative_increments = (int)((initial_guess-min_limit)/search_discretization_);
+}
+
+void IKFastKinematicsPlugin::initFreeJointGrid(const double *ik_seed_state, const std::vector<double> &consistency_limits,
+                                               FreeJointGrid &grid, std::vector<double> &vfree) const
+{
+  vfree.resize(free_params_.size());
+  for(std::size_t i = 0; i < free_params_.size(); ++i)
+  {
+    grid.initial_guess[i] = ik_seed_state[free_params_[i]];
+    grid.counter[i] = 0;
+    getFreeJointIncrements(i, grid.initial_guess[i], consistency_limits,
+                           grid.num_positive_increments[i], grid.num_negative_increments[i]);
+    vfree[i] = grid.initial_guess[i];
+  }
+}
+
+bool IKFastKinematicsPlugin::nextFreeJointValues(FreeJointGrid &grid, std::vector<double> &vfree) const
+{
+  // Odometer over the free joints, a free joint that ran out of steps goes back to its seed value and
+  // the next one takes a step
+  for(std::size_t i = 0; i < free_params_.size(); ++i)
+  {
+    if(getCount(grid.counter[i], grid.num_positive_increments[i], -grid.num_negative_increments[i]))
+    {
+      vfree[i] = grid.initial_guess[i]+search_discretization_*grid.counter[i];
+      return true;
+    }
+    grid.counter[i] = 0;
+    vfree[i] = grid.initial_guess[i];
+  }
+  return false;
+}
+
+void IKFastKinematicsPlugin::fillFreeParams(int count, int *array)
+{
+  free_params_.clear();
+  for(int i=0; i<count;++i) free_params_.push_back(array[i]);
+}
+
+bool IKFastKinematicsPlugin::getCount(int &count, const int &max_count, const int &min_count) const
+{
+  if(count > 0)
+  {
+    if(-count >= min_count)
+    {
+      count = -count;
+      return true;
+    }
+    else if(count+1 <= max_count)
+    {
+      count = count+1;
+      return true;
+    }
+    else
+    {
+      return false;
+    }
+  }
+  else
+  {
+    if(1-count <= max_count)
+    {
+      count = 1-count;
+      return true;
+    }
+    else if(count-1 >= min_count)
+    {
+      count = count -1;
+      return true;
+    }
+    else
+      return false;
+  }
+}
+
+bool IKFastKinematicsPlugin::getPositionFK(const std::vector<std::string> &link_names,
+                                           const std::vector<double> &joint_angles,
+                                           std::vector<geometry_msgs::Pose> &poses) const
+{
+  if(link_names.size() == 0) {
+    ROS_WARN_STREAM_NAMED("ikfast","Link names with nothing");
+    return false;
+  }
+
+  if(joint_angles.size() != num_joints_)
+  {
+    ROS_ERROR_STREAM_NAMED("ikfast","Joint angles must have size " << num_joints_ << " instead of size " << joint_angles.size());
+    return false;
+  }
+
+  double joints[baxter_ikfast_plugin::ARM_FK_NUM_JOINTS];
+  for(size_t i = 0; i < num_joints_; ++i)
+    joints[i] = joint_angles[i];
+
+  // Every frame of the chain in one pass, with the batch size of one this is ARM_FK_NUM_FRAMES frames after another
+  double frames[baxter_ikfast_plugin::ARM_FK_NUM_FRAMES*baxter_ikfast_plugin::ARM_FK_FRAME_SIZE];
+  baxter_ikfast_plugin::computeArmFK(joints, 1, frames);
+
+  poses.resize(link_names.size());
+  for(size_t l = 0; l < link_names.size(); ++l)
+  {
+    geometry_msgs::Pose &pose = poses[l];
+    if(link_names[l] == base_frame_)
+    {
+      pose.position.x = pose.position.y = pose.position.z = 0.0;
+      pose.orientation.x = pose.orientation.y = pose.orientation.z = 0.0;
+      pose.orientation.w = 1.0;
+      continue;
+    }
+
+    // link_names_ lists the links of the chain in the order of the FK frames
+    size_t f = std::find(link_names_.begin(), link_names_.end(), link_names[l]) - link_names_.begin();
+    if(f >= link_names_.size() || f >= static_cast<size_t>(baxter_ikfast_plugin::ARM_FK_NUM_FRAMES))
+    {
+      ROS_ERROR_NAMED("ikfast","Can not compute FK for %s, it is not a link between %s and %s",
+                      link_names[l].c_str(), base_frame_.c_str(), tip_frame_.c_str());
+      return false;
+    }
+
+    const double *frame = frames + f*baxter_ikfast_plugin::ARM_FK_FRAME_SIZE;
+    KDL::Rotation rotation(frame[0], frame[1], frame[2], frame[3], frame[4], frame[5], frame[6], frame[7], frame[8]);
+    rotation.GetQuaternion(pose.orientation.x, pose.orientation.y, pose.orientation.z, pose.orientation.w);
+    pose.position.x = frame[9];
+    pose.position.y = frame[10];
+    pose.position.z = frame[11];
+  }
+
+  return true;
+}
+
+bool IKFastKinematicsPlugin::searchPositionIK(const geometry_msgs::Pose &ik_pose,
+                                           const std::vector<double> &ik_seed_state,
+                                           double timeout,
+                                           std::vector<double> &solution,
+                                           moveit_msgs::MoveItErrorCodes &error_code,
+                                           const kinematics::KinematicsQueryOptions &options) const
+{
+  const IKCallbackFn solution_callback = 0; 
+  std::vector<double> consistency_limits;
+
+  return searchPositionIK(ik_pose,
+                          ik_seed_state,
+                          timeout,
+                          consistency_limits,
+                          solution,
+                          solution_callback,
+                          error_code,
+                          options);
+}
+    
+bool IKFastKinematicsPlugin::searchPositionIK(const geometry_msgs::Pose &ik_pose,
+                                           const std::vector<double> &ik_seed_state,
+                                           double timeout,
+                                           const std::vector<double> &consistency_limits,
+                                           std::vector<double> &solution,
+                                           moveit_msgs::MoveItErrorCodes &error_code,
+                                           const kinematics::KinematicsQueryOptions &options) const
+{
+  const IKCallbackFn solution_callback = 0; 
+  return searchPositionIK(ik_pose,
+                          ik_seed_state,
+                          timeout,
+                          consistency_limits,
+                          solution,
+                          solution_callback,
+                          error_code,
+                          options);
+}
+
+bool IKFastKinematicsPlugin::searchPositionIK(const geometry_msgs::Pose &ik_pose,
+                                           const std::vector<double> &ik_seed_state,
+                                           double timeout,
+                                           std::vector<double> &solution,
+                                           const IKCallbackFn &solution_callback,
+                                           moveit_msgs::MoveItErrorCodes &error_code,
+                                           const kinematics::KinematicsQueryOptions &options) const
+{
+  std::vector<double> consistency_limits;
+  return searchPositionIK(ik_pose,
+                          ik_seed_state,
+                          timeout,
+                          consistency_limits,
+                          solution,
+                          solution_callback,
+                          error_code,
+                          options);
+}
+
+bool IKFastKinematicsPlugin::searchPositionIK(const geometry_msgs::Pose &ik_pose,
+                                              const std::vector<double> &ik_seed_state,
+                                              double timeout,
+                                              const std::vector<double> &consistency_limits,
+                                              std::vector<double> &solution,
+                                              const IKCallbackFn &solution_callback,
+                                              moveit_msgs::MoveItErrorCodes &error_code,
+                                              const kinematics::KinematicsQueryOptions &options) const
+{
+  ROS_DEBUG_STREAM_NAMED("ikfast","searchPositionIK");
+
+  // -------------------------------------------------------------------------------------------------
+  // Error Checking
+  if(!active_)
+  {
+    ROS_ERROR_STREAM_NAMED("ikfast","Kinematics not active");
+    error_code.val = error_code.NO_IK_SOLUTION;
+    return false;
+  }
+
+  if(ik_seed_state.size() != num_joints_)
+  {
+    ROS_ERROR_STREAM_NAMED("ikfast","Seed state must have size " << num_joints_ << " instead of size " << ik_seed_state.size());
+    error_code.val = error_code.NO_IK_SOLUTION;
+    return false;
+  }
+
+  if(!consistency_limits.empty() && consistency_limits.size() != num_joints_)
+  {
+    ROS_ERROR_STREAM_NAMED("ikfast","Consistency limits be empty or must have size " << num_joints_ << " instead of size " << consistency_limits.size());
+    error_code.val = error_code.NO_IK_SOLUTION;
+    return false;
+  }
+
+  // -------------------------------------------------------------------------------------------------
+  // Initialize
+
+  KDL::Frame frame;
+  tf::poseMsgToKDL(ik_pose,frame);
+
+  // Solutions outside the consistency limits of any joint are rejected, the solver does not even follow
+  // the branches that leave them
+  JointBounds bounds;
+  getJointBounds(&ik_seed_state[0], consistency_limits, 0.0, bounds);
+
+  ScratchLease scratch(*this);
+
+  // Check if there are no redundant joints
+  if(free_params_.size()==0)
+  {
+    ROS_DEBUG_STREAM_NAMED("ikfast","No need to search since no free params/redundant joints");
+    if(tryFreeJointValue(ik_pose, frame, ik_seed_state, bounds, std::vector<double>(), solution_callback, *scratch, solution, error_code))
+      return true;
+    ROS_DEBUG_STREAM_NAMED("ikfast","No solution within the joint and consistency limits passes the callback");
+    error_code.val = moveit_msgs::MoveItErrorCodes::NO_IK_SOLUTION;
+    return false;
+  }
+
+  ros::Time maxTime = ros::Time::now() + ros::Duration(timeout);
+
+  // -------------------------------------------------------------------------------------------------
+  // The search range of every free joint is bounded by its consistency limit if needed
+  FreeJointGrid &grid = scratch->grid;
+  std::vector<double> &vfree = scratch->vfree;
+  initFreeJointGrid(&ik_seed_state[0], consistency_limits, grid, vfree);
+  const double initial_guess = grid.initial_guess[0];
+  const int num_positive_increments = grid.num_positive_increments[0];
+  const int num_negative_increments = grid.num_negative_increments[0];
+
+  // -------------------------------------------------------------------------------------------------
+  // Begin searching
+
+  ROS_DEBUG_STREAM_NAMED("ikfast","Free param is " << free_params_[0] << " initial guess is " << initial_guess << ", # positive increments: " << num_positive_increments << ", # negative increments: " << num_negative_increments);
+
+  // The seed of the reachability map and the values that solved poses in the same cell before, as long as
+  // they are within the range of the sweep
+  double prior_values[1+baxter_ikfast_plugin::FreeJointPrior::VALUES_PER_CELL];
+  int num_prior_values = lookupReachabilityMap(frame, prior_values[0]) ? 1 : 0;
+  num_prior_values += lookupFreeJointPrior(frame, prior_values+num_prior_values);
+  for(int i = 0; i < num_prior_values; ++i)
+  {
+    if(prior_values[i] > initial_guess+search_discretization_*num_positive_increments ||
+       prior_values[i] < initial_guess-search_discretization_*num_negative_increments)
+      continue;
+    vfree[0] = prior_values[i];
+    ROS_DEBUG_STREAM_NAMED("ikfast","Trying free joint value " << vfree[0] << " from the reachability map or the free joint prior");
+    if(tryFreeJointValue(ik_pose, frame, ik_seed_state, bounds, vfree, solution_callback, *scratch, solution, error_code))
+    {
+      recordFreeJointPrior(frame, solution);
+      return true;
+    }
+  }
+  vfree[0] = initial_guess;
+
+  if(search_pool_)
+  {
+    FreeJointSweep sweep;
+    sweep.ik_pose = &ik_pose;
+    sweep.ik_seed_state = &ik_seed_state[0];
+    sweep.bounds = &bounds;
+    sweep.frame = frame;
+    sweep.solution_callback = &solution_callback;
+    sweep.initial_guess = initial_guess;
+    sweep.num_positive_increments = std::max(num_positive_increments, 0);
+    sweep.num_negative_increments = std::max(num_negative_increments, 0);
+    sweep.num_steps = 1 + sweep.num_positive_increments + sweep.num_negative_increments;
+    sweep.max_time = maxTime;
+    sweep.next_step = 0;
+    sweep.best_step = sweep.num_steps;
+    sweep.timed_out = 0;
+
+    SweepJob job = {this, &sweep};
+    if(search_pool_->run(job))
+    {
+      if(sweep.best_step < sweep.num_steps)
+      {
+        solution.assign(sweep.solution, sweep.solution+num_joints_);
+        error_code.val = error_code.SUCCESS;
+        recordFreeJointPrior(frame, solution);
+        return true;
+      }
+      error_code.val = sweep.timed_out ? error_code.TIMED_OUT : error_code.NO_IK_SOLUTION;
+      return false;
+    }
+    ROS_DEBUG_NAMED("ikfast","Search pool is busy, sweeping the free joint on the calling thread only");
+  }
+
+  while(true)
+  {
+    if(tryFreeJointValue(ik_pose, frame, ik_seed_state, bounds, vfree, solution_callback, *scratch, solution, error_code))
+    {
+      recordFreeJointPrior(frame, solution);
+      return true;
+    }
+
+    if(!nextFreeJointValues(grid, vfree))
+    {
+      error_code.val = moveit_msgs::MoveItErrorCodes::NO_IK_SOLUTION;
+      return false;
+    }
+
+    // A grid over several free joints can be far larger than one sweep
+    if(ros::Time::now() > maxTime)
+    {
+      error_code.val = moveit_msgs::MoveItErrorCodes::TIMED_OUT;
+      return false;
+    }
+
+    ROS_DEBUG_STREAM_NAMED("ikfast","Attempt " << grid.counter[0] << " with 0th free joint having value " << vfree[0]);
+  }
+}
+
+bool IKFastKinematicsPlugin::tryFreeJointValue(const geometry_msgs::Pose &ik_pose, KDL::Frame &frame,
+                                               const std::vector<double> &ik_seed_state, const JointBounds &bounds,
+                                               const std::vector<double> &vfree,
+                                               const IKCallbackFn &solution_callback, IKScratch &scratch,
+                                               std::vector<double> &solution, moveit_msgs::MoveItErrorCodes &error_code) const
+{
+  IkReal values[IKFAST_MAX_JOINTS];
+  std::copy(vfree.begin(), vfree.end(), values);
+
+  IKFastSolutionList &solutions = scratch.solutions;
+  int numsol = solve(frame, vfree.empty() ? NULL : values, bounds, solutions);
+
+  ROS_DEBUG_STREAM_NAMED("ikfast","Found " << numsol << " solutions from IKFast");
+
+  RankedSolutions &ranked = scratch.ranked;
+  rankSolutions(frame, solutions, &ik_seed_state[0], bounds, closest_solution_ranking_, ranked);
+  for(std::size_t r = 0; r < ranked.size; ++r)
+  {
+    const double *sol = ranked.values[ranked.order[r]];
+    solution.assign(sol, sol+num_joints_);
+
+    // This solution is within joint limits, now check if in collision (if callback provided)
+    if(!solution_callback.empty())
+    {
+      solution_callback(ik_pose, solution, error_code);
+    }
+    else
+    {
+      error_code.val = error_code.SUCCESS;
+    }
+
+    if(error_code.val == error_code.SUCCESS)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+IKFastKinematicsPlugin::ScratchLease::ScratchLease(const IKFastKinematicsPlugin &plugin)
+{
+  scratch_ = &plugin.getThreadScratch();
+  if(scratch_->in_use)
+  {
+    nested_.reset(new IKScratch);
+    scratch_ = nested_.get();
+  }
+  scratch_->in_use = true;
+}
+
+IKFastKinematicsPlugin::IKScratch& IKFastKinematicsPlugin::getThreadScratch() const
+{
+  // Freed by boost when the thread exits
+  IKScratch *scratch = thread_scratch_.get();
+  if(!scratch)
+  {
+    scratch = new IKScratch;
+    scratch->vfree.reserve(IKFAST_MAX_JOINTS);
+    scratch->sweep_solution.reserve(IKFAST_MAX_JOINTS);
+    thread_scratch_.reset(scratch);
+  }
+  return *scratch;
+}
+
+int IKFastKinematicsPlugin::lookupFreeJointPrior(const KDL::Frame &frame, double *values) const
+{
+  if(!free_joint_prior_)
+    return 0;
+  const double direction[3] = {frame.M(0,2), frame.M(1,2), frame.M(2,2)};
+  return free_joint_prior_->lookup(frame.p.data, direction, values);
+}
+
+bool IKFastKinematicsPlugin::readChainConstants(const std::string &xml)
+{
+#ifdef BAXTER_ARM_CHAIN_CONSTANTS
+  using namespace baxter_ikfast_plugin;
+  if(hashURDF(xml) != ARM_CHAIN_URDF_HASH)
+  {
+    ROS_INFO_NAMED("ikfast","The URDF differs from the one of the arm chain constants, parsing it");
+    return false;
+  }
+  for(int c = 0; c < ARM_CHAIN_COUNT; ++c)
+  {
+    const ArmChainConstants &chain = ARM_CHAINS[c];
+    if(base_frame_ != chain.base_frame)
+      continue;
+    // MoveIt passes the last link of the group as the tip, <arm>_wrist for the arm groups of the SRDF. The
+    // chain goes on to the gripper over fixed joints, so any link from the child of the last joint on matches.
+    int num_links = 0;
+    for(int l = chain.num_joint_links-1; l < chain.num_links && num_links == 0; ++l)
+      if(tip_frame_ == chain.link_names[l])
+        num_links = l+1;
+    if(num_links == 0)
+      continue;
+    if(ARM_CHAIN_NUM_JOINTS != IKFAST_MAX_JOINTS)
+      return false;
+    joint_names_.assign(chain.joint_names, chain.joint_names+ARM_CHAIN_NUM_JOINTS);
+    link_names_.assign(chain.link_names, chain.link_names+num_links);
+    std::copy(chain.joint_min, chain.joint_min+ARM_CHAIN_NUM_JOINTS, joint_min_);
+    std::copy(chain.joint_max, chain.joint_max+ARM_CHAIN_NUM_JOINTS, joint_max_);
+    std::copy(chain.joint_has_limits, chain.joint_has_limits+ARM_CHAIN_NUM_JOINTS, joint_has_limits_);
+    ROS_INFO_STREAM_NAMED("ikfast","Using the arm chain constants from " << base_frame_ << " to " << tip_frame_);
+    return true;
+  }
+  ROS_INFO_STREAM_NAMED("ikfast","No arm chain constants from " << base_frame_ << " to " << tip_frame_ << ", parsing the URDF");
+#else
+  ROS_INFO_NAMED("ikfast","Built without the arm chain constants, parsing the URDF");
+#endif
+  return false;
+}
+
+bool IKFastKinematicsPlugin::readChainFromURDF(const std::string &xml)
+{
+  urdf::Model robot_model;
+  robot_model.initString(xml);
+
+  ROS_INFO_STREAM_NAMED("ikfast","Reading the joints and links from " << base_frame_ << " to " << tip_frame_ << " from the URDF");
+
+  std::vector<double> lower_limits, upper_limits;
+  std::vector<bool> has_limits;
+  boost::shared_ptr<urdf::Link> link = boost::const_pointer_cast<urdf::Link>(robot_model.getLink(tip_frame_));
+  while(link->name != base_frame_ && joint_names_.size() <= num_joints_)
+  {
+    ROS_DEBUG_NAMED("ikfast","Link %s",link->name.c_str());
+    link_names_.push_back(link->name);
+    boost::shared_ptr<urdf::Joint> joint = link->parent_joint;
+    if(joint)
+    {
+      if (joint->type != urdf::Joint::UNKNOWN && joint->type != urdf::Joint::FIXED)
+      {
+        ROS_DEBUG_STREAM_NAMED("ikfast","Adding joint " << joint->name );
+
+        joint_names_.push_back(joint->name);
+        if ( joint->type != urdf::Joint::CONTINUOUS )
+        {
+          has_limits.push_back(true);
+          if(joint->safety)
+          {
+            lower_limits.push_back(joint->safety->soft_lower_limit);
+            upper_limits.push_back(joint->safety->soft_upper_limit);
+          } else {
+            lower_limits.push_back(joint->limits->lower);
+            upper_limits.push_back(joint->limits->upper);
+          }
+        }
+        else
+        {
+          has_limits.push_back(false);
+          lower_limits.push_back(-M_PI);
+          upper_limits.push_back(M_PI);
+        }
+      }
+    } else
+    {
+      ROS_WARN_NAMED("ikfast","no joint corresponding to %s",link->name.c_str());
+    }
+    link = link->getParent();
+  }
+
+  if(joint_names_.size() != num_joints_)
+  {
+    ROS_FATAL_STREAM_NAMED("ikfast","Joint numbers mismatch: URDF has " << joint_names_.size() << " and IKFast has " << num_joints_);
+    return false;
+  }
+
+  std::reverse(link_names_.begin(),link_names_.end());
+  std::reverse(joint_names_.begin(),joint_names_.end());
+  std::reverse_copy(lower_limits.begin(),lower_limits.end(),joint_min_);
+  std::reverse_copy(upper_limits.begin(),upper_limits.end(),joint_max_);
+  std::reverse_copy(has_limits.begin(),has_limits.end(),joint_has_limits_);
+  return true;
+}
+
+bool IKFastKinematicsPlugin::lookupReachabilityMap(const KDL::Frame &frame, double &value) const
+{
+  if(!reachability_map_.isLoaded())
+    return false;
+  double position[3], rotation[9], seed[baxter_ikfast_plugin::REACHABILITY_MAP_MAX_JOINTS];
+  reachability_map_.mountToBase(frame.p.data, frame.M.data, position, rotation);
+  if(!reachability_map_.getSeed(position, rotation, seed))
+    return false;
+  value = seed[free_params_[0]];
+  return true;
+}
+
+void IKFastKinematicsPlugin::recordFreeJointPrior(const KDL::Frame &frame, const std::vector<double> &solution) const
+{
+  if(!free_joint_prior_)
+    return;
+  const double direction[3] = {frame.M(0,2), frame.M(1,2), frame.M(2,2)};
+  free_joint_prior_->record(frame.p.data, direction, solution[free_params_[0]]);
+}
+
+bool IKFastKinematicsPlugin::saveFreeJointPrior() const
+{
+  if(!free_joint_prior_ || free_joint_prior_file_.empty())
+    return false;
+  if(!free_joint_prior_->save(free_joint_prior_file_))
+  {
+    ROS_ERROR_STREAM_NAMED("ikfast","Could not write the free joint prior to " << free_joint_prior_file_);
+    return false;
+  }
+  ROS_DEBUG_STREAM_NAMED("ikfast","Saved " << free_joint_prior_->size() << " free joint prior cells to " << free_joint_prior_file_);
+  return true;
+}
+
+void IKFastKinematicsPlugin::sweepFreeJoint(FreeJointSweep &sweep) const
+{
+  KDL::Frame frame = sweep.frame;
+  IKScratch &scratch = getThreadScratch();
+  IKFastSolutionList &solutions = scratch.sweep_solutions;
+  RankedSolutions &ranked = scratch.sweep_ranked;
+  IkReal vfree[1];
+  std::vector<double> &sol = scratch.sweep_solution;
+
+  // Steps are handed out in order, so once one succeeds only the steps before it are still worth solving
+  const int both_sides = 2*std::min(sweep.num_positive_increments, sweep.num_negative_increments);
+  int step;
+  while((step = __sync_fetch_and_add(&sweep.next_step, 1)) < __sync_fetch_and_add(&sweep.best_step, 0))
+  {
+    if(ros::Time::now() > sweep.max_time)
+    {
+      __sync_lock_test_and_set(&sweep.timed_out, 1);
+      return;
+    }
+
+    // Same order as getCount(): 0, 1, -1, 2, -2, ... and only one side once the other is exhausted
+    int counter;
+    if(step <= both_sides)
+      counter = (step % 2) ? (step+1)/2 : -step/2;
+    else if(sweep.num_positive_increments > sweep.num_negative_increments)
+      counter = step - both_sides/2;
+    else
+      counter = both_sides/2 - step;
+    vfree[0] = sweep.initial_guess + search_discretization_*counter;
+
+    solve(frame, vfree, *sweep.bounds, solutions);
+    rankSolutions(frame, solutions, sweep.ik_seed_state, *sweep.bounds, closest_solution_ranking_, ranked);
+    for(std::size_t r = 0; r < ranked.size; ++r)
+    {
+      const double *values = ranked.values[ranked.order[r]];
+      sol.assign(values, values+num_joints_);
+
+      boost::mutex::scoped_lock lock(sweep.mutex);
+      if(step >= sweep.best_step)
+        return; // another thread succeeded closer to the seed
+
+      if(!sweep.solution_callback->empty())
+      {
+        moveit_msgs::MoveItErrorCodes error_code;
+        (*sweep.solution_callback)(*sweep.ik_pose, sol, error_code);
+        if(error_code.val != error_code.SUCCESS)
+          continue;
+      }
+
+      std::copy(sol.begin(), sol.end(), sweep.solution);
+      __sync_lock_test_and_set(&sweep.best_step, step);
+      return;
+    }
+  }
+}
+
+// Used when there are no redundant joints - aka no free params
+bool IKFastKinematicsPlugin::getPositionIK(const geometry_msgs::Pose &ik_pose,
+                                           const std::vector<double> &ik_seed_state,
+                                           std::vector<double> &solution,
+                                           moveit_msgs::MoveItErrorCodes &error_code,
+                                           const kinematics::KinematicsQueryOptions &options) const
+{
+  ROS_DEBUG_STREAM_NAMED("ikfast","getPositionIK");
+
+  if(!active_)
+  {
+    ROS_ERROR("kinematics not active");    
+    return false;
+  }
+
+  ScratchLease scratch(*this);
+  std::vector<double> &vfree = scratch->vfree;
+  vfree.resize(free_params_.size());
+  for(std::size_t i = 0; i < free_params_.size(); ++i)
+  {
+    int p = free_params_[i];
+    ROS_DEBUG_NAMED("ikfast","Free param %d is %f",p,ik_seed_state[p]);
+    vfree[i] = ik_seed_state[p];
+  }
+
+  KDL::Frame frame;
+  tf::poseMsgToKDL(ik_pose,frame);
+
+  IKFastSolutionList &solutions = scratch->solutions;
+  int numsol = solve(frame,vfree,solutions);
+
+  ROS_DEBUG_STREAM_NAMED("ikfast","Found " << numsol << " solutions from IKFast");
+  if(solutions.GetNumDropped() > 0)
+    ROS_DEBUG_STREAM_NAMED("ikfast","Dropped " << solutions.GetNumDropped() << " solutions beyond the first " << IKFAST_MAX_SOLUTIONS);
+
+  JointBounds bounds;
+  getJointBounds(&ik_seed_state[0], std::vector<double>(), LIMIT_TOLERANCE, bounds);
+  RankedSolutions &ranked = scratch->ranked;
+  rankSolutions(frame, solutions, &ik_seed_state[0], bounds, closest_solution_ranking_, ranked);
+  if(ranked.size > 0)
+  {
+    const double *sol = ranked.values[ranked.order[0]];
+    solution.assign(sol, sol+num_joints_);
+    error_code.val = moveit_msgs::MoveItErrorCodes::SUCCESS;
+    return true;
+  }
+
+  ROS_DEBUG_STREAM_NAMED("ikfast","No IK solution within joint limits");
+  error_code.val = moveit_msgs::MoveItErrorCodes::NO_IK_SOLUTION;
+  return false;
+}
+
+
+std::size_t IKFastKinematicsPlugin::getClosestPositionIK(const geometry_msgs::Pose &ik_pose,
+                                                         const std::vector<double> &ik_seed_state,
+                                                         std::size_t max_solutions,
+                                                         std::vector<std::vector<double> > &solutions,
+                                                         std::vector<double> &distances) const
+{
+  solutions.clear();
+  distances.clear();
+
+  if(!active_)
+  {
+    ROS_ERROR("kinematics not active");
+    return 0;
+  }
+
+  if(ik_seed_state.size() != num_joints_)
+  {
+    ROS_ERROR_STREAM_NAMED("ikfast","Seed state must have size " << num_joints_ << " instead of size " << ik_seed_state.size());
+    return 0;
+  }
+
+  IkReal vfree[IKFAST_MAX_JOINTS];
+  for(std::size_t i = 0; i < free_params_.size(); ++i)
+    vfree[i] = ik_seed_state[free_params_[i]];
+
+  KDL::Frame frame;
+  tf::poseMsgToKDL(ik_pose,frame);
+
+  IKFastSolutionList ik_solutions;
+  solve(frame, vfree, ik_solutions);
+
+  JointBounds bounds;
+  getJointBounds(&ik_seed_state[0], std::vector<double>(), LIMIT_TOLERANCE, bounds);
+  RankedSolutions ranked;
+  rankSolutions(frame, ik_solutions, &ik_seed_state[0], bounds, true, ranked);
+
+  const std::size_t num_returned = std::min(ranked.size, max_solutions);
+  solutions.resize(num_returned);
+  distances.resize(num_returned);
+  for(std::size_t r = 0; r < num_returned; ++r)
+  {
+    const double *sol = ranked.values[ranked.order[r]];
+    solutions[r].assign(sol, sol+num_joints_);
+    distances[r] = ranked.distances[ranked.order[r]];
+  }
+  return num_returned;
+}
+
+std::size_t IKFastKinematicsPlugin::getAllPositionIK(const geometry_msgs::Pose &ik_pose,
+                                                     const std::vector<double> &ik_seed_state,
+                                                     double timeout,
+                                                     const std::vector<double> &consistency_limits,
+                                                     double dedup_tolerance,
+                                                     IKSolutionsBuffer &buffer) const
+{
+  // clear() keeps the capacity of the buffer
+  buffer.num_solutions = 0;
+  buffer.solutions.clear();
+  buffer.index.clear();
+  buffer.complete = true;
+
+  if(!active_)
+  {
+    ROS_ERROR("kinematics not active");
+    return 0;
+  }
+
+  if(ik_seed_state.size() != num_joints_)
+  {
+    ROS_ERROR_STREAM_NAMED("ikfast","Seed state must have size " << num_joints_ << " instead of size " << ik_seed_state.size());
+    return 0;
+  }
+
+  if(!consistency_limits.empty() && consistency_limits.size() != num_joints_)
+  {
+    ROS_ERROR_STREAM_NAMED("ikfast","Consistency limits be empty or must have size " << num_joints_ << " instead of size " << consistency_limits.size());
+    return 0;
+  }
+
+  KDL::Frame frame;
+  tf::poseMsgToKDL(ik_pose,frame);
+
+  JointBounds bounds;
+  getJointBounds(&ik_seed_state[0], consistency_limits, 0.0, bounds);
+
+  ScratchLease scratch(*this);
+  FreeJointGrid &grid = scratch->grid;
+  std::vector<double> &vfree = scratch->vfree;
+  initFreeJointGrid(&ik_seed_state[0], consistency_limits, grid, vfree);
+  IkReal values[IKFAST_MAX_JOINTS];
+
+  ros::Time maxTime = ros::Time::now() + ros::Duration(timeout);
+  IKFastSolutionList &solutions = scratch->solutions;
+  RankedSolutions &ranked = scratch->ranked;
+  while(true)
+  {
+    std::copy(vfree.begin(), vfree.end(), values);
+    solve(frame, vfree.empty() ? NULL : values, bounds, solutions);
+    rankSolutions(frame, solutions, &ik_seed_state[0], bounds, false, ranked);
+
+    for(std::size_t r = 0; r < ranked.size; ++r)
+    {
+      const double *sol = ranked.values[ranked.order[r]];
+
+      // Only solutions whose first joint is within the tolerance can be duplicates
+      std::vector<std::pair<double, std::size_t> >::iterator it =
+        std::lower_bound(buffer.index.begin(), buffer.index.end(), std::make_pair(sol[0] - dedup_tolerance, std::size_t(0)));
+      bool duplicate = false;
+      for(; it != buffer.index.end() && it->first <= sol[0] + dedup_tolerance && !duplicate; ++it)
+      {
+        const double *other = &buffer.solutions[it->second*num_joints_];
+        duplicate = true;
+        for(std::size_t i = 0; i < num_joints_; ++i)
+        {
+          if(std::fabs(wrapAngle(sol[i] - other[i])) > dedup_tolerance)
+          {
+            duplicate = false;
+            break;
+          }
+        }
+      }
+      if(duplicate)
+        continue;
+
+      std::pair<double, std::size_t> entry(sol[0], buffer.num_solutions);
+      buffer.index.insert(std::upper_bound(buffer.index.begin(), buffer.index.end(), entry), entry);
+      buffer.solutions.insert(buffer.solutions.end(), sol, sol+num_joints_);
+      ++buffer.num_solutions;
+    }
+
+    if(!nextFreeJointValues(grid, vfree))
+      break;
+
+    if(ros::Time::now() > maxTime)
+    {
+      buffer.complete = false;
+      break;
+    }
+  }
+
+  return buffer.num_solutions;
+}
+
+std::size_t IKFastKinematicsPlugin::getPositionIKPath(const std::vector<geometry_msgs::Pose> &ik_poses,
+                                                      const std::vector<double> &ik_seed_state,
+                                                      double timeout,
+                                                      const std::vector<double> &consistency_limits,
+                                                      IKPathBuffer &buffer) const
+{
+  const std::size_t num_poses = ik_poses.size();
+
+  // resize() only allocates when the path is longer than any path seen before by this buffer
+  buffer.solutions.resize(num_poses*num_joints_);
+  buffer.num_solved = 0;
+  buffer.num_continued = 0;
+  buffer.num_searched = 0;
+
+  if(!active_)
+  {
+    ROS_ERROR("kinematics not active");
+    return 0;
+  }
+
+  if(ik_seed_state.size() != num_joints_)
+  {
+    ROS_ERROR_STREAM_NAMED("ikfast","Seed state must have size " << num_joints_ << " instead of size " << ik_seed_state.size());
+    return 0;
+  }
+
+  if(!consistency_limits.empty() && consistency_limits.size() != num_joints_)
+  {
+    ROS_ERROR_STREAM_NAMED("ikfast","Consistency limits be empty or must have size " << num_joints_ << " instead of size " << consistency_limits.size());
+    return 0;
+  }
+
+  ros::Time maxTime = ros::Time::now() + ros::Duration(timeout);
+  KDL::Frame frame;
+  JointBounds bounds;
+  ScratchLease scratch(*this);
+  IKFastSolutionList &solutions = scratch->solutions;
+  RankedSolutions &ranked = scratch->ranked;
+  FreeJointGrid &grid = scratch->grid;
+  std::vector<double> &vfree = scratch->vfree;
+  IkReal values[IKFAST_MAX_JOINTS];
+  double continued[IKFAST_MAX_JOINTS];
+
+  for(std::size_t p = 0; p < num_poses; ++p)
+  {
+    const double *previous = p == 0 ? &ik_seed_state[0] : &buffer.solutions[(p-1)*num_joints_];
+    double *solution = &buffer.solutions[p*num_joints_];
+    tf::poseMsgToKDL(ik_poses[p], frame);
+    getJointBounds(previous, consistency_limits, 0.0, bounds);
+
+    // Continuation: Newton steps from the previous solution stay on its branch and cost a few FK evaluations.
+    // The refinement holds exactly one free joint.
+    if(free_params_.size() == 1)
+    {
+      std::copy(previous, previous+num_joints_, continued);
+      bool within_bounds = refineSolution(frame, continued, CONTINUATION_MAX_STEP);
+      for(int i = 0; i < IKFAST_MAX_JOINTS; ++i)
+        within_bounds &= (continued[i] >= bounds.min[i]) && (continued[i] <= bounds.max[i]);
+      if(within_bounds)
+      {
+        std::copy(continued, continued+num_joints_, solution);
+        ++buffer.num_continued;
+        ++buffer.num_solved;
+        continue;
+      }
+    }
+
+    // IKFast at the previous free joint values, then around them, taking the solution nearest to the previous one
+    initFreeJointGrid(previous, consistency_limits, grid, vfree);
+    bool searched = false;
+    while(true)
+    {
+      std::copy(vfree.begin(), vfree.end(), values);
+      solve(frame, vfree.empty() ? NULL : values, bounds, solutions);
+      rankSolutions(frame, solutions, previous, bounds, true, ranked);
+      if(ranked.size > 0)
+        break;
+      if(!nextFreeJointValues(grid, vfree) || ros::Time::now() > maxTime)
+      {
+        ROS_DEBUG_STREAM_NAMED("ikfast","No solution for pose " << p << " of the path");
+        return buffer.num_solved;
+      }
+      searched = true;
+    }
+
+    const double *sol = ranked.values[ranked.order[0]];
+    std::copy(sol, sol+num_joints_, solution);
+    if(searched)
+      ++buffer.num_searched;
+    ++buffer.num_solved;
+  }
+  return buffer.num_solved;
+}
+
+bool IKFastKinematicsPlugin::getIKCacheStatistics(std::size_t &hits, std::size_t &misses, std::size_t &size) const
+{
+  if(!ik_cache_)
+    return false;
+  ik_cache_->getStatistics(hits, misses, size);
+  return true;
+}
+
+void IKFastKinematicsPlugin::clearIKCache()
+{
+  if(ik_cache_)
+    ik_cache_->clear();
+}
+
+std::size_t IKFastKinematicsPlugin::getNumSolverErrors() const
+{
+  return __sync_fetch_and_add(&num_solver_errors_, 0);
+}
+
+void IKFastKinematicsPlugin::logStatistics() const
+{
+  std::size_t hits, misses, size;
+  if(getIKCacheStatistics(hits, misses, size))
+  {
+    const double hit_rate = hits + misses > 0 ? 100.0 * hits / (hits + misses) : 0.0;
+    ROS_INFO_STREAM_NAMED("ikfast","IK solution cache of " << group_name_ << ": " << hits << " hits, " << misses
+                          << " misses (" << hit_rate << "% hits), " << size << " solution sets");
+  }
+  if(active_)
+    ROS_INFO_STREAM_NAMED("ikfast",getNumSolverErrors() << " IKFast solver calls of " << group_name_
+                          << " failed a numerical check");
+}
+
+std::size_t IKFastKinematicsPlugin::getPositionIKBatch(const std::vector<geometry_msgs::Pose> &ik_poses,
+                                                       const std::vector<double> &ik_seed_states,
+                                                       IKBatchBuffer &buffer) const
+{
+  const std::size_t num_poses = ik_poses.size();
+
+  if(!active_)
+  {
+    ROS_ERROR("kinematics not active");
+    return 0;
+  }
+
+  if(ik_seed_states.size() != num_poses*num_joints_)
+  {
+    ROS_ERROR_STREAM_NAMED("ikfast","Seed states must have size " << num_poses*num_joints_ << " instead of size " << ik_seed_states.size());
+    return 0;
+  }
+
+  // resize() only allocates when the batch is larger than any batch seen before by this buffer
+  buffer.solutions.resize(num_poses*num_joints_);
+  buffer.found.resize(num_poses);
+  std::fill(buffer.found.begin(), buffer.found.end(), 0);
+
+  IkReal vfree[IKFAST_MAX_JOINTS];
+  IKFastSolutionList ik_solutions;
+  RankedSolutions ranked;
+  KDL::Frame frame;
+  std::size_t num_found = 0;
+  JointBounds bounds;
+  getJointBounds(NULL, std::vector<double>(), LIMIT_TOLERANCE, bounds); // the seed is only read for consistency limits
+
+  for(std::size_t p = 0; p < num_poses; ++p)
+  {
+    const double *seed = &ik_seed_states[p*num_joints_];
+    for(std::size_t i = 0; i < free_params_.size(); ++i)
+      vfree[i] = seed[free_params_[i]];
+
+    tf::poseMsgToKDL(ik_poses[p],frame);
+    solve(frame, vfree, ik_solutions);
+    rankSolutions(frame, ik_solutions, seed, bounds, closest_solution_ranking_, ranked);
+    if(ranked.size > 0)
+    {
+      const double *sol = ranked.values[ranked.order[0]];
+      std::copy(sol, sol+num_joints_, buffer.solutions.begin()+p*num_joints_);
+      buffer.found[p] = 1;
+      ++num_found;
+    }
+  }
+
+  return num_found;
+}
+
+/**
+ * @brief The plugin registered for the left_arm group. Each arm gets its own type so pluginlib can give
+ * both groups a plugin from this one library, the solver and all of the code are shared.
+ */
+class LeftArmIKFastKinematicsPlugin : public IKFastKinematicsPlugin
+{
+};
+
+/**
+ * @brief The plugin registered for the right_arm group
+ */
+class RightArmIKFastKinematicsPlugin : public IKFastKinematicsPlugin
+{
+};
+
+} // end namespace
+
+//register the per arm plugins as KinematicsBase implementations
+#include <pluginlib/class_list_macros.h>
+PLUGINLIB_EXPORT_CLASS(ikfast_kinematics_plugin::LeftArmIKFastKinematicsPlugin, kinematics::KinematicsBase);
+PLUGINLIB_EXPORT_CLASS(ikfast_kinematics_plugin::RightArmIKFastKinematicsPlugin, kinematics::KinematicsBase);
@@ -15,9 +15,21 @@
 /// ikfast version 61 generated on 2013-10-08 17:02:52.109034
 /// To compile with gcc:
 ///     gcc -lstdc++ ik.cpp
-/// To compile without any main function as a shared object (might need -llapack):
+/// To compile without any main function as a shared object (needs the Eigen 3 headers):
 ///     gcc -fPIC -lstdc++ -DIKFAST_NO_MAIN -DIKFAST_CLIBRARY -shared -Wl,-soname,libik.so -o libik.so ik.cpp
 #define IKFAST_HAS_LIBRARY
+
+// single precision build. the thresholds of the generated code assume double precision, they are widened to
+// the rounding errors of float.
+#ifdef IKFAST_SINGLE_PRECISION
+#define IKFAST_REAL float
+#define IKFAST_SINCOS_THRESH ((IkReal)0.0001)
+#define IKFAST_ATAN2_MAGTHRESH ((IkReal)2e-5)
+#define IKFAST_SOLUTION_THRESH ((IkReal)1e-4)
+#define IKFAST_EVALCOND_THRESH ((IkReal)0.01)
+#define IKFAST_CONSISTENCY_THRESH ((IkReal)0.01)
+#endif
+
 #include "ikfast.h" // found inside share/openrave-X.Y/python/ikfast.h
 using namespace ikfast;
 
@@ -30,10 +42,17 @@ IKFAST_COMPILE_ASSERT(IKFAST_VERSION==61);
 #include <limits>
 #include <algorithm>
 #include <complex>
+#include <Eigen/LU>
+#include <Eigen/Eigenvalues>
 
 #define IKFAST_STRINGIZE2(s) #s
 #define IKFAST_STRINGIZE(s) IKFAST_STRINGIZE2(s)
 
+// with IKFAST_NO_EXCEPTIONS the failed checks are counted, and the solver discards the solutions of the query
+#if defined(IKFAST_NO_EXCEPTIONS) && !defined(IKFAST_ASSERT)
+#define IKFAST_ASSERT(b) { if( !(b) ) { ++ikfast::GetErrorCount(); } }
+#endif
+
 #ifndef IKFAST_ASSERT
 #include <stdexcept>
 #include <sstream>
@@ -69,16 +88,6 @@ IKFAST_COMPILE_ASSERT(IKFAST_VERSION==61);
 #endif
 #endif // _MSC_VER
 
-// lapack routines
-extern "C" {
-  void dgetrf_ (const int* m, const int* n, double* a, const int* lda, int* ipiv, int* info);
-  void zgetrf_ (const int* m, const int* n, std::complex<double>* a, const int* lda, int* ipiv, int* info);
-  void dgetri_(const int* n, const double* a, const int* lda, int* ipiv, double* work, const int* lwork, int* info);
-  void dgesv_ (const int* n, const int* nrhs, double* a, const int* lda, int* ipiv, double* b, const int* ldb, int* info);
-  void dgetrs_(const char *trans, const int *n, const int *nrhs, double *a, const int *lda, int *ipiv, double *b, const int *ldb, int *info);
-  void dgeev_(const char *jobvl, const char *jobvr, const int *n, double *a, const int *lda, double *wr, double *wi,double *vl, const int *ldvl, double *vr, const int *ldvr, double *work, const int *lwork, int *info);
-}
-
 using namespace std; // necessary to get std math routines
 
 #ifdef IKFAST_NAMESPACE
@@ -109,6 +118,16 @@ inline double IKlog(double f) { return log(f); }
 #define IKFAST_SOLUTION_THRESH ((IkReal)1e-6)
 #endif
 
+// largest error of the equations a solution is checked with
+#ifndef IKFAST_EVALCOND_THRESH
+#define IKFAST_EVALCOND_THRESH ((IkReal)0.000001)
+#endif
+
+// relative tolerance of the consistency check of the eigenvectors in the dialytic solve
+#ifndef IKFAST_CONSISTENCY_THRESH
+#define IKFAST_CONSISTENCY_THRESH ((IkReal)1e-5)
+#endif
+
 inline float IKasin(float f)
 {
 IKFAST_ASSERT( f > -1-IKFAST_SINCOS_THRESH && f < 1+IKFAST_SINCOS_THRESH ); // any more error implies something is wrong with the solver
@@ -315,8 +334,47 @@ class IKSolver {
 public:
 IkReal j0,cj0,sj0,htj0,j1,cj1,sj1,htj1,j2,cj2,sj2,htj2,j3,cj3,sj3,htj3,j4,cj4,sj4,htj4,j6,cj6,sj6,htj6,j5,cj5,sj5,htj5,new_r00,r00,rxp0_0,new_r01,r01,rxp0_1,new_r02,r02,rxp0_2,new_r10,r10,rxp1_0,new_r11,r11,rxp1_1,new_r12,r12,rxp1_2,new_r20,r20,rxp2_0,new_r21,r21,rxp2_1,new_r22,r22,rxp2_2,new_px,px,npx,new_py,py,npy,new_pz,pz,npz,pp;
 unsigned char _ij0[2], _nj0,_ij1[2], _nj1,_ij2[2], _nj2,_ij3[2], _nj3,_ij4[2], _nj4,_ij6[2], _nj6,_ij5[2], _nj5;
+IkReal jlower[7], jupper[7];
+
+IKSolver() {
+SetJointLimits(NULL,NULL);
+}
+
+/// \brief branches of the solution tree are pruned as soon as one of their joints is outside [lower,upper].
+///
+/// The joints are checked as computed, in [-pi,pi]. NULL for lower and upper removes the limits.
+void SetJointLimits(const IkReal* lower, const IkReal* upper) {
+for(int i = 0; i < 7; ++i) {
+    jlower[i] = lower != NULL ? lower[i] : -numeric_limits<IkReal>::infinity();
+    jupper[i] = upper != NULL ? upper[i] : numeric_limits<IkReal>::infinity();
+}
+}
+
+/// \brief false only if the joint value is outside the limits, so NaN keeps the old behavior of the solver
+inline bool IKinlimits(int index, IkReal value) const {
+return !(value < jlower[index]) && !(value > jupper[index]);
+}
+
+/// \brief number of failed checks in this thread so far, always 0 unless IKFAST_NO_EXCEPTIONS is defined
+static inline unsigned int IKerrorcount() {
+#ifdef IKFAST_NO_EXCEPTIONS
+return GetErrorCount();
+#else
+return 0;
+#endif
+}
+
+/// \brief discards the solutions if a check failed since IKerrorcount returned numerrors
+static inline bool IKcheckerrors(unsigned int numerrors, bool bsolved, IkSolutionListBase<IkReal>& solutions) {
+if( IKerrorcount() != numerrors ) {
+    solutions.Clear();
+    return false;
+}
+return bsolved;
+}
 
 bool ComputeIk(const IkReal* eetrans, const IkReal* eerot, const IkReal* pfree, IkSolutionListBase<IkReal>& solutions) {
+const unsigned int numerrors = IKerrorcount();
 j0=numeric_limits<IkReal>::quiet_NaN(); _ij0[0] = -1; _ij0[1] = -1; _nj0 = -1; j1=numeric_limits<IkReal>::quiet_NaN(); _ij1[0] = -1; _ij1[1] = -1; _nj1 = -1; j2=numeric_limits<IkReal>::quiet_NaN(); _ij2[0] = -1; _ij2[1] = -1; _nj2 = -1; j3=numeric_limits<IkReal>::quiet_NaN(); _ij3[0] = -1; _ij3[1] = -1; _nj3 = -1; j4=numeric_limits<IkReal>::quiet_NaN(); _ij4[0] = -1; _ij4[1] = -1; _nj4 = -1; j6=numeric_limits<IkReal>::quiet_NaN(); _ij6[0] = -1; _ij6[1] = -1; _nj6 = -1;  _ij5[0] = -1; _ij5[1] = -1; _nj5 = 0; 
 for(int dummyiter = 0; dummyiter < 1; ++dummyiter) {
     solutions.Clear();
@@ -620,6 +678,10 @@ else if( j1array[numsolutions] < -IKPI )
 {
     j1array[numsolutions]+=IK2PI;
 }
+if( !IKinlimits(0,j0array[numsolutions]) || !IKinlimits(6,j6array[numsolutions]) || !IKinlimits(1,j1array[numsolutions]) )
+{
+    continue;
+}
 numsolutions++;
 }
 bool j0valid[16]={true,true,true,true,true,true,true,true,true,true,true,true,true,true,true,true};
@@ -700,7 +762,7 @@ if( j2array[0] > IKPI )
 else if( j2array[0] < -IKPI )
 {    j2array[0]+=IK2PI;
 }
-j2valid[0] = true;
+j2valid[0] = IKinlimits(2,j2array[0]);
 for(int ij2 = 0; ij2 < 1; ++ij2)
 {
 if( !j2valid[ij2] )
@@ -733,7 +795,7 @@ IkReal x259=((r00)*(sj6));
 IkReal x260=((cj0)*(x253));
 evalcond[0]=((((IkReal(-1.00000000000000))*(r22)*(x254)))+(((x253)*(x256)))+(((IkReal(0.0690000000000000))*(IKcos(j2))))+(((IkReal(-1.00000000000000))*(x250)*(x256)))+(((IkReal(-1.00000000000000))*(x250)*(x251)))+(pz)+(((x251)*(x253)))+(((IkReal(-1.00000000000000))*(r22)*(x257))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(r02)*(sj0)*(x254)))+(((IkReal(-1.00000000000000))*(sj0)*(x250)*(x255)))+(((IkReal(-1.00000000000000))*(sj0)*(x250)*(x259)))+(((IkReal(-1.00000000000000))*(cj0)*(py)))+(((IkReal(-1.00000000000000))*(x252)*(x260)))+(((cj0)*(x248)*(x250)))+(((sj5)*(x249)*(x259)))+(((IkReal(-1.00000000000000))*(x248)*(x260)))+(((IkReal(-1.00000000000000))*(cj5)*(r02)*(x249)))+(((x254)*(x258)))+(((IkReal(0.0690000000000000))*(IKsin(j2))))+(((sj5)*(x249)*(x255)))+(((cj0)*(x250)*(x252)))+(((x257)*(x258)))+(((px)*(sj0))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -865,7 +927,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -893,7 +955,7 @@ IkReal x349=((cj6)*(r01)*(sj5));
 IkReal x350=((IkReal(1.00000000000000))*(sj0)*(sj5));
 evalcond[0]=((((IkReal(-1.00000000000000))*(sj5)*(x344)*(x346)))+(((IkReal(-1.00000000000000))*(r02)*(x347)))+(((r12)*(x343)))+(((sj0)*(x348)))+(((sj0)*(x349)))+(((IkReal(-1.00000000000000))*(IKsin(j3))))+(((IkReal(-1.00000000000000))*(sj5)*(x344)*(x345))));
 evalcond[1]=((((r12)*(x347)))+(((IkReal(-1.00000000000000))*(IKcos(j3))))+(((IkReal(-1.00000000000000))*(x344)*(x348)))+(((IkReal(-1.00000000000000))*(x346)*(x350)))+(((IkReal(-1.00000000000000))*(x344)*(x349)))+(((IkReal(-1.00000000000000))*(x345)*(x350)))+(((r02)*(x343))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -982,7 +1044,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -1033,14 +1095,14 @@ evalcond[2]=((((x412)*(x420)))+(((x415)*(x416)))+(((IkReal(-1.00000000000000))*(
 evalcond[3]=((((x409)*(x415)))+(((x411)*(x418)))+(((x416)*(x418)))+(((IkReal(-1.00000000000000))*(r10)*(x403)*(x417)))+(((IkReal(-1.00000000000000))*(r10)*(x401)*(x404)*(x413)))+(cj3)+(((x407)*(x417)))+(((IkReal(-1.00000000000000))*(x403)*(x405)*(x420)))+(((IkReal(-1.00000000000000))*(x404)*(x424)))+(((r01)*(x406)*(x418)))+(((IkReal(-1.00000000000000))*(r01)*(x408)*(x415))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x403)*(x405)*(x415)))+(((IkReal(-1.00000000000000))*(x400)*(x404)*(x416)))+(((IkReal(-1.00000000000000))*(x407)*(x418)))+(((IkReal(-1.00000000000000))*(x400)*(x404)*(x411)))+(((IkReal(-1.00000000000000))*(x403)*(x414)*(x417)))+(((IkReal(-1.00000000000000))*(x415)*(x426)))+(((x412)*(x418)))+(((IkReal(-1.00000000000000))*(x410)*(x415)))+(((IkReal(-1.00000000000000))*(x404)*(x425)))+(((x409)*(x420))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x418)*(x426)))+(((IkReal(-1.00000000000000))*(x410)*(x418)))+(((IkReal(-1.00000000000000))*(x401)*(x404)*(x416)))+(((IkReal(-1.00000000000000))*(x403)*(x405)*(x418)))+(((IkReal(-1.00000000000000))*(x403)*(x414)*(x420)))+(((r01)*(sj6)*(x417)))+(((IkReal(-1.00000000000000))*(r00)*(x403)*(x417)))+(((IkReal(-1.00000000000000))*(sj3)))+(((x407)*(x415)))+(((IkReal(-1.00000000000000))*(r10)*(x403)*(x415)))+(((IkReal(-1.00000000000000))*(x401)*(x404)*(x411))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -1076,8 +1138,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -1104,7 +1165,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -1155,14 +1216,14 @@ evalcond[2]=((((r01)*(x433)*(x442)))+(((x439)*(x447)))+(((IkReal(-1.000000000000
 evalcond[3]=((((r01)*(x433)*(x445)))+(((IkReal(-1.00000000000000))*(r10)*(x428)*(x431)*(x440)))+(((x436)*(x442)))+(((IkReal(-1.00000000000000))*(r01)*(x435)*(x442)))+(((x438)*(x445)))+(((IkReal(-1.00000000000000))*(x431)*(x451)))+(cj3)+(((IkReal(-1.00000000000000))*(x430)*(x432)*(x447)))+(((IkReal(-1.00000000000000))*(r10)*(x430)*(x444)))+(((x443)*(x445)))+(((x434)*(x444))));
 evalcond[4]=((((x436)*(x447)))+(((IkReal(-1.00000000000000))*(x430)*(x432)*(x442)))+(((IkReal(-1.00000000000000))*(x427)*(x431)*(x443)))+(((IkReal(-1.00000000000000))*(x434)*(x445)))+(((IkReal(-1.00000000000000))*(x431)*(x452)))+(((IkReal(-1.00000000000000))*(x430)*(x441)*(x444)))+(((IkReal(-1.00000000000000))*(x437)*(x442)))+(((IkReal(-1.00000000000000))*(x427)*(x431)*(x438)))+(((IkReal(-1.00000000000000))*(x442)*(x453)))+(((x439)*(x445))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x437)*(x445)))+(((IkReal(-1.00000000000000))*(x430)*(x432)*(x445)))+(((IkReal(-1.00000000000000))*(x445)*(x453)))+(((IkReal(-1.00000000000000))*(r10)*(x430)*(x442)))+(((IkReal(-1.00000000000000))*(x428)*(x431)*(x443)))+(((IkReal(-1.00000000000000))*(x428)*(x431)*(x438)))+(((IkReal(-1.00000000000000))*(x430)*(x441)*(x447)))+(((x434)*(x442)))+(((IkReal(-1.00000000000000))*(sj3)))+(((r01)*(sj6)*(x444)))+(((IkReal(-1.00000000000000))*(r00)*(x430)*(x444))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -1198,8 +1259,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -1260,7 +1320,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -1288,7 +1348,7 @@ IkReal x485=((cj6)*(r01)*(sj5));
 IkReal x486=((IkReal(1.00000000000000))*(sj0)*(sj5));
 evalcond[0]=((((sj0)*(x484)))+(((r12)*(x479)))+(IKsin(j3))+(((IkReal(-1.00000000000000))*(sj5)*(x480)*(x481)))+(((IkReal(-1.00000000000000))*(sj5)*(x480)*(x482)))+(((IkReal(-1.00000000000000))*(r02)*(x483)))+(((sj0)*(x485))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x480)*(x484)))+(((r12)*(x483)))+(((r02)*(x479)))+(((IkReal(-1.00000000000000))*(IKcos(j3))))+(((IkReal(-1.00000000000000))*(x482)*(x486)))+(((IkReal(-1.00000000000000))*(x481)*(x486)))+(((IkReal(-1.00000000000000))*(x480)*(x485))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -1383,7 +1443,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -1434,14 +1494,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(r10)*(x542)*(x546)*(x555)))+(((IkRea
 evalcond[3]=((((r01)*(x548)*(x560)))+(((x553)*(x560)))+(((x549)*(x559)))+(((IkReal(-1.00000000000000))*(r10)*(x545)*(x559)))+(((IkReal(-1.00000000000000))*(r01)*(x550)*(x557)))+(((IkReal(-1.00000000000000))*(r10)*(x543)*(x546)*(x555)))+(((IkReal(-1.00000000000000))*(cj3)))+(((IkReal(-1.00000000000000))*(x545)*(x547)*(x562)))+(((x551)*(x557)))+(((IkReal(-1.00000000000000))*(x546)*(x566)))+(((x558)*(x560))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x542)*(x546)*(x553)))+(((IkReal(-1.00000000000000))*(x542)*(x546)*(x558)))+(((IkReal(-1.00000000000000))*(x546)*(x567)))+(((IkReal(-1.00000000000000))*(x557)*(x568)))+(((IkReal(-1.00000000000000))*(x545)*(x547)*(x557)))+(((IkReal(-1.00000000000000))*(x549)*(x560)))+(((IkReal(-1.00000000000000))*(x545)*(x556)*(x559)))+(((x554)*(x560)))+(((x551)*(x562)))+(((IkReal(-1.00000000000000))*(x552)*(x557))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x560)*(x568)))+(((r01)*(sj6)*(x559)))+(((IkReal(-1.00000000000000))*(r00)*(x545)*(x559)))+(((IkReal(-1.00000000000000))*(x545)*(x556)*(x562)))+(((IkReal(-1.00000000000000))*(r10)*(x545)*(x557)))+(((IkReal(-1.00000000000000))*(x545)*(x547)*(x560)))+(((IkReal(-1.00000000000000))*(x543)*(x546)*(x558)))+(((IkReal(-1.00000000000000))*(x552)*(x560)))+(((IkReal(-1.00000000000000))*(x543)*(x546)*(x553)))+(((IkReal(-1.00000000000000))*(sj3)))+(((x549)*(x557))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -1477,8 +1537,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -1505,7 +1564,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -1556,14 +1615,14 @@ evalcond[2]=((((r01)*(sj6)*(x587)))+(((IkReal(-1.00000000000000))*(x572)*(x574)*
 evalcond[3]=((((x580)*(x587)))+(((IkReal(-1.00000000000000))*(r01)*(x577)*(x584)))+(((r01)*(x575)*(x587)))+(((x585)*(x587)))+(((IkReal(-1.00000000000000))*(x572)*(x574)*(x589)))+(((IkReal(-1.00000000000000))*(x573)*(x593)))+(((IkReal(-1.00000000000000))*(cj3)))+(((IkReal(-1.00000000000000))*(r10)*(x572)*(x586)))+(((x578)*(x584)))+(((IkReal(-1.00000000000000))*(r10)*(x570)*(x573)*(x582)))+(((x576)*(x586))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x572)*(x583)*(x586)))+(((x578)*(x589)))+(((x581)*(x587)))+(((IkReal(-1.00000000000000))*(x573)*(x594)))+(((IkReal(-1.00000000000000))*(x584)*(x595)))+(((IkReal(-1.00000000000000))*(x569)*(x573)*(x580)))+(((IkReal(-1.00000000000000))*(x579)*(x584)))+(((IkReal(-1.00000000000000))*(x569)*(x573)*(x585)))+(((IkReal(-1.00000000000000))*(x576)*(x587)))+(((IkReal(-1.00000000000000))*(x572)*(x574)*(x584))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x572)*(x583)*(x589)))+(((IkReal(-1.00000000000000))*(r00)*(x572)*(x586)))+(((IkReal(-1.00000000000000))*(x587)*(x595)))+(((IkReal(-1.00000000000000))*(x572)*(x574)*(x587)))+(((IkReal(-1.00000000000000))*(x570)*(x573)*(x580)))+(((IkReal(-1.00000000000000))*(x579)*(x587)))+(((IkReal(-1.00000000000000))*(x570)*(x573)*(x585)))+(((r01)*(sj6)*(x586)))+(((x576)*(x584)))+(((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(-1.00000000000000))*(r10)*(x572)*(x584))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -1599,8 +1658,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -1644,7 +1702,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -1673,7 +1731,7 @@ IkReal x605=((cj6)*(r11)*(sj5));
 evalcond[0]=((((r20)*(x599)))+(((IkReal(-1.00000000000000))*(cj2)*(x603)))+(((cj6)*(r21)*(sj5)))+(((IkReal(-1.00000000000000))*(cj5)*(r22))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(cj5)*(r02)*(x602)))+(((r00)*(sj0)*(x599)))+(((IkReal(-1.00000000000000))*(sj2)*(x603)))+(((IkReal(-1.00000000000000))*(x601)*(x605)))+(((IkReal(-1.00000000000000))*(r10)*(x599)*(x601)))+(((sj0)*(x604)))+(((r12)*(x600))));
 evalcond[2]=((((cj5)*(r12)*(sj0)))+(((IkReal(-1.00000000000000))*(IKcos(j3))))+(((IkReal(-1.00000000000000))*(r10)*(x599)*(x602)))+(((IkReal(-1.00000000000000))*(r00)*(x599)*(x601)))+(((r02)*(x600)))+(((IkReal(-1.00000000000000))*(x602)*(x605)))+(((IkReal(-1.00000000000000))*(x601)*(x604))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -1773,7 +1831,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -1825,14 +1883,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(cj0)*(x669)*(x684)))+(((x681)*(x685)
 evalcond[3]=((((x680)*(x687)))+(((cj5)*(x668)*(x687)))+(((IkReal(-1.00000000000000))*(x673)*(x688)))+(((IkReal(-1.00000000000000))*(x670)*(x677)*(x685)))+(((IkReal(-1.00000000000000))*(r10)*(x670)*(x686)))+(((x678)*(x688)))+(((x672)*(x686)))+(((IkReal(-1.00000000000000))*(sj5)*(x669)*(x685)))+(((cj5)*(x671)*(x687)))+(((IkReal(-1.00000000000000))*(x674)*(x682)*(x685)))+(((cj3)*(sj2))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x680)*(x686)))+(((IkReal(-1.00000000000000))*(x668)*(x674)*(x686)))+(((IkReal(-1.00000000000000))*(x670)*(x677)*(x688)))+(((IkReal(-1.00000000000000))*(x670)*(x683)*(x686)))+(((IkReal(-1.00000000000000))*(sj0)*(x669)*(x684)))+(((IkReal(-1.00000000000000))*(x672)*(x687)))+(((x681)*(x687)))+(((IkReal(-1.00000000000000))*(x674)*(x682)*(x688)))+(((IkReal(-1.00000000000000))*(x673)*(x685)))+(((x678)*(x685))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x674)*(x682)*(x687)))+(((IkReal(-1.00000000000000))*(x680)*(x685)))+(((IkReal(-1.00000000000000))*(sj5)*(x669)*(x687)))+(((x673)*(x686)))+(((IkReal(-1.00000000000000))*(r00)*(x670)*(x686)))+(((IkReal(-1.00000000000000))*(x670)*(x677)*(x687)))+(((IkReal(-1.00000000000000))*(x668)*(x674)*(x685)))+(((x672)*(x688)))+(((IkReal(-1.00000000000000))*(x670)*(x683)*(x685)))+(((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(-1.00000000000000))*(r10)*(x670)*(x688))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -1868,8 +1926,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -1903,7 +1960,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -1955,14 +2012,14 @@ evalcond[2]=((((x715)*(x723)))+(((x703)*(x728)))+(((x708)*(x722)))+(((x706)*(x72
 evalcond[3]=((((x715)*(x722)))+(((IkReal(-1.00000000000000))*(r10)*(x705)*(x721)))+(((x707)*(x721)))+(((cj5)*(x706)*(x722)))+(((cj5)*(x703)*(x722)))+(((IkReal(-1.00000000000000))*(x709)*(x717)*(x720)))+(((x713)*(x723)))+(((IkReal(-1.00000000000000))*(x705)*(x712)*(x720)))+(((cj3)*(sj2)))+(((IkReal(-1.00000000000000))*(sj5)*(x704)*(x720)))+(((IkReal(-1.00000000000000))*(x708)*(x723))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x709)*(x717)*(x723)))+(((IkReal(-1.00000000000000))*(x703)*(x709)*(x721)))+(((IkReal(-1.00000000000000))*(sj0)*(x704)*(x719)))+(((IkReal(-1.00000000000000))*(x715)*(x721)))+(((IkReal(-1.00000000000000))*(x708)*(x720)))+(((x713)*(x720)))+(((x716)*(x722)))+(((IkReal(-1.00000000000000))*(x705)*(x718)*(x721)))+(((IkReal(-1.00000000000000))*(x707)*(x722)))+(((IkReal(-1.00000000000000))*(x705)*(x712)*(x723))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x715)*(x720)))+(((IkReal(-1.00000000000000))*(r00)*(x705)*(x721)))+(((IkReal(-1.00000000000000))*(r10)*(x705)*(x723)))+(((x707)*(x723)))+(((IkReal(-1.00000000000000))*(x705)*(x718)*(x720)))+(((IkReal(-1.00000000000000))*(x703)*(x709)*(x720)))+(((IkReal(-1.00000000000000))*(x705)*(x712)*(x722)))+(((IkReal(-1.00000000000000))*(x709)*(x717)*(x722)))+(((IkReal(-1.00000000000000))*(sj3)))+(((x708)*(x721)))+(((IkReal(-1.00000000000000))*(sj5)*(x704)*(x722))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -1998,8 +2055,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -2042,7 +2098,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -2077,7 +2133,7 @@ IkReal x752=((r11)*(sj6)*(x740));
 evalcond[0]=((((r20)*(sj6)*(x748)))+(((IkReal(-1.00000000000000))*(sj2)))+(((r21)*(sj6)*(x740)))+(((r22)*(x746)))+(((IkReal(-1.00000000000000))*(r20)*(x749)))+(((cj6)*(r21)*(x748))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(r12)*(x743)*(x746)))+(((sj0)*(x751)))+(((IkReal(-1.00000000000000))*(x743)*(x752)))+(((IkReal(-1.00000000000000))*(x743)*(x745)*(x748)))+(cj2)+(((x742)*(x750)))+(((x741)*(x750)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x743)*(x748)))+(((IkReal(-1.00000000000000))*(r00)*(x744)*(x749)))+(((cj0)*(r10)*(x749)))+(((r02)*(sj0)*(x746))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x744)*(x745)*(x748)))+(((IkReal(-1.00000000000000))*(x742)*(x743)*(x748)))+(((IkReal(-1.00000000000000))*(r02)*(x743)*(x746)))+(((IkReal(-1.00000000000000))*(x744)*(x752)))+(((cj0)*(r00)*(x749)))+(((IkReal(-1.00000000000000))*(r12)*(x744)*(x746)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x744)*(x748)))+(((IkReal(-1.00000000000000))*(x741)*(x743)*(x748)))+(((r10)*(sj0)*(x749)))+(((IkReal(-1.00000000000000))*(x743)*(x751))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -2166,7 +2222,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -2204,14 +2260,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x804)))+(((IkReal(-1.00000000000000)
 evalcond[1]=((((x800)*(x801)))+(((r20)*(x798)))+(((x800)*(x802)))+(((cj4)*(r22)*(sj5)))+(x790)+(((IkReal(-1.00000000000000))*(r21)*(x799))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x792)*(x803)))+(((r12)*(x797)))+(((r02)*(x793)))+(((IkReal(-1.00000000000000))*(x794)*(x805)))+(((IkReal(-1.00000000000000))*(x792)*(x796)))+(((IkReal(-1.00000000000000))*(x790)))+(((IkReal(-1.00000000000000))*(x795)*(x805))));
 evalcond[3]=((((r11)*(sj0)*(x799)))+(((IkReal(-1.00000000000000))*(x791)*(x797)*(x803)))+(((IkReal(-1.00000000000000))*(x791)*(x793)*(x794)))+(((IkReal(-1.00000000000000))*(x804)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x791)))+(((IkReal(-1.00000000000000))*(r12)*(x791)*(x792)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x798)))+(((cj0)*(r01)*(x799)))+(((IkReal(-1.00000000000000))*(x791)*(x796)*(x797)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x798)))+(((IkReal(-1.00000000000000))*(x791)*(x793)*(x795))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -2247,8 +2303,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -2319,7 +2374,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -2357,14 +2412,14 @@ evalcond[0]=((((sj5)*(x854)))+(((sj5)*(x855)))+(((IkReal(-1.00000000000000))*(cj
 evalcond[1]=((((r20)*(x851)))+(((x853)*(x854)))+(((cj4)*(r22)*(sj5)))+(((x853)*(x855)))+(((IkReal(-1.00000000000000))*(x857)))+(((IkReal(-1.00000000000000))*(r21)*(x852))));
 evalcond[2]=((((r12)*(x850)))+(((IkReal(-1.00000000000000))*(x848)*(x858)))+(((IkReal(-1.00000000000000))*(x845)*(x849)))+(((IkReal(-1.00000000000000))*(x857)))+(((IkReal(-1.00000000000000))*(x847)*(x858)))+(((IkReal(-1.00000000000000))*(x845)*(x856)))+(((r02)*(x846))));
 evalcond[3]=((((r11)*(sj0)*(x852)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x844)))+(((cj0)*(r01)*(x852)))+(((IkReal(-1.00000000000000))*(x843)))+(((IkReal(-1.00000000000000))*(x844)*(x849)*(x850)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x851)))+(((IkReal(-1.00000000000000))*(r12)*(x844)*(x845)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x851)))+(((IkReal(-1.00000000000000))*(x844)*(x846)*(x848)))+(((IkReal(-1.00000000000000))*(x844)*(x846)*(x847)))+(((IkReal(-1.00000000000000))*(x844)*(x850)*(x856))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -2400,8 +2455,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -2470,7 +2524,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -2509,14 +2563,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(r02)*(x901)))+(((IkReal(-1.000000000
 evalcond[1]=((((IkReal(-1.00000000000000))*(x895)*(x903)))+(((IkReal(-1.00000000000000))*(x896)*(x904)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x904)))+(((r02)*(x900)))+(((IkReal(-1.00000000000000))*(x894)))+(((IkReal(-1.00000000000000))*(x895)*(x902)))+(((r12)*(x901))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x905)*(x908)))+(((r11)*(x909)))+(((IkReal(-1.00000000000000))*(r12)*(x898)*(x904)))+(((IkReal(-1.00000000000000))*(r01)*(x910)))+(((x897)*(x907)))+(((IkReal(-1.00000000000000))*(x898)*(x900)*(x903)))+(((x897)*(x899)))+(((IkReal(-1.00000000000000))*(x898)*(x900)*(x902)))+(x894)+(((cj4)*(x896)*(x901)))+(((cj4)*(r02)*(x895))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(cj5)*(r11)*(x897)*(x898)))+(((IkReal(-1.00000000000000))*(r12)*(x895)*(x898)))+(((IkReal(-1.00000000000000))*(r02)*(x898)*(x904)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x898)*(x900)))+(((IkReal(-1.00000000000000))*(x899)*(x908)))+(((r11)*(x910)))+(((IkReal(-1.00000000000000))*(x897)*(x905)))+(((IkReal(-1.00000000000000))*(x896)*(x898)*(x900)))+(((r01)*(x909)))+(((IkReal(-1.00000000000000))*(x898)*(x901)*(x903)))+(((IkReal(-1.00000000000000))*(x906))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -2552,8 +2606,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -2621,7 +2674,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -2660,14 +2713,14 @@ evalcond[0]=((((x946)*(x952)))+(((IkReal(-1.00000000000000))*(x954)*(x955)))+(((
 evalcond[1]=((((r02)*(x951)))+(((r12)*(x953)))+(((IkReal(-1.00000000000000))*(x946)*(x955)))+(((IkReal(-1.00000000000000))*(x947)*(x954)))+(((IkReal(-1.00000000000000))*(x946)*(x956)))+(((IkReal(-1.00000000000000))*(x958)))+(((IkReal(-1.00000000000000))*(x952)*(x954))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r01)*(x960)))+(((cj4)*(x947)*(x953)))+(((r11)*(x959)))+(((cj4)*(cj5)*(r01)*(x949)))+(((IkReal(-1.00000000000000))*(x957)*(x961)))+(((IkReal(-1.00000000000000))*(x948)*(x951)*(x955)))+(((x949)*(x950)))+(((IkReal(-1.00000000000000))*(r12)*(x948)*(x954)))+(((cj4)*(r02)*(x946)))+(((IkReal(-1.00000000000000))*(x948)*(x951)*(x956)))+(((IkReal(-1.00000000000000))*(x958))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x950)*(x961)))+(((IkReal(-1.00000000000000))*(x945)))+(((IkReal(-1.00000000000000))*(x949)*(x957)))+(((IkReal(-1.00000000000000))*(x948)*(x953)*(x956)))+(((IkReal(-1.00000000000000))*(x948)*(x951)*(x952)))+(((r01)*(x959)))+(((IkReal(-1.00000000000000))*(r12)*(x946)*(x948)))+(((r11)*(x960)))+(((IkReal(-1.00000000000000))*(x947)*(x948)*(x951)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x948)*(x949)))+(((IkReal(-1.00000000000000))*(r02)*(x948)*(x954))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -2703,8 +2756,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -2750,7 +2802,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -2793,14 +2845,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x978)*(x979)))+(((x972)*(x975)))+(((
 evalcond[3]=((((IkReal(-1.00000000000000))*(x972)*(x978)))+(((IkReal(-1.00000000000000))*(x973)*(x979)))+(((r02)*(x976)))+(((IkReal(-1.00000000000000))*(x971)))+(((IkReal(-1.00000000000000))*(x972)*(x984)))+(((IkReal(-1.00000000000000))*(x975)*(x979)))+(((r12)*(x977))));
 evalcond[4]=((((r11)*(x987)))+(((IkReal(-1.00000000000000))*(r10)*(x980)*(x985)))+(((r00)*(sj0)*(x980)))+(((IkReal(-1.00000000000000))*(x974)*(x976)*(x978)))+(((cj4)*(r02)*(x972)))+(((cj4)*(x973)*(x977)))+(((IkReal(-1.00000000000000))*(r12)*(x974)*(x979)))+(((cj4)*(x975)*(x977)))+(((IkReal(-1.00000000000000))*(r01)*(x988)))+(((IkReal(-1.00000000000000))*(x974)*(x976)*(x984)))+(((sj2)*(x971))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x973)*(x974)*(x976)))+(((IkReal(-1.00000000000000))*(x974)*(x977)*(x978)))+(((IkReal(-1.00000000000000))*(x974)*(x977)*(x984)))+(((r01)*(x987)))+(((IkReal(-1.00000000000000))*(r00)*(x980)*(x985)))+(((IkReal(-1.00000000000000))*(r02)*(x974)*(x979)))+(((r11)*(x988)))+(((IkReal(-1.00000000000000))*(x986)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x980)))+(((IkReal(-1.00000000000000))*(x974)*(x975)*(x976)))+(((IkReal(-1.00000000000000))*(r12)*(x972)*(x974))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -2836,8 +2888,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -2866,7 +2917,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -2909,14 +2960,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(r02)*(x998)))+(((IkReal(-1.000000000
 evalcond[3]=((((r02)*(x997)))+(((IkReal(-1.00000000000000))*(x992)))+(((IkReal(-1.00000000000000))*(x993)*(x999)))+(((IkReal(-1.00000000000000))*(x1005)*(x993)))+(((IkReal(-1.00000000000000))*(x1000)*(x994)))+(((r12)*(x998)))+(((IkReal(-1.00000000000000))*(x1000)*(x996))));
 evalcond[4]=((((cj4)*(r02)*(x993)))+(((sj2)*(x992)))+(((r00)*(sj0)*(x1001)))+(((IkReal(-1.00000000000000))*(r12)*(x1000)*(x995)))+(((IkReal(-1.00000000000000))*(x1005)*(x995)*(x997)))+(((IkReal(-1.00000000000000))*(x995)*(x997)*(x999)))+(((IkReal(-1.00000000000000))*(r10)*(x1001)*(x1006)))+(((r11)*(x1008)))+(((cj4)*(x994)*(x998)))+(((cj4)*(x996)*(x998)))+(((IkReal(-1.00000000000000))*(r01)*(x1009))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r12)*(x993)*(x995)))+(((IkReal(-1.00000000000000))*(x995)*(x998)*(x999)))+(((r01)*(x1008)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x1001)))+(((IkReal(-1.00000000000000))*(x1007)))+(((IkReal(-1.00000000000000))*(r02)*(x1000)*(x995)))+(((IkReal(-1.00000000000000))*(r00)*(x1001)*(x1006)))+(((IkReal(-1.00000000000000))*(x995)*(x996)*(x997)))+(((IkReal(-1.00000000000000))*(x994)*(x995)*(x997)))+(((r11)*(x1009)))+(((IkReal(-1.00000000000000))*(x1005)*(x995)*(x998))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -2952,8 +3003,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -2983,7 +3033,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -3026,14 +3076,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x1021)*(x1022)))+(((r12)*(x1019)))+(
 evalcond[3]=((((IkReal(-1.00000000000000))*(x1015)*(x1027)))+(((IkReal(-1.00000000000000))*(x1015)*(x1021)))+(((IkReal(-1.00000000000000))*(x1014)))+(((IkReal(-1.00000000000000))*(x1018)*(x1022)))+(((r12)*(x1020)))+(((r02)*(x1019)))+(((IkReal(-1.00000000000000))*(x1016)*(x1022))));
 evalcond[4]=((((r11)*(x1030)))+(((IkReal(-1.00000000000000))*(r01)*(x1031)))+(((IkReal(-1.00000000000000))*(r12)*(x1017)*(x1022)))+(((r00)*(sj0)*(x1023)))+(((IkReal(-1.00000000000000))*(r10)*(x1023)*(x1028)))+(((IkReal(-1.00000000000000))*(x1017)*(x1019)*(x1021)))+(((cj4)*(x1018)*(x1020)))+(((IkReal(-1.00000000000000))*(x1017)*(x1019)*(x1027)))+(((cj4)*(x1016)*(x1020)))+(((cj4)*(r02)*(x1015)))+(((sj2)*(x1014))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r02)*(x1017)*(x1022)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x1023)))+(((IkReal(-1.00000000000000))*(x1017)*(x1018)*(x1019)))+(((IkReal(-1.00000000000000))*(x1017)*(x1020)*(x1027)))+(((r01)*(x1030)))+(((IkReal(-1.00000000000000))*(r12)*(x1015)*(x1017)))+(((IkReal(-1.00000000000000))*(r00)*(x1023)*(x1028)))+(((IkReal(-1.00000000000000))*(x1017)*(x1020)*(x1021)))+(((IkReal(-1.00000000000000))*(x1029)))+(((IkReal(-1.00000000000000))*(x1016)*(x1017)*(x1019)))+(((r11)*(x1031))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -3069,8 +3119,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -3110,7 +3159,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -3145,7 +3194,7 @@ IkReal x1052=((r11)*(sj6)*(x1040));
 evalcond[0]=((((r22)*(x1046)))+(((IkReal(-1.00000000000000))*(sj2)))+(((IkReal(-1.00000000000000))*(r20)*(x1049)))+(((r20)*(sj6)*(x1048)))+(((r21)*(sj6)*(x1040)))+(((cj6)*(r21)*(x1048))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x1043)*(x1045)*(x1048)))+(((sj0)*(x1051)))+(((IkReal(-1.00000000000000))*(x1043)*(x1052)))+(((IkReal(-1.00000000000000))*(r12)*(x1043)*(x1046)))+(((cj0)*(r10)*(x1049)))+(((IkReal(-1.00000000000000))*(r00)*(x1044)*(x1049)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x1043)*(x1048)))+(cj2)+(((x1042)*(x1050)))+(((x1041)*(x1050)))+(((r02)*(sj0)*(x1046))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x1044)*(x1052)))+(((IkReal(-1.00000000000000))*(x1041)*(x1043)*(x1048)))+(((IkReal(-1.00000000000000))*(x1044)*(x1045)*(x1048)))+(((IkReal(-1.00000000000000))*(r02)*(x1043)*(x1046)))+(((IkReal(-1.00000000000000))*(r12)*(x1044)*(x1046)))+(((IkReal(-1.00000000000000))*(x1042)*(x1043)*(x1048)))+(((r10)*(sj0)*(x1049)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x1044)*(x1048)))+(((cj0)*(r00)*(x1049)))+(((IkReal(-1.00000000000000))*(x1043)*(x1051))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -3234,7 +3283,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -3272,14 +3321,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x1104)))+(((IkReal(-1.00000000000000
 evalcond[1]=((((r20)*(x1098)))+(((cj4)*(r22)*(sj5)))+(((IkReal(-1.00000000000000))*(r21)*(x1099)))+(x1090)+(((x1100)*(x1101)))+(((x1100)*(x1102))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x1095)*(x1105)))+(((IkReal(-1.00000000000000))*(x1094)*(x1105)))+(((r02)*(x1093)))+(((IkReal(-1.00000000000000))*(x1092)*(x1103)))+(((IkReal(-1.00000000000000))*(x1092)*(x1096)))+(((r12)*(x1097)))+(((IkReal(-1.00000000000000))*(x1090))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x1091)*(x1093)*(x1095)))+(((IkReal(-1.00000000000000))*(x1104)))+(((IkReal(-1.00000000000000))*(r12)*(x1091)*(x1092)))+(((IkReal(-1.00000000000000))*(x1091)*(x1093)*(x1094)))+(((cj0)*(r01)*(x1099)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x1091)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x1098)))+(((IkReal(-1.00000000000000))*(x1091)*(x1097)*(x1103)))+(((r11)*(sj0)*(x1099)))+(((IkReal(-1.00000000000000))*(x1091)*(x1096)*(x1097)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x1098))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -3315,8 +3364,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -3387,7 +3435,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -3425,14 +3473,14 @@ evalcond[0]=((x1143)+(((sj5)*(x1154)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)
 evalcond[1]=((((IkReal(-1.00000000000000))*(r21)*(x1152)))+(((cj4)*(r22)*(sj5)))+(((x1153)*(x1154)))+(((x1153)*(x1155)))+(((r20)*(x1151)))+(((IkReal(-1.00000000000000))*(x1157))));
 evalcond[2]=((((r02)*(x1146)))+(((IkReal(-1.00000000000000))*(x1145)*(x1149)))+(((IkReal(-1.00000000000000))*(x1148)*(x1158)))+(((IkReal(-1.00000000000000))*(x1145)*(x1156)))+(((r12)*(x1150)))+(((IkReal(-1.00000000000000))*(x1147)*(x1158)))+(((IkReal(-1.00000000000000))*(x1157))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r12)*(x1144)*(x1145)))+(((IkReal(-1.00000000000000))*(x1144)*(x1146)*(x1148)))+(((IkReal(-1.00000000000000))*(x1144)*(x1150)*(x1156)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x1151)))+(((IkReal(-1.00000000000000))*(x1144)*(x1149)*(x1150)))+(((r11)*(sj0)*(x1152)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x1144)))+(((IkReal(-1.00000000000000))*(x1143)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x1151)))+(((cj0)*(r01)*(x1152)))+(((IkReal(-1.00000000000000))*(x1144)*(x1146)*(x1147))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -3468,8 +3516,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -3538,7 +3585,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -3577,14 +3624,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x1203)*(x1204)))+(((x1195)*(x1196)))
 evalcond[1]=((((IkReal(-1.00000000000000))*(x1195)*(x1202)))+(((IkReal(-1.00000000000000))*(x1194)))+(((r02)*(x1200)))+(((IkReal(-1.00000000000000))*(x1195)*(x1203)))+(((IkReal(-1.00000000000000))*(x1196)*(x1204)))+(((r12)*(x1201)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x1204))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x1198)*(x1200)*(x1203)))+(((IkReal(-1.00000000000000))*(x1205)*(x1208)))+(((IkReal(-1.00000000000000))*(r12)*(x1198)*(x1204)))+(((r11)*(x1209)))+(((IkReal(-1.00000000000000))*(x1198)*(x1200)*(x1202)))+(((cj4)*(r02)*(x1195)))+(x1194)+(((x1197)*(x1207)))+(((IkReal(-1.00000000000000))*(r01)*(x1210)))+(((cj4)*(x1196)*(x1201)))+(((x1197)*(x1199))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r02)*(x1198)*(x1204)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x1197)*(x1198)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x1198)*(x1200)))+(((IkReal(-1.00000000000000))*(x1196)*(x1198)*(x1200)))+(((IkReal(-1.00000000000000))*(x1197)*(x1205)))+(((IkReal(-1.00000000000000))*(x1199)*(x1208)))+(((r01)*(x1209)))+(((IkReal(-1.00000000000000))*(x1198)*(x1201)*(x1203)))+(((IkReal(-1.00000000000000))*(x1206)))+(((IkReal(-1.00000000000000))*(r12)*(x1195)*(x1198)))+(((r11)*(x1210))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -3620,8 +3667,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -3689,7 +3735,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -3728,14 +3774,14 @@ evalcond[0]=((((x1246)*(x1252)))+(((r12)*(x1251)))+(((IkReal(-1.00000000000000))
 evalcond[1]=((((IkReal(-1.00000000000000))*(x1252)*(x1254)))+(((IkReal(-1.00000000000000))*(x1246)*(x1256)))+(((r12)*(x1253)))+(((IkReal(-1.00000000000000))*(x1247)*(x1254)))+(((IkReal(-1.00000000000000))*(x1246)*(x1255)))+(((r02)*(x1251)))+(((IkReal(-1.00000000000000))*(x1258))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x1257)*(x1261)))+(((IkReal(-1.00000000000000))*(r01)*(x1260)))+(((x1249)*(x1250)))+(((IkReal(-1.00000000000000))*(r12)*(x1248)*(x1254)))+(((IkReal(-1.00000000000000))*(x1248)*(x1251)*(x1255)))+(((cj4)*(x1247)*(x1253)))+(((cj4)*(r02)*(x1246)))+(((cj4)*(cj5)*(r01)*(x1249)))+(((IkReal(-1.00000000000000))*(x1248)*(x1251)*(x1256)))+(((r11)*(x1259)))+(((IkReal(-1.00000000000000))*(x1258))));
 evalcond[3]=((((r01)*(x1259)))+(((r11)*(x1260)))+(((IkReal(-1.00000000000000))*(x1250)*(x1261)))+(((IkReal(-1.00000000000000))*(x1245)))+(((IkReal(-1.00000000000000))*(x1247)*(x1248)*(x1251)))+(((IkReal(-1.00000000000000))*(r12)*(x1246)*(x1248)))+(((IkReal(-1.00000000000000))*(x1248)*(x1251)*(x1252)))+(((IkReal(-1.00000000000000))*(x1249)*(x1257)))+(((IkReal(-1.00000000000000))*(x1248)*(x1253)*(x1256)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x1248)*(x1249)))+(((IkReal(-1.00000000000000))*(r02)*(x1248)*(x1254))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -3771,8 +3817,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -3818,7 +3863,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -3861,14 +3906,14 @@ evalcond[2]=((((r12)*(x1276)))+(((x1272)*(x1275)))+(((IkReal(-1.00000000000000))
 evalcond[3]=((((r12)*(x1277)))+(((IkReal(-1.00000000000000))*(x1272)*(x1284)))+(((IkReal(-1.00000000000000))*(x1275)*(x1279)))+(((IkReal(-1.00000000000000))*(x1271)))+(((r02)*(x1276)))+(((IkReal(-1.00000000000000))*(x1272)*(x1278)))+(((IkReal(-1.00000000000000))*(x1273)*(x1279))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x1274)*(x1276)*(x1278)))+(((IkReal(-1.00000000000000))*(r01)*(x1288)))+(((cj4)*(x1275)*(x1277)))+(((cj4)*(x1273)*(x1277)))+(((r00)*(sj0)*(x1280)))+(((IkReal(-1.00000000000000))*(r10)*(x1280)*(x1285)))+(((r11)*(x1287)))+(((IkReal(-1.00000000000000))*(r12)*(x1274)*(x1279)))+(((cj4)*(r02)*(x1272)))+(((sj2)*(x1271)))+(((IkReal(-1.00000000000000))*(x1274)*(x1276)*(x1284))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x1286)))+(((IkReal(-1.00000000000000))*(x1274)*(x1277)*(x1278)))+(((IkReal(-1.00000000000000))*(x1273)*(x1274)*(x1276)))+(((r11)*(x1288)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x1280)))+(((r01)*(x1287)))+(((IkReal(-1.00000000000000))*(x1274)*(x1277)*(x1284)))+(((IkReal(-1.00000000000000))*(r02)*(x1274)*(x1279)))+(((IkReal(-1.00000000000000))*(x1274)*(x1275)*(x1276)))+(((IkReal(-1.00000000000000))*(r00)*(x1280)*(x1285)))+(((IkReal(-1.00000000000000))*(r12)*(x1272)*(x1274))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -3904,8 +3949,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -3934,7 +3978,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -3977,14 +4021,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x1300)*(x1305)))+(((r12)*(x1297)))+(
 evalcond[3]=((((IkReal(-1.00000000000000))*(x1292)))+(((IkReal(-1.00000000000000))*(x1293)*(x1305)))+(((IkReal(-1.00000000000000))*(x1293)*(x1299)))+(((IkReal(-1.00000000000000))*(x1296)*(x1300)))+(((r12)*(x1298)))+(((IkReal(-1.00000000000000))*(x1294)*(x1300)))+(((r02)*(x1297))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r10)*(x1301)*(x1306)))+(((cj4)*(r02)*(x1293)))+(((IkReal(-1.00000000000000))*(x1295)*(x1297)*(x1305)))+(((r00)*(sj0)*(x1301)))+(((IkReal(-1.00000000000000))*(x1295)*(x1297)*(x1299)))+(((cj4)*(x1296)*(x1298)))+(((IkReal(-1.00000000000000))*(r12)*(x1295)*(x1300)))+(((r11)*(x1308)))+(((cj4)*(x1294)*(x1298)))+(((sj2)*(x1292)))+(((IkReal(-1.00000000000000))*(r01)*(x1309))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r02)*(x1295)*(x1300)))+(((IkReal(-1.00000000000000))*(x1295)*(x1298)*(x1299)))+(((IkReal(-1.00000000000000))*(x1295)*(x1298)*(x1305)))+(((IkReal(-1.00000000000000))*(r00)*(x1301)*(x1306)))+(((IkReal(-1.00000000000000))*(r12)*(x1293)*(x1295)))+(((IkReal(-1.00000000000000))*(x1294)*(x1295)*(x1297)))+(((IkReal(-1.00000000000000))*(x1295)*(x1296)*(x1297)))+(((IkReal(-1.00000000000000))*(x1307)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x1301)))+(((r11)*(x1309)))+(((r01)*(x1308))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -4020,8 +4064,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -4051,7 +4094,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -4094,14 +4137,14 @@ evalcond[2]=((((x1315)*(x1318)))+(((r12)*(x1319)))+(((IkReal(-1.00000000000000))
 evalcond[3]=((((IkReal(-1.00000000000000))*(x1316)*(x1322)))+(((IkReal(-1.00000000000000))*(x1315)*(x1321)))+(((r12)*(x1320)))+(((IkReal(-1.00000000000000))*(x1314)))+(((IkReal(-1.00000000000000))*(x1318)*(x1322)))+(((IkReal(-1.00000000000000))*(x1315)*(x1327)))+(((r02)*(x1319))));
 evalcond[4]=((((cj4)*(r02)*(x1315)))+(((IkReal(-1.00000000000000))*(x1317)*(x1319)*(x1321)))+(((cj4)*(x1316)*(x1320)))+(((r11)*(x1330)))+(((IkReal(-1.00000000000000))*(r12)*(x1317)*(x1322)))+(((IkReal(-1.00000000000000))*(x1317)*(x1319)*(x1327)))+(((cj4)*(x1318)*(x1320)))+(((sj2)*(x1314)))+(((IkReal(-1.00000000000000))*(r01)*(x1331)))+(((IkReal(-1.00000000000000))*(r10)*(x1323)*(x1328)))+(((r00)*(sj0)*(x1323))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r10)*(sj0)*(x1323)))+(((IkReal(-1.00000000000000))*(x1317)*(x1320)*(x1327)))+(((IkReal(-1.00000000000000))*(r12)*(x1315)*(x1317)))+(((r11)*(x1331)))+(((IkReal(-1.00000000000000))*(x1317)*(x1320)*(x1321)))+(((r01)*(x1330)))+(((IkReal(-1.00000000000000))*(r02)*(x1317)*(x1322)))+(((IkReal(-1.00000000000000))*(r00)*(x1323)*(x1328)))+(((IkReal(-1.00000000000000))*(x1316)*(x1317)*(x1319)))+(((IkReal(-1.00000000000000))*(x1329)))+(((IkReal(-1.00000000000000))*(x1317)*(x1318)*(x1319))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -4137,8 +4180,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -4196,7 +4238,7 @@ if( j2array[0] > IKPI )
 else if( j2array[0] < -IKPI )
 {    j2array[0]+=IK2PI;
 }
-j2valid[0] = true;
+j2valid[0] = IKinlimits(2,j2array[0]);
 for(int ij2 = 0; ij2 < 1; ++ij2)
 {
 if( !j2valid[ij2] )
@@ -4229,7 +4271,7 @@ IkReal x1362=((r00)*(sj6));
 IkReal x1363=((cj0)*(x1356));
 evalcond[0]=((((IkReal(-1.00000000000000))*(r22)*(x1360)))+(((IkReal(-0.0690000000000000))*(IKcos(j2))))+(((IkReal(-1.00000000000000))*(x1353)*(x1359)))+(((x1356)*(x1359)))+(((IkReal(-1.00000000000000))*(r22)*(x1357)))+(((IkReal(-1.00000000000000))*(x1353)*(x1354)))+(pz)+(((x1354)*(x1356))));
 evalcond[1]=((((cj0)*(x1351)*(x1353)))+(((IkReal(-1.00000000000000))*(x1355)*(x1363)))+(((IkReal(-1.00000000000000))*(cj5)*(r02)*(x1352)))+(((IkReal(-1.00000000000000))*(cj0)*(py)))+(((cj0)*(x1353)*(x1355)))+(((IkReal(-1.00000000000000))*(sj0)*(x1353)*(x1358)))+(((IkReal(-1.00000000000000))*(sj0)*(x1353)*(x1362)))+(((IkReal(-1.00000000000000))*(r02)*(sj0)*(x1357)))+(((IkReal(0.0690000000000000))*(IKsin(j2))))+(((sj5)*(x1352)*(x1358)))+(((x1357)*(x1361)))+(((x1360)*(x1361)))+(((sj5)*(x1352)*(x1362)))+(((IkReal(-1.00000000000000))*(x1351)*(x1363)))+(((px)*(sj0))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -4358,7 +4400,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -4386,7 +4428,7 @@ IkReal x1449=((cj6)*(r01)*(sj5));
 IkReal x1450=((IkReal(1.00000000000000))*(sj0)*(sj5));
 evalcond[0]=((((IkReal(-1.00000000000000))*(sj5)*(x1444)*(x1445)))+(((IkReal(-1.00000000000000))*(r02)*(x1447)))+(((r12)*(x1443)))+(((sj0)*(x1448)))+(((IkReal(-1.00000000000000))*(IKsin(j3))))+(((sj0)*(x1449)))+(((IkReal(-1.00000000000000))*(sj5)*(x1444)*(x1446))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x1446)*(x1450)))+(((r12)*(x1447)))+(((IkReal(-1.00000000000000))*(x1445)*(x1450)))+(((IkReal(-1.00000000000000))*(x1444)*(x1448)))+(IKcos(j3))+(((r02)*(x1443)))+(((IkReal(-1.00000000000000))*(x1444)*(x1449))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -4481,7 +4523,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -4532,14 +4574,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x1506)*(x1510)*(x1516)))+(((IkReal(-
 evalcond[3]=((((x1517)*(x1524)))+(((IkReal(-1.00000000000000))*(x1510)*(x1530)))+(((IkReal(-1.00000000000000))*(r10)*(x1507)*(x1510)*(x1519)))+(cj3)+(((r01)*(x1512)*(x1524)))+(((x1515)*(x1521)))+(((x1513)*(x1523)))+(((IkReal(-1.00000000000000))*(x1509)*(x1511)*(x1526)))+(((x1522)*(x1524)))+(((IkReal(-1.00000000000000))*(r10)*(x1509)*(x1523)))+(((IkReal(-1.00000000000000))*(r01)*(x1514)*(x1521))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x1506)*(x1510)*(x1517)))+(((IkReal(-1.00000000000000))*(x1509)*(x1511)*(x1521)))+(((IkReal(-1.00000000000000))*(x1506)*(x1510)*(x1522)))+(((x1518)*(x1524)))+(((IkReal(-1.00000000000000))*(x1510)*(x1531)))+(((IkReal(-1.00000000000000))*(x1521)*(x1532)))+(((IkReal(-1.00000000000000))*(x1516)*(x1521)))+(((IkReal(-1.00000000000000))*(x1509)*(x1520)*(x1523)))+(((IkReal(-1.00000000000000))*(x1513)*(x1524)))+(((x1515)*(x1526))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x1509)*(x1511)*(x1524)))+(((r01)*(sj6)*(x1523)))+(((IkReal(-1.00000000000000))*(x1516)*(x1524)))+(sj3)+(((IkReal(-1.00000000000000))*(x1507)*(x1510)*(x1522)))+(((IkReal(-1.00000000000000))*(x1509)*(x1520)*(x1526)))+(((IkReal(-1.00000000000000))*(x1507)*(x1510)*(x1517)))+(((IkReal(-1.00000000000000))*(r00)*(x1509)*(x1523)))+(((IkReal(-1.00000000000000))*(x1524)*(x1532)))+(((x1513)*(x1521)))+(((IkReal(-1.00000000000000))*(r10)*(x1509)*(x1521))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -4575,8 +4617,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -4603,7 +4644,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -4654,14 +4695,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x1536)*(x1538)*(x1550)))+(((IkReal(-
 evalcond[3]=((((x1540)*(x1550)))+(((x1542)*(x1548)))+(((IkReal(-1.00000000000000))*(r10)*(x1536)*(x1550)))+(((r01)*(x1539)*(x1551)))+(((x1544)*(x1551)))+(((IkReal(-1.00000000000000))*(x1537)*(x1557)))+(((IkReal(-1.00000000000000))*(r01)*(x1541)*(x1548)))+(((IkReal(-1.00000000000000))*(r10)*(x1534)*(x1537)*(x1546)))+(cj3)+(((x1549)*(x1551)))+(((IkReal(-1.00000000000000))*(x1536)*(x1538)*(x1553))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x1540)*(x1551)))+(((x1542)*(x1553)))+(((IkReal(-1.00000000000000))*(x1536)*(x1538)*(x1548)))+(((IkReal(-1.00000000000000))*(x1533)*(x1537)*(x1544)))+(((IkReal(-1.00000000000000))*(x1533)*(x1537)*(x1549)))+(((IkReal(-1.00000000000000))*(x1536)*(x1547)*(x1550)))+(((IkReal(-1.00000000000000))*(x1543)*(x1548)))+(((IkReal(-1.00000000000000))*(x1548)*(x1559)))+(((x1545)*(x1551)))+(((IkReal(-1.00000000000000))*(x1537)*(x1558))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x1536)*(x1547)*(x1553)))+(((x1540)*(x1548)))+(((r01)*(sj6)*(x1550)))+(((IkReal(-1.00000000000000))*(r00)*(x1536)*(x1550)))+(sj3)+(((IkReal(-1.00000000000000))*(x1536)*(x1538)*(x1551)))+(((IkReal(-1.00000000000000))*(r10)*(x1536)*(x1548)))+(((IkReal(-1.00000000000000))*(x1551)*(x1559)))+(((IkReal(-1.00000000000000))*(x1534)*(x1537)*(x1544)))+(((IkReal(-1.00000000000000))*(x1534)*(x1537)*(x1549)))+(((IkReal(-1.00000000000000))*(x1543)*(x1551))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -4697,8 +4738,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -4757,7 +4797,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -4785,7 +4825,7 @@ IkReal x1589=((cj6)*(r01)*(sj5));
 IkReal x1590=((IkReal(1.00000000000000))*(sj0)*(sj5));
 evalcond[0]=((((IkReal(-1.00000000000000))*(sj5)*(x1584)*(x1585)))+(((IkReal(-1.00000000000000))*(r02)*(x1587)))+(((r12)*(x1583)))+(((sj0)*(x1588)))+(IKsin(j3))+(((sj0)*(x1589)))+(((IkReal(-1.00000000000000))*(sj5)*(x1584)*(x1586))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x1584)*(x1589)))+(((r02)*(x1583)))+(((IkReal(-1.00000000000000))*(x1585)*(x1590)))+(IKcos(j3))+(((IkReal(-1.00000000000000))*(x1586)*(x1590)))+(((IkReal(-1.00000000000000))*(x1584)*(x1588)))+(((r12)*(x1587))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -4874,7 +4914,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -4925,14 +4965,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(r10)*(x1640)*(x1644)*(x1653)))+(((r0
 evalcond[3]=((((x1649)*(x1655)))+(((x1656)*(x1658)))+(((IkReal(-1.00000000000000))*(r01)*(x1648)*(x1655)))+(((IkReal(-1.00000000000000))*(r10)*(x1641)*(x1644)*(x1653)))+(((IkReal(-1.00000000000000))*(cj3)))+(((IkReal(-1.00000000000000))*(x1644)*(x1664)))+(((x1651)*(x1658)))+(((x1647)*(x1657)))+(((r01)*(x1646)*(x1658)))+(((IkReal(-1.00000000000000))*(r10)*(x1643)*(x1657)))+(((IkReal(-1.00000000000000))*(x1643)*(x1645)*(x1660))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x1644)*(x1665)))+(((IkReal(-1.00000000000000))*(x1640)*(x1644)*(x1656)))+(((IkReal(-1.00000000000000))*(x1643)*(x1654)*(x1657)))+(((IkReal(-1.00000000000000))*(x1643)*(x1645)*(x1655)))+(((IkReal(-1.00000000000000))*(x1655)*(x1666)))+(((x1649)*(x1660)))+(((x1652)*(x1658)))+(((IkReal(-1.00000000000000))*(x1640)*(x1644)*(x1651)))+(((IkReal(-1.00000000000000))*(x1650)*(x1655)))+(((IkReal(-1.00000000000000))*(x1647)*(x1658))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x1643)*(x1645)*(x1658)))+(sj3)+(((x1647)*(x1655)))+(((IkReal(-1.00000000000000))*(x1658)*(x1666)))+(((IkReal(-1.00000000000000))*(x1641)*(x1644)*(x1651)))+(((IkReal(-1.00000000000000))*(r00)*(x1643)*(x1657)))+(((IkReal(-1.00000000000000))*(r10)*(x1643)*(x1655)))+(((IkReal(-1.00000000000000))*(x1641)*(x1644)*(x1656)))+(((IkReal(-1.00000000000000))*(x1650)*(x1658)))+(((IkReal(-1.00000000000000))*(x1643)*(x1654)*(x1660)))+(((r01)*(sj6)*(x1657))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -4968,8 +5008,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -4996,7 +5035,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -5047,14 +5086,14 @@ evalcond[2]=((((r01)*(sj6)*(x1685)))+(((x1682)*(x1683)))+(((x1679)*(x1687)))+(((
 evalcond[3]=((((IkReal(-1.00000000000000))*(r01)*(x1675)*(x1682)))+(((IkReal(-1.00000000000000))*(x1671)*(x1691)))+(((IkReal(-1.00000000000000))*(r10)*(x1670)*(x1684)))+(((IkReal(-1.00000000000000))*(r10)*(x1668)*(x1671)*(x1680)))+(((r01)*(x1673)*(x1685)))+(((IkReal(-1.00000000000000))*(cj3)))+(((IkReal(-1.00000000000000))*(x1670)*(x1672)*(x1687)))+(((x1676)*(x1682)))+(((x1683)*(x1685)))+(((x1674)*(x1684)))+(((x1678)*(x1685))));
 evalcond[4]=((((x1676)*(x1687)))+(((IkReal(-1.00000000000000))*(x1667)*(x1671)*(x1683)))+(((IkReal(-1.00000000000000))*(x1670)*(x1681)*(x1684)))+(((IkReal(-1.00000000000000))*(x1670)*(x1672)*(x1682)))+(((IkReal(-1.00000000000000))*(x1667)*(x1671)*(x1678)))+(((IkReal(-1.00000000000000))*(x1677)*(x1682)))+(((IkReal(-1.00000000000000))*(x1682)*(x1693)))+(((IkReal(-1.00000000000000))*(x1671)*(x1692)))+(((IkReal(-1.00000000000000))*(x1674)*(x1685)))+(((x1679)*(x1685))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x1685)*(x1693)))+(((IkReal(-1.00000000000000))*(x1677)*(x1685)))+(((IkReal(-1.00000000000000))*(r10)*(x1670)*(x1682)))+(((IkReal(-1.00000000000000))*(x1670)*(x1672)*(x1685)))+(sj3)+(((x1674)*(x1682)))+(((IkReal(-1.00000000000000))*(x1670)*(x1681)*(x1687)))+(((IkReal(-1.00000000000000))*(x1668)*(x1671)*(x1678)))+(((r01)*(sj6)*(x1684)))+(((IkReal(-1.00000000000000))*(r00)*(x1670)*(x1684)))+(((IkReal(-1.00000000000000))*(x1668)*(x1671)*(x1683))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -5090,8 +5129,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -5136,7 +5174,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -5164,7 +5202,7 @@ IkReal x1703=((cj6)*(r11)*(sj5));
 evalcond[0]=((((cj2)*(x1697)))+(((cj6)*(r21)*(sj5)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((r20)*(x1698))));
 evalcond[1]=((((r12)*(x1699)))+(((IkReal(-1.00000000000000))*(x1700)*(x1703)))+(((IkReal(-1.00000000000000))*(cj5)*(r02)*(x1701)))+(((sj0)*(x1702)))+(((r00)*(sj0)*(x1698)))+(((IkReal(-1.00000000000000))*(sj2)*(x1697)))+(((IkReal(-1.00000000000000))*(r10)*(x1698)*(x1700))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r00)*(x1698)*(x1700)))+(((r02)*(x1699)))+(((IkReal(-1.00000000000000))*(x1700)*(x1702)))+(((cj5)*(r12)*(sj0)))+(((IkReal(-1.00000000000000))*(r10)*(x1698)*(x1701)))+(IKcos(j3))+(((IkReal(-1.00000000000000))*(x1701)*(x1703))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -5262,7 +5300,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -5311,14 +5349,14 @@ evalcond[2]=((((x1769)*(x1778)))+(((IkReal(-1.00000000000000))*(x1766)*(x1768)*(
 evalcond[3]=((((IkReal(-1.00000000000000))*(r10)*(sj6)*(x1770)*(x1776)))+(((x1768)*(x1777)))+(((IkReal(-1.00000000000000))*(cj5)*(x1763)*(x1766)*(x1768)))+(((cj5)*(x1764)*(x1778)))+(((cj6)*(sj0)*(x1783)))+(((cj5)*(x1767)*(x1778)))+(((IkReal(-1.00000000000000))*(sj0)*(x1762)*(x1769)))+(((x1773)*(x1778)))+(((IkReal(-1.00000000000000))*(cj0)*(x1766)*(x1779)))+(((IkReal(-1.00000000000000))*(sj5)*(x1765)*(x1776)))+(((cj3)*(sj2))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x1778)*(x1782)))+(((cj6)*(r00)*(x1776)))+(((IkReal(-1.00000000000000))*(cj0)*(x1762)*(x1764)*(x1770)))+(((IkReal(-1.00000000000000))*(x1769)*(x1776)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x1770)*(x1777)))+(((IkReal(-1.00000000000000))*(sj0)*(x1765)*(x1775)))+(((IkReal(-1.00000000000000))*(cj0)*(x1762)*(x1773)))+(((x1774)*(x1778)))+(((IkReal(-1.00000000000000))*(x1766)*(x1772)*(x1781)))+(((IkReal(-1.00000000000000))*(sj0)*(x1762)*(x1766)*(x1771))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x1773)*(x1776)))+(((IkReal(-1.00000000000000))*(sj5)*(x1765)*(x1778)))+(sj3)+(((IkReal(-1.00000000000000))*(cj0)*(x1766)*(x1783)))+(((r11)*(sj0)*(x1777)))+(((IkReal(-1.00000000000000))*(x1766)*(x1771)*(x1778)))+(((IkReal(-1.00000000000000))*(cj5)*(x1763)*(x1766)*(x1772)))+(((cj0)*(x1762)*(x1769)))+(((IkReal(-1.00000000000000))*(r10)*(sj6)*(x1770)*(x1778)))+(((IkReal(-1.00000000000000))*(x1764)*(x1770)*(x1776)))+(((IkReal(-1.00000000000000))*(sj0)*(x1766)*(x1779))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -5354,8 +5392,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -5388,7 +5425,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -5437,14 +5474,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x1797)*(x1799)*(x1812)))+(((sj0)*(x1
 evalcond[3]=((((cj6)*(sj0)*(x1814)))+(((x1799)*(x1808)))+(((IkReal(-1.00000000000000))*(r10)*(sj6)*(x1801)*(x1807)))+(((IkReal(-1.00000000000000))*(sj0)*(x1793)*(x1800)))+(((x1804)*(x1809)))+(((cj3)*(sj2)))+(((cj5)*(x1798)*(x1809)))+(((cj5)*(x1795)*(x1809)))+(((IkReal(-1.00000000000000))*(cj0)*(x1797)*(x1810)))+(((IkReal(-1.00000000000000))*(sj5)*(x1796)*(x1807)))+(((IkReal(-1.00000000000000))*(cj5)*(x1794)*(x1797)*(x1799))));
 evalcond[4]=((((x1805)*(x1809)))+(((IkReal(-1.00000000000000))*(x1809)*(x1813)))+(((IkReal(-1.00000000000000))*(x1797)*(x1803)*(x1812)))+(((IkReal(-1.00000000000000))*(cj0)*(x1793)*(x1804)))+(((IkReal(-1.00000000000000))*(sj0)*(x1796)*(x1806)))+(((IkReal(-1.00000000000000))*(cj0)*(x1793)*(x1795)*(x1801)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x1801)*(x1808)))+(((IkReal(-1.00000000000000))*(sj0)*(x1793)*(x1797)*(x1802)))+(((IkReal(-1.00000000000000))*(x1800)*(x1807)))+(((cj6)*(r00)*(x1807))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x1804)*(x1807)))+(((IkReal(-1.00000000000000))*(x1797)*(x1802)*(x1809)))+(((cj0)*(x1793)*(x1800)))+(sj3)+(((IkReal(-1.00000000000000))*(cj5)*(x1794)*(x1797)*(x1803)))+(((IkReal(-1.00000000000000))*(sj0)*(x1797)*(x1810)))+(((IkReal(-1.00000000000000))*(cj0)*(x1797)*(x1814)))+(((IkReal(-1.00000000000000))*(r10)*(sj6)*(x1801)*(x1809)))+(((IkReal(-1.00000000000000))*(sj5)*(x1796)*(x1809)))+(((r11)*(sj0)*(x1808)))+(((IkReal(-1.00000000000000))*(x1795)*(x1801)*(x1807))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -5480,8 +5517,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -5522,7 +5558,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -5557,7 +5593,7 @@ IkReal x1839=((r11)*(sj6)*(x1827));
 evalcond[0]=((sj2)+(((r22)*(x1833)))+(((r20)*(sj6)*(x1835)))+(((r21)*(sj6)*(x1827)))+(((IkReal(-1.00000000000000))*(r20)*(x1836)))+(((cj6)*(r21)*(x1835))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x1830)*(x1839)))+(((cj0)*(r10)*(x1836)))+(((r02)*(sj0)*(x1833)))+(((IkReal(-1.00000000000000))*(r12)*(x1830)*(x1833)))+(cj2)+(((IkReal(-1.00000000000000))*(x1830)*(x1832)*(x1835)))+(((sj0)*(x1838)))+(((x1828)*(x1837)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x1830)*(x1835)))+(((IkReal(-1.00000000000000))*(r00)*(x1831)*(x1836)))+(((x1829)*(x1837))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x1831)*(x1839)))+(((IkReal(-1.00000000000000))*(r02)*(x1830)*(x1833)))+(((IkReal(-1.00000000000000))*(x1829)*(x1830)*(x1835)))+(((r10)*(sj0)*(x1836)))+(((IkReal(-1.00000000000000))*(r12)*(x1831)*(x1833)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x1831)*(x1835)))+(((IkReal(-1.00000000000000))*(x1830)*(x1838)))+(((IkReal(-1.00000000000000))*(x1831)*(x1832)*(x1835)))+(((IkReal(-1.00000000000000))*(x1828)*(x1830)*(x1835)))+(((cj0)*(r00)*(x1836))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -5646,7 +5682,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -5684,14 +5720,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(cj5)*(r22)))+(x1878)+(((sj5)*(x1889)
 evalcond[1]=((((x1888)*(x1889)))+(((x1888)*(x1890)))+(((IkReal(-1.00000000000000))*(r21)*(x1887)))+(((cj4)*(r22)*(sj5)))+(((r20)*(x1886)))+(((IkReal(-1.00000000000000))*(x1877))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x1880)*(x1891)))+(((r12)*(x1885)))+(((r02)*(x1881)))+(((IkReal(-1.00000000000000))*(x1883)*(x1892)))+(x1877)+(((IkReal(-1.00000000000000))*(x1880)*(x1884)))+(((IkReal(-1.00000000000000))*(x1882)*(x1892))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(cj0)*(r00)*(x1886)))+(((r11)*(sj0)*(x1887)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x1886)))+(((IkReal(-1.00000000000000))*(x1879)*(x1881)*(x1882)))+(((IkReal(-1.00000000000000))*(x1879)*(x1881)*(x1883)))+(((IkReal(-1.00000000000000))*(r12)*(x1879)*(x1880)))+(((IkReal(-1.00000000000000))*(x1879)*(x1885)*(x1891)))+(x1878)+(((cj0)*(r01)*(x1887)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x1879)))+(((IkReal(-1.00000000000000))*(x1879)*(x1884)*(x1885))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -5727,8 +5763,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -5799,7 +5834,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -5837,14 +5872,14 @@ evalcond[0]=((((sj5)*(x1943)))+(((IkReal(-1.00000000000000))*(x1931)))+(((sj5)*(
 evalcond[1]=((x1930)+(((IkReal(-1.00000000000000))*(r21)*(x1940)))+(((x1941)*(x1943)))+(((r20)*(x1939)))+(((cj4)*(r22)*(sj5)))+(((x1941)*(x1942))));
 evalcond[2]=((x1930)+(((r02)*(x1934)))+(((IkReal(-1.00000000000000))*(x1936)*(x1945)))+(((r12)*(x1938)))+(((IkReal(-1.00000000000000))*(x1935)*(x1945)))+(((IkReal(-1.00000000000000))*(x1933)*(x1937)))+(((IkReal(-1.00000000000000))*(x1933)*(x1944))));
 evalcond[3]=((x1931)+(((IkReal(-1.00000000000000))*(r12)*(x1932)*(x1933)))+(((IkReal(-1.00000000000000))*(x1932)*(x1934)*(x1936)))+(((IkReal(-1.00000000000000))*(x1932)*(x1938)*(x1944)))+(((cj0)*(r01)*(x1940)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x1932)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x1939)))+(((r11)*(sj0)*(x1940)))+(((IkReal(-1.00000000000000))*(x1932)*(x1934)*(x1935)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x1939)))+(((IkReal(-1.00000000000000))*(x1932)*(x1937)*(x1938))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -5880,8 +5915,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -5949,7 +5983,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -5988,14 +6022,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(r02)*(x1988)))+(((x1982)*(x1983)))+(
 evalcond[1]=((((IkReal(-1.00000000000000))*(cj6)*(r01)*(x1991)))+(x1980)+(((r12)*(x1988)))+(((IkReal(-1.00000000000000))*(x1982)*(x1989)))+(((IkReal(-1.00000000000000))*(x1983)*(x1991)))+(((r02)*(x1987)))+(((IkReal(-1.00000000000000))*(x1982)*(x1990))));
 evalcond[2]=((((cj4)*(x1983)*(x1988)))+(x1980)+(((r11)*(x1995)))+(((IkReal(-1.00000000000000))*(x1992)*(x1994)))+(((cj4)*(r02)*(x1982)))+(((x1984)*(x1993)))+(((IkReal(-1.00000000000000))*(r12)*(x1985)*(x1991)))+(((IkReal(-1.00000000000000))*(x1985)*(x1987)*(x1990)))+(((IkReal(-1.00000000000000))*(r01)*(x1996)))+(((IkReal(-1.00000000000000))*(x1985)*(x1987)*(x1989)))+(((x1984)*(x1986))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x1984)*(x1992)))+(x1981)+(((IkReal(-1.00000000000000))*(r02)*(x1985)*(x1991)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x1985)*(x1987)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x1984)*(x1985)))+(((IkReal(-1.00000000000000))*(x1986)*(x1994)))+(((IkReal(-1.00000000000000))*(x1983)*(x1985)*(x1987)))+(((r01)*(x1995)))+(((r11)*(x1996)))+(((IkReal(-1.00000000000000))*(x1985)*(x1988)*(x1990)))+(((IkReal(-1.00000000000000))*(r12)*(x1982)*(x1985))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -6031,8 +6065,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -6098,7 +6131,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -6137,14 +6170,14 @@ evalcond[0]=((x2030)+(((x2031)*(x2032)))+(((IkReal(-1.00000000000000))*(r02)*(x2
 evalcond[1]=((x2029)+(((IkReal(-1.00000000000000))*(x2032)*(x2039)))+(((r02)*(x2036)))+(((IkReal(-1.00000000000000))*(x2031)*(x2041)))+(((IkReal(-1.00000000000000))*(x2037)*(x2039)))+(((r12)*(x2038)))+(((IkReal(-1.00000000000000))*(x2031)*(x2040))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x2029)))+(((cj4)*(x2032)*(x2038)))+(((IkReal(-1.00000000000000))*(x2033)*(x2036)*(x2041)))+(((IkReal(-1.00000000000000))*(r12)*(x2033)*(x2039)))+(((IkReal(-1.00000000000000))*(x2042)*(x2045)))+(((IkReal(-1.00000000000000))*(x2033)*(x2036)*(x2040)))+(((IkReal(-1.00000000000000))*(r01)*(x2044)))+(((r11)*(x2043)))+(((cj4)*(cj5)*(r01)*(x2034)))+(((cj4)*(r02)*(x2031)))+(((x2034)*(x2035))));
 evalcond[3]=((x2030)+(((r01)*(x2043)))+(((IkReal(-1.00000000000000))*(r02)*(x2033)*(x2039)))+(((r11)*(x2044)))+(((IkReal(-1.00000000000000))*(x2034)*(x2042)))+(((IkReal(-1.00000000000000))*(r12)*(x2031)*(x2033)))+(((IkReal(-1.00000000000000))*(x2032)*(x2033)*(x2036)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x2033)*(x2034)))+(((IkReal(-1.00000000000000))*(x2033)*(x2038)*(x2041)))+(((IkReal(-1.00000000000000))*(x2033)*(x2036)*(x2037)))+(((IkReal(-1.00000000000000))*(x2035)*(x2045))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -6180,8 +6213,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -6226,7 +6258,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -6268,14 +6300,14 @@ evalcond[2]=((((x2055)*(x2056)))+(((IkReal(-1.00000000000000))*(x2063)*(x2067)))
 evalcond[3]=((((IkReal(-1.00000000000000))*(x2055)*(x2061)))+(((r02)*(x2059)))+(((IkReal(-1.00000000000000))*(x2058)*(x2063)))+(x2054)+(((IkReal(-1.00000000000000))*(x2056)*(x2063)))+(((r12)*(x2060)))+(((IkReal(-1.00000000000000))*(x2055)*(x2067))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r01)*(x2070)))+(((IkReal(-1.00000000000000))*(r12)*(x2057)*(x2063)))+(((r00)*(sj0)*(x2062)))+(((cj4)*(r02)*(x2055)))+(((IkReal(-1.00000000000000))*(r10)*(x2062)*(x2068)))+(((IkReal(-1.00000000000000))*(x2057)*(x2059)*(x2061)))+(((r11)*(x2069)))+(((cj4)*(x2058)*(x2060)))+(((IkReal(-1.00000000000000))*(x2057)*(x2059)*(x2067)))+(((cj4)*(x2056)*(x2060)))+(((sj2)*(x2054))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x2057)*(x2058)*(x2059)))+(((IkReal(-1.00000000000000))*(x2057)*(x2060)*(x2061)))+(x2053)+(((IkReal(-1.00000000000000))*(r12)*(x2055)*(x2057)))+(((r01)*(x2069)))+(((IkReal(-1.00000000000000))*(r00)*(x2062)*(x2068)))+(((r11)*(x2070)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x2062)))+(((IkReal(-1.00000000000000))*(x2057)*(x2060)*(x2067)))+(((IkReal(-1.00000000000000))*(x2056)*(x2057)*(x2059)))+(((IkReal(-1.00000000000000))*(r02)*(x2057)*(x2063))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -6311,8 +6343,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -6342,7 +6373,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -6384,14 +6415,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x2084)*(x2088)))+(((IkReal(-1.000000
 evalcond[3]=((x2075)+(((IkReal(-1.00000000000000))*(x2076)*(x2082)))+(((r12)*(x2081)))+(((r02)*(x2080)))+(((IkReal(-1.00000000000000))*(x2077)*(x2084)))+(((IkReal(-1.00000000000000))*(x2076)*(x2088)))+(((IkReal(-1.00000000000000))*(x2079)*(x2084))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r10)*(x2083)*(x2089)))+(((IkReal(-1.00000000000000))*(x2078)*(x2080)*(x2082)))+(((r00)*(sj0)*(x2083)))+(((IkReal(-1.00000000000000))*(r12)*(x2078)*(x2084)))+(((cj4)*(r02)*(x2076)))+(((r11)*(x2090)))+(((sj2)*(x2075)))+(((IkReal(-1.00000000000000))*(x2078)*(x2080)*(x2088)))+(((cj4)*(x2077)*(x2081)))+(((cj4)*(x2079)*(x2081)))+(((IkReal(-1.00000000000000))*(r01)*(x2091))));
 evalcond[5]=((x2074)+(((r01)*(x2090)))+(((IkReal(-1.00000000000000))*(x2078)*(x2079)*(x2080)))+(((IkReal(-1.00000000000000))*(x2078)*(x2081)*(x2082)))+(((IkReal(-1.00000000000000))*(x2077)*(x2078)*(x2080)))+(((IkReal(-1.00000000000000))*(r12)*(x2076)*(x2078)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x2083)))+(((r11)*(x2091)))+(((IkReal(-1.00000000000000))*(r00)*(x2083)*(x2089)))+(((IkReal(-1.00000000000000))*(r02)*(x2078)*(x2084)))+(((IkReal(-1.00000000000000))*(x2078)*(x2081)*(x2088))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -6427,8 +6458,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -6458,7 +6488,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -6500,14 +6530,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(sj2)*(x2095)))+(((IkReal(-1.00000000
 evalcond[3]=((x2096)+(((IkReal(-1.00000000000000))*(x2098)*(x2105)))+(((IkReal(-1.00000000000000))*(x2100)*(x2105)))+(((r12)*(x2102)))+(((r02)*(x2101)))+(((IkReal(-1.00000000000000))*(x2097)*(x2103)))+(((IkReal(-1.00000000000000))*(x2097)*(x2109))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x2099)*(x2101)*(x2103)))+(((IkReal(-1.00000000000000))*(r10)*(x2104)*(x2110)))+(((sj2)*(x2096)))+(((cj4)*(r02)*(x2097)))+(((cj4)*(x2100)*(x2102)))+(((cj4)*(x2098)*(x2102)))+(((IkReal(-1.00000000000000))*(r12)*(x2099)*(x2105)))+(((IkReal(-1.00000000000000))*(x2099)*(x2101)*(x2109)))+(((IkReal(-1.00000000000000))*(r01)*(x2112)))+(((r11)*(x2111)))+(((r00)*(sj0)*(x2104))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x2099)*(x2100)*(x2101)))+(((IkReal(-1.00000000000000))*(r00)*(x2104)*(x2110)))+(((r01)*(x2111)))+(((IkReal(-1.00000000000000))*(x2098)*(x2099)*(x2101)))+(x2095)+(((r11)*(x2112)))+(((IkReal(-1.00000000000000))*(r12)*(x2097)*(x2099)))+(((IkReal(-1.00000000000000))*(r02)*(x2099)*(x2105)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x2104)))+(((IkReal(-1.00000000000000))*(x2099)*(x2102)*(x2109)))+(((IkReal(-1.00000000000000))*(x2099)*(x2102)*(x2103))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -6543,8 +6573,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -6584,7 +6613,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -6619,7 +6648,7 @@ IkReal x2133=((r11)*(sj6)*(x2121));
 evalcond[0]=((sj2)+(((cj6)*(r21)*(x2129)))+(((IkReal(-1.00000000000000))*(r20)*(x2130)))+(((r21)*(sj6)*(x2121)))+(((r20)*(sj6)*(x2129)))+(((r22)*(x2127))));
 evalcond[1]=((((sj0)*(x2132)))+(((x2123)*(x2131)))+(((IkReal(-1.00000000000000))*(r12)*(x2124)*(x2127)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x2124)*(x2129)))+(((IkReal(-1.00000000000000))*(r00)*(x2125)*(x2130)))+(((IkReal(-1.00000000000000))*(x2124)*(x2126)*(x2129)))+(((cj0)*(r10)*(x2130)))+(cj2)+(((r02)*(sj0)*(x2127)))+(((IkReal(-1.00000000000000))*(x2124)*(x2133)))+(((x2122)*(x2131))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x2125)*(x2133)))+(((IkReal(-1.00000000000000))*(x2125)*(x2126)*(x2129)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x2125)*(x2129)))+(((IkReal(-1.00000000000000))*(x2123)*(x2124)*(x2129)))+(((IkReal(-1.00000000000000))*(x2124)*(x2132)))+(((IkReal(-1.00000000000000))*(r12)*(x2125)*(x2127)))+(((IkReal(-1.00000000000000))*(r02)*(x2124)*(x2127)))+(((IkReal(-1.00000000000000))*(x2122)*(x2124)*(x2129)))+(((r10)*(sj0)*(x2130)))+(((cj0)*(r00)*(x2130))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -6708,7 +6737,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -6746,14 +6775,14 @@ evalcond[0]=((x2172)+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((sj5)*(x2184)
 evalcond[1]=((((IkReal(-1.00000000000000))*(r21)*(x2181)))+(((cj4)*(r22)*(sj5)))+(((IkReal(-1.00000000000000))*(x2171)))+(((x2182)*(x2183)))+(((x2182)*(x2184)))+(((r20)*(x2180))));
 evalcond[2]=((x2171)+(((IkReal(-1.00000000000000))*(x2176)*(x2186)))+(((r02)*(x2175)))+(((IkReal(-1.00000000000000))*(x2174)*(x2185)))+(((IkReal(-1.00000000000000))*(x2174)*(x2178)))+(((r12)*(x2179)))+(((IkReal(-1.00000000000000))*(x2177)*(x2186))));
 evalcond[3]=((((cj0)*(r01)*(x2181)))+(x2172)+(((r11)*(sj0)*(x2181)))+(((IkReal(-1.00000000000000))*(x2173)*(x2179)*(x2185)))+(((IkReal(-1.00000000000000))*(x2173)*(x2175)*(x2177)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x2180)))+(((IkReal(-1.00000000000000))*(x2173)*(x2178)*(x2179)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x2173)))+(((IkReal(-1.00000000000000))*(r12)*(x2173)*(x2174)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x2180)))+(((IkReal(-1.00000000000000))*(x2173)*(x2175)*(x2176))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -6789,8 +6818,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -6861,7 +6889,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -6899,14 +6927,14 @@ evalcond[0]=((((sj5)*(x2236)))+(((sj5)*(x2237)))+(((IkReal(-1.00000000000000))*(
 evalcond[1]=((x2224)+(((r20)*(x2233)))+(((IkReal(-1.00000000000000))*(r21)*(x2234)))+(((x2235)*(x2237)))+(((cj4)*(r22)*(sj5)))+(((x2235)*(x2236))));
 evalcond[2]=((x2224)+(((IkReal(-1.00000000000000))*(x2230)*(x2239)))+(((IkReal(-1.00000000000000))*(x2227)*(x2238)))+(((IkReal(-1.00000000000000))*(x2227)*(x2231)))+(((IkReal(-1.00000000000000))*(x2229)*(x2239)))+(((r12)*(x2232)))+(((r02)*(x2228))));
 evalcond[3]=((x2225)+(((IkReal(-1.00000000000000))*(x2226)*(x2228)*(x2229)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x2226)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x2233)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x2233)))+(((IkReal(-1.00000000000000))*(x2226)*(x2228)*(x2230)))+(((IkReal(-1.00000000000000))*(x2226)*(x2232)*(x2238)))+(((IkReal(-1.00000000000000))*(r12)*(x2226)*(x2227)))+(((IkReal(-1.00000000000000))*(x2226)*(x2231)*(x2232)))+(((cj0)*(r01)*(x2234)))+(((r11)*(sj0)*(x2234))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -6942,8 +6970,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -7011,7 +7038,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -7050,14 +7077,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(r02)*(x2282)))+(((cj6)*(r01)*(x2276)
 evalcond[1]=((((IkReal(-1.00000000000000))*(x2277)*(x2285)))+(((IkReal(-1.00000000000000))*(x2276)*(x2283)))+(((r12)*(x2282)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x2285)))+(x2274)+(((r02)*(x2281)))+(((IkReal(-1.00000000000000))*(x2276)*(x2284))));
 evalcond[2]=((((cj4)*(x2277)*(x2282)))+(((x2278)*(x2280)))+(((cj4)*(r02)*(x2276)))+(((IkReal(-1.00000000000000))*(x2279)*(x2281)*(x2284)))+(((r11)*(x2289)))+(((IkReal(-1.00000000000000))*(x2286)*(x2288)))+(x2274)+(((IkReal(-1.00000000000000))*(r01)*(x2290)))+(((IkReal(-1.00000000000000))*(x2279)*(x2281)*(x2283)))+(((IkReal(-1.00000000000000))*(r12)*(x2279)*(x2285)))+(((x2278)*(x2287))));
 evalcond[3]=((((r01)*(x2289)))+(((r11)*(x2290)))+(((IkReal(-1.00000000000000))*(x2279)*(x2282)*(x2284)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x2279)*(x2281)))+(((IkReal(-1.00000000000000))*(r02)*(x2279)*(x2285)))+(((IkReal(-1.00000000000000))*(x2280)*(x2288)))+(((IkReal(-1.00000000000000))*(x2278)*(x2286)))+(x2275)+(((IkReal(-1.00000000000000))*(r12)*(x2276)*(x2279)))+(((IkReal(-1.00000000000000))*(x2277)*(x2279)*(x2281)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x2278)*(x2279))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -7093,8 +7120,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -7160,7 +7186,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -7199,14 +7225,14 @@ evalcond[0]=((((r12)*(x2330)))+(x2324)+(((IkReal(-1.00000000000000))*(r02)*(x233
 evalcond[1]=((x2323)+(((IkReal(-1.00000000000000))*(x2325)*(x2335)))+(((IkReal(-1.00000000000000))*(x2331)*(x2333)))+(((IkReal(-1.00000000000000))*(x2325)*(x2334)))+(((r02)*(x2330)))+(((r12)*(x2332)))+(((IkReal(-1.00000000000000))*(x2326)*(x2333))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x2336)*(x2339)))+(((IkReal(-1.00000000000000))*(r12)*(x2327)*(x2333)))+(((x2328)*(x2329)))+(((IkReal(-1.00000000000000))*(x2327)*(x2330)*(x2334)))+(((IkReal(-1.00000000000000))*(x2323)))+(((IkReal(-1.00000000000000))*(r01)*(x2338)))+(((IkReal(-1.00000000000000))*(x2327)*(x2330)*(x2335)))+(((cj4)*(x2326)*(x2332)))+(((r11)*(x2337)))+(((cj4)*(cj5)*(r01)*(x2328)))+(((cj4)*(r02)*(x2325))));
 evalcond[3]=((x2324)+(((IkReal(-1.00000000000000))*(r02)*(x2327)*(x2333)))+(((IkReal(-1.00000000000000))*(x2326)*(x2327)*(x2330)))+(((IkReal(-1.00000000000000))*(x2327)*(x2330)*(x2331)))+(((IkReal(-1.00000000000000))*(x2329)*(x2339)))+(((IkReal(-1.00000000000000))*(x2328)*(x2336)))+(((IkReal(-1.00000000000000))*(x2327)*(x2332)*(x2335)))+(((IkReal(-1.00000000000000))*(r12)*(x2325)*(x2327)))+(((r11)*(x2338)))+(((r01)*(x2337)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x2327)*(x2328))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -7242,8 +7268,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -7288,7 +7313,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -7330,14 +7355,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x2357)*(x2361)))+(((IkReal(-1.000000
 evalcond[3]=((((r02)*(x2353)))+(((IkReal(-1.00000000000000))*(x2349)*(x2361)))+(((IkReal(-1.00000000000000))*(x2350)*(x2357)))+(x2348)+(((r12)*(x2354)))+(((IkReal(-1.00000000000000))*(x2349)*(x2355)))+(((IkReal(-1.00000000000000))*(x2352)*(x2357))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r12)*(x2351)*(x2357)))+(((cj4)*(x2350)*(x2354)))+(((IkReal(-1.00000000000000))*(x2351)*(x2353)*(x2361)))+(((r00)*(sj0)*(x2356)))+(((IkReal(-1.00000000000000))*(r10)*(x2356)*(x2362)))+(((cj4)*(x2352)*(x2354)))+(((IkReal(-1.00000000000000))*(x2351)*(x2353)*(x2355)))+(((r11)*(x2363)))+(((cj4)*(r02)*(x2349)))+(((sj2)*(x2348)))+(((IkReal(-1.00000000000000))*(r01)*(x2364))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x2351)*(x2354)*(x2355)))+(((IkReal(-1.00000000000000))*(x2351)*(x2354)*(x2361)))+(((r11)*(x2364)))+(((IkReal(-1.00000000000000))*(r12)*(x2349)*(x2351)))+(x2347)+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x2356)))+(((IkReal(-1.00000000000000))*(x2351)*(x2352)*(x2353)))+(((IkReal(-1.00000000000000))*(r02)*(x2351)*(x2357)))+(((IkReal(-1.00000000000000))*(r00)*(x2356)*(x2362)))+(((r01)*(x2363)))+(((IkReal(-1.00000000000000))*(x2350)*(x2351)*(x2353))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -7373,8 +7398,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -7404,7 +7428,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -7446,14 +7470,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x2376)*(x2378)))+(((r12)*(x2374)))+(
 evalcond[3]=((x2369)+(((IkReal(-1.00000000000000))*(x2370)*(x2382)))+(((r02)*(x2374)))+(((IkReal(-1.00000000000000))*(x2371)*(x2378)))+(((IkReal(-1.00000000000000))*(x2370)*(x2376)))+(((r12)*(x2375)))+(((IkReal(-1.00000000000000))*(x2373)*(x2378))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r12)*(x2372)*(x2378)))+(((IkReal(-1.00000000000000))*(x2372)*(x2374)*(x2376)))+(((r11)*(x2384)))+(((cj4)*(x2373)*(x2375)))+(((cj4)*(r02)*(x2370)))+(((sj2)*(x2369)))+(((IkReal(-1.00000000000000))*(r01)*(x2385)))+(((r00)*(sj0)*(x2377)))+(((IkReal(-1.00000000000000))*(r10)*(x2377)*(x2383)))+(((IkReal(-1.00000000000000))*(x2372)*(x2374)*(x2382)))+(((cj4)*(x2371)*(x2375))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x2372)*(x2373)*(x2374)))+(x2368)+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x2377)))+(((IkReal(-1.00000000000000))*(x2372)*(x2375)*(x2382)))+(((IkReal(-1.00000000000000))*(r00)*(x2377)*(x2383)))+(((r01)*(x2384)))+(((IkReal(-1.00000000000000))*(x2371)*(x2372)*(x2374)))+(((IkReal(-1.00000000000000))*(x2372)*(x2375)*(x2376)))+(((IkReal(-1.00000000000000))*(r12)*(x2370)*(x2372)))+(((IkReal(-1.00000000000000))*(r02)*(x2372)*(x2378)))+(((r11)*(x2385))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -7489,8 +7513,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -7520,7 +7543,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -7562,14 +7585,14 @@ evalcond[2]=((((x2391)*(x2392)))+(((IkReal(-1.00000000000000))*(r02)*(x2396)))+(
 evalcond[3]=((((IkReal(-1.00000000000000))*(x2391)*(x2403)))+(((r12)*(x2396)))+(((r02)*(x2395)))+(((IkReal(-1.00000000000000))*(x2392)*(x2399)))+(x2390)+(((IkReal(-1.00000000000000))*(x2394)*(x2399)))+(((IkReal(-1.00000000000000))*(x2391)*(x2397))));
 evalcond[4]=((((cj4)*(r02)*(x2391)))+(((sj2)*(x2390)))+(((cj4)*(x2392)*(x2396)))+(((IkReal(-1.00000000000000))*(r01)*(x2406)))+(((cj4)*(x2394)*(x2396)))+(((IkReal(-1.00000000000000))*(x2393)*(x2395)*(x2397)))+(((r11)*(x2405)))+(((IkReal(-1.00000000000000))*(r10)*(x2398)*(x2404)))+(((IkReal(-1.00000000000000))*(x2393)*(x2395)*(x2403)))+(((IkReal(-1.00000000000000))*(r12)*(x2393)*(x2399)))+(((r00)*(sj0)*(x2398))));
 evalcond[5]=((x2389)+(((IkReal(-1.00000000000000))*(r00)*(x2398)*(x2404)))+(((r01)*(x2405)))+(((IkReal(-1.00000000000000))*(x2393)*(x2394)*(x2395)))+(((IkReal(-1.00000000000000))*(r12)*(x2391)*(x2393)))+(((IkReal(-1.00000000000000))*(x2393)*(x2396)*(x2397)))+(((IkReal(-1.00000000000000))*(x2393)*(x2396)*(x2403)))+(((r11)*(x2406)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x2398)))+(((IkReal(-1.00000000000000))*(x2392)*(x2393)*(x2395)))+(((IkReal(-1.00000000000000))*(r02)*(x2393)*(x2399))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -7605,8 +7628,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -7664,7 +7686,7 @@ if( j2array[0] > IKPI )
 else if( j2array[0] < -IKPI )
 {    j2array[0]+=IK2PI;
 }
-j2valid[0] = true;
+j2valid[0] = IKinlimits(2,j2array[0]);
 for(int ij2 = 0; ij2 < 1; ++ij2)
 {
 if( !j2valid[ij2] )
@@ -7699,7 +7721,7 @@ IkReal x2439=((x2433)*(x2437));
 IkReal x2440=((x2435)*(x2437));
 evalcond[0]=((((x2428)*(x2438)))+(((IkReal(-1.00000000000000))*(r10)*(x2440)))+(((IkReal(-1.00000000000000))*(r00)*(x2431)*(x2434)))+(((IkReal(-1.00000000000000))*(r11)*(x2439)))+(((IkReal(-1.00000000000000))*(r01)*(x2429)*(x2434)))+(((r01)*(x2426)*(x2433)))+(((IkReal(-1.00000000000000))*(x2426)*(x2427)))+(((IkReal(0.0690000000000000))*(IKsin(j2))))+(((r10)*(x2428)*(x2431)))+(((r00)*(x2426)*(x2435)))+(((px)*(sj0)))+(((r11)*(x2428)*(x2429)))+(((IkReal(-1.00000000000000))*(cj0)*(x2432)))+(((IkReal(-1.00000000000000))*(x2430)*(x2434)))+(((x2436)*(x2437))));
 evalcond[1]=((IkReal(0.0690000000000000))+(((IkReal(-1.00000000000000))*(cj0)*(px)))+(((x2434)*(x2438)))+(((IkReal(-0.0690000000000000))*(IKcos(j2))))+(((r00)*(x2428)*(x2431)))+(((x2426)*(x2436)))+(((r10)*(x2431)*(x2434)))+(((x2427)*(x2437)))+(((IkReal(-1.00000000000000))*(r00)*(x2440)))+(((IkReal(-1.00000000000000))*(r01)*(x2439)))+(((IkReal(-1.00000000000000))*(r10)*(x2426)*(x2435)))+(((r11)*(x2429)*(x2434)))+(((x2428)*(x2430)))+(((r01)*(x2428)*(x2429)))+(((IkReal(-1.00000000000000))*(r11)*(x2426)*(x2433)))+(((IkReal(-1.00000000000000))*(sj0)*(x2432))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -7827,7 +7849,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -7851,7 +7873,7 @@ IkReal x2521=((IkReal(1.00000000000000))*(cj0));
 IkReal x2522=((IkReal(1.00000000000000))*(cj5));
 evalcond[0]=((((r21)*(x2520)))+(((IkReal(-1.00000000000000))*(IKcos(j3))))+(((r20)*(x2519)))+(((IkReal(-1.00000000000000))*(r22)*(x2522))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(r02)*(sj0)*(x2522)))+(((IkReal(-1.00000000000000))*(r11)*(x2520)*(x2521)))+(((r01)*(sj0)*(x2520)))+(((cj0)*(cj5)*(r12)))+(((IkReal(-1.00000000000000))*(r10)*(x2519)*(x2521)))+(((r00)*(sj0)*(x2519)))+(((IkReal(-1.00000000000000))*(IKsin(j3)))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -7957,7 +7979,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -8008,14 +8030,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x2589)*(x2593)*(x2599)))+(((IkReal(-
 evalcond[3]=((((IkReal(-1.00000000000000))*(r10)*(x2592)*(x2606)))+(((IkReal(-1.00000000000000))*(x2593)*(x2613)))+(((IkReal(-1.00000000000000))*(r10)*(x2590)*(x2593)*(x2602)))+(((IkReal(-1.00000000000000))*(x2592)*(x2594)*(x2609)))+(cj3)+(((x2600)*(x2607)))+(((x2598)*(x2604)))+(((IkReal(-1.00000000000000))*(r01)*(x2597)*(x2604)))+(((r01)*(x2595)*(x2607)))+(((x2605)*(x2607)))+(((x2596)*(x2606))));
 evalcond[4]=((IkReal(1.00000000000000))+(((IkReal(-1.00000000000000))*(x2604)*(x2615)))+(((IkReal(-1.00000000000000))*(x2589)*(x2593)*(x2600)))+(((IkReal(-1.00000000000000))*(x2589)*(x2593)*(x2605)))+(((IkReal(-1.00000000000000))*(x2592)*(x2594)*(x2604)))+(((IkReal(-1.00000000000000))*(x2592)*(x2603)*(x2606)))+(((IkReal(-1.00000000000000))*(x2599)*(x2604)))+(((x2601)*(x2607)))+(((IkReal(-1.00000000000000))*(x2596)*(x2607)))+(((x2598)*(x2609)))+(((IkReal(-1.00000000000000))*(x2593)*(x2614))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x2607)*(x2615)))+(((r01)*(sj6)*(x2606)))+(((IkReal(-1.00000000000000))*(r00)*(x2592)*(x2606)))+(((IkReal(-1.00000000000000))*(x2592)*(x2603)*(x2609)))+(((IkReal(-1.00000000000000))*(x2590)*(x2593)*(x2600)))+(((IkReal(-1.00000000000000))*(x2599)*(x2607)))+(((IkReal(-1.00000000000000))*(x2590)*(x2593)*(x2605)))+(((IkReal(-1.00000000000000))*(x2592)*(x2594)*(x2607)))+(((x2596)*(x2604)))+(((IkReal(-1.00000000000000))*(r10)*(x2592)*(x2604))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -8051,8 +8073,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -8081,7 +8102,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -8132,14 +8153,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x2618)*(x2622)*(x2628)))+(((IkReal(-
 evalcond[3]=((((IkReal(-1.00000000000000))*(r10)*(x2621)*(x2635)))+(((IkReal(-1.00000000000000))*(r01)*(x2626)*(x2633)))+(((r01)*(x2624)*(x2636)))+(((x2629)*(x2636)))+(((IkReal(-1.00000000000000))*(x2622)*(x2642)))+(((x2634)*(x2636)))+(cj3)+(((x2627)*(x2633)))+(((x2625)*(x2635)))+(((IkReal(-1.00000000000000))*(x2621)*(x2623)*(x2638)))+(((IkReal(-1.00000000000000))*(r10)*(x2619)*(x2622)*(x2631))));
 evalcond[4]=((IkReal(1.00000000000000))+(((IkReal(-1.00000000000000))*(x2618)*(x2622)*(x2629)))+(((x2630)*(x2636)))+(((IkReal(-1.00000000000000))*(x2628)*(x2633)))+(((IkReal(-1.00000000000000))*(x2621)*(x2623)*(x2633)))+(((IkReal(-1.00000000000000))*(x2625)*(x2636)))+(((x2627)*(x2638)))+(((IkReal(-1.00000000000000))*(x2633)*(x2644)))+(((IkReal(-1.00000000000000))*(x2621)*(x2632)*(x2635)))+(((IkReal(-1.00000000000000))*(x2622)*(x2643)))+(((IkReal(-1.00000000000000))*(x2618)*(x2622)*(x2634))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r00)*(x2621)*(x2635)))+(((x2625)*(x2633)))+(((IkReal(-1.00000000000000))*(r10)*(x2621)*(x2633)))+(((IkReal(-1.00000000000000))*(x2621)*(x2632)*(x2638)))+(((IkReal(-1.00000000000000))*(x2636)*(x2644)))+(((IkReal(-1.00000000000000))*(x2619)*(x2622)*(x2629)))+(((IkReal(-1.00000000000000))*(x2619)*(x2622)*(x2634)))+(((IkReal(-1.00000000000000))*(x2621)*(x2623)*(x2636)))+(((r01)*(sj6)*(x2635)))+(((IkReal(-1.00000000000000))*(x2628)*(x2636))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -8175,8 +8196,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -8236,7 +8256,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -8260,7 +8280,7 @@ IkReal x2671=((IkReal(1.00000000000000))*(cj0));
 IkReal x2672=((IkReal(1.00000000000000))*(cj5));
 evalcond[0]=((((IkReal(-1.00000000000000))*(IKcos(j3))))+(((r21)*(x2670)))+(((IkReal(-1.00000000000000))*(r22)*(x2672)))+(((r20)*(x2669))));
 evalcond[1]=((((r00)*(sj0)*(x2669)))+(((IkReal(-1.00000000000000))*(r10)*(x2669)*(x2671)))+(((cj0)*(cj5)*(r12)))+(((IkReal(-1.00000000000000))*(r02)*(sj0)*(x2672)))+(((r01)*(sj0)*(x2670)))+(((IkReal(-1.00000000000000))*(r11)*(x2670)*(x2671)))+(IKsin(j3)));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -8362,7 +8382,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -8413,14 +8433,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x2736)*(x2739)*(x2742)))+(((IkReal(-
 evalcond[3]=((((x2751)*(x2753)))+(((IkReal(-1.00000000000000))*(x2738)*(x2740)*(x2755)))+(((IkReal(-1.00000000000000))*(x2739)*(x2759)))+(((IkReal(-1.00000000000000))*(r10)*(x2738)*(x2752)))+(((IkReal(-1.00000000000000))*(r10)*(x2736)*(x2739)*(x2748)))+(((x2744)*(x2750)))+(((x2746)*(x2753)))+(((r01)*(x2741)*(x2753)))+(((x2742)*(x2752)))+(((IkReal(-1.00000000000000))*(cj3)))+(((IkReal(-1.00000000000000))*(r01)*(x2743)*(x2750))));
 evalcond[4]=((IkReal(-1.00000000000000))+(((IkReal(-1.00000000000000))*(x2739)*(x2760)))+(((IkReal(-1.00000000000000))*(x2745)*(x2750)))+(((IkReal(-1.00000000000000))*(x2735)*(x2739)*(x2746)))+(((IkReal(-1.00000000000000))*(x2742)*(x2753)))+(((IkReal(-1.00000000000000))*(x2735)*(x2739)*(x2751)))+(((IkReal(-1.00000000000000))*(x2738)*(x2740)*(x2750)))+(((IkReal(-1.00000000000000))*(x2750)*(x2761)))+(((IkReal(-1.00000000000000))*(x2738)*(x2749)*(x2752)))+(((x2744)*(x2755)))+(((x2747)*(x2753))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x2736)*(x2739)*(x2751)))+(((r01)*(sj6)*(x2752)))+(((IkReal(-1.00000000000000))*(x2738)*(x2740)*(x2753)))+(((x2742)*(x2750)))+(((IkReal(-1.00000000000000))*(x2745)*(x2753)))+(((IkReal(-1.00000000000000))*(x2738)*(x2749)*(x2755)))+(((IkReal(-1.00000000000000))*(x2736)*(x2739)*(x2746)))+(((IkReal(-1.00000000000000))*(x2753)*(x2761)))+(((IkReal(-1.00000000000000))*(r00)*(x2738)*(x2752)))+(((IkReal(-1.00000000000000))*(r10)*(x2738)*(x2750))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -8456,8 +8476,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -8486,7 +8505,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -8537,14 +8556,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x2767)*(x2769)*(x2781)))+(((IkReal(-
 evalcond[3]=((((r01)*(x2770)*(x2782)))+(((x2773)*(x2779)))+(((IkReal(-1.00000000000000))*(x2767)*(x2769)*(x2784)))+(((IkReal(-1.00000000000000))*(r10)*(x2767)*(x2781)))+(((IkReal(-1.00000000000000))*(r10)*(x2765)*(x2768)*(x2777)))+(((x2780)*(x2782)))+(((IkReal(-1.00000000000000))*(cj3)))+(((x2775)*(x2782)))+(((IkReal(-1.00000000000000))*(r01)*(x2772)*(x2779)))+(((x2771)*(x2781)))+(((IkReal(-1.00000000000000))*(x2768)*(x2788))));
 evalcond[4]=((IkReal(-1.00000000000000))+(((x2776)*(x2782)))+(((IkReal(-1.00000000000000))*(x2764)*(x2768)*(x2775)))+(((IkReal(-1.00000000000000))*(x2774)*(x2779)))+(((IkReal(-1.00000000000000))*(x2764)*(x2768)*(x2780)))+(((IkReal(-1.00000000000000))*(x2767)*(x2778)*(x2781)))+(((x2773)*(x2784)))+(((IkReal(-1.00000000000000))*(x2771)*(x2782)))+(((IkReal(-1.00000000000000))*(x2768)*(x2789)))+(((IkReal(-1.00000000000000))*(x2779)*(x2790)))+(((IkReal(-1.00000000000000))*(x2767)*(x2769)*(x2779))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x2767)*(x2778)*(x2784)))+(((r01)*(sj6)*(x2781)))+(((IkReal(-1.00000000000000))*(r10)*(x2767)*(x2779)))+(((IkReal(-1.00000000000000))*(x2765)*(x2768)*(x2780)))+(((IkReal(-1.00000000000000))*(x2767)*(x2769)*(x2782)))+(((IkReal(-1.00000000000000))*(x2774)*(x2782)))+(((x2771)*(x2779)))+(((IkReal(-1.00000000000000))*(x2782)*(x2790)))+(((IkReal(-1.00000000000000))*(r00)*(x2767)*(x2781)))+(((IkReal(-1.00000000000000))*(x2765)*(x2768)*(x2775))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -8580,8 +8599,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -8626,7 +8644,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -8654,7 +8672,7 @@ IkReal x2800=((cj6)*(r11)*(sj5));
 evalcond[0]=((((cj6)*(r21)*(sj5)))+(((r20)*(x2795)))+(((IkReal(-1.00000000000000))*(IKcos(j3))))+(((IkReal(-1.00000000000000))*(cj5)*(r22))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(r10)*(x2795)*(x2797)))+(((sj0)*(x2799)))+(((r12)*(x2796)))+(((IkReal(-1.00000000000000))*(x2797)*(x2800)))+(((r00)*(sj0)*(x2795)))+(((IkReal(-1.00000000000000))*(cj5)*(r02)*(x2798)))+(((IkReal(-1.00000000000000))*(sj2)*(x2794))));
 evalcond[2]=((((cj2)*(x2794)))+(((IkReal(-1.00000000000000))*(x2797)*(x2799)))+(((cj5)*(r12)*(sj0)))+(((IkReal(-1.00000000000000))*(r00)*(x2795)*(x2797)))+(((IkReal(-1.00000000000000))*(x2798)*(x2800)))+(((IkReal(-1.00000000000000))*(r10)*(x2795)*(x2798)))+(((r02)*(x2796))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -8745,7 +8763,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -8795,14 +8813,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(r00)*(x2856)*(x2872)))+(((IkReal(-1.
 evalcond[3]=((((x2865)*(x2872)))+(((x2858)*(x2871)))+(((IkReal(-1.00000000000000))*(x2856)*(x2862)*(x2870)))+(((cj5)*(x2857)*(x2872)))+(((x2863)*(x2873)))+(((IkReal(-1.00000000000000))*(x2859)*(x2873)))+(((cj3)*(sj2)))+(((cj5)*(x2854)*(x2872)))+(((IkReal(-1.00000000000000))*(r10)*(x2856)*(x2871)))+(((IkReal(-1.00000000000000))*(sj5)*(x2855)*(x2870)))+(((IkReal(-1.00000000000000))*(x2860)*(x2861)*(x2870))));
 evalcond[4]=((((x2866)*(x2872)))+(((IkReal(-1.00000000000000))*(x2856)*(x2868)*(x2871)))+(sj2)+(((IkReal(-1.00000000000000))*(x2859)*(x2870)))+(((IkReal(-1.00000000000000))*(x2860)*(x2861)*(x2873)))+(((IkReal(-1.00000000000000))*(x2854)*(x2860)*(x2871)))+(((IkReal(-1.00000000000000))*(x2856)*(x2862)*(x2873)))+(((IkReal(-1.00000000000000))*(x2858)*(x2872)))+(((x2863)*(x2870)))+(((IkReal(-1.00000000000000))*(sj0)*(x2855)*(x2869)))+(((IkReal(-1.00000000000000))*(x2865)*(x2871))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r10)*(x2856)*(x2873)))+(((IkReal(-1.00000000000000))*(r00)*(x2856)*(x2871)))+(((IkReal(-1.00000000000000))*(x2860)*(x2861)*(x2872)))+(((IkReal(-1.00000000000000))*(sj5)*(x2855)*(x2872)))+(((IkReal(-1.00000000000000))*(x2856)*(x2868)*(x2870)))+(((x2859)*(x2871)))+(((IkReal(-1.00000000000000))*(x2865)*(x2870)))+(((x2858)*(x2873)))+(((IkReal(-1.00000000000000))*(x2854)*(x2860)*(x2870)))+(((IkReal(-1.00000000000000))*(x2856)*(x2862)*(x2872)))+(((IkReal(-1.00000000000000))*(cj2)*(cj3))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -8838,8 +8856,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -8868,7 +8885,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -8918,14 +8935,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x2886)*(x2898)))+(((IkReal(-1.000000
 evalcond[3]=((((x2893)*(x2900)))+(((cj5)*(x2885)*(x2900)))+(((IkReal(-1.00000000000000))*(x2888)*(x2889)*(x2898)))+(((cj5)*(x2882)*(x2900)))+(((IkReal(-1.00000000000000))*(x2887)*(x2901)))+(((IkReal(-1.00000000000000))*(sj5)*(x2883)*(x2898)))+(((IkReal(-1.00000000000000))*(x2884)*(x2890)*(x2898)))+(((x2886)*(x2899)))+(((cj3)*(sj2)))+(((IkReal(-1.00000000000000))*(r10)*(x2884)*(x2899)))+(((x2891)*(x2901))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x2886)*(x2900)))+(((IkReal(-1.00000000000000))*(sj0)*(x2883)*(x2897)))+(((IkReal(-1.00000000000000))*(x2882)*(x2888)*(x2899)))+(sj2)+(((IkReal(-1.00000000000000))*(x2888)*(x2889)*(x2901)))+(((IkReal(-1.00000000000000))*(x2893)*(x2899)))+(((IkReal(-1.00000000000000))*(x2887)*(x2898)))+(((IkReal(-1.00000000000000))*(x2884)*(x2896)*(x2899)))+(((x2891)*(x2898)))+(((x2894)*(x2900)))+(((IkReal(-1.00000000000000))*(x2884)*(x2890)*(x2901))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r10)*(x2884)*(x2901)))+(((IkReal(-1.00000000000000))*(sj5)*(x2883)*(x2900)))+(((IkReal(-1.00000000000000))*(x2884)*(x2890)*(x2900)))+(((IkReal(-1.00000000000000))*(x2888)*(x2889)*(x2900)))+(((IkReal(-1.00000000000000))*(x2884)*(x2896)*(x2898)))+(((IkReal(-1.00000000000000))*(r00)*(x2884)*(x2899)))+(((x2887)*(x2899)))+(((IkReal(-1.00000000000000))*(x2882)*(x2888)*(x2898)))+(((x2886)*(x2901)))+(((IkReal(-1.00000000000000))*(x2893)*(x2898)))+(((IkReal(-1.00000000000000))*(cj2)*(cj3))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -8961,8 +8978,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -8996,7 +9012,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -9031,7 +9047,7 @@ IkReal x2920=((r11)*(sj6)*(x2908));
 evalcond[0]=((((cj6)*(r21)*(x2916)))+(((IkReal(-1.00000000000000))*(r20)*(x2917)))+(((r22)*(x2914)))+(((r21)*(sj6)*(x2908)))+(((r20)*(sj6)*(x2916))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x2911)*(x2913)*(x2916)))+(((IkReal(-1.00000000000000))*(x2911)*(x2920)))+(((cj0)*(r10)*(x2917)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x2911)*(x2916)))+(((IkReal(-1.00000000000000))*(r00)*(x2912)*(x2917)))+(((x2910)*(x2918)))+(cj2)+(((IkReal(-1.00000000000000))*(r12)*(x2911)*(x2914)))+(((r02)*(sj0)*(x2914)))+(((sj0)*(x2919)))+(((x2909)*(x2918))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x2909)*(x2911)*(x2916)))+(((IkReal(-1.00000000000000))*(x2912)*(x2920)))+(((cj0)*(r00)*(x2917)))+(sj2)+(((IkReal(-1.00000000000000))*(x2910)*(x2911)*(x2916)))+(((IkReal(-1.00000000000000))*(r02)*(x2911)*(x2914)))+(((IkReal(-1.00000000000000))*(x2912)*(x2913)*(x2916)))+(((IkReal(-1.00000000000000))*(x2911)*(x2919)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x2912)*(x2916)))+(((IkReal(-1.00000000000000))*(r12)*(x2912)*(x2914)))+(((r10)*(sj0)*(x2917))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -9056,7 +9072,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -9101,14 +9117,14 @@ evalcond[2]=((((x2926)*(x2927)))+(((cj0)*(x2931)))+(((IkReal(-1.00000000000000))
 evalcond[3]=((((IkReal(-1.00000000000000))*(x2926)*(x2938)))+(((cj2)*(x2924)))+(((IkReal(-1.00000000000000))*(sj5)*(x2928)*(x2930)))+(((IkReal(-1.00000000000000))*(x2926)*(x2933)))+(((cj0)*(x2935)))+(((sj0)*(x2931)))+(((IkReal(-1.00000000000000))*(sj5)*(x2927)*(x2930))));
 evalcond[4]=((((x2926)*(x2940)))+(((IkReal(-1.00000000000000))*(r01)*(x2932)*(x2939)))+(((r11)*(x2942)))+(((sj0)*(x2928)*(x2929)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x2930)))+(((r00)*(sj0)*(x2934)))+(((sj0)*(x2927)*(x2929)))+(((IkReal(-1.00000000000000))*(x2929)*(x2930)*(x2933)))+(((IkReal(-1.00000000000000))*(r10)*(x2930)*(x2934)))+(((IkReal(-1.00000000000000))*(x2929)*(x2930)*(x2938)))+(((sj2)*(x2925))));
 evalcond[5]=((((r11)*(sj0)*(x2939)))+(((IkReal(-1.00000000000000))*(x2927)*(x2929)*(x2930)))+(((r01)*(x2942)))+(((IkReal(-1.00000000000000))*(r10)*(x2932)*(x2934)))+(((IkReal(-1.00000000000000))*(x2926)*(x2941)))+(((IkReal(-1.00000000000000))*(r00)*(x2930)*(x2934)))+(((IkReal(-1.00000000000000))*(sj5)*(x2930)*(x2940)))+(((IkReal(-1.00000000000000))*(x2929)*(x2932)*(x2933)))+(((IkReal(-1.00000000000000))*(x2928)*(x2929)*(x2930)))+(((IkReal(-1.00000000000000))*(cj2)*(x2944)))+(((IkReal(-1.00000000000000))*(x2929)*(x2932)*(x2938))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -9144,8 +9160,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -9177,7 +9192,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -9212,7 +9227,7 @@ IkReal x2961=((r11)*(sj6)*(x2949));
 evalcond[0]=((((r20)*(sj6)*(x2957)))+(((cj6)*(r21)*(x2957)))+(((r22)*(x2955)))+(((IkReal(-1.00000000000000))*(r20)*(x2958)))+(((r21)*(sj6)*(x2949))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x2952)*(x2954)*(x2957)))+(((IkReal(-1.00000000000000))*(r12)*(x2952)*(x2955)))+(((IkReal(-1.00000000000000))*(r00)*(x2953)*(x2958)))+(((x2950)*(x2959)))+(((x2951)*(x2959)))+(cj2)+(((sj0)*(x2960)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x2952)*(x2957)))+(((IkReal(-1.00000000000000))*(x2952)*(x2961)))+(((cj0)*(r10)*(x2958)))+(((r02)*(sj0)*(x2955))));
 evalcond[2]=((sj2)+(((IkReal(-1.00000000000000))*(x2950)*(x2952)*(x2957)))+(((IkReal(-1.00000000000000))*(x2951)*(x2952)*(x2957)))+(((cj0)*(r00)*(x2958)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x2953)*(x2957)))+(((IkReal(-1.00000000000000))*(r12)*(x2953)*(x2955)))+(((IkReal(-1.00000000000000))*(x2953)*(x2961)))+(((r10)*(sj0)*(x2958)))+(((IkReal(-1.00000000000000))*(x2952)*(x2960)))+(((IkReal(-1.00000000000000))*(x2953)*(x2954)*(x2957)))+(((IkReal(-1.00000000000000))*(r02)*(x2952)*(x2955))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -9237,7 +9252,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -9282,14 +9297,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(sj2)*(x2984)))+(((IkReal(-1.00000000
 evalcond[3]=((((IkReal(-1.00000000000000))*(sj5)*(x2968)*(x2971)))+(((IkReal(-1.00000000000000))*(x2967)*(x2974)))+(((IkReal(-1.00000000000000))*(sj5)*(x2969)*(x2971)))+(((sj0)*(x2972)))+(((cj0)*(x2976)))+(((IkReal(-1.00000000000000))*(x2967)*(x2979)))+(((cj2)*(x2965))));
 evalcond[4]=((((sj0)*(x2969)*(x2970)))+(((IkReal(-1.00000000000000))*(r01)*(x2973)*(x2980)))+(((r11)*(x2983)))+(((IkReal(-1.00000000000000))*(r10)*(x2971)*(x2975)))+(((IkReal(-1.00000000000000))*(x2970)*(x2971)*(x2979)))+(((x2967)*(x2981)))+(((sj0)*(x2968)*(x2970)))+(((IkReal(-1.00000000000000))*(x2970)*(x2971)*(x2974)))+(((r00)*(sj0)*(x2975)))+(((sj2)*(x2966)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x2971))));
 evalcond[5]=((((r01)*(x2983)))+(((IkReal(-1.00000000000000))*(sj5)*(x2971)*(x2981)))+(((IkReal(-1.00000000000000))*(r10)*(x2973)*(x2975)))+(((IkReal(-1.00000000000000))*(r00)*(x2971)*(x2975)))+(((IkReal(-1.00000000000000))*(x2967)*(x2982)))+(((IkReal(-1.00000000000000))*(x2970)*(x2973)*(x2979)))+(((IkReal(-1.00000000000000))*(x2969)*(x2970)*(x2971)))+(((r11)*(sj0)*(x2980)))+(((IkReal(-1.00000000000000))*(x2968)*(x2970)*(x2971)))+(((IkReal(-1.00000000000000))*(cj2)*(x2985)))+(((IkReal(-1.00000000000000))*(x2970)*(x2973)*(x2974))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -9325,8 +9340,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -9381,7 +9395,7 @@ if( j2array[0] > IKPI )
 else if( j2array[0] < -IKPI )
 {    j2array[0]+=IK2PI;
 }
-j2valid[0] = true;
+j2valid[0] = IKinlimits(2,j2array[0]);
 for(int ij2 = 0; ij2 < 1; ++ij2)
 {
 if( !j2valid[ij2] )
@@ -9416,7 +9430,7 @@ IkReal x3019=((x3013)*(x3017));
 IkReal x3020=((x3015)*(x3017));
 evalcond[0]=((((IkReal(-1.00000000000000))*(cj0)*(x3012)))+(((IkReal(-1.00000000000000))*(r10)*(x3020)))+(((IkReal(-1.00000000000000))*(x3006)*(x3007)))+(((r10)*(x3008)*(x3011)))+(((r00)*(x3006)*(x3015)))+(((IkReal(-1.00000000000000))*(r01)*(x3009)*(x3014)))+(((IkReal(-1.00000000000000))*(r11)*(x3019)))+(((IkReal(0.0690000000000000))*(IKsin(j2))))+(((IkReal(-1.00000000000000))*(r00)*(x3011)*(x3014)))+(((x3016)*(x3017)))+(((x3008)*(x3018)))+(((r01)*(x3006)*(x3013)))+(((px)*(sj0)))+(((r11)*(x3008)*(x3009)))+(((IkReal(-1.00000000000000))*(x3010)*(x3014))));
 evalcond[1]=((IkReal(0.0690000000000000))+(((IkReal(-1.00000000000000))*(r10)*(x3006)*(x3015)))+(((r01)*(x3008)*(x3009)))+(((IkReal(-1.00000000000000))*(cj0)*(px)))+(((IkReal(-1.00000000000000))*(sj0)*(x3012)))+(((x3007)*(x3017)))+(((x3008)*(x3010)))+(((IkReal(-1.00000000000000))*(r00)*(x3020)))+(((IkReal(0.0690000000000000))*(IKcos(j2))))+(((IkReal(-1.00000000000000))*(r11)*(x3006)*(x3013)))+(((r00)*(x3008)*(x3011)))+(((x3006)*(x3016)))+(((IkReal(-1.00000000000000))*(r01)*(x3019)))+(((r10)*(x3011)*(x3014)))+(((r11)*(x3009)*(x3014)))+(((x3014)*(x3018))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -9537,7 +9551,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -9559,7 +9573,7 @@ IkReal x3092=((sj5)*(sj6));
 IkReal x3093=((IkReal(1.00000000000000))*(cj6)*(sj5));
 evalcond[0]=((((cj6)*(r21)*(sj5)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(IKcos(j3))+(((r20)*(x3092))));
 evalcond[1]=((((cj0)*(cj5)*(r02)))+(((IkReal(-1.00000000000000))*(cj0)*(r01)*(x3093)))+(((cj5)*(r12)*(sj0)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x3092)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x3092)))+(((IkReal(-1.00000000000000))*(r11)*(sj0)*(x3093)))+(((IkReal(-1.00000000000000))*(IKsin(j3)))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -9644,7 +9658,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -9695,14 +9709,14 @@ evalcond[2]=((IkReal(1.00000000000000))+(((IkReal(-1.00000000000000))*(x3139)*(x
 evalcond[3]=((((r01)*(x3145)*(x3157)))+(((x3155)*(x3157)))+(((x3146)*(x3156)))+(((IkReal(-1.00000000000000))*(x3142)*(x3144)*(x3159)))+(((IkReal(-1.00000000000000))*(x3143)*(x3163)))+(((IkReal(-1.00000000000000))*(r10)*(x3142)*(x3156)))+(((IkReal(-1.00000000000000))*(r01)*(x3147)*(x3154)))+(((x3148)*(x3154)))+(((IkReal(-1.00000000000000))*(r10)*(x3140)*(x3143)*(x3152)))+(((x3150)*(x3157))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x3154)*(x3165)))+(((IkReal(-1.00000000000000))*(x3142)*(x3153)*(x3156)))+(((IkReal(-1.00000000000000))*(x3146)*(x3157)))+(((IkReal(-1.00000000000000))*(x3143)*(x3164)))+(((IkReal(-1.00000000000000))*(x3142)*(x3144)*(x3154)))+(((IkReal(-1.00000000000000))*(x3149)*(x3154)))+(((x3151)*(x3157)))+(((IkReal(-1.00000000000000))*(x3139)*(x3143)*(x3155)))+(((IkReal(-1.00000000000000))*(x3139)*(x3143)*(x3150)))+(((x3148)*(x3159))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x3142)*(x3153)*(x3159)))+(((IkReal(-1.00000000000000))*(r00)*(x3142)*(x3156)))+(((x3146)*(x3154)))+(((IkReal(-1.00000000000000))*(x3140)*(x3143)*(x3150)))+(cj3)+(((IkReal(-1.00000000000000))*(x3149)*(x3157)))+(((IkReal(-1.00000000000000))*(r10)*(x3142)*(x3154)))+(((IkReal(-1.00000000000000))*(x3157)*(x3165)))+(((IkReal(-1.00000000000000))*(x3142)*(x3144)*(x3157)))+(((r01)*(sj6)*(x3156)))+(((IkReal(-1.00000000000000))*(x3140)*(x3143)*(x3155))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -9738,8 +9752,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -9768,7 +9781,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -9819,14 +9832,14 @@ evalcond[2]=((IkReal(1.00000000000000))+(((IkReal(-1.00000000000000))*(r10)*(x31
 evalcond[3]=((((IkReal(-1.00000000000000))*(x3171)*(x3173)*(x3188)))+(((x3175)*(x3185)))+(((IkReal(-1.00000000000000))*(r10)*(x3169)*(x3172)*(x3181)))+(((x3184)*(x3186)))+(((x3179)*(x3186)))+(((IkReal(-1.00000000000000))*(x3172)*(x3192)))+(((IkReal(-1.00000000000000))*(r01)*(x3176)*(x3183)))+(((IkReal(-1.00000000000000))*(r10)*(x3171)*(x3185)))+(((x3177)*(x3183)))+(((r01)*(x3174)*(x3186))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x3171)*(x3173)*(x3183)))+(((x3180)*(x3186)))+(((x3177)*(x3188)))+(((IkReal(-1.00000000000000))*(x3168)*(x3172)*(x3184)))+(((IkReal(-1.00000000000000))*(x3172)*(x3193)))+(((IkReal(-1.00000000000000))*(x3168)*(x3172)*(x3179)))+(((IkReal(-1.00000000000000))*(x3183)*(x3194)))+(((IkReal(-1.00000000000000))*(x3175)*(x3186)))+(((IkReal(-1.00000000000000))*(x3178)*(x3183)))+(((IkReal(-1.00000000000000))*(x3171)*(x3182)*(x3185))));
 evalcond[5]=((((r01)*(sj6)*(x3185)))+(((IkReal(-1.00000000000000))*(x3178)*(x3186)))+(((IkReal(-1.00000000000000))*(x3169)*(x3172)*(x3184)))+(((IkReal(-1.00000000000000))*(x3186)*(x3194)))+(((IkReal(-1.00000000000000))*(x3171)*(x3173)*(x3186)))+(cj3)+(((IkReal(-1.00000000000000))*(x3171)*(x3182)*(x3188)))+(((x3175)*(x3183)))+(((IkReal(-1.00000000000000))*(x3169)*(x3172)*(x3179)))+(((IkReal(-1.00000000000000))*(r00)*(x3171)*(x3185)))+(((IkReal(-1.00000000000000))*(r10)*(x3171)*(x3183))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -9862,8 +9875,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -9919,7 +9931,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -9941,7 +9953,7 @@ IkReal x3215=((sj5)*(sj6));
 IkReal x3216=((IkReal(1.00000000000000))*(cj6)*(sj5));
 evalcond[0]=((((cj6)*(r21)*(sj5)))+(((r20)*(x3215)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(IKcos(j3)));
 evalcond[1]=((((cj0)*(cj5)*(r02)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x3215)))+(((IkReal(-1.00000000000000))*(r11)*(sj0)*(x3216)))+(((cj5)*(r12)*(sj0)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x3215)))+(IKsin(j3))+(((IkReal(-1.00000000000000))*(cj0)*(r01)*(x3216))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -10028,7 +10040,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -10079,14 +10091,14 @@ evalcond[2]=((IkReal(-1.00000000000000))+(((r01)*(sj6)*(x3282)))+(((r01)*(x3270)
 evalcond[3]=((((x3273)*(x3279)))+(((x3275)*(x3282)))+(((IkReal(-1.00000000000000))*(r10)*(x3265)*(x3268)*(x3277)))+(((r01)*(x3270)*(x3282)))+(((x3280)*(x3282)))+(((IkReal(-1.00000000000000))*(r10)*(x3267)*(x3281)))+(((IkReal(-1.00000000000000))*(x3267)*(x3269)*(x3284)))+(((IkReal(-1.00000000000000))*(x3268)*(x3288)))+(((x3271)*(x3281)))+(((IkReal(-1.00000000000000))*(r01)*(x3272)*(x3279))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x3274)*(x3279)))+(((x3273)*(x3284)))+(((IkReal(-1.00000000000000))*(x3279)*(x3290)))+(((IkReal(-1.00000000000000))*(x3267)*(x3278)*(x3281)))+(((IkReal(-1.00000000000000))*(x3267)*(x3269)*(x3279)))+(((IkReal(-1.00000000000000))*(x3264)*(x3268)*(x3280)))+(((x3276)*(x3282)))+(((IkReal(-1.00000000000000))*(x3264)*(x3268)*(x3275)))+(((IkReal(-1.00000000000000))*(x3271)*(x3282)))+(((IkReal(-1.00000000000000))*(x3268)*(x3289))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r10)*(x3267)*(x3279)))+(((IkReal(-1.00000000000000))*(r00)*(x3267)*(x3281)))+(((IkReal(-1.00000000000000))*(x3274)*(x3282)))+(((x3271)*(x3279)))+(((IkReal(-1.00000000000000))*(x3267)*(x3278)*(x3284)))+(((IkReal(-1.00000000000000))*(cj3)))+(((IkReal(-1.00000000000000))*(x3265)*(x3268)*(x3280)))+(((IkReal(-1.00000000000000))*(x3265)*(x3268)*(x3275)))+(((IkReal(-1.00000000000000))*(x3267)*(x3269)*(x3282)))+(((r01)*(sj6)*(x3281)))+(((IkReal(-1.00000000000000))*(x3282)*(x3290))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -10122,8 +10134,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -10152,7 +10163,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -10203,14 +10214,14 @@ evalcond[2]=((IkReal(-1.00000000000000))+(((IkReal(-1.00000000000000))*(x3294)*(
 evalcond[3]=((((x3300)*(x3310)))+(((IkReal(-1.00000000000000))*(x3296)*(x3298)*(x3313)))+(((IkReal(-1.00000000000000))*(x3297)*(x3317)))+(((IkReal(-1.00000000000000))*(r10)*(x3294)*(x3297)*(x3306)))+(((x3304)*(x3311)))+(((x3309)*(x3311)))+(((IkReal(-1.00000000000000))*(r01)*(x3301)*(x3308)))+(((IkReal(-1.00000000000000))*(r10)*(x3296)*(x3310)))+(((r01)*(x3299)*(x3311)))+(((x3302)*(x3308))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x3300)*(x3311)))+(((x3305)*(x3311)))+(((x3302)*(x3313)))+(((IkReal(-1.00000000000000))*(x3308)*(x3319)))+(((IkReal(-1.00000000000000))*(x3296)*(x3298)*(x3308)))+(((IkReal(-1.00000000000000))*(x3293)*(x3297)*(x3304)))+(((IkReal(-1.00000000000000))*(x3296)*(x3307)*(x3310)))+(((IkReal(-1.00000000000000))*(x3293)*(x3297)*(x3309)))+(((IkReal(-1.00000000000000))*(x3303)*(x3308)))+(((IkReal(-1.00000000000000))*(x3297)*(x3318))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r10)*(x3296)*(x3308)))+(((r01)*(sj6)*(x3310)))+(((IkReal(-1.00000000000000))*(r00)*(x3296)*(x3310)))+(((IkReal(-1.00000000000000))*(x3296)*(x3307)*(x3313)))+(((IkReal(-1.00000000000000))*(x3311)*(x3319)))+(((x3300)*(x3308)))+(((IkReal(-1.00000000000000))*(cj3)))+(((IkReal(-1.00000000000000))*(x3294)*(x3297)*(x3304)))+(((IkReal(-1.00000000000000))*(x3303)*(x3311)))+(((IkReal(-1.00000000000000))*(x3296)*(x3298)*(x3311)))+(((IkReal(-1.00000000000000))*(x3294)*(x3297)*(x3309))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -10246,8 +10257,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -10292,7 +10302,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -10321,7 +10331,7 @@ IkReal x3330=((cj6)*(r11)*(sj5));
 evalcond[0]=((((cj6)*(r21)*(sj5)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((r20)*(x3324)))+(IKcos(j3)));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x3326)*(x3330)))+(((r12)*(x3325)))+(((r00)*(sj0)*(x3324)))+(((IkReal(-1.00000000000000))*(sj2)*(x3328)))+(((IkReal(-1.00000000000000))*(r10)*(x3324)*(x3326)))+(((sj0)*(x3329)))+(((IkReal(-1.00000000000000))*(cj5)*(r02)*(x3327))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r00)*(x3324)*(x3326)))+(((r02)*(x3325)))+(((IkReal(-1.00000000000000))*(x3327)*(x3330)))+(((IkReal(-1.00000000000000))*(r10)*(x3324)*(x3327)))+(((cj5)*(r12)*(sj0)))+(((IkReal(-1.00000000000000))*(cj2)*(x3328)))+(((IkReal(-1.00000000000000))*(x3326)*(x3329))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -10408,7 +10418,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -10460,14 +10470,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x3384)*(x3397)))+(((x3385)*(x3399)))
 evalcond[3]=((((IkReal(-1.00000000000000))*(x3382)*(x3388)*(x3397)))+(((IkReal(-1.00000000000000))*(x3386)*(x3394)*(x3397)))+(((x3389)*(x3400)))+(((IkReal(-1.00000000000000))*(sj5)*(x3381)*(x3397)))+(((cj5)*(x3380)*(x3399)))+(((IkReal(-1.00000000000000))*(r10)*(x3382)*(x3398)))+(((IkReal(-1.00000000000000))*(x3385)*(x3400)))+(((cj5)*(x3383)*(x3399)))+(((cj3)*(sj2)))+(((x3391)*(x3399)))+(((x3384)*(x3398))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(sj0)*(x3381)*(x3396)))+(((IkReal(-1.00000000000000))*(sj2)))+(((x3389)*(x3397)))+(((IkReal(-1.00000000000000))*(x3385)*(x3397)))+(((x3392)*(x3399)))+(((IkReal(-1.00000000000000))*(x3391)*(x3398)))+(((IkReal(-1.00000000000000))*(x3380)*(x3386)*(x3398)))+(((IkReal(-1.00000000000000))*(x3386)*(x3394)*(x3400)))+(((IkReal(-1.00000000000000))*(x3382)*(x3395)*(x3398)))+(((IkReal(-1.00000000000000))*(x3384)*(x3399)))+(((IkReal(-1.00000000000000))*(x3382)*(x3388)*(x3400))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r10)*(x3382)*(x3400)))+(((IkReal(-1.00000000000000))*(x3380)*(x3386)*(x3397)))+(((IkReal(-1.00000000000000))*(x3391)*(x3397)))+(((IkReal(-1.00000000000000))*(x3386)*(x3394)*(x3399)))+(((IkReal(-1.00000000000000))*(r00)*(x3382)*(x3398)))+(((x3384)*(x3400)))+(((cj2)*(cj3)))+(((IkReal(-1.00000000000000))*(x3382)*(x3395)*(x3397)))+(((IkReal(-1.00000000000000))*(sj5)*(x3381)*(x3399)))+(((x3385)*(x3398)))+(((IkReal(-1.00000000000000))*(x3382)*(x3388)*(x3399))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -10503,8 +10513,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -10533,7 +10542,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -10585,14 +10594,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x3414)*(x3427)))+(((IkReal(-1.000000
 evalcond[3]=((((IkReal(-1.00000000000000))*(x3415)*(x3430)))+(((IkReal(-1.00000000000000))*(x3412)*(x3418)*(x3427)))+(((x3419)*(x3430)))+(((IkReal(-1.00000000000000))*(sj5)*(x3411)*(x3427)))+(((cj5)*(x3410)*(x3429)))+(((IkReal(-1.00000000000000))*(r10)*(x3412)*(x3428)))+(((cj3)*(sj2)))+(((IkReal(-1.00000000000000))*(x3416)*(x3424)*(x3427)))+(((x3421)*(x3429)))+(((x3414)*(x3428)))+(((cj5)*(x3413)*(x3429))));
 evalcond[4]=((((x3419)*(x3427)))+(((IkReal(-1.00000000000000))*(sj2)))+(((IkReal(-1.00000000000000))*(x3421)*(x3428)))+(((IkReal(-1.00000000000000))*(x3412)*(x3425)*(x3428)))+(((IkReal(-1.00000000000000))*(x3412)*(x3418)*(x3430)))+(((x3422)*(x3429)))+(((IkReal(-1.00000000000000))*(x3410)*(x3416)*(x3428)))+(((IkReal(-1.00000000000000))*(x3414)*(x3429)))+(((IkReal(-1.00000000000000))*(sj0)*(x3411)*(x3426)))+(((IkReal(-1.00000000000000))*(x3415)*(x3427)))+(((IkReal(-1.00000000000000))*(x3416)*(x3424)*(x3430))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x3412)*(x3418)*(x3429)))+(((IkReal(-1.00000000000000))*(x3410)*(x3416)*(x3427)))+(((x3415)*(x3428)))+(((x3414)*(x3430)))+(((IkReal(-1.00000000000000))*(r00)*(x3412)*(x3428)))+(((IkReal(-1.00000000000000))*(x3416)*(x3424)*(x3429)))+(((cj2)*(cj3)))+(((IkReal(-1.00000000000000))*(x3412)*(x3425)*(x3427)))+(((IkReal(-1.00000000000000))*(r10)*(x3412)*(x3430)))+(((IkReal(-1.00000000000000))*(sj5)*(x3411)*(x3429)))+(((IkReal(-1.00000000000000))*(x3421)*(x3427))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -10628,8 +10637,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -10663,7 +10671,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -10698,7 +10706,7 @@ IkReal x3450=((r11)*(sj6)*(x3438));
 evalcond[0]=((((r22)*(x3444)))+(((r21)*(sj6)*(x3438)))+(((r20)*(sj6)*(x3446)))+(((cj6)*(r21)*(x3446)))+(((IkReal(-1.00000000000000))*(r20)*(x3447))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(r12)*(x3441)*(x3444)))+(((r02)*(sj0)*(x3444)))+(((sj0)*(x3449)))+(((x3440)*(x3448)))+(((IkReal(-1.00000000000000))*(x3441)*(x3450)))+(cj2)+(((cj0)*(r10)*(x3447)))+(((x3439)*(x3448)))+(((IkReal(-1.00000000000000))*(r00)*(x3442)*(x3447)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x3441)*(x3446)))+(((IkReal(-1.00000000000000))*(x3441)*(x3443)*(x3446))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x3440)*(x3441)*(x3446)))+(((IkReal(-1.00000000000000))*(x3442)*(x3443)*(x3446)))+(((IkReal(-1.00000000000000))*(x3439)*(x3441)*(x3446)))+(((IkReal(-1.00000000000000))*(sj2)))+(((IkReal(-1.00000000000000))*(r02)*(x3441)*(x3444)))+(((r10)*(sj0)*(x3447)))+(((cj0)*(r00)*(x3447)))+(((IkReal(-1.00000000000000))*(x3442)*(x3450)))+(((IkReal(-1.00000000000000))*(r12)*(x3442)*(x3444)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x3442)*(x3446)))+(((IkReal(-1.00000000000000))*(x3441)*(x3449))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -10724,7 +10732,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -10767,14 +10775,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(sj2)*(x3471)))+(((IkReal(-1.00000000
 evalcond[3]=((((IkReal(-1.00000000000000))*(x3457)*(x3463)))+(((IkReal(-1.00000000000000))*(cj2)*(x3471)))+(((r02)*(x3461)))+(((IkReal(-1.00000000000000))*(x3460)*(x3464)))+(((r12)*(x3462)))+(((IkReal(-1.00000000000000))*(x3457)*(x3469)))+(((IkReal(-1.00000000000000))*(x3458)*(x3464))));
 evalcond[4]=((((r00)*(sj0)*(x3465)))+(((cj4)*(x3458)*(x3462)))+(((IkReal(-1.00000000000000))*(r12)*(x3459)*(x3464)))+(((cj4)*(r02)*(x3457)))+(((IkReal(-1.00000000000000))*(r01)*(x3473)))+(((IkReal(-1.00000000000000))*(x3459)*(x3461)*(x3469)))+(((sj2)*(x3456)))+(((cj4)*(x3460)*(x3462)))+(((IkReal(-1.00000000000000))*(r10)*(x3465)*(x3470)))+(((IkReal(-1.00000000000000))*(x3459)*(x3461)*(x3463)))+(((r11)*(x3472))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x3458)*(x3459)*(x3461)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x3465)))+(((IkReal(-1.00000000000000))*(x3459)*(x3460)*(x3461)))+(((r01)*(x3472)))+(((cj2)*(x3456)))+(((IkReal(-1.00000000000000))*(r00)*(x3465)*(x3470)))+(((IkReal(-1.00000000000000))*(r02)*(x3459)*(x3464)))+(((r11)*(x3473)))+(((IkReal(-1.00000000000000))*(r12)*(x3457)*(x3459)))+(((IkReal(-1.00000000000000))*(x3459)*(x3462)*(x3469)))+(((IkReal(-1.00000000000000))*(x3459)*(x3462)*(x3463))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -10810,8 +10818,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -10843,7 +10850,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -10878,7 +10885,7 @@ IkReal x3490=((r11)*(sj6)*(x3478));
 evalcond[0]=((((r20)*(sj6)*(x3486)))+(((cj6)*(r21)*(x3486)))+(((r21)*(sj6)*(x3478)))+(((IkReal(-1.00000000000000))*(r20)*(x3487)))+(((r22)*(x3484))));
 evalcond[1]=((((sj0)*(x3489)))+(((IkReal(-1.00000000000000))*(r12)*(x3481)*(x3484)))+(((IkReal(-1.00000000000000))*(x3481)*(x3483)*(x3486)))+(((r02)*(sj0)*(x3484)))+(((cj0)*(r10)*(x3487)))+(((IkReal(-1.00000000000000))*(r00)*(x3482)*(x3487)))+(cj2)+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x3481)*(x3486)))+(((x3479)*(x3488)))+(((x3480)*(x3488)))+(((IkReal(-1.00000000000000))*(x3481)*(x3490))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r02)*(x3481)*(x3484)))+(((IkReal(-1.00000000000000))*(x3482)*(x3483)*(x3486)))+(((IkReal(-1.00000000000000))*(sj2)))+(((IkReal(-1.00000000000000))*(x3479)*(x3481)*(x3486)))+(((IkReal(-1.00000000000000))*(x3482)*(x3490)))+(((cj0)*(r00)*(x3487)))+(((IkReal(-1.00000000000000))*(r12)*(x3482)*(x3484)))+(((r10)*(sj0)*(x3487)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x3482)*(x3486)))+(((IkReal(-1.00000000000000))*(x3480)*(x3481)*(x3486)))+(((IkReal(-1.00000000000000))*(x3481)*(x3489))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -10904,7 +10911,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -10947,14 +10954,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x3503)*(x3504)))+(((IkReal(-1.000000
 evalcond[3]=((((r02)*(x3501)))+(((IkReal(-1.00000000000000))*(x3497)*(x3509)))+(((IkReal(-1.00000000000000))*(x3498)*(x3504)))+(((IkReal(-1.00000000000000))*(x3500)*(x3504)))+(((IkReal(-1.00000000000000))*(x3497)*(x3503)))+(((IkReal(-1.00000000000000))*(cj2)*(x3511)))+(((r12)*(x3502))));
 evalcond[4]=((((cj4)*(r02)*(x3497)))+(((IkReal(-1.00000000000000))*(r10)*(x3505)*(x3510)))+(((IkReal(-1.00000000000000))*(x3499)*(x3501)*(x3509)))+(((r00)*(sj0)*(x3505)))+(((IkReal(-1.00000000000000))*(x3499)*(x3501)*(x3503)))+(((IkReal(-1.00000000000000))*(r01)*(x3513)))+(((r11)*(x3512)))+(((cj4)*(x3500)*(x3502)))+(((sj2)*(x3496)))+(((cj4)*(x3498)*(x3502)))+(((IkReal(-1.00000000000000))*(r12)*(x3499)*(x3504))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x3499)*(x3502)*(x3509)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x3505)))+(((IkReal(-1.00000000000000))*(x3499)*(x3502)*(x3503)))+(((IkReal(-1.00000000000000))*(r02)*(x3499)*(x3504)))+(((IkReal(-1.00000000000000))*(x3498)*(x3499)*(x3501)))+(((r01)*(x3512)))+(((cj2)*(x3496)))+(((IkReal(-1.00000000000000))*(r12)*(x3497)*(x3499)))+(((r11)*(x3513)))+(((IkReal(-1.00000000000000))*(x3499)*(x3500)*(x3501)))+(((IkReal(-1.00000000000000))*(r00)*(x3505)*(x3510))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -10990,8 +10997,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -11045,7 +11051,7 @@ if( j2array[0] > IKPI )
 else if( j2array[0] < -IKPI )
 {    j2array[0]+=IK2PI;
 }
-j2valid[0] = true;
+j2valid[0] = IKinlimits(2,j2array[0]);
 for(int ij2 = 0; ij2 < 1; ++ij2)
 {
 if( !j2valid[ij2] )
@@ -11084,7 +11090,7 @@ IkReal x3539=((cj0)*(cj6)*(x3523));
 evalcond[0]=((((x3523)*(x3530)))+(((IkReal(0.364420000000000))*(sj1)))+(((cj1)*(x3536)))+(((IkReal(-1.00000000000000))*(r21)*(x3535)))+(((IkReal(-1.00000000000000))*(x3527)*(x3530)))+(((IkReal(-1.00000000000000))*(r22)*(x3532)))+(((cj6)*(r21)*(x3523)))+(pz)+(((IkReal(-1.00000000000000))*(r22)*(x3525))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x3529)*(x3535)))+(((x3532)*(x3533)))+(((x3525)*(x3533)))+(((r10)*(x3524)*(x3527)))+(((IkReal(-1.00000000000000))*(r11)*(x3539)))+(((IkReal(-1.00000000000000))*(r02)*(sj0)*(x3525)))+(((cj6)*(x3523)*(x3529)))+(((x3523)*(x3538)))+(((IkReal(-1.00000000000000))*(x3527)*(x3538)))+(((IkReal(0.0690000000000000))*(IKsin(j2))))+(((IkReal(-1.00000000000000))*(r10)*(x3523)*(x3524)))+(((IkReal(-1.00000000000000))*(r02)*(x3534)))+(((IkReal(-1.00000000000000))*(cj0)*(x3528)))+(((px)*(sj0)))+(((cj0)*(r11)*(x3535))));
 evalcond[2]=((IkReal(0.0690000000000000))+(((x3526)*(x3532)))+(((IkReal(-1.00000000000000))*(cj0)*(px)))+(((IkReal(-1.00000000000000))*(r01)*(x3539)))+(((x3527)*(x3537)))+(((r12)*(sj0)*(x3525)))+(((IkReal(-1.00000000000000))*(cj6)*(x3523)*(x3531)))+(((r00)*(x3524)*(x3527)))+(((IkReal(-1.00000000000000))*(x3523)*(x3537)))+(((IkReal(-1.00000000000000))*(sj0)*(x3528)))+(((x3525)*(x3526)))+(((cj0)*(r01)*(x3535)))+(((IkReal(0.364420000000000))*(cj1)))+(((IkReal(-1.00000000000000))*(r00)*(x3523)*(x3524)))+(((r12)*(x3534)))+(((IkReal(-1.00000000000000))*(sj1)*(x3536)))+(((x3531)*(x3535))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -11312,7 +11318,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -11340,7 +11346,7 @@ IkReal x3696=((cj6)*(r01)*(sj5));
 IkReal x3697=((IkReal(1.00000000000000))*(sj0)*(sj5));
 evalcond[0]=((((IkReal(-1.00000000000000))*(sj5)*(x3691)*(x3692)))+(((sj0)*(x3696)))+(((IkReal(-1.00000000000000))*(sj5)*(x3691)*(x3693)))+(((IkReal(-1.00000000000000))*(r02)*(x3694)))+(((sj0)*(x3695)))+(((IkReal(-1.00000000000000))*(IKsin(j3))))+(((r12)*(x3690))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x3692)*(x3697)))+(((IkReal(-1.00000000000000))*(x3691)*(x3696)))+(((IkReal(-1.00000000000000))*(x3691)*(x3695)))+(((IkReal(-1.00000000000000))*(IKcos(j3))))+(((IkReal(-1.00000000000000))*(x3693)*(x3697)))+(((r02)*(x3690)))+(((r12)*(x3694))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -11429,7 +11435,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -11480,14 +11486,14 @@ evalcond[2]=((((x3759)*(x3767)))+(((x3762)*(x3763)))+(((r01)*(sj6)*(x3765)))+(((
 evalcond[3]=((((IkReal(-1.00000000000000))*(r10)*(x3750)*(x3764)))+(((IkReal(-1.00000000000000))*(x3750)*(x3752)*(x3767)))+(((IkReal(-1.00000000000000))*(r01)*(x3755)*(x3762)))+(((x3754)*(x3764)))+(((IkReal(-1.00000000000000))*(x3751)*(x3771)))+(((x3756)*(x3762)))+(cj3)+(((IkReal(-1.00000000000000))*(r10)*(x3748)*(x3751)*(x3760)))+(((r01)*(x3753)*(x3765)))+(((x3758)*(x3765)))+(((x3763)*(x3765))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x3750)*(x3752)*(x3762)))+(((IkReal(-1.00000000000000))*(x3747)*(x3751)*(x3758)))+(((IkReal(-1.00000000000000))*(x3762)*(x3773)))+(((IkReal(-1.00000000000000))*(x3757)*(x3762)))+(((IkReal(-1.00000000000000))*(x3754)*(x3765)))+(((IkReal(-1.00000000000000))*(x3750)*(x3761)*(x3764)))+(((IkReal(-1.00000000000000))*(x3751)*(x3772)))+(((x3759)*(x3765)))+(((IkReal(-1.00000000000000))*(x3747)*(x3751)*(x3763)))+(((x3756)*(x3767))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r10)*(x3750)*(x3762)))+(((IkReal(-1.00000000000000))*(x3757)*(x3765)))+(((IkReal(-1.00000000000000))*(x3750)*(x3752)*(x3765)))+(((IkReal(-1.00000000000000))*(x3748)*(x3751)*(x3758)))+(((IkReal(-1.00000000000000))*(r00)*(x3750)*(x3764)))+(((IkReal(-1.00000000000000))*(x3750)*(x3761)*(x3767)))+(((IkReal(-1.00000000000000))*(x3765)*(x3773)))+(((x3754)*(x3762)))+(((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(-1.00000000000000))*(x3748)*(x3751)*(x3763)))+(((r01)*(sj6)*(x3764))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -11523,8 +11529,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -11551,7 +11556,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -11602,14 +11607,14 @@ evalcond[2]=((((x3789)*(x3790)))+(((IkReal(-1.00000000000000))*(x3775)*(x3778)*(
 evalcond[3]=((((x3785)*(x3792)))+(((IkReal(-1.00000000000000))*(r10)*(x3775)*(x3778)*(x3787)))+(((IkReal(-1.00000000000000))*(x3778)*(x3798)))+(((x3783)*(x3789)))+(cj3)+(((IkReal(-1.00000000000000))*(x3777)*(x3779)*(x3794)))+(((IkReal(-1.00000000000000))*(r10)*(x3777)*(x3791)))+(((r01)*(x3780)*(x3792)))+(((x3781)*(x3791)))+(((x3790)*(x3792)))+(((IkReal(-1.00000000000000))*(r01)*(x3782)*(x3789))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x3774)*(x3778)*(x3785)))+(((x3786)*(x3792)))+(((IkReal(-1.00000000000000))*(x3784)*(x3789)))+(((IkReal(-1.00000000000000))*(x3777)*(x3788)*(x3791)))+(((IkReal(-1.00000000000000))*(x3778)*(x3799)))+(((IkReal(-1.00000000000000))*(x3774)*(x3778)*(x3790)))+(((IkReal(-1.00000000000000))*(x3789)*(x3800)))+(((IkReal(-1.00000000000000))*(x3777)*(x3779)*(x3789)))+(((IkReal(-1.00000000000000))*(x3781)*(x3792)))+(((x3783)*(x3794))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r10)*(x3777)*(x3789)))+(((IkReal(-1.00000000000000))*(x3784)*(x3792)))+(((r01)*(sj6)*(x3791)))+(((IkReal(-1.00000000000000))*(x3792)*(x3800)))+(((x3781)*(x3789)))+(((IkReal(-1.00000000000000))*(x3775)*(x3778)*(x3790)))+(((IkReal(-1.00000000000000))*(x3777)*(x3779)*(x3792)))+(((IkReal(-1.00000000000000))*(x3777)*(x3788)*(x3794)))+(((IkReal(-1.00000000000000))*(x3775)*(x3778)*(x3785)))+(((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(-1.00000000000000))*(r00)*(x3777)*(x3791))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -11645,8 +11650,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -11707,7 +11711,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -11735,7 +11739,7 @@ IkReal x3832=((cj6)*(r01)*(sj5));
 IkReal x3833=((IkReal(1.00000000000000))*(sj0)*(sj5));
 evalcond[0]=((((IkReal(-1.00000000000000))*(sj5)*(x3827)*(x3828)))+(((IkReal(-1.00000000000000))*(r02)*(x3830)))+(((IkReal(-1.00000000000000))*(sj5)*(x3827)*(x3829)))+(((IkReal(-1.00000000000000))*(IKsin(j3))))+(((sj0)*(x3832)))+(((sj0)*(x3831)))+(((r12)*(x3826))));
 evalcond[1]=((((r12)*(x3830)))+(((IkReal(-1.00000000000000))*(x3827)*(x3831)))+(((IkReal(-1.00000000000000))*(x3828)*(x3833)))+(((r02)*(x3826)))+(((IkReal(-1.00000000000000))*(x3829)*(x3833)))+(IKcos(j3))+(((IkReal(-1.00000000000000))*(x3827)*(x3832))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -11830,7 +11834,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -11881,14 +11885,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x3890)*(x3893)*(x3896)))+(((x3904)*(
 evalcond[3]=((((IkReal(-1.00000000000000))*(r01)*(x3897)*(x3904)))+(((x3896)*(x3906)))+(((IkReal(-1.00000000000000))*(x3892)*(x3894)*(x3909)))+(((x3905)*(x3907)))+(((r01)*(x3895)*(x3907)))+(((IkReal(-1.00000000000000))*(r10)*(x3890)*(x3893)*(x3902)))+(cj3)+(((x3898)*(x3904)))+(((x3900)*(x3907)))+(((IkReal(-1.00000000000000))*(r10)*(x3892)*(x3906)))+(((IkReal(-1.00000000000000))*(x3893)*(x3913))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x3889)*(x3893)*(x3905)))+(((IkReal(-1.00000000000000))*(x3892)*(x3903)*(x3906)))+(((IkReal(-1.00000000000000))*(x3896)*(x3907)))+(((IkReal(-1.00000000000000))*(x3904)*(x3915)))+(((IkReal(-1.00000000000000))*(x3893)*(x3914)))+(((x3901)*(x3907)))+(((IkReal(-1.00000000000000))*(x3889)*(x3893)*(x3900)))+(((IkReal(-1.00000000000000))*(x3899)*(x3904)))+(((x3898)*(x3909)))+(((IkReal(-1.00000000000000))*(x3892)*(x3894)*(x3904))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r00)*(x3892)*(x3906)))+(((r01)*(sj6)*(x3906)))+(sj3)+(((IkReal(-1.00000000000000))*(x3892)*(x3903)*(x3909)))+(((IkReal(-1.00000000000000))*(x3890)*(x3893)*(x3900)))+(((IkReal(-1.00000000000000))*(x3892)*(x3894)*(x3907)))+(((IkReal(-1.00000000000000))*(x3899)*(x3907)))+(((x3896)*(x3904)))+(((IkReal(-1.00000000000000))*(r10)*(x3892)*(x3904)))+(((IkReal(-1.00000000000000))*(x3890)*(x3893)*(x3905)))+(((IkReal(-1.00000000000000))*(x3907)*(x3915))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -11924,8 +11928,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -11952,7 +11955,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -12003,14 +12006,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x3916)*(x3920)*(x3926)))+(((IkReal(-
 evalcond[3]=((((x3925)*(x3931)))+(((x3923)*(x3933)))+(((x3932)*(x3934)))+(((IkReal(-1.00000000000000))*(r01)*(x3924)*(x3931)))+(((r01)*(x3922)*(x3934)))+(((IkReal(-1.00000000000000))*(r10)*(x3919)*(x3933)))+(cj3)+(((IkReal(-1.00000000000000))*(x3919)*(x3921)*(x3936)))+(((x3927)*(x3934)))+(((IkReal(-1.00000000000000))*(r10)*(x3917)*(x3920)*(x3929)))+(((IkReal(-1.00000000000000))*(x3920)*(x3940))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x3920)*(x3941)))+(((IkReal(-1.00000000000000))*(x3923)*(x3934)))+(((IkReal(-1.00000000000000))*(x3916)*(x3920)*(x3932)))+(((IkReal(-1.00000000000000))*(x3919)*(x3930)*(x3933)))+(((x3925)*(x3936)))+(((IkReal(-1.00000000000000))*(x3919)*(x3921)*(x3931)))+(((IkReal(-1.00000000000000))*(x3926)*(x3931)))+(((IkReal(-1.00000000000000))*(x3916)*(x3920)*(x3927)))+(((x3928)*(x3934)))+(((IkReal(-1.00000000000000))*(x3931)*(x3942))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x3917)*(x3920)*(x3927)))+(((IkReal(-1.00000000000000))*(x3917)*(x3920)*(x3932)))+(sj3)+(((IkReal(-1.00000000000000))*(x3934)*(x3942)))+(((r01)*(sj6)*(x3933)))+(((IkReal(-1.00000000000000))*(x3919)*(x3921)*(x3934)))+(((IkReal(-1.00000000000000))*(r10)*(x3919)*(x3931)))+(((IkReal(-1.00000000000000))*(x3926)*(x3934)))+(((x3923)*(x3931)))+(((IkReal(-1.00000000000000))*(r00)*(x3919)*(x3933)))+(((IkReal(-1.00000000000000))*(x3919)*(x3930)*(x3936))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -12046,8 +12049,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -12093,7 +12095,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -12122,7 +12124,7 @@ IkReal x3954=((cj6)*(r11)*(sj5));
 evalcond[0]=((((cj6)*(r21)*(sj5)))+(((r20)*(x3948)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((IkReal(-1.00000000000000))*(sj1)*(x3952))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(cj5)*(r02)*(x3951)))+(((r12)*(x3949)))+(((IkReal(-1.00000000000000))*(r10)*(x3948)*(x3950)))+(((sj0)*(x3953)))+(((r00)*(sj0)*(x3948)))+(((IkReal(-1.00000000000000))*(IKsin(j3))))+(((IkReal(-1.00000000000000))*(x3950)*(x3954))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x3951)*(x3954)))+(((cj5)*(r12)*(sj0)))+(((IkReal(-1.00000000000000))*(r10)*(x3948)*(x3951)))+(((IkReal(-1.00000000000000))*(x3950)*(x3953)))+(((r02)*(x3949)))+(((IkReal(-1.00000000000000))*(r00)*(x3948)*(x3950)))+(((IkReal(-1.00000000000000))*(cj1)*(x3952))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -12217,7 +12219,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -12269,14 +12271,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(r00)*(x4013)*(x4029)))+(((r01)*(sj6)
 evalcond[3]=((((x4020)*(x4026)))+(((x4018)*(x4028)))+(((x4027)*(x4029)))+(((IkReal(-1.00000000000000))*(x4014)*(x4035)))+(((IkReal(-1.00000000000000))*(x4013)*(x4015)*(x4031)))+(cj3)+(((IkReal(-1.00000000000000))*(r10)*(x4013)*(x4028)))+(((x4022)*(x4029)))+(((r01)*(x4016)*(x4029)))+(((IkReal(-1.00000000000000))*(r10)*(x4011)*(x4014)*(x4024)))+(((IkReal(-1.00000000000000))*(r01)*(x4019)*(x4026))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x4010)*(x4014)*(x4022)))+(((IkReal(-1.00000000000000))*(x4014)*(x4036)))+(((IkReal(-1.00000000000000))*(x4021)*(x4026)))+(((IkReal(-1.00000000000000))*(x4010)*(x4014)*(x4027)))+(sj1)+(((IkReal(-1.00000000000000))*(x4013)*(x4015)*(x4026)))+(((x4023)*(x4029)))+(((IkReal(-1.00000000000000))*(x4026)*(x4037)))+(((x4020)*(x4031)))+(((IkReal(-1.00000000000000))*(x4018)*(x4029)))+(((IkReal(-1.00000000000000))*(x4013)*(x4025)*(x4028))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r10)*(x4013)*(x4026)))+(((IkReal(-1.00000000000000))*(r00)*(x4013)*(x4028)))+(((IkReal(-1.00000000000000))*(x4013)*(x4025)*(x4031)))+(((IkReal(-1.00000000000000))*(x4011)*(x4014)*(x4022)))+(((IkReal(-1.00000000000000))*(x4011)*(x4014)*(x4027)))+(((IkReal(-1.00000000000000))*(cj1)*(x4017)))+(((IkReal(-1.00000000000000))*(x4029)*(x4037)))+(((x4018)*(x4026)))+(((r01)*(sj6)*(x4028)))+(((IkReal(-1.00000000000000))*(x4021)*(x4029)))+(((IkReal(-1.00000000000000))*(x4013)*(x4015)*(x4029))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -12312,8 +12314,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -12347,7 +12348,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -12399,14 +12400,14 @@ evalcond[2]=((((x4057)*(x4061)))+(((x4061)*(x4062)))+(((IkReal(-1.00000000000000
 evalcond[3]=((((IkReal(-1.00000000000000))*(r10)*(x4048)*(x4063)))+(((x4053)*(x4063)))+(((x4055)*(x4061)))+(((x4057)*(x4064)))+(((IkReal(-1.00000000000000))*(x4048)*(x4050)*(x4066)))+(cj3)+(((r01)*(x4051)*(x4064)))+(((x4062)*(x4064)))+(((IkReal(-1.00000000000000))*(r01)*(x4054)*(x4061)))+(((IkReal(-1.00000000000000))*(r10)*(x4046)*(x4049)*(x4059)))+(((IkReal(-1.00000000000000))*(x4049)*(x4070))));
 evalcond[4]=((sj1)+(((IkReal(-1.00000000000000))*(x4048)*(x4050)*(x4061)))+(((IkReal(-1.00000000000000))*(x4056)*(x4061)))+(((IkReal(-1.00000000000000))*(x4061)*(x4072)))+(((IkReal(-1.00000000000000))*(x4045)*(x4049)*(x4062)))+(((x4055)*(x4066)))+(((IkReal(-1.00000000000000))*(x4048)*(x4060)*(x4063)))+(((x4058)*(x4064)))+(((IkReal(-1.00000000000000))*(x4045)*(x4049)*(x4057)))+(((IkReal(-1.00000000000000))*(x4049)*(x4071)))+(((IkReal(-1.00000000000000))*(x4053)*(x4064))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(cj1)*(x4052)))+(((IkReal(-1.00000000000000))*(x4048)*(x4050)*(x4064)))+(((IkReal(-1.00000000000000))*(x4048)*(x4060)*(x4066)))+(((IkReal(-1.00000000000000))*(x4046)*(x4049)*(x4057)))+(((IkReal(-1.00000000000000))*(r10)*(x4048)*(x4061)))+(((IkReal(-1.00000000000000))*(x4064)*(x4072)))+(((x4053)*(x4061)))+(((IkReal(-1.00000000000000))*(x4056)*(x4064)))+(((IkReal(-1.00000000000000))*(x4046)*(x4049)*(x4062)))+(((IkReal(-1.00000000000000))*(r00)*(x4048)*(x4063)))+(((r01)*(sj6)*(x4063))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -12442,8 +12443,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -12484,7 +12484,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -12519,7 +12519,7 @@ IkReal x4094=((r11)*(sj6)*(x4082));
 evalcond[0]=((((r20)*(sj6)*(x4090)))+(((r21)*(sj6)*(x4082)))+(((IkReal(-1.00000000000000))*(cj1)))+(((r22)*(x4088)))+(((cj6)*(r21)*(x4090)))+(((IkReal(-1.00000000000000))*(r20)*(x4091))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x4085)*(x4094)))+(((r02)*(sj0)*(x4088)))+(((x4084)*(x4092)))+(((IkReal(-1.00000000000000))*(r00)*(x4086)*(x4091)))+(((IkReal(-1.00000000000000))*(x4085)*(x4087)*(x4090)))+(((cj0)*(r10)*(x4091)))+(((x4083)*(x4092)))+(((IkReal(-1.00000000000000))*(r12)*(x4085)*(x4088)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x4085)*(x4090)))+(((sj0)*(x4093))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x4086)*(x4094)))+(((IkReal(-1.00000000000000))*(x4083)*(x4085)*(x4090)))+(((IkReal(-1.00000000000000))*(r02)*(x4085)*(x4088)))+(((IkReal(-1.00000000000000))*(x4086)*(x4087)*(x4090)))+(((cj0)*(r00)*(x4091)))+(sj1)+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x4086)*(x4090)))+(((r10)*(sj0)*(x4091)))+(((IkReal(-1.00000000000000))*(r12)*(x4086)*(x4088)))+(((IkReal(-1.00000000000000))*(x4085)*(x4093)))+(((IkReal(-1.00000000000000))*(x4084)*(x4085)*(x4090))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -12601,7 +12601,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -12639,14 +12639,14 @@ evalcond[0]=((((r21)*(x4139)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((Ik
 evalcond[1]=((((IkReal(-1.00000000000000))*(x4140)))+(((r20)*(x4131)))+(((IkReal(-1.00000000000000))*(r21)*(x4132)))+(((cj5)*(r21)*(x4134)))+(((r22)*(x4137)))+(((cj5)*(r20)*(x4135))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x4140)))+(((x4126)*(x4128)))+(((IkReal(-1.00000000000000))*(r02)*(x4129)))+(((IkReal(-1.00000000000000))*(x4133)*(x4139)))+(((r12)*(x4130)))+(((IkReal(-1.00000000000000))*(r10)*(x4136)*(x4138)))+(((x4126)*(x4127))));
 evalcond[3]=((((cj4)*(x4127)*(x4129)))+(((IkReal(-1.00000000000000))*(r10)*(x4130)*(x4135)))+(((x4132)*(x4133)))+(((cj4)*(r02)*(x4126)))+(((IkReal(-1.00000000000000))*(r12)*(x4136)*(x4137)))+(((IkReal(-1.00000000000000))*(r10)*(x4131)*(x4136)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x4132)))+(((IkReal(-1.00000000000000))*(r11)*(x4130)*(x4134)))+(((r00)*(sj0)*(x4131)))+(((cj4)*(x4128)*(x4129)))+(x4125));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -12682,8 +12682,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -12748,7 +12747,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -12786,14 +12785,14 @@ evalcond[0]=((((r21)*(x4187)))+(x4173)+(((IkReal(-1.00000000000000))*(cj5)*(r22)
 evalcond[1]=((x4172)+(((r22)*(x4185)))+(((cj5)*(r21)*(x4182)))+(((IkReal(-1.00000000000000))*(r21)*(x4180)))+(((r20)*(x4179)))+(((cj5)*(r20)*(x4183))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x4181)*(x4187)))+(((IkReal(-1.00000000000000))*(r02)*(x4177)))+(((r12)*(x4178)))+(((x4174)*(x4175)))+(((x4174)*(x4176)))+(((IkReal(-1.00000000000000))*(r10)*(x4184)*(x4186)))+(((IkReal(-1.00000000000000))*(x4172))));
 evalcond[3]=((((r00)*(sj0)*(x4179)))+(((x4180)*(x4181)))+(((cj4)*(r02)*(x4174)))+(x4173)+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x4180)))+(((cj4)*(x4176)*(x4177)))+(((cj4)*(x4175)*(x4177)))+(((IkReal(-1.00000000000000))*(r10)*(x4179)*(x4184)))+(((IkReal(-1.00000000000000))*(r10)*(x4178)*(x4183)))+(((IkReal(-1.00000000000000))*(r12)*(x4184)*(x4185)))+(((IkReal(-1.00000000000000))*(r11)*(x4178)*(x4182))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -12829,8 +12828,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -12899,7 +12897,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -12938,14 +12936,14 @@ evalcond[0]=((((cj6)*(r01)*(x4224)))+(((IkReal(-1.00000000000000))*(x4231)*(x423
 evalcond[1]=((((r02)*(x4229)))+(((r12)*(x4230)))+(((IkReal(-1.00000000000000))*(x4225)*(x4233)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x4233)))+(((IkReal(-1.00000000000000))*(x4223)))+(((IkReal(-1.00000000000000))*(x4224)*(x4232)))+(((IkReal(-1.00000000000000))*(x4224)*(x4231))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x4234)*(x4237)))+(((x4226)*(x4236)))+(((cj4)*(x4225)*(x4230)))+(((IkReal(-1.00000000000000))*(r12)*(x4227)*(x4233)))+(((cj4)*(r02)*(x4224)))+(x4223)+(((IkReal(-1.00000000000000))*(r01)*(x4239)))+(((x4226)*(x4228)))+(((IkReal(-1.00000000000000))*(x4227)*(x4229)*(x4232)))+(((IkReal(-1.00000000000000))*(x4227)*(x4229)*(x4231)))+(((r11)*(x4238))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(cj6)*(r01)*(x4227)*(x4229)))+(((IkReal(-1.00000000000000))*(x4227)*(x4230)*(x4232)))+(((IkReal(-1.00000000000000))*(r12)*(x4224)*(x4227)))+(((IkReal(-1.00000000000000))*(x4228)*(x4237)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x4226)*(x4227)))+(((r01)*(x4238)))+(((IkReal(-1.00000000000000))*(x4226)*(x4234)))+(((IkReal(-1.00000000000000))*(r02)*(x4227)*(x4233)))+(((r11)*(x4239)))+(((IkReal(-1.00000000000000))*(x4235)))+(((IkReal(-1.00000000000000))*(x4225)*(x4227)*(x4229))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -12981,8 +12979,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -13050,7 +13047,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -13089,14 +13086,14 @@ evalcond[0]=((((cj6)*(r01)*(x4276)))+(((IkReal(-1.00000000000000))*(x4284)*(x428
 evalcond[1]=((((r02)*(x4281)))+(((IkReal(-1.00000000000000))*(x4277)*(x4285)))+(((IkReal(-1.00000000000000))*(x4276)*(x4284)))+(x4274)+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x4285)))+(((r12)*(x4282)))+(((IkReal(-1.00000000000000))*(x4276)*(x4283))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x4279)*(x4281)*(x4284)))+(((x4278)*(x4287)))+(((r11)*(x4289)))+(((x4278)*(x4280)))+(((IkReal(-1.00000000000000))*(r01)*(x4290)))+(x4274)+(((IkReal(-1.00000000000000))*(x4286)*(x4288)))+(((IkReal(-1.00000000000000))*(r12)*(x4279)*(x4285)))+(((cj4)*(r02)*(x4276)))+(((IkReal(-1.00000000000000))*(x4279)*(x4281)*(x4283)))+(((cj4)*(x4277)*(x4282))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r02)*(x4279)*(x4285)))+(((IkReal(-1.00000000000000))*(x4280)*(x4288)))+(x4275)+(((r01)*(x4289)))+(((r11)*(x4290)))+(((IkReal(-1.00000000000000))*(x4279)*(x4282)*(x4284)))+(((IkReal(-1.00000000000000))*(x4278)*(x4286)))+(((IkReal(-1.00000000000000))*(x4277)*(x4279)*(x4281)))+(((IkReal(-1.00000000000000))*(r12)*(x4276)*(x4279)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x4279)*(x4281)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x4278)*(x4279))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -13132,8 +13129,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -13179,7 +13175,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -13224,14 +13220,14 @@ evalcond[2]=((((cj0)*(x4306)))+(((IkReal(-1.00000000000000))*(sj5)*(x4305)*(x431
 evalcond[3]=((((sj0)*(x4306)))+(((IkReal(-1.00000000000000))*(x4301)*(x4308)))+(((IkReal(-1.00000000000000))*(sj5)*(x4302)*(x4305)))+(((IkReal(-1.00000000000000))*(x4301)*(x4314)))+(((IkReal(-1.00000000000000))*(x4300)*(x4310)))+(((IkReal(-1.00000000000000))*(sj5)*(x4303)*(x4305)))+(((cj0)*(x4309))));
 evalcond[4]=((((r11)*(x4319)))+(((x4301)*(x4316)))+(((IkReal(-1.00000000000000))*(x4304)*(x4305)*(x4308)))+(((IkReal(-1.00000000000000))*(x4304)*(x4305)*(x4314)))+(((IkReal(-1.00000000000000))*(r10)*(x4305)*(x4311)))+(((sj0)*(x4303)*(x4304)))+(((IkReal(-1.00000000000000))*(r01)*(x4307)*(x4315)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x4305)))+(((sj0)*(x4302)*(x4304)))+(x4300)+(((r00)*(sj0)*(x4311))));
 evalcond[5]=((((r11)*(sj0)*(x4315)))+(((IkReal(-1.00000000000000))*(r00)*(x4305)*(x4311)))+(((IkReal(-1.00000000000000))*(r10)*(x4307)*(x4311)))+(((IkReal(-1.00000000000000))*(x4299)*(x4310)))+(((IkReal(-1.00000000000000))*(x4304)*(x4307)*(x4308)))+(((IkReal(-1.00000000000000))*(x4301)*(x4317)))+(((IkReal(-1.00000000000000))*(sj5)*(x4305)*(x4316)))+(((IkReal(-1.00000000000000))*(x4303)*(x4304)*(x4305)))+(((IkReal(-1.00000000000000))*(x4304)*(x4307)*(x4314)))+(((IkReal(-1.00000000000000))*(x4302)*(x4304)*(x4305)))+(((r01)*(x4319))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -13267,8 +13263,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -13299,7 +13294,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -13344,14 +13339,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x4343)))+(((cj0)*(x4331)))+(((x4326)
 evalcond[3]=((((IkReal(-1.00000000000000))*(sj5)*(x4327)*(x4330)))+(((IkReal(-1.00000000000000))*(x4325)*(x4335)))+(((cj0)*(x4334)))+(((IkReal(-1.00000000000000))*(x4326)*(x4339)))+(((sj0)*(x4331)))+(((IkReal(-1.00000000000000))*(sj5)*(x4328)*(x4330)))+(((IkReal(-1.00000000000000))*(x4326)*(x4333))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x4330)))+(((IkReal(-1.00000000000000))*(x4329)*(x4330)*(x4333)))+(((IkReal(-1.00000000000000))*(x4329)*(x4330)*(x4339)))+(((r00)*(sj0)*(x4336)))+(((r11)*(x4344)))+(((sj0)*(x4327)*(x4329)))+(((IkReal(-1.00000000000000))*(r01)*(x4332)*(x4340)))+(((IkReal(-1.00000000000000))*(r10)*(x4330)*(x4336)))+(((x4326)*(x4341)))+(((sj0)*(x4328)*(x4329)))+(x4325));
 evalcond[5]=((((r01)*(x4344)))+(((IkReal(-1.00000000000000))*(r00)*(x4330)*(x4336)))+(((IkReal(-1.00000000000000))*(x4326)*(x4342)))+(((IkReal(-1.00000000000000))*(x4328)*(x4329)*(x4330)))+(((IkReal(-1.00000000000000))*(r10)*(x4332)*(x4336)))+(((IkReal(-1.00000000000000))*(x4327)*(x4329)*(x4330)))+(((IkReal(-1.00000000000000))*(x4329)*(x4332)*(x4339)))+(((IkReal(-1.00000000000000))*(x4324)*(x4335)))+(((IkReal(-1.00000000000000))*(x4329)*(x4332)*(x4333)))+(((IkReal(-1.00000000000000))*(sj5)*(x4330)*(x4341)))+(((r11)*(sj0)*(x4340))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -13387,8 +13382,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -13418,7 +13412,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -13463,14 +13457,14 @@ evalcond[2]=((((cj0)*(x4355)))+(((IkReal(-1.00000000000000))*(x4356)*(x4358)))+(
 evalcond[3]=((((cj0)*(x4358)))+(((IkReal(-1.00000000000000))*(x4349)*(x4359)))+(((IkReal(-1.00000000000000))*(sj5)*(x4352)*(x4354)))+(((IkReal(-1.00000000000000))*(sj5)*(x4351)*(x4354)))+(((IkReal(-1.00000000000000))*(x4350)*(x4357)))+(((sj0)*(x4355)))+(((IkReal(-1.00000000000000))*(x4350)*(x4363))));
 evalcond[4]=((((r00)*(sj0)*(x4360)))+(((IkReal(-1.00000000000000))*(r01)*(x4356)*(x4364)))+(((sj0)*(x4352)*(x4353)))+(((sj0)*(x4351)*(x4353)))+(((IkReal(-1.00000000000000))*(x4353)*(x4354)*(x4363)))+(((IkReal(-1.00000000000000))*(x4353)*(x4354)*(x4357)))+(x4349)+(((IkReal(-1.00000000000000))*(r10)*(x4354)*(x4360)))+(((x4350)*(x4365)))+(((r11)*(x4368)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x4354))));
 evalcond[5]=((((r01)*(x4368)))+(((IkReal(-1.00000000000000))*(sj5)*(x4354)*(x4365)))+(((IkReal(-1.00000000000000))*(x4353)*(x4356)*(x4357)))+(((r11)*(sj0)*(x4364)))+(((IkReal(-1.00000000000000))*(x4350)*(x4366)))+(((IkReal(-1.00000000000000))*(x4353)*(x4356)*(x4363)))+(((IkReal(-1.00000000000000))*(x4351)*(x4353)*(x4354)))+(((IkReal(-1.00000000000000))*(x4348)*(x4359)))+(((IkReal(-1.00000000000000))*(r10)*(x4356)*(x4360)))+(((IkReal(-1.00000000000000))*(r00)*(x4354)*(x4360)))+(((IkReal(-1.00000000000000))*(x4352)*(x4353)*(x4354))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -13506,8 +13500,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -13547,7 +13540,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -13582,7 +13575,7 @@ IkReal x4389=((r11)*(sj6)*(x4377));
 evalcond[0]=((((r22)*(x4383)))+(((r20)*(sj6)*(x4385)))+(((r21)*(sj6)*(x4377)))+(((IkReal(-1.00000000000000))*(cj1)))+(((IkReal(-1.00000000000000))*(r20)*(x4386)))+(((cj6)*(r21)*(x4385))));
 evalcond[1]=((((x4378)*(x4387)))+(((IkReal(-1.00000000000000))*(r12)*(x4380)*(x4383)))+(((cj0)*(r10)*(x4386)))+(((IkReal(-1.00000000000000))*(r00)*(x4381)*(x4386)))+(((r02)*(sj0)*(x4383)))+(((IkReal(-1.00000000000000))*(x4380)*(x4382)*(x4385)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x4380)*(x4385)))+(((IkReal(-1.00000000000000))*(x4380)*(x4389)))+(((x4379)*(x4387)))+(((sj0)*(x4388))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x4379)*(x4380)*(x4385)))+(((cj0)*(r00)*(x4386)))+(((IkReal(-1.00000000000000))*(r12)*(x4381)*(x4383)))+(sj1)+(((IkReal(-1.00000000000000))*(x4380)*(x4388)))+(((r10)*(sj0)*(x4386)))+(((IkReal(-1.00000000000000))*(x4381)*(x4389)))+(((IkReal(-1.00000000000000))*(r02)*(x4380)*(x4383)))+(((IkReal(-1.00000000000000))*(x4381)*(x4382)*(x4385)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x4381)*(x4385)))+(((IkReal(-1.00000000000000))*(x4378)*(x4380)*(x4385))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -13664,7 +13657,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -13702,14 +13695,14 @@ evalcond[0]=((((r21)*(x4434)))+(((r20)*(x4433)))+(((IkReal(-1.00000000000000))*(
 evalcond[1]=((((IkReal(-1.00000000000000))*(r21)*(x4427)))+(((r20)*(x4426)))+(((r22)*(x4432)))+(((cj5)*(r20)*(x4430)))+(((IkReal(-1.00000000000000))*(x4435)))+(((cj5)*(r21)*(x4429))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r02)*(x4424)))+(((r12)*(x4425)))+(((IkReal(-1.00000000000000))*(x4428)*(x4434)))+(((x4421)*(x4422)))+(((x4421)*(x4423)))+(((IkReal(-1.00000000000000))*(r10)*(x4431)*(x4433)))+(((IkReal(-1.00000000000000))*(x4435))));
 evalcond[3]=((((cj4)*(r02)*(x4421)))+(((cj4)*(x4423)*(x4424)))+(((IkReal(-1.00000000000000))*(r11)*(x4425)*(x4429)))+(((IkReal(-1.00000000000000))*(r12)*(x4431)*(x4432)))+(x4420)+(((x4427)*(x4428)))+(((cj4)*(x4422)*(x4424)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x4427)))+(((IkReal(-1.00000000000000))*(r10)*(x4425)*(x4430)))+(((r00)*(sj0)*(x4426)))+(((IkReal(-1.00000000000000))*(r10)*(x4426)*(x4431))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -13745,8 +13738,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -13811,7 +13803,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -13849,14 +13841,14 @@ evalcond[0]=((x4468)+(((r21)*(x4482)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)
 evalcond[1]=((x4467)+(((r22)*(x4480)))+(((cj5)*(r20)*(x4478)))+(((cj5)*(r21)*(x4477)))+(((IkReal(-1.00000000000000))*(r21)*(x4475)))+(((r20)*(x4474))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r10)*(x4479)*(x4481)))+(((r12)*(x4473)))+(((x4469)*(x4471)))+(((IkReal(-1.00000000000000))*(x4476)*(x4482)))+(((x4469)*(x4470)))+(((IkReal(-1.00000000000000))*(r02)*(x4472)))+(((IkReal(-1.00000000000000))*(x4467))));
 evalcond[3]=((x4468)+(((r00)*(sj0)*(x4474)))+(((IkReal(-1.00000000000000))*(r10)*(x4474)*(x4479)))+(((cj4)*(x4471)*(x4472)))+(((cj4)*(r02)*(x4469)))+(((x4475)*(x4476)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x4475)))+(((IkReal(-1.00000000000000))*(r11)*(x4473)*(x4477)))+(((IkReal(-1.00000000000000))*(r10)*(x4473)*(x4478)))+(((IkReal(-1.00000000000000))*(r12)*(x4479)*(x4480)))+(((cj4)*(x4470)*(x4472))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -13892,8 +13884,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -13962,7 +13953,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -14001,14 +13992,14 @@ evalcond[0]=((((x4519)*(x4520)))+(((IkReal(-1.00000000000000))*(x4526)*(x4528)))
 evalcond[1]=((((r02)*(x4524)))+(((IkReal(-1.00000000000000))*(x4518)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x4528)))+(((IkReal(-1.00000000000000))*(x4519)*(x4526)))+(((IkReal(-1.00000000000000))*(x4520)*(x4528)))+(((r12)*(x4525)))+(((IkReal(-1.00000000000000))*(x4519)*(x4527))));
 evalcond[2]=((x4518)+(((x4521)*(x4523)))+(((IkReal(-1.00000000000000))*(x4522)*(x4524)*(x4527)))+(((IkReal(-1.00000000000000))*(r12)*(x4522)*(x4528)))+(((IkReal(-1.00000000000000))*(x4522)*(x4524)*(x4526)))+(((IkReal(-1.00000000000000))*(r01)*(x4534)))+(((IkReal(-1.00000000000000))*(x4529)*(x4532)))+(((cj4)*(r02)*(x4519)))+(((r11)*(x4533)))+(((x4521)*(x4531)))+(((cj4)*(x4520)*(x4525))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(cj6)*(r01)*(x4522)*(x4524)))+(((IkReal(-1.00000000000000))*(x4521)*(x4529)))+(((IkReal(-1.00000000000000))*(x4522)*(x4525)*(x4527)))+(((IkReal(-1.00000000000000))*(x4520)*(x4522)*(x4524)))+(((IkReal(-1.00000000000000))*(x4523)*(x4532)))+(((r11)*(x4534)))+(((r01)*(x4533)))+(((IkReal(-1.00000000000000))*(r12)*(x4519)*(x4522)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x4521)*(x4522)))+(((IkReal(-1.00000000000000))*(x4530)))+(((IkReal(-1.00000000000000))*(r02)*(x4522)*(x4528))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -14044,8 +14035,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -14113,7 +14103,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -14152,14 +14142,14 @@ evalcond[0]=((((r12)*(x4576)))+(((cj6)*(r01)*(x4571)))+(((IkReal(-1.000000000000
 evalcond[1]=((((IkReal(-1.00000000000000))*(x4571)*(x4579)))+(((IkReal(-1.00000000000000))*(x4571)*(x4578)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x4580)))+(((r12)*(x4577)))+(((IkReal(-1.00000000000000))*(x4572)*(x4580)))+(x4569)+(((r02)*(x4576))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r01)*(x4585)))+(((IkReal(-1.00000000000000))*(x4574)*(x4576)*(x4579)))+(((IkReal(-1.00000000000000))*(x4574)*(x4576)*(x4578)))+(((cj4)*(x4572)*(x4577)))+(((r11)*(x4584)))+(((IkReal(-1.00000000000000))*(x4581)*(x4583)))+(((cj4)*(r02)*(x4571)))+(x4569)+(((x4573)*(x4575)))+(((x4573)*(x4582)))+(((IkReal(-1.00000000000000))*(r12)*(x4574)*(x4580))));
 evalcond[3]=((x4570)+(((IkReal(-1.00000000000000))*(x4574)*(x4577)*(x4579)))+(((IkReal(-1.00000000000000))*(r02)*(x4574)*(x4580)))+(((r11)*(x4585)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x4574)*(x4576)))+(((IkReal(-1.00000000000000))*(x4573)*(x4581)))+(((IkReal(-1.00000000000000))*(x4575)*(x4583)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x4573)*(x4574)))+(((r01)*(x4584)))+(((IkReal(-1.00000000000000))*(r12)*(x4571)*(x4574)))+(((IkReal(-1.00000000000000))*(x4572)*(x4574)*(x4576))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -14195,8 +14185,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -14242,7 +14231,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -14287,14 +14276,14 @@ evalcond[2]=((((cj0)*(x4601)))+(((IkReal(-1.00000000000000))*(sj5)*(x4600)*(x460
 evalcond[3]=((((IkReal(-1.00000000000000))*(sj5)*(x4598)*(x4600)))+(((IkReal(-1.00000000000000))*(x4595)*(x4605)))+(((sj0)*(x4601)))+(((IkReal(-1.00000000000000))*(x4596)*(x4603)))+(((cj0)*(x4604)))+(((IkReal(-1.00000000000000))*(sj5)*(x4597)*(x4600)))+(((IkReal(-1.00000000000000))*(x4596)*(x4609))));
 evalcond[4]=((x4595)+(((r11)*(x4614)))+(((sj0)*(x4598)*(x4599)))+(((sj0)*(x4597)*(x4599)))+(((IkReal(-1.00000000000000))*(x4599)*(x4600)*(x4609)))+(((x4596)*(x4611)))+(((IkReal(-1.00000000000000))*(r01)*(x4602)*(x4610)))+(((IkReal(-1.00000000000000))*(x4599)*(x4600)*(x4603)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x4600)))+(((IkReal(-1.00000000000000))*(r10)*(x4600)*(x4606)))+(((r00)*(sj0)*(x4606))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x4594)*(x4605)))+(((IkReal(-1.00000000000000))*(x4599)*(x4602)*(x4603)))+(((IkReal(-1.00000000000000))*(r00)*(x4600)*(x4606)))+(((r01)*(x4614)))+(((IkReal(-1.00000000000000))*(x4597)*(x4599)*(x4600)))+(((IkReal(-1.00000000000000))*(x4599)*(x4602)*(x4609)))+(((IkReal(-1.00000000000000))*(x4598)*(x4599)*(x4600)))+(((IkReal(-1.00000000000000))*(sj5)*(x4600)*(x4611)))+(((r11)*(sj0)*(x4610)))+(((IkReal(-1.00000000000000))*(r10)*(x4602)*(x4606)))+(((IkReal(-1.00000000000000))*(x4596)*(x4612))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -14330,8 +14319,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -14362,7 +14350,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -14407,14 +14395,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x4627)*(x4629)))+(((IkReal(-1.000000
 evalcond[3]=((((IkReal(-1.00000000000000))*(x4621)*(x4628)))+(((cj0)*(x4629)))+(((IkReal(-1.00000000000000))*(sj5)*(x4622)*(x4625)))+(((IkReal(-1.00000000000000))*(sj5)*(x4623)*(x4625)))+(((IkReal(-1.00000000000000))*(x4620)*(x4630)))+(((IkReal(-1.00000000000000))*(x4621)*(x4634)))+(((sj0)*(x4626))));
 evalcond[4]=((((sj0)*(x4623)*(x4624)))+(((IkReal(-1.00000000000000))*(x4624)*(x4625)*(x4634)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x4625)))+(((x4621)*(x4636)))+(((r11)*(x4639)))+(((IkReal(-1.00000000000000))*(r10)*(x4625)*(x4631)))+(((IkReal(-1.00000000000000))*(r01)*(x4627)*(x4635)))+(((r00)*(sj0)*(x4631)))+(((sj0)*(x4622)*(x4624)))+(((IkReal(-1.00000000000000))*(x4624)*(x4625)*(x4628)))+(x4620));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x4624)*(x4627)*(x4628)))+(((IkReal(-1.00000000000000))*(x4624)*(x4627)*(x4634)))+(((IkReal(-1.00000000000000))*(r00)*(x4625)*(x4631)))+(((IkReal(-1.00000000000000))*(r10)*(x4627)*(x4631)))+(((IkReal(-1.00000000000000))*(x4622)*(x4624)*(x4625)))+(((IkReal(-1.00000000000000))*(x4619)*(x4630)))+(((r11)*(sj0)*(x4635)))+(((IkReal(-1.00000000000000))*(x4621)*(x4637)))+(((IkReal(-1.00000000000000))*(sj5)*(x4625)*(x4636)))+(((r01)*(x4639)))+(((IkReal(-1.00000000000000))*(x4623)*(x4624)*(x4625))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -14450,8 +14438,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -14481,7 +14468,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -14526,14 +14513,14 @@ evalcond[2]=((((x4645)*(x4646)))+(((IkReal(-1.00000000000000))*(sj5)*(x4649)*(x4
 evalcond[3]=((((IkReal(-1.00000000000000))*(x4645)*(x4658)))+(((IkReal(-1.00000000000000))*(sj5)*(x4647)*(x4649)))+(((IkReal(-1.00000000000000))*(x4644)*(x4654)))+(((cj0)*(x4653)))+(((sj0)*(x4650)))+(((IkReal(-1.00000000000000))*(x4645)*(x4652)))+(((IkReal(-1.00000000000000))*(sj5)*(x4646)*(x4649))));
 evalcond[4]=((((r11)*(x4663)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x4649)))+(((sj0)*(x4647)*(x4648)))+(((x4645)*(x4660)))+(((sj0)*(x4646)*(x4648)))+(((IkReal(-1.00000000000000))*(r01)*(x4651)*(x4659)))+(((IkReal(-1.00000000000000))*(x4648)*(x4649)*(x4658)))+(((r00)*(sj0)*(x4655)))+(((IkReal(-1.00000000000000))*(x4648)*(x4649)*(x4652)))+(x4644)+(((IkReal(-1.00000000000000))*(r10)*(x4649)*(x4655))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(sj5)*(x4649)*(x4660)))+(((r01)*(x4663)))+(((IkReal(-1.00000000000000))*(r10)*(x4651)*(x4655)))+(((IkReal(-1.00000000000000))*(x4648)*(x4651)*(x4658)))+(((IkReal(-1.00000000000000))*(x4643)*(x4654)))+(((IkReal(-1.00000000000000))*(x4648)*(x4651)*(x4652)))+(((IkReal(-1.00000000000000))*(r00)*(x4649)*(x4655)))+(((r11)*(sj0)*(x4659)))+(((IkReal(-1.00000000000000))*(x4647)*(x4648)*(x4649)))+(((IkReal(-1.00000000000000))*(x4645)*(x4661)))+(((IkReal(-1.00000000000000))*(x4646)*(x4648)*(x4649))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -14569,8 +14556,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -14732,7 +14718,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -14760,7 +14746,7 @@ IkReal x4765=((cj6)*(r01)*(sj5));
 IkReal x4766=((IkReal(1.00000000000000))*(sj0)*(sj5));
 evalcond[0]=((((IkReal(-1.00000000000000))*(r02)*(x4763)))+(((sj0)*(x4765)))+(((r12)*(x4759)))+(((sj0)*(x4764)))+(((IkReal(-1.00000000000000))*(sj5)*(x4760)*(x4761)))+(IKsin(j3))+(((IkReal(-1.00000000000000))*(sj5)*(x4760)*(x4762))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x4760)*(x4765)))+(((IkReal(-1.00000000000000))*(x4761)*(x4766)))+(((IkReal(-1.00000000000000))*(IKcos(j3))))+(((r02)*(x4759)))+(((IkReal(-1.00000000000000))*(x4760)*(x4764)))+(((r12)*(x4763)))+(((IkReal(-1.00000000000000))*(x4762)*(x4766))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -14855,7 +14841,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -14906,14 +14892,14 @@ evalcond[2]=((((r01)*(x4828)*(x4837)))+(((IkReal(-1.00000000000000))*(r10)*(x482
 evalcond[3]=((((IkReal(-1.00000000000000))*(r10)*(x4825)*(x4839)))+(((IkReal(-1.00000000000000))*(r01)*(x4830)*(x4837)))+(((IkReal(-1.00000000000000))*(x4825)*(x4827)*(x4842)))+(((x4838)*(x4840)))+(((x4829)*(x4839)))+(((IkReal(-1.00000000000000))*(r10)*(x4823)*(x4826)*(x4835)))+(((IkReal(-1.00000000000000))*(cj3)))+(((x4831)*(x4837)))+(((r01)*(x4828)*(x4840)))+(((x4833)*(x4840)))+(((IkReal(-1.00000000000000))*(x4826)*(x4846))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x4837)*(x4848)))+(((x4831)*(x4842)))+(((IkReal(-1.00000000000000))*(x4822)*(x4826)*(x4838)))+(((IkReal(-1.00000000000000))*(x4822)*(x4826)*(x4833)))+(((IkReal(-1.00000000000000))*(x4829)*(x4840)))+(((x4834)*(x4840)))+(((IkReal(-1.00000000000000))*(x4825)*(x4827)*(x4837)))+(((IkReal(-1.00000000000000))*(x4826)*(x4847)))+(((IkReal(-1.00000000000000))*(x4825)*(x4836)*(x4839)))+(((IkReal(-1.00000000000000))*(x4832)*(x4837))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r10)*(x4825)*(x4837)))+(((r01)*(sj6)*(x4839)))+(((IkReal(-1.00000000000000))*(x4825)*(x4836)*(x4842)))+(((x4829)*(x4837)))+(((IkReal(-1.00000000000000))*(x4825)*(x4827)*(x4840)))+(((IkReal(-1.00000000000000))*(x4840)*(x4848)))+(((IkReal(-1.00000000000000))*(x4832)*(x4840)))+(((IkReal(-1.00000000000000))*(x4823)*(x4826)*(x4833)))+(((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(-1.00000000000000))*(r00)*(x4825)*(x4839)))+(((IkReal(-1.00000000000000))*(x4823)*(x4826)*(x4838))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -14949,8 +14935,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -14977,7 +14962,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -15028,14 +15013,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(r00)*(x4852)*(x4867)))+(((IkReal(-1.
 evalcond[3]=((((x4858)*(x4864)))+(((IkReal(-1.00000000000000))*(r10)*(x4852)*(x4866)))+(((x4856)*(x4866)))+(((IkReal(-1.00000000000000))*(r10)*(x4850)*(x4853)*(x4862)))+(((r01)*(x4855)*(x4867)))+(((IkReal(-1.00000000000000))*(r01)*(x4857)*(x4864)))+(((IkReal(-1.00000000000000))*(cj3)))+(((IkReal(-1.00000000000000))*(x4853)*(x4873)))+(((x4865)*(x4867)))+(((IkReal(-1.00000000000000))*(x4852)*(x4854)*(x4869)))+(((x4860)*(x4867))));
 evalcond[4]=((((x4858)*(x4869)))+(((IkReal(-1.00000000000000))*(x4849)*(x4853)*(x4865)))+(((IkReal(-1.00000000000000))*(x4864)*(x4875)))+(((IkReal(-1.00000000000000))*(x4852)*(x4863)*(x4866)))+(((IkReal(-1.00000000000000))*(x4859)*(x4864)))+(((IkReal(-1.00000000000000))*(x4853)*(x4874)))+(((IkReal(-1.00000000000000))*(x4849)*(x4853)*(x4860)))+(((IkReal(-1.00000000000000))*(x4856)*(x4867)))+(((x4861)*(x4867)))+(((IkReal(-1.00000000000000))*(x4852)*(x4854)*(x4864))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x4850)*(x4853)*(x4860)))+(((IkReal(-1.00000000000000))*(r00)*(x4852)*(x4866)))+(((x4856)*(x4864)))+(((IkReal(-1.00000000000000))*(x4852)*(x4854)*(x4867)))+(((r01)*(sj6)*(x4866)))+(((IkReal(-1.00000000000000))*(x4852)*(x4863)*(x4869)))+(((IkReal(-1.00000000000000))*(x4867)*(x4875)))+(((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(-1.00000000000000))*(r10)*(x4852)*(x4864)))+(((IkReal(-1.00000000000000))*(x4859)*(x4867)))+(((IkReal(-1.00000000000000))*(x4850)*(x4853)*(x4865))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -15071,8 +15056,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -15131,7 +15115,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -15159,7 +15143,7 @@ IkReal x4905=((cj6)*(r01)*(sj5));
 IkReal x4906=((IkReal(1.00000000000000))*(sj0)*(sj5));
 evalcond[0]=((((sj0)*(x4904)))+(((r12)*(x4899)))+(IKsin(j3))+(((IkReal(-1.00000000000000))*(sj5)*(x4900)*(x4901)))+(((IkReal(-1.00000000000000))*(sj5)*(x4900)*(x4902)))+(((sj0)*(x4905)))+(((IkReal(-1.00000000000000))*(r02)*(x4903))));
 evalcond[1]=((((r02)*(x4899)))+(((IkReal(-1.00000000000000))*(x4902)*(x4906)))+(((IkReal(-1.00000000000000))*(x4900)*(x4905)))+(((IkReal(-1.00000000000000))*(x4900)*(x4904)))+(IKcos(j3))+(((IkReal(-1.00000000000000))*(x4901)*(x4906)))+(((r12)*(x4903))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -15248,7 +15232,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -15299,14 +15283,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(r10)*(x4956)*(x4960)*(x4969)))+(((x4
 evalcond[3]=((((r01)*(x4962)*(x4974)))+(((x4965)*(x4971)))+(((IkReal(-1.00000000000000))*(r10)*(x4959)*(x4973)))+(((x4963)*(x4973)))+(((IkReal(-1.00000000000000))*(r01)*(x4964)*(x4971)))+(((IkReal(-1.00000000000000))*(r10)*(x4957)*(x4960)*(x4969)))+(((IkReal(-1.00000000000000))*(x4959)*(x4961)*(x4976)))+(((IkReal(-1.00000000000000))*(cj3)))+(((x4972)*(x4974)))+(((x4967)*(x4974)))+(((IkReal(-1.00000000000000))*(x4960)*(x4980))));
 evalcond[4]=((((x4968)*(x4974)))+(((IkReal(-1.00000000000000))*(x4956)*(x4960)*(x4967)))+(((IkReal(-1.00000000000000))*(x4959)*(x4970)*(x4973)))+(((IkReal(-1.00000000000000))*(x4956)*(x4960)*(x4972)))+(((IkReal(-1.00000000000000))*(x4960)*(x4981)))+(((IkReal(-1.00000000000000))*(x4963)*(x4974)))+(((IkReal(-1.00000000000000))*(x4959)*(x4961)*(x4971)))+(((IkReal(-1.00000000000000))*(x4966)*(x4971)))+(((x4965)*(x4976)))+(((IkReal(-1.00000000000000))*(x4971)*(x4982))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x4959)*(x4970)*(x4976)))+(sj3)+(((IkReal(-1.00000000000000))*(r00)*(x4959)*(x4973)))+(((IkReal(-1.00000000000000))*(x4959)*(x4961)*(x4974)))+(((r01)*(sj6)*(x4973)))+(((IkReal(-1.00000000000000))*(x4966)*(x4974)))+(((x4963)*(x4971)))+(((IkReal(-1.00000000000000))*(x4957)*(x4960)*(x4972)))+(((IkReal(-1.00000000000000))*(r10)*(x4959)*(x4971)))+(((IkReal(-1.00000000000000))*(x4974)*(x4982)))+(((IkReal(-1.00000000000000))*(x4957)*(x4960)*(x4967))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -15342,8 +15326,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -15370,7 +15353,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -15421,14 +15404,14 @@ evalcond[2]=((((r01)*(x4989)*(x4998)))+(((IkReal(-1.00000000000000))*(x4986)*(x4
 evalcond[3]=((((x4994)*(x5001)))+(((IkReal(-1.00000000000000))*(r10)*(x4986)*(x5000)))+(((IkReal(-1.00000000000000))*(r10)*(x4984)*(x4987)*(x4996)))+(((IkReal(-1.00000000000000))*(x4987)*(x5007)))+(((x4990)*(x5000)))+(((r01)*(x4989)*(x5001)))+(((IkReal(-1.00000000000000))*(r01)*(x4991)*(x4998)))+(((IkReal(-1.00000000000000))*(cj3)))+(((IkReal(-1.00000000000000))*(x4986)*(x4988)*(x5003)))+(((x4999)*(x5001)))+(((x4992)*(x4998))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x4993)*(x4998)))+(((IkReal(-1.00000000000000))*(x4983)*(x4987)*(x4999)))+(((IkReal(-1.00000000000000))*(x4987)*(x5008)))+(((IkReal(-1.00000000000000))*(x4986)*(x4988)*(x4998)))+(((IkReal(-1.00000000000000))*(x4990)*(x5001)))+(((IkReal(-1.00000000000000))*(x4983)*(x4987)*(x4994)))+(((x4992)*(x5003)))+(((IkReal(-1.00000000000000))*(x4998)*(x5009)))+(((x4995)*(x5001)))+(((IkReal(-1.00000000000000))*(x4986)*(x4997)*(x5000))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x4984)*(x4987)*(x4999)))+(sj3)+(((IkReal(-1.00000000000000))*(x5001)*(x5009)))+(((r01)*(sj6)*(x5000)))+(((IkReal(-1.00000000000000))*(x4993)*(x5001)))+(((IkReal(-1.00000000000000))*(x4986)*(x4997)*(x5003)))+(((IkReal(-1.00000000000000))*(x4984)*(x4987)*(x4994)))+(((IkReal(-1.00000000000000))*(x4986)*(x4988)*(x5001)))+(((IkReal(-1.00000000000000))*(r10)*(x4986)*(x4998)))+(((x4990)*(x4998)))+(((IkReal(-1.00000000000000))*(r00)*(x4986)*(x5000))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -15464,8 +15447,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -15511,7 +15493,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -15540,7 +15522,7 @@ IkReal x5021=((cj6)*(r11)*(sj5));
 evalcond[0]=((((cj6)*(r21)*(sj5)))+(((IkReal(-1.00000000000000))*(sj1)*(x5019)))+(((r20)*(x5015)))+(((IkReal(-1.00000000000000))*(cj5)*(r22))));
 evalcond[1]=((((sj0)*(x5020)))+(((IkReal(-1.00000000000000))*(x5017)*(x5021)))+(((r12)*(x5016)))+(((r00)*(sj0)*(x5015)))+(((IkReal(-1.00000000000000))*(cj5)*(r02)*(x5018)))+(((IkReal(-1.00000000000000))*(r10)*(x5015)*(x5017)))+(IKsin(j3)));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r00)*(x5015)*(x5017)))+(((cj5)*(r12)*(sj0)))+(((r02)*(x5016)))+(((IkReal(-1.00000000000000))*(x5018)*(x5021)))+(((IkReal(-1.00000000000000))*(cj1)*(x5019)))+(((IkReal(-1.00000000000000))*(r10)*(x5015)*(x5018)))+(((IkReal(-1.00000000000000))*(x5017)*(x5020))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -15636,7 +15618,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -15688,14 +15670,14 @@ evalcond[2]=((((x5090)*(x5094)))+(((x5091)*(x5099)))+(((r01)*(sj6)*(x5097)))+(((
 evalcond[3]=((((IkReal(-1.00000000000000))*(x5082)*(x5103)))+(((IkReal(-1.00000000000000))*(r10)*(x5081)*(x5096)))+(((IkReal(-1.00000000000000))*(x5081)*(x5084)*(x5099)))+(((IkReal(-1.00000000000000))*(cj3)))+(((x5095)*(x5097)))+(((x5086)*(x5096)))+(((IkReal(-1.00000000000000))*(r01)*(x5087)*(x5094)))+(((r01)*(x5085)*(x5097)))+(((x5090)*(x5097)))+(((x5088)*(x5094)))+(((IkReal(-1.00000000000000))*(r10)*(x5079)*(x5082)*(x5092))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x5094)*(x5105)))+(((IkReal(-1.00000000000000))*(x5082)*(x5104)))+(((IkReal(-1.00000000000000))*(x5086)*(x5097)))+(((IkReal(-1.00000000000000))*(x5081)*(x5093)*(x5096)))+(((IkReal(-1.00000000000000))*(x5089)*(x5094)))+(((IkReal(-1.00000000000000))*(x5081)*(x5084)*(x5094)))+(((x5091)*(x5097)))+(((x5088)*(x5099)))+(((IkReal(-1.00000000000000))*(x5078)*(x5082)*(x5090)))+(((IkReal(-1.00000000000000))*(x5078)*(x5082)*(x5095)))+(((IkReal(-1.00000000000000))*(x5083))));
 evalcond[5]=((((x5086)*(x5094)))+(((IkReal(-1.00000000000000))*(r00)*(x5081)*(x5096)))+(((IkReal(-1.00000000000000))*(r10)*(x5081)*(x5094)))+(((r01)*(sj6)*(x5096)))+(((IkReal(-1.00000000000000))*(cj1)*(sj3)))+(((IkReal(-1.00000000000000))*(x5081)*(x5093)*(x5099)))+(((IkReal(-1.00000000000000))*(x5079)*(x5082)*(x5090)))+(((IkReal(-1.00000000000000))*(x5079)*(x5082)*(x5095)))+(((IkReal(-1.00000000000000))*(x5081)*(x5084)*(x5097)))+(((IkReal(-1.00000000000000))*(x5097)*(x5105)))+(((IkReal(-1.00000000000000))*(x5089)*(x5097))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -15731,8 +15713,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -15766,7 +15747,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -15818,14 +15799,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x5113)*(x5117)*(x5124)))+(((IkReal(-
 evalcond[3]=((((IkReal(-1.00000000000000))*(r10)*(x5116)*(x5131)))+(((IkReal(-1.00000000000000))*(r10)*(x5114)*(x5117)*(x5127)))+(((x5130)*(x5132)))+(((IkReal(-1.00000000000000))*(x5117)*(x5138)))+(((IkReal(-1.00000000000000))*(x5116)*(x5119)*(x5134)))+(((x5123)*(x5129)))+(((r01)*(x5120)*(x5132)))+(((x5121)*(x5131)))+(((IkReal(-1.00000000000000))*(cj3)))+(((IkReal(-1.00000000000000))*(r01)*(x5122)*(x5129)))+(((x5125)*(x5132))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x5116)*(x5119)*(x5129)))+(((IkReal(-1.00000000000000))*(x5129)*(x5140)))+(((IkReal(-1.00000000000000))*(x5113)*(x5117)*(x5125)))+(((x5126)*(x5132)))+(((IkReal(-1.00000000000000))*(x5117)*(x5139)))+(((IkReal(-1.00000000000000))*(x5113)*(x5117)*(x5130)))+(((IkReal(-1.00000000000000))*(x5124)*(x5129)))+(((IkReal(-1.00000000000000))*(x5121)*(x5132)))+(((IkReal(-1.00000000000000))*(x5118)))+(((x5123)*(x5134)))+(((IkReal(-1.00000000000000))*(x5116)*(x5128)*(x5131))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x5116)*(x5128)*(x5134)))+(((IkReal(-1.00000000000000))*(x5114)*(x5117)*(x5125)))+(((IkReal(-1.00000000000000))*(x5114)*(x5117)*(x5130)))+(((IkReal(-1.00000000000000))*(x5116)*(x5119)*(x5132)))+(((IkReal(-1.00000000000000))*(r00)*(x5116)*(x5131)))+(((x5121)*(x5129)))+(((IkReal(-1.00000000000000))*(r10)*(x5116)*(x5129)))+(((IkReal(-1.00000000000000))*(cj1)*(sj3)))+(((IkReal(-1.00000000000000))*(x5132)*(x5140)))+(((r01)*(sj6)*(x5131)))+(((IkReal(-1.00000000000000))*(x5124)*(x5132))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -15861,8 +15842,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -15902,7 +15882,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -15937,7 +15917,7 @@ IkReal x5161=((r11)*(sj6)*(x5149));
 evalcond[0]=((((IkReal(-1.00000000000000))*(r20)*(x5158)))+(((r21)*(sj6)*(x5149)))+(((r20)*(sj6)*(x5157)))+(cj1)+(((r22)*(x5155)))+(((cj6)*(r21)*(x5157))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(r00)*(x5153)*(x5158)))+(((IkReal(-1.00000000000000))*(r12)*(x5152)*(x5155)))+(((IkReal(-1.00000000000000))*(x5152)*(x5154)*(x5157)))+(((x5150)*(x5159)))+(((x5151)*(x5159)))+(((cj0)*(r10)*(x5158)))+(((r02)*(sj0)*(x5155)))+(((sj0)*(x5160)))+(((IkReal(-1.00000000000000))*(x5152)*(x5161)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x5152)*(x5157))));
 evalcond[2]=((((r10)*(sj0)*(x5158)))+(((cj0)*(r00)*(x5158)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x5153)*(x5157)))+(((IkReal(-1.00000000000000))*(x5151)*(x5152)*(x5157)))+(((IkReal(-1.00000000000000))*(x5152)*(x5160)))+(((IkReal(-1.00000000000000))*(x5153)*(x5154)*(x5157)))+(((IkReal(-1.00000000000000))*(sj1)))+(((IkReal(-1.00000000000000))*(x5150)*(x5152)*(x5157)))+(((IkReal(-1.00000000000000))*(r02)*(x5152)*(x5155)))+(((IkReal(-1.00000000000000))*(r12)*(x5153)*(x5155)))+(((IkReal(-1.00000000000000))*(x5153)*(x5161))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -16019,7 +15999,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -16057,14 +16037,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x5207)))+(((r21)*(x5206)))+(((IkReal
 evalcond[1]=((((cj5)*(r21)*(x5201)))+(((cj5)*(r20)*(x5202)))+(((IkReal(-1.00000000000000))*(r21)*(x5199)))+(((r22)*(x5204)))+(((IkReal(-1.00000000000000))*(x5192)))+(((r20)*(x5198))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x5200)*(x5206)))+(x5192)+(((r12)*(x5197)))+(((IkReal(-1.00000000000000))*(r10)*(x5203)*(x5205)))+(((x5193)*(x5194)))+(((IkReal(-1.00000000000000))*(r02)*(x5196)))+(((x5193)*(x5195))));
 evalcond[3]=((((x5199)*(x5200)))+(((cj4)*(x5195)*(x5196)))+(((IkReal(-1.00000000000000))*(r11)*(x5197)*(x5201)))+(((IkReal(-1.00000000000000))*(r10)*(x5197)*(x5202)))+(((IkReal(-1.00000000000000))*(x5207)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x5199)))+(((IkReal(-1.00000000000000))*(r10)*(x5198)*(x5203)))+(((cj4)*(r02)*(x5193)))+(((IkReal(-1.00000000000000))*(r12)*(x5203)*(x5204)))+(((cj4)*(x5194)*(x5196)))+(((r00)*(sj0)*(x5198))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -16100,8 +16080,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -16166,7 +16145,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -16204,14 +16183,14 @@ evalcond[0]=((x5240)+(((IkReal(-1.00000000000000))*(r22)*(x5245)))+(((sj5)*(x525
 evalcond[1]=((((x5246)*(x5252)))+(x5239)+(((cj4)*(r22)*(sj5)))+(((r20)*(x5247)))+(((x5246)*(x5251)))+(((IkReal(-1.00000000000000))*(r21)*(x5248))));
 evalcond[2]=((x5239)+(((r12)*(x5244)))+(((IkReal(-1.00000000000000))*(x5253)*(x5254)))+(((IkReal(-1.00000000000000))*(cj6)*(sj5)*(x5249)))+(((x5241)*(x5242)))+(((x5241)*(x5243)))+(((IkReal(-1.00000000000000))*(r02)*(sj0)*(x5245))));
 evalcond[3]=((((sj0)*(x5242)*(x5246)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x5248)))+(((r00)*(sj0)*(x5247)))+(((IkReal(-1.00000000000000))*(x5244)*(x5250)*(x5254)))+(((sj0)*(x5243)*(x5246)))+(((IkReal(-1.00000000000000))*(cj0)*(r10)*(x5247)))+(((IkReal(-1.00000000000000))*(r12)*(x5250)*(x5253)))+(((x5248)*(x5249)))+(((IkReal(-1.00000000000000))*(x5240)))+(((cj4)*(r02)*(x5241)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x5244)*(x5250))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -16247,8 +16226,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -16316,7 +16294,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -16355,14 +16333,14 @@ evalcond[0]=((x5289)+(((r12)*(x5295)))+(((x5290)*(x5296)))+(((IkReal(-1.00000000
 evalcond[1]=((((IkReal(-1.00000000000000))*(x5296)*(x5298)))+(((r12)*(x5297)))+(((IkReal(-1.00000000000000))*(x5290)*(x5300)))+(((IkReal(-1.00000000000000))*(x5290)*(x5299)))+(((IkReal(-1.00000000000000))*(x5302)))+(((IkReal(-1.00000000000000))*(x5291)*(x5298)))+(((r02)*(x5295))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r12)*(x5292)*(x5298)))+(((cj4)*(cj5)*(r01)*(x5293)))+(((IkReal(-1.00000000000000))*(x5301)*(x5305)))+(((cj4)*(r02)*(x5290)))+(((cj4)*(x5291)*(x5297)))+(((x5293)*(x5294)))+(((IkReal(-1.00000000000000))*(x5302)))+(((r11)*(x5303)))+(((IkReal(-1.00000000000000))*(x5292)*(x5295)*(x5300)))+(((IkReal(-1.00000000000000))*(r01)*(x5304)))+(((IkReal(-1.00000000000000))*(x5292)*(x5295)*(x5299))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x5292)*(x5297)*(x5300)))+(((IkReal(-1.00000000000000))*(x5291)*(x5292)*(x5295)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x5292)*(x5293)))+(((r11)*(x5304)))+(((r01)*(x5303)))+(((IkReal(-1.00000000000000))*(x5294)*(x5305)))+(((IkReal(-1.00000000000000))*(x5293)*(x5301)))+(((IkReal(-1.00000000000000))*(r12)*(x5290)*(x5292)))+(((IkReal(-1.00000000000000))*(x5289)))+(((IkReal(-1.00000000000000))*(x5292)*(x5295)*(x5296)))+(((IkReal(-1.00000000000000))*(r02)*(x5292)*(x5298))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -16398,8 +16376,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -16465,7 +16442,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -16504,14 +16481,14 @@ evalcond[0]=((((r12)*(x5345)))+(((IkReal(-1.00000000000000))*(x5348)*(x5350)))+(
 evalcond[1]=((((IkReal(-1.00000000000000))*(x5340)*(x5349)))+(((IkReal(-1.00000000000000))*(x5340)*(x5350)))+(((IkReal(-1.00000000000000))*(x5346)*(x5348)))+(((r02)*(x5345)))+(((IkReal(-1.00000000000000))*(x5341)*(x5348)))+(((r12)*(x5347)))+(x5338));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r01)*(x5353)))+(((IkReal(-1.00000000000000))*(r12)*(x5342)*(x5348)))+(((IkReal(-1.00000000000000))*(x5342)*(x5345)*(x5350)))+(((cj4)*(x5341)*(x5347)))+(((IkReal(-1.00000000000000))*(x5342)*(x5345)*(x5349)))+(((cj4)*(cj5)*(r01)*(x5343)))+(((IkReal(-1.00000000000000))*(x5338)))+(((x5343)*(x5344)))+(((r11)*(x5352)))+(((IkReal(-1.00000000000000))*(x5351)*(x5354)))+(((cj4)*(r02)*(x5340))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r12)*(x5340)*(x5342)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x5342)*(x5343)))+(((IkReal(-1.00000000000000))*(x5343)*(x5351)))+(((IkReal(-1.00000000000000))*(x5341)*(x5342)*(x5345)))+(((IkReal(-1.00000000000000))*(x5342)*(x5345)*(x5346)))+(((IkReal(-1.00000000000000))*(x5344)*(x5354)))+(((IkReal(-1.00000000000000))*(r02)*(x5342)*(x5348)))+(((r11)*(x5353)))+(((r01)*(x5352)))+(((IkReal(-1.00000000000000))*(x5342)*(x5347)*(x5350)))+(x5339));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -16547,8 +16524,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -16593,7 +16569,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -16637,14 +16613,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x5371)*(x5378)))+(((x5364)*(x5367)))
 evalcond[3]=((((IkReal(-1.00000000000000))*(x5363)*(x5372)))+(((r12)*(x5369)))+(((IkReal(-1.00000000000000))*(x5365)*(x5371)))+(((IkReal(-1.00000000000000))*(x5364)*(x5378)))+(((r02)*(x5368)))+(((IkReal(-1.00000000000000))*(x5367)*(x5371)))+(((IkReal(-1.00000000000000))*(x5364)*(x5370))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r12)*(x5366)*(x5371)))+(((cj4)*(x5367)*(x5369)))+(((r00)*(sj0)*(x5373)))+(((IkReal(-1.00000000000000))*(r01)*(x5381)))+(((IkReal(-1.00000000000000))*(r10)*(x5373)*(x5379)))+(((IkReal(-1.00000000000000))*(x5363)))+(((r11)*(x5380)))+(((cj4)*(x5365)*(x5369)))+(((IkReal(-1.00000000000000))*(x5366)*(x5368)*(x5370)))+(((cj4)*(r02)*(x5364)))+(((IkReal(-1.00000000000000))*(x5366)*(x5368)*(x5378))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x5362)*(x5372)))+(((IkReal(-1.00000000000000))*(r02)*(x5366)*(x5371)))+(((IkReal(-1.00000000000000))*(x5366)*(x5367)*(x5368)))+(((IkReal(-1.00000000000000))*(x5366)*(x5369)*(x5378)))+(((r01)*(x5380)))+(((r11)*(x5381)))+(((IkReal(-1.00000000000000))*(x5365)*(x5366)*(x5368)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x5373)))+(((IkReal(-1.00000000000000))*(r12)*(x5364)*(x5366)))+(((IkReal(-1.00000000000000))*(x5366)*(x5369)*(x5370)))+(((IkReal(-1.00000000000000))*(r00)*(x5373)*(x5379))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -16680,8 +16656,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -16712,7 +16687,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -16756,14 +16731,14 @@ evalcond[2]=((((r12)*(x5392)))+(((IkReal(-1.00000000000000))*(r02)*(x5393)))+(((
 evalcond[3]=((((IkReal(-1.00000000000000))*(x5388)*(x5402)))+(((IkReal(-1.00000000000000))*(x5391)*(x5395)))+(((IkReal(-1.00000000000000))*(x5388)*(x5394)))+(((IkReal(-1.00000000000000))*(x5389)*(x5395)))+(((IkReal(-1.00000000000000))*(x5387)*(x5396)))+(((r02)*(x5392)))+(((r12)*(x5393))));
 evalcond[4]=((((cj4)*(x5391)*(x5393)))+(((IkReal(-1.00000000000000))*(x5390)*(x5392)*(x5402)))+(((IkReal(-1.00000000000000))*(x5387)))+(((r11)*(x5404)))+(((IkReal(-1.00000000000000))*(r10)*(x5397)*(x5403)))+(((r00)*(sj0)*(x5397)))+(((IkReal(-1.00000000000000))*(r12)*(x5390)*(x5395)))+(((IkReal(-1.00000000000000))*(x5390)*(x5392)*(x5394)))+(((cj4)*(x5389)*(x5393)))+(((IkReal(-1.00000000000000))*(r01)*(x5405)))+(((cj4)*(r02)*(x5388))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x5386)*(x5396)))+(((IkReal(-1.00000000000000))*(r12)*(x5388)*(x5390)))+(((r11)*(x5405)))+(((IkReal(-1.00000000000000))*(x5390)*(x5393)*(x5402)))+(((IkReal(-1.00000000000000))*(x5390)*(x5393)*(x5394)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x5397)))+(((IkReal(-1.00000000000000))*(r02)*(x5390)*(x5395)))+(((IkReal(-1.00000000000000))*(r00)*(x5397)*(x5403)))+(((r01)*(x5404)))+(((IkReal(-1.00000000000000))*(x5389)*(x5390)*(x5392)))+(((IkReal(-1.00000000000000))*(x5390)*(x5391)*(x5392))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -16799,8 +16774,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -16830,7 +16804,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -16874,14 +16848,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x5418)*(x5425)))+(((r12)*(x5415)))+(
 evalcond[3]=((((IkReal(-1.00000000000000))*(x5411)*(x5417)))+(((r02)*(x5415)))+(((IkReal(-1.00000000000000))*(x5414)*(x5418)))+(((IkReal(-1.00000000000000))*(x5412)*(x5418)))+(((IkReal(-1.00000000000000))*(x5410)*(x5419)))+(((r12)*(x5416)))+(((IkReal(-1.00000000000000))*(x5411)*(x5425))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x5413)*(x5415)*(x5425)))+(((cj4)*(x5414)*(x5416)))+(((IkReal(-1.00000000000000))*(r01)*(x5428)))+(((cj4)*(x5412)*(x5416)))+(((IkReal(-1.00000000000000))*(r12)*(x5413)*(x5418)))+(((IkReal(-1.00000000000000))*(r10)*(x5420)*(x5426)))+(((cj4)*(r02)*(x5411)))+(((r11)*(x5427)))+(((IkReal(-1.00000000000000))*(x5413)*(x5415)*(x5417)))+(((IkReal(-1.00000000000000))*(x5410)))+(((r00)*(sj0)*(x5420))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x5409)*(x5419)))+(((r01)*(x5427)))+(((IkReal(-1.00000000000000))*(x5412)*(x5413)*(x5415)))+(((IkReal(-1.00000000000000))*(x5413)*(x5414)*(x5415)))+(((IkReal(-1.00000000000000))*(r00)*(x5420)*(x5426)))+(((r11)*(x5428)))+(((IkReal(-1.00000000000000))*(x5413)*(x5416)*(x5425)))+(((IkReal(-1.00000000000000))*(r12)*(x5411)*(x5413)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x5420)))+(((IkReal(-1.00000000000000))*(r02)*(x5413)*(x5418)))+(((IkReal(-1.00000000000000))*(x5413)*(x5416)*(x5417))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -16917,8 +16891,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -16958,7 +16931,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -16993,7 +16966,7 @@ IkReal x5449=((r11)*(sj6)*(x5437));
 evalcond[0]=((((r20)*(sj6)*(x5445)))+(((r22)*(x5443)))+(((r21)*(sj6)*(x5437)))+(cj1)+(((cj6)*(r21)*(x5445)))+(((IkReal(-1.00000000000000))*(r20)*(x5446))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x5440)*(x5442)*(x5445)))+(((x5439)*(x5447)))+(((r02)*(sj0)*(x5443)))+(((IkReal(-1.00000000000000))*(r12)*(x5440)*(x5443)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x5440)*(x5445)))+(((cj0)*(r10)*(x5446)))+(((x5438)*(x5447)))+(((IkReal(-1.00000000000000))*(x5440)*(x5449)))+(((IkReal(-1.00000000000000))*(r00)*(x5441)*(x5446)))+(((sj0)*(x5448))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x5438)*(x5440)*(x5445)))+(((IkReal(-1.00000000000000))*(x5441)*(x5449)))+(((IkReal(-1.00000000000000))*(x5439)*(x5440)*(x5445)))+(((IkReal(-1.00000000000000))*(r12)*(x5441)*(x5443)))+(((IkReal(-1.00000000000000))*(r02)*(x5440)*(x5443)))+(((IkReal(-1.00000000000000))*(sj1)))+(((r10)*(sj0)*(x5446)))+(((IkReal(-1.00000000000000))*(x5441)*(x5442)*(x5445)))+(((IkReal(-1.00000000000000))*(x5440)*(x5448)))+(((cj0)*(r00)*(x5446)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x5441)*(x5445))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -17075,7 +17048,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -17113,14 +17086,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((r21)*(x5494)))+(((r2
 evalcond[1]=((((IkReal(-1.00000000000000))*(r21)*(x5487)))+(((cj5)*(r20)*(x5490)))+(((IkReal(-1.00000000000000))*(x5480)))+(((r20)*(x5486)))+(((cj5)*(r21)*(x5489)))+(((r22)*(x5492))));
 evalcond[2]=((x5480)+(((IkReal(-1.00000000000000))*(r10)*(x5491)*(x5493)))+(((r12)*(x5485)))+(((IkReal(-1.00000000000000))*(r02)*(x5484)))+(((x5481)*(x5482)))+(((IkReal(-1.00000000000000))*(x5488)*(x5494)))+(((x5481)*(x5483))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r11)*(x5485)*(x5489)))+(((cj4)*(x5482)*(x5484)))+(((IkReal(-1.00000000000000))*(r12)*(x5491)*(x5492)))+(((IkReal(-1.00000000000000))*(r10)*(x5485)*(x5490)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x5487)))+(((cj4)*(x5483)*(x5484)))+(((r00)*(sj0)*(x5486)))+(((cj4)*(r02)*(x5481)))+(((x5487)*(x5488)))+(((IkReal(-1.00000000000000))*(r10)*(x5486)*(x5491)))+(((IkReal(-1.00000000000000))*(x5495))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -17156,8 +17129,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -17222,7 +17194,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -17260,14 +17232,14 @@ evalcond[0]=((((sj5)*(x5540)))+(((IkReal(-1.00000000000000))*(r22)*(x5533)))+(x5
 evalcond[1]=((((x5534)*(x5540)))+(((cj4)*(r22)*(sj5)))+(((x5534)*(x5539)))+(x5527)+(((r20)*(x5535)))+(((IkReal(-1.00000000000000))*(r21)*(x5536))));
 evalcond[2]=((((x5529)*(x5531)))+(((IkReal(-1.00000000000000))*(cj6)*(sj5)*(x5537)))+(((r12)*(x5532)))+(x5527)+(((IkReal(-1.00000000000000))*(r02)*(sj0)*(x5533)))+(((x5529)*(x5530)))+(((IkReal(-1.00000000000000))*(x5541)*(x5542))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r12)*(x5538)*(x5541)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x5532)*(x5538)))+(((r00)*(sj0)*(x5535)))+(((x5536)*(x5537)))+(((IkReal(-1.00000000000000))*(cj0)*(r10)*(x5535)))+(((IkReal(-1.00000000000000))*(x5528)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x5536)))+(((IkReal(-1.00000000000000))*(x5532)*(x5538)*(x5542)))+(((sj0)*(x5531)*(x5534)))+(((cj4)*(r02)*(x5529)))+(((sj0)*(x5530)*(x5534))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -17303,8 +17275,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -17372,7 +17343,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -17411,14 +17382,14 @@ evalcond[0]=((((x5578)*(x5584)))+(((r12)*(x5583)))+(((IkReal(-1.00000000000000))
 evalcond[1]=((((IkReal(-1.00000000000000))*(x5578)*(x5588)))+(((r02)*(x5583)))+(((r12)*(x5585)))+(((IkReal(-1.00000000000000))*(x5579)*(x5586)))+(((IkReal(-1.00000000000000))*(x5578)*(x5587)))+(((IkReal(-1.00000000000000))*(x5584)*(x5586)))+(((IkReal(-1.00000000000000))*(x5590))));
 evalcond[2]=((((cj4)*(cj5)*(r01)*(x5581)))+(((cj4)*(r02)*(x5578)))+(((IkReal(-1.00000000000000))*(x5589)*(x5593)))+(((IkReal(-1.00000000000000))*(x5580)*(x5583)*(x5587)))+(((IkReal(-1.00000000000000))*(r12)*(x5580)*(x5586)))+(((cj4)*(x5579)*(x5585)))+(((r11)*(x5591)))+(((IkReal(-1.00000000000000))*(x5590)))+(((x5581)*(x5582)))+(((IkReal(-1.00000000000000))*(x5580)*(x5583)*(x5588)))+(((IkReal(-1.00000000000000))*(r01)*(x5592))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r12)*(x5578)*(x5580)))+(((IkReal(-1.00000000000000))*(x5577)))+(((IkReal(-1.00000000000000))*(x5580)*(x5585)*(x5588)))+(((IkReal(-1.00000000000000))*(x5580)*(x5583)*(x5584)))+(((r01)*(x5591)))+(((IkReal(-1.00000000000000))*(x5579)*(x5580)*(x5583)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x5580)*(x5581)))+(((IkReal(-1.00000000000000))*(r02)*(x5580)*(x5586)))+(((IkReal(-1.00000000000000))*(x5582)*(x5593)))+(((IkReal(-1.00000000000000))*(x5581)*(x5589)))+(((r11)*(x5592))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -17454,8 +17425,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -17521,7 +17491,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -17560,14 +17530,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(r02)*(x5635)))+(((x5628)*(x5629)))+(
 evalcond[1]=((((IkReal(-1.00000000000000))*(x5628)*(x5637)))+(((IkReal(-1.00000000000000))*(x5629)*(x5636)))+(((IkReal(-1.00000000000000))*(x5634)*(x5636)))+(((IkReal(-1.00000000000000))*(x5628)*(x5638)))+(((r02)*(x5633)))+(((r12)*(x5635)))+(x5626));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r01)*(x5641)))+(((IkReal(-1.00000000000000))*(r12)*(x5630)*(x5636)))+(((cj4)*(r02)*(x5628)))+(((IkReal(-1.00000000000000))*(x5630)*(x5633)*(x5638)))+(((cj4)*(cj5)*(r01)*(x5631)))+(((IkReal(-1.00000000000000))*(x5630)*(x5633)*(x5637)))+(((r11)*(x5640)))+(((cj4)*(x5629)*(x5635)))+(((x5631)*(x5632)))+(((IkReal(-1.00000000000000))*(x5639)*(x5642)))+(((IkReal(-1.00000000000000))*(x5626))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x5630)*(x5635)*(x5638)))+(((r11)*(x5641)))+(((IkReal(-1.00000000000000))*(x5629)*(x5630)*(x5633)))+(((IkReal(-1.00000000000000))*(x5631)*(x5639)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x5630)*(x5631)))+(((IkReal(-1.00000000000000))*(x5630)*(x5633)*(x5634)))+(((r01)*(x5640)))+(((IkReal(-1.00000000000000))*(r12)*(x5628)*(x5630)))+(((IkReal(-1.00000000000000))*(x5632)*(x5642)))+(x5627)+(((IkReal(-1.00000000000000))*(r02)*(x5630)*(x5636))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -17603,8 +17573,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -17649,7 +17618,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -17693,14 +17662,14 @@ evalcond[2]=((((x5652)*(x5653)))+(((r12)*(x5656)))+(((x5652)*(x5655)))+(((IkReal
 evalcond[3]=((((r12)*(x5657)))+(((IkReal(-1.00000000000000))*(x5651)*(x5660)))+(((r02)*(x5656)))+(((IkReal(-1.00000000000000))*(x5655)*(x5659)))+(((IkReal(-1.00000000000000))*(x5652)*(x5666)))+(((IkReal(-1.00000000000000))*(x5652)*(x5658)))+(((IkReal(-1.00000000000000))*(x5653)*(x5659))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r01)*(x5669)))+(((cj4)*(x5655)*(x5657)))+(((IkReal(-1.00000000000000))*(x5654)*(x5656)*(x5658)))+(((r11)*(x5668)))+(((cj4)*(r02)*(x5652)))+(((IkReal(-1.00000000000000))*(x5654)*(x5656)*(x5666)))+(((IkReal(-1.00000000000000))*(r10)*(x5661)*(x5667)))+(((r00)*(sj0)*(x5661)))+(((cj4)*(x5653)*(x5657)))+(((IkReal(-1.00000000000000))*(r12)*(x5654)*(x5659)))+(((IkReal(-1.00000000000000))*(x5651))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r02)*(x5654)*(x5659)))+(((IkReal(-1.00000000000000))*(x5650)*(x5660)))+(((r11)*(x5669)))+(((IkReal(-1.00000000000000))*(x5653)*(x5654)*(x5656)))+(((IkReal(-1.00000000000000))*(r12)*(x5652)*(x5654)))+(((IkReal(-1.00000000000000))*(r00)*(x5661)*(x5667)))+(((IkReal(-1.00000000000000))*(x5654)*(x5657)*(x5658)))+(((IkReal(-1.00000000000000))*(x5654)*(x5655)*(x5656)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x5661)))+(((IkReal(-1.00000000000000))*(x5654)*(x5657)*(x5666)))+(((r01)*(x5668))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -17736,8 +17705,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -17768,7 +17736,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -17812,14 +17780,14 @@ evalcond[2]=((x5674)+(((IkReal(-1.00000000000000))*(x5682)*(x5683)))+(((IkReal(-
 evalcond[3]=((((r02)*(x5680)))+(((IkReal(-1.00000000000000))*(x5675)*(x5684)))+(((IkReal(-1.00000000000000))*(x5679)*(x5683)))+(((IkReal(-1.00000000000000))*(x5676)*(x5690)))+(((r12)*(x5681)))+(((IkReal(-1.00000000000000))*(x5677)*(x5683)))+(((IkReal(-1.00000000000000))*(x5676)*(x5682))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x5675)))+(((cj4)*(x5677)*(x5681)))+(((IkReal(-1.00000000000000))*(r01)*(x5693)))+(((r00)*(sj0)*(x5685)))+(((cj4)*(x5679)*(x5681)))+(((IkReal(-1.00000000000000))*(x5678)*(x5680)*(x5682)))+(((cj4)*(r02)*(x5676)))+(((IkReal(-1.00000000000000))*(r12)*(x5678)*(x5683)))+(((IkReal(-1.00000000000000))*(r10)*(x5685)*(x5691)))+(((r11)*(x5692)))+(((IkReal(-1.00000000000000))*(x5678)*(x5680)*(x5690))));
 evalcond[5]=((((r01)*(x5692)))+(((IkReal(-1.00000000000000))*(x5674)*(x5684)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x5685)))+(((r11)*(x5693)))+(((IkReal(-1.00000000000000))*(r02)*(x5678)*(x5683)))+(((IkReal(-1.00000000000000))*(x5678)*(x5681)*(x5690)))+(((IkReal(-1.00000000000000))*(r12)*(x5676)*(x5678)))+(((IkReal(-1.00000000000000))*(x5677)*(x5678)*(x5680)))+(((IkReal(-1.00000000000000))*(x5678)*(x5681)*(x5682)))+(((IkReal(-1.00000000000000))*(x5678)*(x5679)*(x5680)))+(((IkReal(-1.00000000000000))*(r00)*(x5685)*(x5691))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -17855,8 +17823,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -17886,7 +17853,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -17930,14 +17897,14 @@ evalcond[2]=((x5697)+(((x5699)*(x5702)))+(((x5699)*(x5700)))+(((IkReal(-1.000000
 evalcond[3]=((((IkReal(-1.00000000000000))*(x5702)*(x5706)))+(((r02)*(x5703)))+(((IkReal(-1.00000000000000))*(x5700)*(x5706)))+(((IkReal(-1.00000000000000))*(x5699)*(x5705)))+(((IkReal(-1.00000000000000))*(x5698)*(x5707)))+(((r12)*(x5704)))+(((IkReal(-1.00000000000000))*(x5699)*(x5713))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x5701)*(x5703)*(x5713)))+(((IkReal(-1.00000000000000))*(r01)*(x5716)))+(((IkReal(-1.00000000000000))*(x5698)))+(((IkReal(-1.00000000000000))*(r12)*(x5701)*(x5706)))+(((IkReal(-1.00000000000000))*(r10)*(x5708)*(x5714)))+(((r00)*(sj0)*(x5708)))+(((r11)*(x5715)))+(((cj4)*(x5702)*(x5704)))+(((cj4)*(x5700)*(x5704)))+(((IkReal(-1.00000000000000))*(x5701)*(x5703)*(x5705)))+(((cj4)*(r02)*(x5699))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x5701)*(x5702)*(x5703)))+(((r01)*(x5715)))+(((IkReal(-1.00000000000000))*(x5700)*(x5701)*(x5703)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x5708)))+(((IkReal(-1.00000000000000))*(r00)*(x5708)*(x5714)))+(((IkReal(-1.00000000000000))*(x5697)*(x5707)))+(((IkReal(-1.00000000000000))*(r12)*(x5699)*(x5701)))+(((r11)*(x5716)))+(((IkReal(-1.00000000000000))*(x5701)*(x5704)*(x5705)))+(((IkReal(-1.00000000000000))*(x5701)*(x5704)*(x5713)))+(((IkReal(-1.00000000000000))*(r02)*(x5701)*(x5706))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -17973,8 +17940,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -18036,7 +18002,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -18067,7 +18033,7 @@ IkReal x5742=((cj6)*(r11)*(sj5));
 evalcond[0]=((((cj6)*(r21)*(sj5)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((IkReal(-1.00000000000000))*(sj1)*(x5739)))+(((IkReal(-1.00000000000000))*(cj1)*(cj2)*(x5740)))+(((r20)*(x5735))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x5737)*(x5742)))+(((IkReal(-1.00000000000000))*(cj5)*(r02)*(x5738)))+(((r12)*(x5736)))+(((IkReal(-1.00000000000000))*(r10)*(x5735)*(x5737)))+(((sj0)*(x5741)))+(((IkReal(-1.00000000000000))*(sj2)*(x5740)))+(((r00)*(sj0)*(x5735))));
 evalcond[2]=((((cj2)*(sj1)*(x5733)))+(((IkReal(-1.00000000000000))*(r00)*(x5735)*(x5737)))+(((IkReal(-1.00000000000000))*(x5738)*(x5742)))+(((cj5)*(r12)*(sj0)))+(((IkReal(-1.00000000000000))*(x5737)*(x5741)))+(((r02)*(x5736)))+(((IkReal(-1.00000000000000))*(r10)*(x5735)*(x5738)))+(((IkReal(-1.00000000000000))*(cj1)*(x5739))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -18162,7 +18128,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -18215,14 +18181,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(r00)*(x5802)*(x5821)))+(((IkReal(-1.
 evalcond[3]=((((IkReal(-1.00000000000000))*(r10)*(x5802)*(x5820)))+(((cj5)*(x5803)*(x5821)))+(((IkReal(-1.00000000000000))*(sj5)*(x5801)*(x5819)))+(((x5807)*(x5820)))+(((IkReal(-1.00000000000000))*(x5808)*(x5822)))+(((x5814)*(x5821)))+(((x5812)*(x5822)))+(((IkReal(-1.00000000000000))*(x5809)*(x5810)*(x5819)))+(((cj3)*(sj2)))+(((cj5)*(x5800)*(x5821)))+(((IkReal(-1.00000000000000))*(x5802)*(x5811)*(x5819))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x5809)*(x5810)*(x5822)))+(((x5815)*(x5821)))+(((IkReal(-1.00000000000000))*(x5814)*(x5820)))+(((IkReal(-1.00000000000000))*(x5808)*(x5819)))+(((x5812)*(x5819)))+(((IkReal(-1.00000000000000))*(sj0)*(x5801)*(x5818)))+(((IkReal(-1.00000000000000))*(x5807)*(x5821)))+(((IkReal(-1.00000000000000))*(x5800)*(x5809)*(x5820)))+(((sj1)*(sj2)))+(((IkReal(-1.00000000000000))*(x5802)*(x5811)*(x5822)))+(((IkReal(-1.00000000000000))*(x5802)*(x5817)*(x5820))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(sj5)*(x5801)*(x5821)))+(((IkReal(-1.00000000000000))*(x5802)*(x5817)*(x5819)))+(((IkReal(-1.00000000000000))*(x5805)*(x5806)))+(((IkReal(-1.00000000000000))*(x5814)*(x5819)))+(((IkReal(-1.00000000000000))*(r10)*(x5802)*(x5822)))+(((IkReal(-1.00000000000000))*(x5809)*(x5810)*(x5821)))+(((IkReal(-1.00000000000000))*(x5802)*(x5811)*(x5821)))+(((x5808)*(x5820)))+(((IkReal(-1.00000000000000))*(r00)*(x5802)*(x5820)))+(((x5807)*(x5822)))+(((IkReal(-1.00000000000000))*(sj3)*(x5804)))+(((IkReal(-1.00000000000000))*(x5800)*(x5809)*(x5819))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -18258,8 +18224,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -18295,7 +18260,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -18348,14 +18313,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(cj0)*(x5839)*(x5856)))+(((IkReal(-1.
 evalcond[3]=((((cj5)*(x5838)*(x5859)))+(((cj5)*(x5841)*(x5859)))+(((x5852)*(x5859)))+(((x5850)*(x5860)))+(((IkReal(-1.00000000000000))*(sj5)*(x5839)*(x5857)))+(((x5845)*(x5858)))+(((IkReal(-1.00000000000000))*(x5840)*(x5849)*(x5857)))+(((IkReal(-1.00000000000000))*(r10)*(x5840)*(x5858)))+(((IkReal(-1.00000000000000))*(x5847)*(x5848)*(x5857)))+(((cj3)*(sj2)))+(((IkReal(-1.00000000000000))*(x5846)*(x5860))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x5852)*(x5858)))+(((IkReal(-1.00000000000000))*(x5840)*(x5855)*(x5858)))+(((IkReal(-1.00000000000000))*(x5847)*(x5848)*(x5860)))+(((IkReal(-1.00000000000000))*(x5840)*(x5849)*(x5860)))+(((IkReal(-1.00000000000000))*(sj0)*(x5839)*(x5856)))+(((x5853)*(x5859)))+(((IkReal(-1.00000000000000))*(x5838)*(x5847)*(x5858)))+(((x5850)*(x5857)))+(((IkReal(-1.00000000000000))*(x5845)*(x5859)))+(((sj1)*(sj2)))+(((IkReal(-1.00000000000000))*(x5846)*(x5857))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x5840)*(x5855)*(x5857)))+(((IkReal(-1.00000000000000))*(x5852)*(x5857)))+(((IkReal(-1.00000000000000))*(x5838)*(x5847)*(x5857)))+(((IkReal(-1.00000000000000))*(r10)*(x5840)*(x5860)))+(((IkReal(-1.00000000000000))*(x5847)*(x5848)*(x5859)))+(((x5845)*(x5860)))+(((IkReal(-1.00000000000000))*(x5840)*(x5849)*(x5859)))+(((IkReal(-1.00000000000000))*(r00)*(x5840)*(x5858)))+(((x5846)*(x5858)))+(((IkReal(-1.00000000000000))*(x5843)*(x5844)))+(((IkReal(-1.00000000000000))*(sj3)*(x5842)))+(((IkReal(-1.00000000000000))*(sj5)*(x5839)*(x5859))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -18391,8 +18356,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -18436,7 +18400,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -18471,7 +18435,7 @@ IkReal x5889=((r11)*(sj6)*(x5877));
 evalcond[0]=((((cj6)*(r21)*(x5885)))+(((r22)*(x5883)))+(((IkReal(-1.00000000000000))*(cj1)*(sj2)))+(((r20)*(sj6)*(x5885)))+(((r21)*(sj6)*(x5877)))+(((IkReal(-1.00000000000000))*(r20)*(x5886))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(cj6)*(r11)*(x5880)*(x5885)))+(((IkReal(-1.00000000000000))*(x5880)*(x5889)))+(((r02)*(sj0)*(x5883)))+(((IkReal(-1.00000000000000))*(r00)*(x5881)*(x5886)))+(((IkReal(-1.00000000000000))*(r12)*(x5880)*(x5883)))+(((IkReal(-1.00000000000000))*(x5880)*(x5882)*(x5885)))+(cj2)+(((x5878)*(x5887)))+(((x5879)*(x5887)))+(((sj0)*(x5888)))+(((cj0)*(r10)*(x5886))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x5878)*(x5880)*(x5885)))+(((IkReal(-1.00000000000000))*(x5880)*(x5888)))+(((IkReal(-1.00000000000000))*(x5879)*(x5880)*(x5885)))+(((IkReal(-1.00000000000000))*(x5881)*(x5882)*(x5885)))+(((r10)*(sj0)*(x5886)))+(((cj0)*(r00)*(x5886)))+(((IkReal(-1.00000000000000))*(x5881)*(x5889)))+(((IkReal(-1.00000000000000))*(r02)*(x5880)*(x5883)))+(((sj1)*(sj2)))+(((IkReal(-1.00000000000000))*(r12)*(x5881)*(x5883)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x5881)*(x5885))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -18590,7 +18554,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -18633,14 +18597,14 @@ evalcond[0]=((((sj5)*(x5950)))+(((IkReal(-1.00000000000000))*(x5957)))+(((IkReal
 evalcond[1]=((((r20)*(x5946)))+(((IkReal(-1.00000000000000))*(sj1)*(x5954)))+(((cj4)*(r22)*(sj5)))+(x5952)+(((x5948)*(x5950)))+(((x5948)*(x5949)))+(((IkReal(-1.00000000000000))*(r21)*(x5947))));
 evalcond[2]=((((sj1)*(x5938)))+(((r12)*(x5945)))+(((IkReal(-1.00000000000000))*(x5940)*(x5944)))+(((IkReal(-1.00000000000000))*(x5942)*(x5953)))+(((r02)*(x5941)))+(((IkReal(-1.00000000000000))*(x5943)*(x5953)))+(((IkReal(-1.00000000000000))*(x5952)))+(((IkReal(-1.00000000000000))*(x5940)*(x5951))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r12)*(x5939)*(x5940)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x5939)))+(((r11)*(sj0)*(x5947)))+(((cj0)*(r01)*(x5947)))+(((IkReal(-1.00000000000000))*(x5957)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x5946)))+(((IkReal(-1.00000000000000))*(x5939)*(x5945)*(x5951)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x5946)))+(((IkReal(-1.00000000000000))*(x5939)*(x5941)*(x5943)))+(((IkReal(-1.00000000000000))*(x5939)*(x5941)*(x5942)))+(((IkReal(-1.00000000000000))*(x5939)*(x5944)*(x5945))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -18676,8 +18640,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -18714,7 +18677,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -18757,14 +18720,14 @@ evalcond[0]=((((sj5)*(x5980)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((sj
 evalcond[1]=((((IkReal(-1.00000000000000))*(r21)*(x5978)))+(((IkReal(-1.00000000000000))*(sj1)*(x5985)))+(x5983)+(((x5979)*(x5980)))+(((cj4)*(r22)*(sj5)))+(((r20)*(x5977)))+(((x5979)*(x5981))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x5983)))+(((IkReal(-1.00000000000000))*(x5973)*(x5984)))+(((IkReal(-1.00000000000000))*(x5971)*(x5975)))+(((IkReal(-1.00000000000000))*(x5971)*(x5982)))+(((r12)*(x5976)))+(((IkReal(-1.00000000000000))*(x5974)*(x5984)))+(((sj1)*(x5969)))+(((r02)*(x5972))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x5970)*(x5972)*(x5974)))+(((r11)*(sj0)*(x5978)))+(((IkReal(-1.00000000000000))*(r12)*(x5970)*(x5971)))+(((cj0)*(r01)*(x5978)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x5977)))+(((IkReal(-1.00000000000000))*(x5970)*(x5976)*(x5982)))+(((IkReal(-1.00000000000000))*(x5970)*(x5972)*(x5973)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x5970)))+(((IkReal(-1.00000000000000))*(x5988)))+(((IkReal(-1.00000000000000))*(x5970)*(x5975)*(x5976)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x5977))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -18800,8 +18763,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -18904,7 +18866,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -18947,14 +18909,14 @@ evalcond[0]=((((sj5)*(x6049)))+(((IkReal(-1.00000000000000))*(sj1)*(x6053)))+(((
 evalcond[1]=((((x6047)*(x6048)))+(((IkReal(-1.00000000000000))*(r21)*(x6046)))+(((cj4)*(r22)*(sj5)))+(((r20)*(x6045)))+(((x6047)*(x6049)))+(((IkReal(-1.00000000000000))*(x6056))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x6039)*(x6043)))+(((IkReal(-1.00000000000000))*(x6042)*(x6052)))+(((r02)*(x6040)))+(((IkReal(-1.00000000000000))*(x6041)*(x6052)))+(((IkReal(-1.00000000000000))*(x6039)*(x6050)))+(((IkReal(-1.00000000000000))*(x6056)))+(((r12)*(x6044))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r12)*(x6038)*(x6039)))+(((IkReal(-1.00000000000000))*(x6038)*(x6040)*(x6042)))+(((IkReal(-1.00000000000000))*(x6051)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x6045)))+(((sj1)*(x6037)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x6045)))+(((IkReal(-1.00000000000000))*(x6038)*(x6043)*(x6044)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x6038)))+(((IkReal(-1.00000000000000))*(x6038)*(x6040)*(x6041)))+(((IkReal(-1.00000000000000))*(x6038)*(x6044)*(x6050)))+(((r11)*(sj0)*(x6046)))+(((cj0)*(r01)*(x6046))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -18990,8 +18952,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -19028,7 +18989,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -19071,14 +19032,14 @@ evalcond[0]=((((sj5)*(x6080)))+(((IkReal(-1.00000000000000))*(sj1)*(x6084)))+(((
 evalcond[1]=((((x6078)*(x6080)))+(((IkReal(-1.00000000000000))*(r21)*(x6077)))+(((cj4)*(r22)*(sj5)))+(((IkReal(-1.00000000000000))*(x6087)))+(((x6078)*(x6079)))+(((r20)*(x6076))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x6070)*(x6074)))+(((IkReal(-1.00000000000000))*(x6072)*(x6083)))+(((IkReal(-1.00000000000000))*(x6073)*(x6083)))+(((r12)*(x6075)))+(((r02)*(x6071)))+(((IkReal(-1.00000000000000))*(x6087)))+(((IkReal(-1.00000000000000))*(x6070)*(x6081))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x6069)*(x6071)*(x6073)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x6076)))+(((sj1)*(x6068)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x6069)))+(((IkReal(-1.00000000000000))*(r12)*(x6069)*(x6070)))+(((IkReal(-1.00000000000000))*(x6069)*(x6075)*(x6081)))+(((IkReal(-1.00000000000000))*(x6069)*(x6074)*(x6075)))+(((r11)*(sj0)*(x6077)))+(((IkReal(-1.00000000000000))*(x6069)*(x6071)*(x6072)))+(((cj0)*(r01)*(x6077)))+(((IkReal(-1.00000000000000))*(x6082)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x6076))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -19114,8 +19075,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -19242,7 +19202,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -19280,14 +19240,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x6163)))+(((sj5)*(x6160)))+(((IkReal
 evalcond[1]=((((x6159)*(x6160)))+(((cj4)*(r22)*(sj5)))+(((r20)*(x6157)))+(((IkReal(-1.00000000000000))*(r21)*(x6158)))+(x6149)+(((x6159)*(x6161))));
 evalcond[2]=((((r02)*(x6152)))+(((r12)*(x6156)))+(((IkReal(-1.00000000000000))*(x6151)*(x6155)))+(((IkReal(-1.00000000000000))*(x6154)*(x6164)))+(((IkReal(-1.00000000000000))*(x6153)*(x6164)))+(((IkReal(-1.00000000000000))*(x6149)))+(((IkReal(-1.00000000000000))*(x6151)*(x6162))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x6150)*(x6155)*(x6156)))+(((IkReal(-1.00000000000000))*(x6163)))+(((cj0)*(r01)*(x6158)))+(((r11)*(sj0)*(x6158)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x6157)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x6150)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x6157)))+(((IkReal(-1.00000000000000))*(x6150)*(x6156)*(x6162)))+(((IkReal(-1.00000000000000))*(x6150)*(x6152)*(x6154)))+(((IkReal(-1.00000000000000))*(r12)*(x6150)*(x6151)))+(((IkReal(-1.00000000000000))*(x6150)*(x6152)*(x6153))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -19323,8 +19283,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -19395,7 +19354,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -19433,14 +19392,14 @@ evalcond[0]=((((sj5)*(x6213)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(x620
 evalcond[1]=((((x6212)*(x6214)))+(((cj4)*(r22)*(sj5)))+(((x6212)*(x6213)))+(((IkReal(-1.00000000000000))*(r21)*(x6211)))+(((IkReal(-1.00000000000000))*(x6216)))+(((r20)*(x6210))));
 evalcond[2]=((((r02)*(x6205)))+(((IkReal(-1.00000000000000))*(x6204)*(x6208)))+(((IkReal(-1.00000000000000))*(x6207)*(x6217)))+(((IkReal(-1.00000000000000))*(x6206)*(x6217)))+(((r12)*(x6209)))+(((IkReal(-1.00000000000000))*(x6216)))+(((IkReal(-1.00000000000000))*(x6204)*(x6215))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r10)*(sj0)*(x6210)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x6203)))+(((r11)*(sj0)*(x6211)))+(((IkReal(-1.00000000000000))*(x6203)*(x6205)*(x6207)))+(((IkReal(-1.00000000000000))*(x6203)*(x6205)*(x6206)))+(((IkReal(-1.00000000000000))*(x6203)*(x6208)*(x6209)))+(((IkReal(-1.00000000000000))*(x6203)*(x6209)*(x6215)))+(((IkReal(-1.00000000000000))*(x6202)))+(((IkReal(-1.00000000000000))*(r12)*(x6203)*(x6204)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x6210)))+(((cj0)*(r01)*(x6211))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -19476,8 +19435,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -19546,7 +19504,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -19585,14 +19543,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x6261)*(x6263)))+(((IkReal(-1.000000
 evalcond[1]=((((r12)*(x6260)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x6263)))+(((r02)*(x6259)))+(((IkReal(-1.00000000000000))*(x6253)))+(((IkReal(-1.00000000000000))*(x6254)*(x6262)))+(((IkReal(-1.00000000000000))*(x6255)*(x6263)))+(((IkReal(-1.00000000000000))*(x6254)*(x6261))));
 evalcond[2]=((((r11)*(x6268)))+(x6253)+(((IkReal(-1.00000000000000))*(r01)*(x6269)))+(((cj4)*(r02)*(x6254)))+(((IkReal(-1.00000000000000))*(r12)*(x6257)*(x6263)))+(((x6256)*(x6266)))+(((cj4)*(x6255)*(x6260)))+(((IkReal(-1.00000000000000))*(x6264)*(x6267)))+(((x6256)*(x6258)))+(((IkReal(-1.00000000000000))*(x6257)*(x6259)*(x6261)))+(((IkReal(-1.00000000000000))*(x6257)*(x6259)*(x6262))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(cj6)*(r01)*(x6257)*(x6259)))+(((IkReal(-1.00000000000000))*(x6257)*(x6260)*(x6262)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x6256)*(x6257)))+(((IkReal(-1.00000000000000))*(x6256)*(x6264)))+(((IkReal(-1.00000000000000))*(x6258)*(x6267)))+(((r01)*(x6268)))+(((IkReal(-1.00000000000000))*(x6265)))+(((IkReal(-1.00000000000000))*(r02)*(x6257)*(x6263)))+(((IkReal(-1.00000000000000))*(r12)*(x6254)*(x6257)))+(((r11)*(x6269)))+(((IkReal(-1.00000000000000))*(x6255)*(x6257)*(x6259))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -19628,8 +19586,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -19697,7 +19654,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -19736,14 +19693,14 @@ evalcond[0]=((((x6305)*(x6311)))+(x6304)+(((IkReal(-1.00000000000000))*(x6313)*(
 evalcond[1]=((((IkReal(-1.00000000000000))*(x6311)*(x6313)))+(((IkReal(-1.00000000000000))*(x6317)))+(((IkReal(-1.00000000000000))*(x6305)*(x6315)))+(((IkReal(-1.00000000000000))*(x6306)*(x6313)))+(((IkReal(-1.00000000000000))*(x6305)*(x6314)))+(((r02)*(x6310)))+(((r12)*(x6312))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r01)*(x6319)))+(((cj4)*(cj5)*(r01)*(x6308)))+(((cj4)*(r02)*(x6305)))+(((IkReal(-1.00000000000000))*(x6317)))+(((IkReal(-1.00000000000000))*(x6307)*(x6310)*(x6315)))+(((IkReal(-1.00000000000000))*(x6316)*(x6320)))+(((IkReal(-1.00000000000000))*(x6307)*(x6310)*(x6314)))+(((IkReal(-1.00000000000000))*(r12)*(x6307)*(x6313)))+(((x6308)*(x6309)))+(((cj4)*(x6306)*(x6312)))+(((r11)*(x6318))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x6309)*(x6320)))+(((r11)*(x6319)))+(((IkReal(-1.00000000000000))*(x6307)*(x6310)*(x6311)))+(((IkReal(-1.00000000000000))*(x6304)))+(((IkReal(-1.00000000000000))*(x6307)*(x6312)*(x6315)))+(((IkReal(-1.00000000000000))*(r12)*(x6305)*(x6307)))+(((IkReal(-1.00000000000000))*(x6308)*(x6316)))+(((IkReal(-1.00000000000000))*(r02)*(x6307)*(x6313)))+(((r01)*(x6318)))+(((IkReal(-1.00000000000000))*(x6306)*(x6307)*(x6310)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x6307)*(x6308))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -19779,8 +19736,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -19826,7 +19782,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -19869,14 +19825,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x6338)*(x6343)))+(((r12)*(x6335)))+(
 evalcond[3]=((((r02)*(x6335)))+(((IkReal(-1.00000000000000))*(x6331)*(x6343)))+(((IkReal(-1.00000000000000))*(x6332)*(x6338)))+(((IkReal(-1.00000000000000))*(x6334)*(x6338)))+(((r12)*(x6336)))+(((IkReal(-1.00000000000000))*(x6330)))+(((IkReal(-1.00000000000000))*(x6331)*(x6337))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r10)*(x6339)*(x6344)))+(((cj4)*(x6334)*(x6336)))+(((cj4)*(r02)*(x6331)))+(((IkReal(-1.00000000000000))*(x6333)*(x6335)*(x6337)))+(((IkReal(-1.00000000000000))*(r01)*(x6347)))+(((r11)*(x6346)))+(((IkReal(-1.00000000000000))*(x6333)*(x6335)*(x6343)))+(((IkReal(-1.00000000000000))*(r12)*(x6333)*(x6338)))+(((cj4)*(x6332)*(x6336)))+(((r00)*(sj0)*(x6339)))+(((sj2)*(x6330))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x6333)*(x6336)*(x6337)))+(((IkReal(-1.00000000000000))*(x6332)*(x6333)*(x6335)))+(((IkReal(-1.00000000000000))*(r02)*(x6333)*(x6338)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x6339)))+(((IkReal(-1.00000000000000))*(r12)*(x6331)*(x6333)))+(((IkReal(-1.00000000000000))*(x6333)*(x6336)*(x6343)))+(((IkReal(-1.00000000000000))*(x6333)*(x6334)*(x6335)))+(((r11)*(x6347)))+(((r01)*(x6346)))+(((IkReal(-1.00000000000000))*(r00)*(x6339)*(x6344)))+(((IkReal(-1.00000000000000))*(x6345))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -19912,8 +19868,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -19942,7 +19897,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -19985,14 +19940,14 @@ evalcond[2]=((((x6352)*(x6353)))+(((IkReal(-1.00000000000000))*(sj2)*(x6366)))+(
 evalcond[3]=((((IkReal(-1.00000000000000))*(x6353)*(x6359)))+(((IkReal(-1.00000000000000))*(x6351)))+(((IkReal(-1.00000000000000))*(x6352)*(x6364)))+(((IkReal(-1.00000000000000))*(x6352)*(x6358)))+(((r02)*(x6356)))+(((r12)*(x6357)))+(((IkReal(-1.00000000000000))*(x6355)*(x6359))));
 evalcond[4]=((((cj4)*(r02)*(x6352)))+(((r11)*(x6367)))+(((sj2)*(x6351)))+(((cj4)*(x6353)*(x6357)))+(((IkReal(-1.00000000000000))*(r10)*(x6360)*(x6365)))+(((IkReal(-1.00000000000000))*(x6354)*(x6356)*(x6358)))+(((IkReal(-1.00000000000000))*(x6354)*(x6356)*(x6364)))+(((cj4)*(x6355)*(x6357)))+(((IkReal(-1.00000000000000))*(r12)*(x6354)*(x6359)))+(((IkReal(-1.00000000000000))*(r01)*(x6368)))+(((r00)*(sj0)*(x6360))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x6354)*(x6357)*(x6364)))+(((IkReal(-1.00000000000000))*(r12)*(x6352)*(x6354)))+(((r01)*(x6367)))+(((r11)*(x6368)))+(((IkReal(-1.00000000000000))*(x6366)))+(((IkReal(-1.00000000000000))*(x6354)*(x6355)*(x6356)))+(((IkReal(-1.00000000000000))*(r00)*(x6360)*(x6365)))+(((IkReal(-1.00000000000000))*(r02)*(x6354)*(x6359)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x6360)))+(((IkReal(-1.00000000000000))*(x6354)*(x6357)*(x6358)))+(((IkReal(-1.00000000000000))*(x6353)*(x6354)*(x6356))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -20028,8 +19983,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -20059,7 +20013,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -20102,14 +20056,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(sj2)*(x6388)))+(((x6374)*(x6377)))+(
 evalcond[3]=((((IkReal(-1.00000000000000))*(x6377)*(x6381)))+(((IkReal(-1.00000000000000))*(x6373)))+(((IkReal(-1.00000000000000))*(x6374)*(x6380)))+(((IkReal(-1.00000000000000))*(x6375)*(x6381)))+(((r12)*(x6379)))+(((IkReal(-1.00000000000000))*(x6374)*(x6386)))+(((r02)*(x6378))));
 evalcond[4]=((((sj2)*(x6373)))+(((IkReal(-1.00000000000000))*(r12)*(x6376)*(x6381)))+(((IkReal(-1.00000000000000))*(r10)*(x6382)*(x6387)))+(((r11)*(x6389)))+(((r00)*(sj0)*(x6382)))+(((IkReal(-1.00000000000000))*(r01)*(x6390)))+(((cj4)*(x6375)*(x6379)))+(((cj4)*(r02)*(x6374)))+(((IkReal(-1.00000000000000))*(x6376)*(x6378)*(x6386)))+(((cj4)*(x6377)*(x6379)))+(((IkReal(-1.00000000000000))*(x6376)*(x6378)*(x6380))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r02)*(x6376)*(x6381)))+(((IkReal(-1.00000000000000))*(r00)*(x6382)*(x6387)))+(((r11)*(x6390)))+(((IkReal(-1.00000000000000))*(x6376)*(x6377)*(x6378)))+(((r01)*(x6389)))+(((IkReal(-1.00000000000000))*(x6376)*(x6379)*(x6380)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x6382)))+(((IkReal(-1.00000000000000))*(x6375)*(x6376)*(x6378)))+(((IkReal(-1.00000000000000))*(r12)*(x6374)*(x6376)))+(((IkReal(-1.00000000000000))*(x6388)))+(((IkReal(-1.00000000000000))*(x6376)*(x6379)*(x6386))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -20145,8 +20099,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -20274,7 +20227,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -20312,14 +20265,14 @@ evalcond[0]=((((sj5)*(x6465)))+(((sj5)*(x6466)))+(((IkReal(-1.00000000000000))*(
 evalcond[1]=((((x6464)*(x6466)))+(((IkReal(-1.00000000000000))*(x6453)))+(((cj4)*(r22)*(sj5)))+(((r20)*(x6462)))+(((x6464)*(x6465)))+(((IkReal(-1.00000000000000))*(r21)*(x6463))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x6456)*(x6460)))+(((IkReal(-1.00000000000000))*(x6458)*(x6468)))+(((IkReal(-1.00000000000000))*(x6459)*(x6468)))+(((r12)*(x6461)))+(((r02)*(x6457)))+(((IkReal(-1.00000000000000))*(x6456)*(x6467)))+(x6453));
 evalcond[3]=((((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x6455)))+(((IkReal(-1.00000000000000))*(x6455)*(x6460)*(x6461)))+(((IkReal(-1.00000000000000))*(x6455)*(x6461)*(x6467)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x6462)))+(((IkReal(-1.00000000000000))*(x6455)*(x6457)*(x6458)))+(((r11)*(sj0)*(x6463)))+(((IkReal(-1.00000000000000))*(x6455)*(x6457)*(x6459)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x6462)))+(((cj0)*(r01)*(x6463)))+(x6454)+(((IkReal(-1.00000000000000))*(r12)*(x6455)*(x6456))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -20355,8 +20308,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -20427,7 +20379,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -20465,14 +20417,14 @@ evalcond[0]=((((sj5)*(x6518)))+(((IkReal(-1.00000000000000))*(x6507)))+(((IkReal
 evalcond[1]=((((IkReal(-1.00000000000000))*(r21)*(x6516)))+(((x6517)*(x6518)))+(((x6517)*(x6519)))+(((cj4)*(r22)*(sj5)))+(((r20)*(x6515)))+(x6506));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x6509)*(x6513)))+(((IkReal(-1.00000000000000))*(x6511)*(x6521)))+(((r02)*(x6510)))+(((IkReal(-1.00000000000000))*(x6509)*(x6520)))+(x6506)+(((r12)*(x6514)))+(((IkReal(-1.00000000000000))*(x6512)*(x6521))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x6508)*(x6510)*(x6511)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x6515)))+(((IkReal(-1.00000000000000))*(x6508)*(x6514)*(x6520)))+(((IkReal(-1.00000000000000))*(x6508)*(x6510)*(x6512)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x6515)))+(((cj0)*(r01)*(x6516)))+(((IkReal(-1.00000000000000))*(x6508)*(x6513)*(x6514)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x6508)))+(((r11)*(sj0)*(x6516)))+(((IkReal(-1.00000000000000))*(r12)*(x6508)*(x6509)))+(x6507));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -20508,8 +20460,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -20577,7 +20528,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -20616,14 +20567,14 @@ evalcond[0]=((((r12)*(x6563)))+(((IkReal(-1.00000000000000))*(r02)*(x6564)))+(((
 evalcond[1]=((((r12)*(x6564)))+(((IkReal(-1.00000000000000))*(x6559)*(x6567)))+(((r02)*(x6563)))+(((IkReal(-1.00000000000000))*(x6558)*(x6565)))+(((IkReal(-1.00000000000000))*(x6558)*(x6566)))+(x6556)+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x6567))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x6568)*(x6570)))+(((cj4)*(x6559)*(x6564)))+(((IkReal(-1.00000000000000))*(x6561)*(x6563)*(x6566)))+(((r11)*(x6571)))+(((x6560)*(x6562)))+(((IkReal(-1.00000000000000))*(r01)*(x6572)))+(((cj4)*(r02)*(x6558)))+(x6556)+(((IkReal(-1.00000000000000))*(r12)*(x6561)*(x6567)))+(((x6560)*(x6569)))+(((IkReal(-1.00000000000000))*(x6561)*(x6563)*(x6565))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(cj6)*(r01)*(x6561)*(x6563)))+(((IkReal(-1.00000000000000))*(x6560)*(x6568)))+(((r01)*(x6571)))+(((r11)*(x6572)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x6560)*(x6561)))+(x6557)+(((IkReal(-1.00000000000000))*(r02)*(x6561)*(x6567)))+(((IkReal(-1.00000000000000))*(x6562)*(x6570)))+(((IkReal(-1.00000000000000))*(x6559)*(x6561)*(x6563)))+(((IkReal(-1.00000000000000))*(r12)*(x6558)*(x6561)))+(((IkReal(-1.00000000000000))*(x6561)*(x6564)*(x6566))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -20659,8 +20610,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -20726,7 +20676,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -20765,14 +20715,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x6615)*(x6617)))+(x6606)+(((r12)*(x6
 evalcond[1]=((x6605)+(((IkReal(-1.00000000000000))*(x6613)*(x6615)))+(((r12)*(x6614)))+(((IkReal(-1.00000000000000))*(x6608)*(x6615)))+(((IkReal(-1.00000000000000))*(x6607)*(x6616)))+(((r02)*(x6612)))+(((IkReal(-1.00000000000000))*(x6607)*(x6617))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x6605)))+(((r11)*(x6619)))+(((cj4)*(r02)*(x6607)))+(((IkReal(-1.00000000000000))*(r12)*(x6609)*(x6615)))+(((IkReal(-1.00000000000000))*(r01)*(x6620)))+(((IkReal(-1.00000000000000))*(x6609)*(x6612)*(x6617)))+(((IkReal(-1.00000000000000))*(x6609)*(x6612)*(x6616)))+(((IkReal(-1.00000000000000))*(x6618)*(x6621)))+(((cj4)*(x6608)*(x6614)))+(((cj4)*(cj5)*(r01)*(x6610)))+(((x6610)*(x6611))));
 evalcond[3]=((x6606)+(((IkReal(-1.00000000000000))*(r02)*(x6609)*(x6615)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x6609)*(x6610)))+(((IkReal(-1.00000000000000))*(x6609)*(x6614)*(x6617)))+(((IkReal(-1.00000000000000))*(x6608)*(x6609)*(x6612)))+(((IkReal(-1.00000000000000))*(x6610)*(x6618)))+(((r01)*(x6619)))+(((IkReal(-1.00000000000000))*(x6609)*(x6612)*(x6613)))+(((IkReal(-1.00000000000000))*(x6611)*(x6621)))+(((r11)*(x6620)))+(((IkReal(-1.00000000000000))*(r12)*(x6607)*(x6609))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -20808,8 +20758,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -20854,7 +20803,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -20896,14 +20845,14 @@ evalcond[2]=((((x6631)*(x6632)))+(((r12)*(x6635)))+(((x6631)*(x6634)))+(((IkReal
 evalcond[3]=((((IkReal(-1.00000000000000))*(x6631)*(x6643)))+(x6630)+(((r02)*(x6635)))+(((r12)*(x6636)))+(((IkReal(-1.00000000000000))*(x6634)*(x6639)))+(((IkReal(-1.00000000000000))*(x6631)*(x6637)))+(((IkReal(-1.00000000000000))*(x6632)*(x6639))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r10)*(x6638)*(x6644)))+(((cj4)*(r02)*(x6631)))+(((sj2)*(x6630)))+(((cj4)*(x6632)*(x6636)))+(((IkReal(-1.00000000000000))*(x6633)*(x6635)*(x6643)))+(((IkReal(-1.00000000000000))*(r12)*(x6633)*(x6639)))+(((r11)*(x6645)))+(((IkReal(-1.00000000000000))*(r01)*(x6646)))+(((cj4)*(x6634)*(x6636)))+(((r00)*(sj0)*(x6638)))+(((IkReal(-1.00000000000000))*(x6633)*(x6635)*(x6637))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x6632)*(x6633)*(x6635)))+(((IkReal(-1.00000000000000))*(r12)*(x6631)*(x6633)))+(((r11)*(x6646)))+(x6629)+(((IkReal(-1.00000000000000))*(x6633)*(x6636)*(x6643)))+(((IkReal(-1.00000000000000))*(r00)*(x6638)*(x6644)))+(((IkReal(-1.00000000000000))*(x6633)*(x6634)*(x6635)))+(((IkReal(-1.00000000000000))*(x6633)*(x6636)*(x6637)))+(((IkReal(-1.00000000000000))*(r02)*(x6633)*(x6639)))+(((r01)*(x6645)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x6638))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -20939,8 +20888,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -20970,7 +20918,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -21012,14 +20960,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(r02)*(x6657)))+(((IkReal(-1.00000000
 evalcond[3]=((((r12)*(x6657)))+(((IkReal(-1.00000000000000))*(x6653)*(x6660)))+(((IkReal(-1.00000000000000))*(x6655)*(x6660)))+(((r02)*(x6656)))+(x6651)+(((IkReal(-1.00000000000000))*(x6652)*(x6664)))+(((IkReal(-1.00000000000000))*(x6652)*(x6658))));
 evalcond[4]=((((r11)*(x6666)))+(((IkReal(-1.00000000000000))*(r10)*(x6659)*(x6665)))+(((r00)*(sj0)*(x6659)))+(((cj4)*(x6653)*(x6657)))+(((IkReal(-1.00000000000000))*(x6654)*(x6656)*(x6658)))+(((cj4)*(r02)*(x6652)))+(((IkReal(-1.00000000000000))*(r12)*(x6654)*(x6660)))+(((sj2)*(x6651)))+(((IkReal(-1.00000000000000))*(r01)*(x6667)))+(((cj4)*(x6655)*(x6657)))+(((IkReal(-1.00000000000000))*(x6654)*(x6656)*(x6664))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x6654)*(x6657)*(x6664)))+(((IkReal(-1.00000000000000))*(x6653)*(x6654)*(x6656)))+(((IkReal(-1.00000000000000))*(r02)*(x6654)*(x6660)))+(((IkReal(-1.00000000000000))*(x6654)*(x6655)*(x6656)))+(((IkReal(-1.00000000000000))*(r12)*(x6652)*(x6654)))+(((IkReal(-1.00000000000000))*(r00)*(x6659)*(x6665)))+(x6650)+(((r11)*(x6667)))+(((r01)*(x6666)))+(((IkReal(-1.00000000000000))*(x6654)*(x6657)*(x6658)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x6659))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -21055,8 +21003,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -21086,7 +21033,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -21128,14 +21075,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(sj2)*(x6671)))+(((IkReal(-1.00000000
 evalcond[3]=((((IkReal(-1.00000000000000))*(x6673)*(x6679)))+(((IkReal(-1.00000000000000))*(x6673)*(x6685)))+(((r12)*(x6678)))+(((IkReal(-1.00000000000000))*(x6674)*(x6681)))+(((IkReal(-1.00000000000000))*(x6676)*(x6681)))+(x6672)+(((r02)*(x6677))));
 evalcond[4]=((((r00)*(sj0)*(x6680)))+(((IkReal(-1.00000000000000))*(r01)*(x6688)))+(((sj2)*(x6672)))+(((IkReal(-1.00000000000000))*(r10)*(x6680)*(x6686)))+(((cj4)*(x6674)*(x6678)))+(((IkReal(-1.00000000000000))*(r12)*(x6675)*(x6681)))+(((IkReal(-1.00000000000000))*(x6675)*(x6677)*(x6679)))+(((cj4)*(x6676)*(x6678)))+(((cj4)*(r02)*(x6673)))+(((IkReal(-1.00000000000000))*(x6675)*(x6677)*(x6685)))+(((r11)*(x6687))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x6675)*(x6678)*(x6679)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x6680)))+(((IkReal(-1.00000000000000))*(x6675)*(x6676)*(x6677)))+(((r11)*(x6688)))+(((IkReal(-1.00000000000000))*(r00)*(x6680)*(x6686)))+(((IkReal(-1.00000000000000))*(x6674)*(x6675)*(x6677)))+(((IkReal(-1.00000000000000))*(r02)*(x6675)*(x6681)))+(x6671)+(((IkReal(-1.00000000000000))*(x6675)*(x6678)*(x6685)))+(((IkReal(-1.00000000000000))*(r12)*(x6673)*(x6675)))+(((r01)*(x6687))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -21171,8 +21118,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -21293,7 +21239,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -21331,14 +21277,14 @@ evalcond[0]=((((r21)*(x6758)))+(((IkReal(-1.00000000000000))*(x6744)))+(((r20)*(
 evalcond[1]=((((cj5)*(r20)*(x6754)))+(((r22)*(x6756)))+(((cj5)*(r21)*(x6753)))+(((IkReal(-1.00000000000000))*(r21)*(x6751)))+(((r20)*(x6750)))+(((IkReal(-1.00000000000000))*(x6759))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r10)*(x6755)*(x6757)))+(((IkReal(-1.00000000000000))*(r02)*(x6748)))+(((r12)*(x6749)))+(((x6745)*(x6747)))+(((IkReal(-1.00000000000000))*(x6759)))+(((x6745)*(x6746)))+(((IkReal(-1.00000000000000))*(x6752)*(x6758))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r12)*(x6755)*(x6756)))+(((IkReal(-1.00000000000000))*(r10)*(x6750)*(x6755)))+(((cj4)*(x6747)*(x6748)))+(((IkReal(-1.00000000000000))*(r10)*(x6749)*(x6754)))+(((cj4)*(r02)*(x6745)))+(((r00)*(sj0)*(x6750)))+(((IkReal(-1.00000000000000))*(r11)*(x6749)*(x6753)))+(((cj4)*(x6746)*(x6748)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x6751)))+(x6744)+(((x6751)*(x6752))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -21374,8 +21320,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -21440,7 +21385,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -21478,14 +21423,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(cj5)*(r22)))+(x6792)+(((r21)*(x6806)
 evalcond[1]=((((cj5)*(r21)*(x6801)))+(((IkReal(-1.00000000000000))*(r21)*(x6799)))+(((r20)*(x6798)))+(((cj5)*(r20)*(x6802)))+(((r22)*(x6804)))+(x6791));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x6791)))+(((r12)*(x6797)))+(((x6793)*(x6794)))+(((IkReal(-1.00000000000000))*(x6800)*(x6806)))+(((IkReal(-1.00000000000000))*(r02)*(x6796)))+(((x6793)*(x6795)))+(((IkReal(-1.00000000000000))*(r10)*(x6803)*(x6805))));
 evalcond[3]=((((cj4)*(x6794)*(x6796)))+(((IkReal(-1.00000000000000))*(r10)*(x6797)*(x6802)))+(((cj4)*(x6795)*(x6796)))+(((x6799)*(x6800)))+(((IkReal(-1.00000000000000))*(r12)*(x6803)*(x6804)))+(((r00)*(sj0)*(x6798)))+(((cj4)*(r02)*(x6793)))+(x6792)+(((IkReal(-1.00000000000000))*(r11)*(x6797)*(x6801)))+(((IkReal(-1.00000000000000))*(r10)*(x6798)*(x6803)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x6799))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -21521,8 +21466,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -21566,7 +21510,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -21611,14 +21555,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(sj5)*(x6821)*(x6824)))+(((cj0)*(x682
 evalcond[3]=((((sj0)*(x6822)))+(((IkReal(-1.00000000000000))*(x6817)*(x6830)))+(((IkReal(-1.00000000000000))*(sj5)*(x6818)*(x6821)))+(((cj0)*(x6825)))+(((IkReal(-1.00000000000000))*(x6817)*(x6824)))+(((IkReal(-1.00000000000000))*(sj5)*(x6819)*(x6821)))+(((IkReal(-1.00000000000000))*(x6816)*(x6826))));
 evalcond[4]=((((x6817)*(x6832)))+(((IkReal(-1.00000000000000))*(x6820)*(x6821)*(x6830)))+(((sj0)*(x6819)*(x6820)))+(((IkReal(-1.00000000000000))*(r01)*(x6823)*(x6831)))+(((IkReal(-1.00000000000000))*(x6820)*(x6821)*(x6824)))+(((r00)*(sj0)*(x6827)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x6821)))+(((r11)*(x6835)))+(((sj0)*(x6818)*(x6820)))+(((IkReal(-1.00000000000000))*(r10)*(x6821)*(x6827)))+(x6816));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r10)*(x6823)*(x6827)))+(((IkReal(-1.00000000000000))*(x6819)*(x6820)*(x6821)))+(((IkReal(-1.00000000000000))*(sj5)*(x6821)*(x6832)))+(((IkReal(-1.00000000000000))*(x6817)*(x6833)))+(((IkReal(-1.00000000000000))*(x6820)*(x6823)*(x6824)))+(((IkReal(-1.00000000000000))*(x6818)*(x6820)*(x6821)))+(((IkReal(-1.00000000000000))*(x6815)*(x6826)))+(((r11)*(sj0)*(x6831)))+(((IkReal(-1.00000000000000))*(r00)*(x6821)*(x6827)))+(((r01)*(x6835)))+(((IkReal(-1.00000000000000))*(x6820)*(x6823)*(x6830))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -21654,8 +21598,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -21686,7 +21629,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -21731,14 +21674,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x6848)*(x6850)))+(((x6842)*(x6844)))
 evalcond[3]=((((IkReal(-1.00000000000000))*(x6842)*(x6849)))+(((IkReal(-1.00000000000000))*(sj5)*(x6843)*(x6846)))+(((IkReal(-1.00000000000000))*(x6841)*(x6851)))+(((IkReal(-1.00000000000000))*(x6842)*(x6855)))+(((cj0)*(x6850)))+(((IkReal(-1.00000000000000))*(sj5)*(x6844)*(x6846)))+(((sj0)*(x6847))));
 evalcond[4]=((((r11)*(x6860)))+(((r00)*(sj0)*(x6852)))+(((x6842)*(x6857)))+(x6841)+(((IkReal(-1.00000000000000))*(r10)*(x6846)*(x6852)))+(((IkReal(-1.00000000000000))*(r01)*(x6848)*(x6856)))+(((IkReal(-1.00000000000000))*(x6845)*(x6846)*(x6855)))+(((IkReal(-1.00000000000000))*(x6845)*(x6846)*(x6849)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x6846)))+(((sj0)*(x6843)*(x6845)))+(((sj0)*(x6844)*(x6845))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x6842)*(x6858)))+(((IkReal(-1.00000000000000))*(x6840)*(x6851)))+(((IkReal(-1.00000000000000))*(x6844)*(x6845)*(x6846)))+(((r01)*(x6860)))+(((IkReal(-1.00000000000000))*(x6845)*(x6848)*(x6849)))+(((IkReal(-1.00000000000000))*(x6845)*(x6848)*(x6855)))+(((IkReal(-1.00000000000000))*(sj5)*(x6846)*(x6857)))+(((IkReal(-1.00000000000000))*(r10)*(x6848)*(x6852)))+(((r11)*(sj0)*(x6856)))+(((IkReal(-1.00000000000000))*(r00)*(x6846)*(x6852)))+(((IkReal(-1.00000000000000))*(x6843)*(x6845)*(x6846))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -21774,8 +21717,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -21805,7 +21747,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -21850,14 +21792,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(sj5)*(x6870)*(x6879)))+(((x6866)*(x6
 evalcond[3]=((((IkReal(-1.00000000000000))*(x6866)*(x6873)))+(((cj0)*(x6874)))+(((IkReal(-1.00000000000000))*(x6866)*(x6879)))+(((IkReal(-1.00000000000000))*(sj5)*(x6868)*(x6870)))+(((IkReal(-1.00000000000000))*(x6865)*(x6875)))+(((IkReal(-1.00000000000000))*(sj5)*(x6867)*(x6870)))+(((sj0)*(x6871))));
 evalcond[4]=((((sj0)*(x6867)*(x6869)))+(((IkReal(-1.00000000000000))*(x6869)*(x6870)*(x6873)))+(((IkReal(-1.00000000000000))*(r10)*(x6870)*(x6876)))+(((r11)*(x6884)))+(((IkReal(-1.00000000000000))*(x6869)*(x6870)*(x6879)))+(x6865)+(((r00)*(sj0)*(x6876)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x6870)))+(((sj0)*(x6868)*(x6869)))+(((IkReal(-1.00000000000000))*(r01)*(x6872)*(x6880)))+(((x6866)*(x6881))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x6868)*(x6869)*(x6870)))+(((r01)*(x6884)))+(((IkReal(-1.00000000000000))*(sj5)*(x6870)*(x6881)))+(((IkReal(-1.00000000000000))*(x6866)*(x6882)))+(((r11)*(sj0)*(x6880)))+(((IkReal(-1.00000000000000))*(x6869)*(x6872)*(x6873)))+(((IkReal(-1.00000000000000))*(x6869)*(x6872)*(x6879)))+(((IkReal(-1.00000000000000))*(r10)*(x6872)*(x6876)))+(((IkReal(-1.00000000000000))*(x6864)*(x6875)))+(((IkReal(-1.00000000000000))*(r00)*(x6870)*(x6876)))+(((IkReal(-1.00000000000000))*(x6867)*(x6869)*(x6870))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -21893,8 +21835,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -22015,7 +21956,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -22053,14 +21994,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x6955)))+(((IkReal(-1.00000000000000
 evalcond[1]=((((IkReal(-1.00000000000000))*(x6940)))+(((r20)*(x6946)))+(((IkReal(-1.00000000000000))*(r21)*(x6947)))+(((r22)*(x6952)))+(((cj5)*(r20)*(x6950)))+(((cj5)*(r21)*(x6949))));
 evalcond[2]=((((x6941)*(x6942)))+(x6940)+(((x6941)*(x6943)))+(((r12)*(x6945)))+(((IkReal(-1.00000000000000))*(x6948)*(x6954)))+(((IkReal(-1.00000000000000))*(r02)*(x6944)))+(((IkReal(-1.00000000000000))*(r10)*(x6951)*(x6953))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x6955)))+(((cj4)*(x6942)*(x6944)))+(((IkReal(-1.00000000000000))*(r10)*(x6945)*(x6950)))+(((x6947)*(x6948)))+(((IkReal(-1.00000000000000))*(r10)*(x6946)*(x6951)))+(((r00)*(sj0)*(x6946)))+(((IkReal(-1.00000000000000))*(r12)*(x6951)*(x6952)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x6947)))+(((cj4)*(r02)*(x6941)))+(((IkReal(-1.00000000000000))*(r11)*(x6945)*(x6949)))+(((cj4)*(x6943)*(x6944))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -22096,8 +22037,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -22162,7 +22102,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -22200,14 +22140,14 @@ evalcond[0]=((((sj5)*(x7000)))+(x6988)+(((sj5)*(x6999)))+(((IkReal(-1.0000000000
 evalcond[1]=((((x6994)*(x6999)))+(((r20)*(x6995)))+(((IkReal(-1.00000000000000))*(r21)*(x6996)))+(((cj4)*(r22)*(sj5)))+(x6987)+(((x6994)*(x7000))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(cj6)*(sj5)*(x6997)))+(((IkReal(-1.00000000000000))*(r02)*(sj0)*(x6993)))+(((r12)*(x6992)))+(x6987)+(((IkReal(-1.00000000000000))*(x7001)*(x7002)))+(((x6989)*(x6990)))+(((x6989)*(x6991))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x6992)*(x6998)*(x7002)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x6996)))+(((x6996)*(x6997)))+(((cj4)*(r02)*(x6989)))+(((IkReal(-1.00000000000000))*(x6988)))+(((r00)*(sj0)*(x6995)))+(((IkReal(-1.00000000000000))*(cj0)*(r10)*(x6995)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x6992)*(x6998)))+(((sj0)*(x6990)*(x6994)))+(((IkReal(-1.00000000000000))*(r12)*(x6998)*(x7001)))+(((sj0)*(x6991)*(x6994))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -22243,8 +22183,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -22287,7 +22226,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -22331,14 +22270,14 @@ evalcond[2]=((((x7012)*(x7015)))+(((r12)*(x7016)))+(x7010)+(((x7012)*(x7013)))+(
 evalcond[3]=((((r12)*(x7017)))+(((IkReal(-1.00000000000000))*(x7015)*(x7019)))+(((IkReal(-1.00000000000000))*(x7012)*(x7018)))+(((r02)*(x7016)))+(((IkReal(-1.00000000000000))*(x7013)*(x7019)))+(((IkReal(-1.00000000000000))*(x7011)*(x7020)))+(((IkReal(-1.00000000000000))*(x7012)*(x7026))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r10)*(x7021)*(x7027)))+(((r00)*(sj0)*(x7021)))+(((cj4)*(x7015)*(x7017)))+(((IkReal(-1.00000000000000))*(r01)*(x7029)))+(((cj4)*(r02)*(x7012)))+(((cj4)*(x7013)*(x7017)))+(((IkReal(-1.00000000000000))*(x7011)))+(((IkReal(-1.00000000000000))*(x7014)*(x7016)*(x7026)))+(((IkReal(-1.00000000000000))*(x7014)*(x7016)*(x7018)))+(((r11)*(x7028)))+(((IkReal(-1.00000000000000))*(r12)*(x7014)*(x7019))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x7014)*(x7017)*(x7026)))+(((IkReal(-1.00000000000000))*(x7013)*(x7014)*(x7016)))+(((IkReal(-1.00000000000000))*(r02)*(x7014)*(x7019)))+(((IkReal(-1.00000000000000))*(x7014)*(x7017)*(x7018)))+(((IkReal(-1.00000000000000))*(x7014)*(x7015)*(x7016)))+(((r01)*(x7028)))+(((IkReal(-1.00000000000000))*(r00)*(x7021)*(x7027)))+(((IkReal(-1.00000000000000))*(x7010)*(x7020)))+(((IkReal(-1.00000000000000))*(r12)*(x7012)*(x7014)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x7021)))+(((r11)*(x7029))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -22374,8 +22313,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -22406,7 +22344,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -22450,14 +22388,14 @@ evalcond[2]=((((x7036)*(x7037)))+(((IkReal(-1.00000000000000))*(x7043)*(x7050)))
 evalcond[3]=((((IkReal(-1.00000000000000))*(x7039)*(x7043)))+(((IkReal(-1.00000000000000))*(x7037)*(x7043)))+(((IkReal(-1.00000000000000))*(x7035)*(x7044)))+(((IkReal(-1.00000000000000))*(x7036)*(x7042)))+(((IkReal(-1.00000000000000))*(x7036)*(x7050)))+(((r12)*(x7041)))+(((r02)*(x7040))));
 evalcond[4]=((((cj4)*(r02)*(x7036)))+(((IkReal(-1.00000000000000))*(r10)*(x7045)*(x7051)))+(((cj4)*(x7039)*(x7041)))+(((r11)*(x7052)))+(((IkReal(-1.00000000000000))*(x7038)*(x7040)*(x7042)))+(((IkReal(-1.00000000000000))*(x7038)*(x7040)*(x7050)))+(((IkReal(-1.00000000000000))*(x7035)))+(((IkReal(-1.00000000000000))*(r01)*(x7053)))+(((r00)*(sj0)*(x7045)))+(((cj4)*(x7037)*(x7041)))+(((IkReal(-1.00000000000000))*(r12)*(x7038)*(x7043))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r12)*(x7036)*(x7038)))+(((IkReal(-1.00000000000000))*(x7034)*(x7044)))+(((IkReal(-1.00000000000000))*(x7038)*(x7041)*(x7042)))+(((IkReal(-1.00000000000000))*(x7038)*(x7039)*(x7040)))+(((IkReal(-1.00000000000000))*(x7038)*(x7041)*(x7050)))+(((r01)*(x7052)))+(((IkReal(-1.00000000000000))*(r00)*(x7045)*(x7051)))+(((r11)*(x7053)))+(((IkReal(-1.00000000000000))*(x7037)*(x7038)*(x7040)))+(((IkReal(-1.00000000000000))*(r02)*(x7038)*(x7043)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x7045))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -22493,8 +22431,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -22524,7 +22461,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -22568,14 +22505,14 @@ evalcond[2]=((((x7059)*(x7062)))+(((x7059)*(x7060)))+(((r12)*(x7063)))+(x7057)+(
 evalcond[3]=((((IkReal(-1.00000000000000))*(x7060)*(x7066)))+(((IkReal(-1.00000000000000))*(x7059)*(x7073)))+(((r12)*(x7064)))+(((IkReal(-1.00000000000000))*(x7059)*(x7065)))+(((IkReal(-1.00000000000000))*(x7058)*(x7067)))+(((r02)*(x7063)))+(((IkReal(-1.00000000000000))*(x7062)*(x7066))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r12)*(x7061)*(x7066)))+(((IkReal(-1.00000000000000))*(x7061)*(x7063)*(x7065)))+(((r00)*(sj0)*(x7068)))+(((r11)*(x7075)))+(((IkReal(-1.00000000000000))*(x7058)))+(((cj4)*(x7062)*(x7064)))+(((IkReal(-1.00000000000000))*(x7061)*(x7063)*(x7073)))+(((IkReal(-1.00000000000000))*(r10)*(x7068)*(x7074)))+(((cj4)*(r02)*(x7059)))+(((IkReal(-1.00000000000000))*(r01)*(x7076)))+(((cj4)*(x7060)*(x7064))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x7061)*(x7062)*(x7063)))+(((IkReal(-1.00000000000000))*(r02)*(x7061)*(x7066)))+(((IkReal(-1.00000000000000))*(x7060)*(x7061)*(x7063)))+(((IkReal(-1.00000000000000))*(x7061)*(x7064)*(x7073)))+(((r01)*(x7075)))+(((IkReal(-1.00000000000000))*(r00)*(x7068)*(x7074)))+(((IkReal(-1.00000000000000))*(r12)*(x7059)*(x7061)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x7068)))+(((IkReal(-1.00000000000000))*(x7057)*(x7067)))+(((IkReal(-1.00000000000000))*(x7061)*(x7064)*(x7065)))+(((r11)*(x7076))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -22611,8 +22548,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -22667,7 +22603,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -22714,14 +22650,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x7096)*(x7105)))+(((r12)*(x7094)))+(
 evalcond[3]=((((IkReal(-1.00000000000000))*(x7088)*(x7098)))+(((IkReal(-1.00000000000000))*(x7090)*(x7096)))+(((r12)*(x7095)))+(((sj1)*(x7108)))+(((IkReal(-1.00000000000000))*(x7091)*(x7105)))+(((IkReal(-1.00000000000000))*(x7090)*(x7102)))+(((r02)*(x7094)))+(((IkReal(-1.00000000000000))*(x7093)*(x7105))));
 evalcond[4]=((((cj4)*(r02)*(x7090)))+(((sj2)*(x7088)))+(((r11)*(x7107)))+(((r00)*(sj0)*(x7097)))+(((IkReal(-1.00000000000000))*(r10)*(x7097)*(x7104)))+(((cj4)*(x7093)*(x7095)))+(((IkReal(-1.00000000000000))*(x7092)*(x7094)*(x7096)))+(((cj4)*(x7091)*(x7095)))+(((IkReal(-1.00000000000000))*(x7092)*(x7094)*(x7102)))+(((IkReal(-1.00000000000000))*(r12)*(x7092)*(x7103)))+(((IkReal(-1.00000000000000))*(r01)*(x7109))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(cj2)*(x7110)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x7097)))+(((IkReal(-1.00000000000000))*(r00)*(x7097)*(x7104)))+(((IkReal(-1.00000000000000))*(x7089)*(x7098)))+(((IkReal(-1.00000000000000))*(x7092)*(x7095)*(x7102)))+(((IkReal(-1.00000000000000))*(x7091)*(x7092)*(x7094)))+(((IkReal(-1.00000000000000))*(x7092)*(x7095)*(x7096)))+(((IkReal(-1.00000000000000))*(r12)*(x7090)*(x7092)))+(((r11)*(x7109)))+(((r01)*(x7107)))+(((IkReal(-1.00000000000000))*(x7092)*(x7093)*(x7094)))+(((IkReal(-1.00000000000000))*(r02)*(x7092)*(x7103))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -22757,8 +22693,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -22801,7 +22736,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -22848,14 +22783,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x7141)*(x7144)))+(((IkReal(-1.000000
 evalcond[3]=((((IkReal(-1.00000000000000))*(x7129)*(x7135)))+(((IkReal(-1.00000000000000))*(x7127)*(x7137)))+(((IkReal(-1.00000000000000))*(x7129)*(x7141)))+(((IkReal(-1.00000000000000))*(x7132)*(x7144)))+(((IkReal(-1.00000000000000))*(x7130)*(x7144)))+(((sj1)*(x7147)))+(((r02)*(x7133)))+(((r12)*(x7134))));
 evalcond[4]=((((r11)*(x7146)))+(((cj4)*(x7132)*(x7134)))+(((IkReal(-1.00000000000000))*(r12)*(x7131)*(x7142)))+(((IkReal(-1.00000000000000))*(r10)*(x7136)*(x7143)))+(((r00)*(sj0)*(x7136)))+(((sj2)*(x7127)))+(((IkReal(-1.00000000000000))*(x7131)*(x7133)*(x7141)))+(((cj4)*(r02)*(x7129)))+(((IkReal(-1.00000000000000))*(r01)*(x7148)))+(((IkReal(-1.00000000000000))*(x7131)*(x7133)*(x7135)))+(((cj4)*(x7130)*(x7134))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(cj2)*(x7149)))+(((IkReal(-1.00000000000000))*(x7128)*(x7137)))+(((IkReal(-1.00000000000000))*(r00)*(x7136)*(x7143)))+(((r01)*(x7146)))+(((r11)*(x7148)))+(((IkReal(-1.00000000000000))*(x7131)*(x7134)*(x7141)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x7136)))+(((IkReal(-1.00000000000000))*(x7131)*(x7134)*(x7135)))+(((IkReal(-1.00000000000000))*(r12)*(x7129)*(x7131)))+(((IkReal(-1.00000000000000))*(x7130)*(x7131)*(x7133)))+(((IkReal(-1.00000000000000))*(r02)*(x7131)*(x7142)))+(((IkReal(-1.00000000000000))*(x7131)*(x7132)*(x7133))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -22891,8 +22826,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -22931,7 +22865,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -22978,14 +22912,14 @@ evalcond[2]=((((x7164)*(x7167)))+(((x7164)*(x7165)))+(((IkReal(-1.00000000000000
 evalcond[3]=((((IkReal(-1.00000000000000))*(x7165)*(x7179)))+(((r12)*(x7169)))+(((IkReal(-1.00000000000000))*(x7162)*(x7172)))+(((sj1)*(x7182)))+(((r02)*(x7168)))+(((IkReal(-1.00000000000000))*(x7164)*(x7170)))+(((IkReal(-1.00000000000000))*(x7164)*(x7176)))+(((IkReal(-1.00000000000000))*(x7167)*(x7179))));
 evalcond[4]=((((cj4)*(r02)*(x7164)))+(((IkReal(-1.00000000000000))*(x7166)*(x7168)*(x7176)))+(((IkReal(-1.00000000000000))*(r12)*(x7166)*(x7177)))+(((r00)*(sj0)*(x7171)))+(((IkReal(-1.00000000000000))*(r10)*(x7171)*(x7178)))+(((sj2)*(x7162)))+(((cj4)*(x7167)*(x7169)))+(((IkReal(-1.00000000000000))*(x7166)*(x7168)*(x7170)))+(((IkReal(-1.00000000000000))*(r01)*(x7183)))+(((cj4)*(x7165)*(x7169)))+(((r11)*(x7181))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r10)*(sj0)*(x7171)))+(((IkReal(-1.00000000000000))*(x7166)*(x7169)*(x7176)))+(((IkReal(-1.00000000000000))*(r02)*(x7166)*(x7177)))+(((IkReal(-1.00000000000000))*(r00)*(x7171)*(x7178)))+(((IkReal(-1.00000000000000))*(x7166)*(x7167)*(x7168)))+(((IkReal(-1.00000000000000))*(r12)*(x7164)*(x7166)))+(((IkReal(-1.00000000000000))*(x7165)*(x7166)*(x7168)))+(((r11)*(x7183)))+(((IkReal(-1.00000000000000))*(cj2)*(x7184)))+(((IkReal(-1.00000000000000))*(x7166)*(x7169)*(x7170)))+(((r01)*(x7181)))+(((IkReal(-1.00000000000000))*(x7163)*(x7172))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -23021,8 +22955,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -23063,7 +22996,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -23098,7 +23031,7 @@ IkReal x7206=((r11)*(sj6)*(x7194));
 evalcond[0]=((((IkReal(-1.00000000000000))*(r20)*(x7203)))+(((IkReal(-1.00000000000000))*(cj1)*(sj2)))+(((cj6)*(r21)*(x7202)))+(((r21)*(sj6)*(x7194)))+(((r22)*(x7200)))+(((r20)*(sj6)*(x7202))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x7197)*(x7199)*(x7202)))+(((sj0)*(x7205)))+(((IkReal(-1.00000000000000))*(x7197)*(x7206)))+(((IkReal(-1.00000000000000))*(r00)*(x7198)*(x7203)))+(((x7195)*(x7204)))+(((IkReal(-1.00000000000000))*(r12)*(x7197)*(x7200)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x7197)*(x7202)))+(((r02)*(sj0)*(x7200)))+(cj2)+(((x7196)*(x7204)))+(((cj0)*(r10)*(x7203))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x7196)*(x7197)*(x7202)))+(((IkReal(-1.00000000000000))*(x7195)*(x7197)*(x7202)))+(((IkReal(-1.00000000000000))*(r12)*(x7198)*(x7200)))+(((IkReal(-1.00000000000000))*(x7198)*(x7199)*(x7202)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x7198)*(x7202)))+(((IkReal(-1.00000000000000))*(r02)*(x7197)*(x7200)))+(((cj0)*(r00)*(x7203)))+(((IkReal(-1.00000000000000))*(x7198)*(x7206)))+(((r10)*(sj0)*(x7203)))+(((sj1)*(sj2)))+(((IkReal(-1.00000000000000))*(x7197)*(x7205))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -23217,7 +23150,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -23260,14 +23193,14 @@ evalcond[0]=((((sj5)*(x7267)))+(((sj5)*(x7266)))+(((IkReal(-1.00000000000000))*(
 evalcond[1]=((((x7265)*(x7266)))+(((IkReal(-1.00000000000000))*(sj1)*(x7271)))+(((cj4)*(r22)*(sj5)))+(((r20)*(x7263)))+(x7269)+(((x7265)*(x7267)))+(((IkReal(-1.00000000000000))*(r21)*(x7264))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x7269)))+(((sj1)*(x7255)))+(((r02)*(x7258)))+(((r12)*(x7262)))+(((IkReal(-1.00000000000000))*(x7259)*(x7270)))+(((IkReal(-1.00000000000000))*(x7260)*(x7270)))+(((IkReal(-1.00000000000000))*(x7257)*(x7268)))+(((IkReal(-1.00000000000000))*(x7257)*(x7261))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(cj0)*(r00)*(x7263)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x7263)))+(((IkReal(-1.00000000000000))*(x7256)*(x7261)*(x7262)))+(((IkReal(-1.00000000000000))*(x7256)*(x7258)*(x7259)))+(((IkReal(-1.00000000000000))*(x7256)*(x7262)*(x7268)))+(((IkReal(-1.00000000000000))*(x7274)))+(((cj0)*(r01)*(x7264)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x7256)))+(((IkReal(-1.00000000000000))*(x7256)*(x7258)*(x7260)))+(((IkReal(-1.00000000000000))*(r12)*(x7256)*(x7257)))+(((r11)*(sj0)*(x7264))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -23303,8 +23236,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -23341,7 +23273,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -23384,14 +23316,14 @@ evalcond[0]=((((sj5)*(x7298)))+(((sj5)*(x7297)))+(((IkReal(-1.00000000000000))*(
 evalcond[1]=((((IkReal(-1.00000000000000))*(sj1)*(x7302)))+(((IkReal(-1.00000000000000))*(r21)*(x7295)))+(((cj4)*(r22)*(sj5)))+(x7300)+(((x7296)*(x7297)))+(((r20)*(x7294)))+(((x7296)*(x7298))));
 evalcond[2]=((((sj1)*(x7286)))+(((IkReal(-1.00000000000000))*(x7288)*(x7292)))+(((IkReal(-1.00000000000000))*(x7290)*(x7301)))+(((r02)*(x7289)))+(((r12)*(x7293)))+(((IkReal(-1.00000000000000))*(x7300)))+(((IkReal(-1.00000000000000))*(x7291)*(x7301)))+(((IkReal(-1.00000000000000))*(x7288)*(x7299))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x7287)*(x7292)*(x7293)))+(((IkReal(-1.00000000000000))*(x7287)*(x7293)*(x7299)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x7294)))+(((IkReal(-1.00000000000000))*(x7287)*(x7289)*(x7290)))+(((IkReal(-1.00000000000000))*(r12)*(x7287)*(x7288)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x7294)))+(((cj0)*(r01)*(x7295)))+(((r11)*(sj0)*(x7295)))+(((IkReal(-1.00000000000000))*(x7305)))+(((IkReal(-1.00000000000000))*(x7287)*(x7289)*(x7291)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x7287))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -23427,8 +23359,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -23531,7 +23462,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -23574,14 +23505,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(sj1)*(x7370)))+(((IkReal(-1.00000000
 evalcond[1]=((((IkReal(-1.00000000000000))*(x7373)))+(((cj4)*(r22)*(sj5)))+(((r20)*(x7362)))+(((x7364)*(x7365)))+(((IkReal(-1.00000000000000))*(r21)*(x7363)))+(((x7364)*(x7366))));
 evalcond[2]=((((r12)*(x7361)))+(((IkReal(-1.00000000000000))*(x7356)*(x7367)))+(((IkReal(-1.00000000000000))*(x7373)))+(((IkReal(-1.00000000000000))*(x7359)*(x7369)))+(((IkReal(-1.00000000000000))*(x7358)*(x7369)))+(((r02)*(x7357)))+(((IkReal(-1.00000000000000))*(x7356)*(x7360))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x7355)*(x7357)*(x7358)))+(((r11)*(sj0)*(x7363)))+(((IkReal(-1.00000000000000))*(x7355)*(x7357)*(x7359)))+(((IkReal(-1.00000000000000))*(r12)*(x7355)*(x7356)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x7355)))+(((IkReal(-1.00000000000000))*(x7355)*(x7360)*(x7361)))+(((cj0)*(r01)*(x7363)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x7362)))+(((IkReal(-1.00000000000000))*(x7355)*(x7361)*(x7367)))+(((sj1)*(x7354)))+(((IkReal(-1.00000000000000))*(x7368)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x7362))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -23617,8 +23548,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -23655,7 +23585,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -23698,14 +23628,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(sj1)*(x7401)))+(((sj5)*(x7396)))+(((
 evalcond[1]=((((IkReal(-1.00000000000000))*(r21)*(x7394)))+(((x7395)*(x7396)))+(((r20)*(x7393)))+(((IkReal(-1.00000000000000))*(x7404)))+(((cj4)*(r22)*(sj5)))+(((x7395)*(x7397))));
 evalcond[2]=((((r02)*(x7388)))+(((IkReal(-1.00000000000000))*(x7404)))+(((r12)*(x7392)))+(((IkReal(-1.00000000000000))*(x7390)*(x7400)))+(((IkReal(-1.00000000000000))*(x7389)*(x7400)))+(((IkReal(-1.00000000000000))*(x7387)*(x7398)))+(((IkReal(-1.00000000000000))*(x7387)*(x7391))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x7386)*(x7391)*(x7392)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x7393)))+(((IkReal(-1.00000000000000))*(x7386)*(x7388)*(x7389)))+(((IkReal(-1.00000000000000))*(x7386)*(x7388)*(x7390)))+(((sj1)*(x7385)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x7386)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x7393)))+(((cj0)*(r01)*(x7394)))+(((r11)*(sj0)*(x7394)))+(((IkReal(-1.00000000000000))*(x7386)*(x7392)*(x7398)))+(((IkReal(-1.00000000000000))*(x7399)))+(((IkReal(-1.00000000000000))*(r12)*(x7386)*(x7387))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -23741,8 +23671,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -23869,7 +23798,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -23907,14 +23836,14 @@ evalcond[0]=((((sj5)*(x7477)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((sj
 evalcond[1]=((((x7476)*(x7477)))+(((x7476)*(x7478)))+(((IkReal(-1.00000000000000))*(r21)*(x7475)))+(((cj4)*(r22)*(sj5)))+(((r20)*(x7474)))+(x7466));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x7471)*(x7481)))+(((IkReal(-1.00000000000000))*(x7468)*(x7472)))+(((IkReal(-1.00000000000000))*(x7468)*(x7479)))+(((IkReal(-1.00000000000000))*(x7470)*(x7481)))+(((IkReal(-1.00000000000000))*(x7466)))+(((r12)*(x7473)))+(((r02)*(x7469))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r12)*(x7467)*(x7468)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x7467)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x7474)))+(((IkReal(-1.00000000000000))*(x7467)*(x7469)*(x7470)))+(((r11)*(sj0)*(x7475)))+(((IkReal(-1.00000000000000))*(x7467)*(x7472)*(x7473)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x7474)))+(((IkReal(-1.00000000000000))*(x7480)))+(((cj0)*(r01)*(x7475)))+(((IkReal(-1.00000000000000))*(x7467)*(x7473)*(x7479)))+(((IkReal(-1.00000000000000))*(x7467)*(x7469)*(x7471))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -23950,8 +23879,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -24022,7 +23950,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -24060,14 +23988,14 @@ evalcond[0]=((x7519)+(((sj5)*(x7530)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)
 evalcond[1]=((((r20)*(x7527)))+(((x7529)*(x7531)))+(((cj4)*(r22)*(sj5)))+(((IkReal(-1.00000000000000))*(r21)*(x7528)))+(((x7529)*(x7530)))+(((IkReal(-1.00000000000000))*(x7533))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x7521)*(x7532)))+(((IkReal(-1.00000000000000))*(x7524)*(x7534)))+(((r02)*(x7522)))+(((IkReal(-1.00000000000000))*(x7521)*(x7525)))+(((IkReal(-1.00000000000000))*(x7523)*(x7534)))+(((r12)*(x7526)))+(((IkReal(-1.00000000000000))*(x7533))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r12)*(x7520)*(x7521)))+(((IkReal(-1.00000000000000))*(x7520)*(x7526)*(x7532)))+(((IkReal(-1.00000000000000))*(x7519)))+(((IkReal(-1.00000000000000))*(x7520)*(x7522)*(x7523)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x7527)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x7527)))+(((r11)*(sj0)*(x7528)))+(((IkReal(-1.00000000000000))*(x7520)*(x7525)*(x7526)))+(((IkReal(-1.00000000000000))*(x7520)*(x7522)*(x7524)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x7520)))+(((cj0)*(r01)*(x7528))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -24103,8 +24031,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -24173,7 +24100,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -24212,14 +24139,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x7582)))+(((IkReal(-1.00000000000000
 evalcond[1]=((((IkReal(-1.00000000000000))*(cj6)*(r01)*(x7580)))+(((IkReal(-1.00000000000000))*(x7571)*(x7578)))+(((IkReal(-1.00000000000000))*(x7571)*(x7579)))+(((IkReal(-1.00000000000000))*(x7570)))+(((r12)*(x7577)))+(((r02)*(x7576)))+(((IkReal(-1.00000000000000))*(x7572)*(x7580))));
 evalcond[2]=((((cj4)*(r02)*(x7571)))+(((IkReal(-1.00000000000000))*(x7574)*(x7576)*(x7579)))+(((r11)*(x7585)))+(((IkReal(-1.00000000000000))*(x7581)*(x7584)))+(((IkReal(-1.00000000000000))*(x7574)*(x7576)*(x7578)))+(((IkReal(-1.00000000000000))*(r01)*(x7586)))+(((x7573)*(x7575)))+(((IkReal(-1.00000000000000))*(r12)*(x7574)*(x7580)))+(((x7573)*(x7583)))+(((cj4)*(x7572)*(x7577)))+(x7570));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r12)*(x7571)*(x7574)))+(((IkReal(-1.00000000000000))*(x7582)))+(((IkReal(-1.00000000000000))*(r02)*(x7574)*(x7580)))+(((IkReal(-1.00000000000000))*(x7574)*(x7577)*(x7579)))+(((IkReal(-1.00000000000000))*(x7572)*(x7574)*(x7576)))+(((r11)*(x7586)))+(((r01)*(x7585)))+(((IkReal(-1.00000000000000))*(x7573)*(x7581)))+(((IkReal(-1.00000000000000))*(x7575)*(x7584)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x7574)*(x7576)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x7573)*(x7574))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -24255,8 +24182,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -24324,7 +24250,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -24363,14 +24289,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(r02)*(x7629)))+(((x7622)*(x7628)))+(
 evalcond[1]=((((IkReal(-1.00000000000000))*(x7628)*(x7630)))+(((IkReal(-1.00000000000000))*(x7634)))+(((IkReal(-1.00000000000000))*(x7622)*(x7632)))+(((IkReal(-1.00000000000000))*(x7623)*(x7630)))+(((r12)*(x7629)))+(((IkReal(-1.00000000000000))*(x7622)*(x7631)))+(((r02)*(x7627))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x7624)*(x7627)*(x7632)))+(((IkReal(-1.00000000000000))*(x7624)*(x7627)*(x7631)))+(((cj4)*(r02)*(x7622)))+(((x7625)*(x7626)))+(((IkReal(-1.00000000000000))*(x7634)))+(((cj4)*(x7623)*(x7629)))+(((r11)*(x7635)))+(((IkReal(-1.00000000000000))*(r01)*(x7636)))+(((IkReal(-1.00000000000000))*(x7633)*(x7637)))+(((IkReal(-1.00000000000000))*(r12)*(x7624)*(x7630)))+(((cj4)*(cj5)*(r01)*(x7625))));
 evalcond[3]=((((r11)*(x7636)))+(((IkReal(-1.00000000000000))*(x7626)*(x7637)))+(((IkReal(-1.00000000000000))*(x7624)*(x7627)*(x7628)))+(((IkReal(-1.00000000000000))*(r02)*(x7624)*(x7630)))+(((IkReal(-1.00000000000000))*(x7625)*(x7633)))+(((r01)*(x7635)))+(((IkReal(-1.00000000000000))*(r12)*(x7622)*(x7624)))+(((IkReal(-1.00000000000000))*(x7624)*(x7629)*(x7632)))+(((IkReal(-1.00000000000000))*(x7621)))+(((IkReal(-1.00000000000000))*(x7623)*(x7624)*(x7627)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x7624)*(x7625))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -24406,8 +24332,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -24453,7 +24378,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -24496,14 +24421,14 @@ evalcond[2]=((((x7648)*(x7649)))+(((IkReal(-1.00000000000000))*(x7655)*(x7660)))
 evalcond[3]=((((IkReal(-1.00000000000000))*(x7647)))+(((IkReal(-1.00000000000000))*(x7648)*(x7654)))+(((IkReal(-1.00000000000000))*(x7648)*(x7660)))+(((r12)*(x7653)))+(((IkReal(-1.00000000000000))*(x7651)*(x7655)))+(((IkReal(-1.00000000000000))*(x7649)*(x7655)))+(((r02)*(x7652))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r12)*(x7650)*(x7655)))+(((r00)*(sj0)*(x7656)))+(((IkReal(-1.00000000000000))*(x7650)*(x7652)*(x7660)))+(((IkReal(-1.00000000000000))*(r01)*(x7664)))+(((cj4)*(r02)*(x7648)))+(((sj2)*(x7647)))+(((IkReal(-1.00000000000000))*(x7650)*(x7652)*(x7654)))+(((cj4)*(x7649)*(x7653)))+(((cj4)*(x7651)*(x7653)))+(((IkReal(-1.00000000000000))*(r10)*(x7656)*(x7661)))+(((r11)*(x7663))));
 evalcond[5]=((((r11)*(x7664)))+(((IkReal(-1.00000000000000))*(x7650)*(x7653)*(x7660)))+(((IkReal(-1.00000000000000))*(x7650)*(x7651)*(x7652)))+(((IkReal(-1.00000000000000))*(x7650)*(x7653)*(x7654)))+(((IkReal(-1.00000000000000))*(r12)*(x7648)*(x7650)))+(((r01)*(x7663)))+(((IkReal(-1.00000000000000))*(x7649)*(x7650)*(x7652)))+(((IkReal(-1.00000000000000))*(r02)*(x7650)*(x7655)))+(((IkReal(-1.00000000000000))*(x7662)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x7656)))+(((IkReal(-1.00000000000000))*(r00)*(x7656)*(x7661))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -24539,8 +24464,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -24569,7 +24493,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -24612,14 +24536,14 @@ evalcond[2]=((((x7669)*(x7672)))+(((IkReal(-1.00000000000000))*(x7675)*(x7676)))
 evalcond[3]=((((IkReal(-1.00000000000000))*(x7672)*(x7676)))+(((r12)*(x7674)))+(((IkReal(-1.00000000000000))*(x7670)*(x7676)))+(((IkReal(-1.00000000000000))*(x7669)*(x7681)))+(((IkReal(-1.00000000000000))*(x7669)*(x7675)))+(((IkReal(-1.00000000000000))*(x7668)))+(((r02)*(x7673))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x7671)*(x7673)*(x7681)))+(((IkReal(-1.00000000000000))*(r12)*(x7671)*(x7676)))+(((sj2)*(x7668)))+(((cj4)*(x7670)*(x7674)))+(((cj4)*(x7672)*(x7674)))+(((r00)*(sj0)*(x7677)))+(((IkReal(-1.00000000000000))*(r01)*(x7685)))+(((cj4)*(r02)*(x7669)))+(((r11)*(x7684)))+(((IkReal(-1.00000000000000))*(r10)*(x7677)*(x7682)))+(((IkReal(-1.00000000000000))*(x7671)*(x7673)*(x7675))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x7671)*(x7672)*(x7673)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x7677)))+(((IkReal(-1.00000000000000))*(x7683)))+(((IkReal(-1.00000000000000))*(x7671)*(x7674)*(x7681)))+(((IkReal(-1.00000000000000))*(r02)*(x7671)*(x7676)))+(((IkReal(-1.00000000000000))*(x7671)*(x7674)*(x7675)))+(((IkReal(-1.00000000000000))*(x7670)*(x7671)*(x7673)))+(((IkReal(-1.00000000000000))*(r12)*(x7669)*(x7671)))+(((r01)*(x7684)))+(((IkReal(-1.00000000000000))*(r00)*(x7677)*(x7682)))+(((r11)*(x7685))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -24655,8 +24579,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -24686,7 +24609,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -24729,14 +24652,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(sj2)*(x7705)))+(((x7691)*(x7694)))+(
 evalcond[3]=((((IkReal(-1.00000000000000))*(x7694)*(x7698)))+(((r12)*(x7696)))+(((IkReal(-1.00000000000000))*(x7691)*(x7703)))+(((IkReal(-1.00000000000000))*(x7690)))+(((r02)*(x7695)))+(((IkReal(-1.00000000000000))*(x7691)*(x7697)))+(((IkReal(-1.00000000000000))*(x7692)*(x7698))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r01)*(x7707)))+(((IkReal(-1.00000000000000))*(x7693)*(x7695)*(x7703)))+(((r00)*(sj0)*(x7699)))+(((IkReal(-1.00000000000000))*(r10)*(x7699)*(x7704)))+(((IkReal(-1.00000000000000))*(r12)*(x7693)*(x7698)))+(((sj2)*(x7690)))+(((cj4)*(x7694)*(x7696)))+(((r11)*(x7706)))+(((IkReal(-1.00000000000000))*(x7693)*(x7695)*(x7697)))+(((cj4)*(x7692)*(x7696)))+(((cj4)*(r02)*(x7691))));
 evalcond[5]=((((r01)*(x7706)))+(((r11)*(x7707)))+(((IkReal(-1.00000000000000))*(x7705)))+(((IkReal(-1.00000000000000))*(x7693)*(x7696)*(x7703)))+(((IkReal(-1.00000000000000))*(r00)*(x7699)*(x7704)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x7699)))+(((IkReal(-1.00000000000000))*(r02)*(x7693)*(x7698)))+(((IkReal(-1.00000000000000))*(x7693)*(x7696)*(x7697)))+(((IkReal(-1.00000000000000))*(r12)*(x7691)*(x7693)))+(((IkReal(-1.00000000000000))*(x7693)*(x7694)*(x7695)))+(((IkReal(-1.00000000000000))*(x7692)*(x7693)*(x7695))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -24772,8 +24695,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -24901,7 +24823,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -24939,14 +24861,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(cj5)*(r22)))+(x7771)+(((sj5)*(x7782)
 evalcond[1]=((((IkReal(-1.00000000000000))*(r21)*(x7780)))+(((x7781)*(x7782)))+(((cj4)*(r22)*(sj5)))+(((r20)*(x7779)))+(((IkReal(-1.00000000000000))*(x7770)))+(((x7781)*(x7783))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x7773)*(x7777)))+(((IkReal(-1.00000000000000))*(x7773)*(x7784)))+(((IkReal(-1.00000000000000))*(x7776)*(x7785)))+(((IkReal(-1.00000000000000))*(x7775)*(x7785)))+(x7770)+(((r12)*(x7778)))+(((r02)*(x7774))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x7772)*(x7778)*(x7784)))+(((IkReal(-1.00000000000000))*(x7772)*(x7774)*(x7776)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x7779)))+(((IkReal(-1.00000000000000))*(x7772)*(x7774)*(x7775)))+(((r11)*(sj0)*(x7780)))+(x7771)+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x7779)))+(((cj0)*(r01)*(x7780)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x7772)))+(((IkReal(-1.00000000000000))*(r12)*(x7772)*(x7773)))+(((IkReal(-1.00000000000000))*(x7772)*(x7777)*(x7778))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -24982,8 +24904,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -25054,7 +24975,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -25092,14 +25013,14 @@ evalcond[0]=((((sj5)*(x7836)))+(((sj5)*(x7835)))+(((IkReal(-1.00000000000000))*(
 evalcond[1]=((x7823)+(((cj4)*(r22)*(sj5)))+(((IkReal(-1.00000000000000))*(r21)*(x7833)))+(((x7834)*(x7836)))+(((x7834)*(x7835)))+(((r20)*(x7832))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x7829)*(x7838)))+(((IkReal(-1.00000000000000))*(x7828)*(x7838)))+(((IkReal(-1.00000000000000))*(x7826)*(x7830)))+(x7823)+(((IkReal(-1.00000000000000))*(x7826)*(x7837)))+(((r12)*(x7831)))+(((r02)*(x7827))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(cj0)*(r00)*(x7832)))+(((IkReal(-1.00000000000000))*(r12)*(x7825)*(x7826)))+(x7824)+(((r11)*(sj0)*(x7833)))+(((IkReal(-1.00000000000000))*(x7825)*(x7827)*(x7829)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x7825)))+(((IkReal(-1.00000000000000))*(x7825)*(x7831)*(x7837)))+(((IkReal(-1.00000000000000))*(x7825)*(x7827)*(x7828)))+(((cj0)*(r01)*(x7833)))+(((IkReal(-1.00000000000000))*(x7825)*(x7830)*(x7831)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x7832))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -25135,8 +25056,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -25204,7 +25124,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -25243,14 +25163,14 @@ evalcond[0]=((((x7875)*(x7876)))+(((r12)*(x7880)))+(((cj6)*(r01)*(x7875)))+(((Ik
 evalcond[1]=((((IkReal(-1.00000000000000))*(x7875)*(x7883)))+(((IkReal(-1.00000000000000))*(x7876)*(x7884)))+(((r02)*(x7880)))+(((r12)*(x7881)))+(((IkReal(-1.00000000000000))*(x7875)*(x7882)))+(x7873)+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x7884))));
 evalcond[2]=((((cj4)*(r02)*(x7875)))+(((IkReal(-1.00000000000000))*(x7885)*(x7887)))+(((r11)*(x7888)))+(((IkReal(-1.00000000000000))*(r01)*(x7889)))+(((IkReal(-1.00000000000000))*(r12)*(x7878)*(x7884)))+(((IkReal(-1.00000000000000))*(x7878)*(x7880)*(x7883)))+(x7873)+(((cj4)*(x7876)*(x7881)))+(((IkReal(-1.00000000000000))*(x7878)*(x7880)*(x7882)))+(((x7877)*(x7879)))+(((x7877)*(x7886))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x7877)*(x7885)))+(((r11)*(x7889)))+(((IkReal(-1.00000000000000))*(x7879)*(x7887)))+(((IkReal(-1.00000000000000))*(r12)*(x7875)*(x7878)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x7878)*(x7880)))+(x7874)+(((IkReal(-1.00000000000000))*(r02)*(x7878)*(x7884)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x7877)*(x7878)))+(((IkReal(-1.00000000000000))*(x7878)*(x7881)*(x7883)))+(((IkReal(-1.00000000000000))*(x7876)*(x7878)*(x7880)))+(((r01)*(x7888))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -25286,8 +25206,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -25353,7 +25272,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -25392,14 +25311,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(r02)*(x7931)))+(((x7924)*(x7930)))+(
 evalcond[1]=((((IkReal(-1.00000000000000))*(x7924)*(x7934)))+(((r02)*(x7929)))+(((r12)*(x7931)))+(((IkReal(-1.00000000000000))*(x7925)*(x7932)))+(((IkReal(-1.00000000000000))*(x7924)*(x7933)))+(((IkReal(-1.00000000000000))*(x7930)*(x7932)))+(x7922));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r12)*(x7926)*(x7932)))+(((IkReal(-1.00000000000000))*(x7926)*(x7929)*(x7933)))+(((cj4)*(r02)*(x7924)))+(((IkReal(-1.00000000000000))*(x7935)*(x7938)))+(((x7927)*(x7928)))+(((IkReal(-1.00000000000000))*(r01)*(x7937)))+(((cj4)*(x7925)*(x7931)))+(((IkReal(-1.00000000000000))*(x7922)))+(((r11)*(x7936)))+(((cj4)*(cj5)*(r01)*(x7927)))+(((IkReal(-1.00000000000000))*(x7926)*(x7929)*(x7934))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x7927)*(x7935)))+(((IkReal(-1.00000000000000))*(r12)*(x7924)*(x7926)))+(((r11)*(x7937)))+(((IkReal(-1.00000000000000))*(x7926)*(x7929)*(x7930)))+(((r01)*(x7936)))+(((IkReal(-1.00000000000000))*(r02)*(x7926)*(x7932)))+(((IkReal(-1.00000000000000))*(x7925)*(x7926)*(x7929)))+(x7923)+(((IkReal(-1.00000000000000))*(x7928)*(x7938)))+(((IkReal(-1.00000000000000))*(x7926)*(x7931)*(x7934)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x7926)*(x7927))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -25435,8 +25354,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -25481,7 +25399,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -25523,14 +25441,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x7956)*(x7960)))+(((x7948)*(x7951)))
 evalcond[3]=((((r12)*(x7953)))+(x7947)+(((IkReal(-1.00000000000000))*(x7951)*(x7956)))+(((IkReal(-1.00000000000000))*(x7949)*(x7956)))+(((r02)*(x7952)))+(((IkReal(-1.00000000000000))*(x7948)*(x7960)))+(((IkReal(-1.00000000000000))*(x7948)*(x7954))));
 evalcond[4]=((((cj4)*(r02)*(x7948)))+(((IkReal(-1.00000000000000))*(x7950)*(x7952)*(x7954)))+(((r00)*(sj0)*(x7955)))+(((IkReal(-1.00000000000000))*(r10)*(x7955)*(x7961)))+(((r11)*(x7962)))+(((sj2)*(x7947)))+(((IkReal(-1.00000000000000))*(r12)*(x7950)*(x7956)))+(((IkReal(-1.00000000000000))*(x7950)*(x7952)*(x7960)))+(((cj4)*(x7951)*(x7953)))+(((IkReal(-1.00000000000000))*(r01)*(x7963)))+(((cj4)*(x7949)*(x7953))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r00)*(x7955)*(x7961)))+(((r01)*(x7962)))+(x7946)+(((IkReal(-1.00000000000000))*(x7950)*(x7953)*(x7954)))+(((IkReal(-1.00000000000000))*(r02)*(x7950)*(x7956)))+(((IkReal(-1.00000000000000))*(x7950)*(x7953)*(x7960)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x7955)))+(((r11)*(x7963)))+(((IkReal(-1.00000000000000))*(x7949)*(x7950)*(x7952)))+(((IkReal(-1.00000000000000))*(r12)*(x7948)*(x7950)))+(((IkReal(-1.00000000000000))*(x7950)*(x7951)*(x7952))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -25566,8 +25484,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -25597,7 +25514,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -25639,14 +25556,14 @@ evalcond[2]=((((x7969)*(x7970)))+(((x7969)*(x7972)))+(((r12)*(x7973)))+(((IkReal
 evalcond[3]=((x7968)+(((r02)*(x7973)))+(((IkReal(-1.00000000000000))*(x7970)*(x7977)))+(((IkReal(-1.00000000000000))*(x7969)*(x7981)))+(((r12)*(x7974)))+(((IkReal(-1.00000000000000))*(x7972)*(x7977)))+(((IkReal(-1.00000000000000))*(x7969)*(x7975))));
 evalcond[4]=((((cj4)*(r02)*(x7969)))+(((r00)*(sj0)*(x7976)))+(((cj4)*(x7970)*(x7974)))+(((sj2)*(x7968)))+(((IkReal(-1.00000000000000))*(r12)*(x7971)*(x7977)))+(((IkReal(-1.00000000000000))*(r10)*(x7976)*(x7982)))+(((IkReal(-1.00000000000000))*(r01)*(x7984)))+(((IkReal(-1.00000000000000))*(x7971)*(x7973)*(x7975)))+(((IkReal(-1.00000000000000))*(x7971)*(x7973)*(x7981)))+(((cj4)*(x7972)*(x7974)))+(((r11)*(x7983))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r02)*(x7971)*(x7977)))+(x7967)+(((r01)*(x7983)))+(((r11)*(x7984)))+(((IkReal(-1.00000000000000))*(x7970)*(x7971)*(x7973)))+(((IkReal(-1.00000000000000))*(x7971)*(x7974)*(x7981)))+(((IkReal(-1.00000000000000))*(r00)*(x7976)*(x7982)))+(((IkReal(-1.00000000000000))*(x7971)*(x7974)*(x7975)))+(((IkReal(-1.00000000000000))*(x7971)*(x7972)*(x7973)))+(((IkReal(-1.00000000000000))*(r12)*(x7969)*(x7971)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x7976))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -25682,8 +25599,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -25713,7 +25629,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -25755,14 +25671,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x7998)*(x8002)))+(((IkReal(-1.000000
 evalcond[3]=((((IkReal(-1.00000000000000))*(x7991)*(x7998)))+(((IkReal(-1.00000000000000))*(x7990)*(x8002)))+(x7989)+(((IkReal(-1.00000000000000))*(x7990)*(x7996)))+(((IkReal(-1.00000000000000))*(x7993)*(x7998)))+(((r12)*(x7995)))+(((r02)*(x7994))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x7992)*(x7994)*(x7996)))+(((sj2)*(x7989)))+(((IkReal(-1.00000000000000))*(r10)*(x7997)*(x8003)))+(((IkReal(-1.00000000000000))*(x7992)*(x7994)*(x8002)))+(((r11)*(x8004)))+(((IkReal(-1.00000000000000))*(r01)*(x8005)))+(((cj4)*(r02)*(x7990)))+(((IkReal(-1.00000000000000))*(r12)*(x7992)*(x7998)))+(((cj4)*(x7991)*(x7995)))+(((r00)*(sj0)*(x7997)))+(((cj4)*(x7993)*(x7995))));
 evalcond[5]=((((r11)*(x8005)))+(((IkReal(-1.00000000000000))*(x7992)*(x7995)*(x7996)))+(((IkReal(-1.00000000000000))*(x7991)*(x7992)*(x7994)))+(x7988)+(((IkReal(-1.00000000000000))*(r00)*(x7997)*(x8003)))+(((IkReal(-1.00000000000000))*(x7992)*(x7995)*(x8002)))+(((IkReal(-1.00000000000000))*(x7992)*(x7993)*(x7994)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x7997)))+(((r01)*(x8004)))+(((IkReal(-1.00000000000000))*(r12)*(x7990)*(x7992)))+(((IkReal(-1.00000000000000))*(r02)*(x7992)*(x7998))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -25798,8 +25714,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -25920,7 +25835,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -25958,14 +25873,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((r21)*(x8075)))+(((r2
 evalcond[1]=((((cj5)*(r21)*(x8070)))+(((r20)*(x8067)))+(((IkReal(-1.00000000000000))*(x8076)))+(((cj5)*(r20)*(x8071)))+(((IkReal(-1.00000000000000))*(r21)*(x8068)))+(((r22)*(x8073))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r02)*(x8065)))+(((IkReal(-1.00000000000000))*(x8069)*(x8075)))+(((x8062)*(x8064)))+(((IkReal(-1.00000000000000))*(x8076)))+(((r12)*(x8066)))+(((IkReal(-1.00000000000000))*(r10)*(x8072)*(x8074)))+(((x8062)*(x8063))));
 evalcond[3]=((((x8068)*(x8069)))+(((IkReal(-1.00000000000000))*(r11)*(x8066)*(x8070)))+(((IkReal(-1.00000000000000))*(r12)*(x8072)*(x8073)))+(((cj4)*(x8063)*(x8065)))+(((cj4)*(x8064)*(x8065)))+(x8061)+(((cj4)*(r02)*(x8062)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x8068)))+(((IkReal(-1.00000000000000))*(r10)*(x8066)*(x8071)))+(((r00)*(sj0)*(x8067)))+(((IkReal(-1.00000000000000))*(r10)*(x8067)*(x8072))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -26001,8 +25916,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -26067,7 +25981,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -26105,14 +26019,14 @@ evalcond[0]=((x8109)+(((r21)*(x8123)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)
 evalcond[1]=((((IkReal(-1.00000000000000))*(r21)*(x8116)))+(((cj5)*(r20)*(x8119)))+(x8108)+(((r20)*(x8115)))+(((r22)*(x8121)))+(((cj5)*(r21)*(x8118))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x8108)))+(((r12)*(x8114)))+(((IkReal(-1.00000000000000))*(r10)*(x8120)*(x8122)))+(((x8110)*(x8111)))+(((x8110)*(x8112)))+(((IkReal(-1.00000000000000))*(r02)*(x8113)))+(((IkReal(-1.00000000000000))*(x8117)*(x8123))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r11)*(x8114)*(x8118)))+(((cj4)*(x8111)*(x8113)))+(((IkReal(-1.00000000000000))*(r10)*(x8115)*(x8120)))+(x8109)+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x8116)))+(((x8116)*(x8117)))+(((cj4)*(x8112)*(x8113)))+(((IkReal(-1.00000000000000))*(r10)*(x8114)*(x8119)))+(((cj4)*(r02)*(x8110)))+(((r00)*(sj0)*(x8115)))+(((IkReal(-1.00000000000000))*(r12)*(x8120)*(x8121))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -26148,8 +26062,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -26193,7 +26106,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -26238,14 +26151,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(sj5)*(x8138)*(x8147)))+(((IkReal(-1.
 evalcond[3]=((((IkReal(-1.00000000000000))*(x8134)*(x8147)))+(((IkReal(-1.00000000000000))*(sj5)*(x8135)*(x8138)))+(((IkReal(-1.00000000000000))*(sj5)*(x8136)*(x8138)))+(((cj0)*(x8142)))+(((IkReal(-1.00000000000000))*(x8134)*(x8141)))+(((sj0)*(x8139)))+(((IkReal(-1.00000000000000))*(x8133)*(x8143))));
 evalcond[4]=((((x8134)*(x8149)))+(x8133)+(((IkReal(-1.00000000000000))*(r10)*(x8138)*(x8144)))+(((r11)*(x8152)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x8138)))+(((r00)*(sj0)*(x8144)))+(((IkReal(-1.00000000000000))*(x8137)*(x8138)*(x8141)))+(((sj0)*(x8135)*(x8137)))+(((sj0)*(x8136)*(x8137)))+(((IkReal(-1.00000000000000))*(x8137)*(x8138)*(x8147)))+(((IkReal(-1.00000000000000))*(r01)*(x8140)*(x8148))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r00)*(x8138)*(x8144)))+(((IkReal(-1.00000000000000))*(x8137)*(x8140)*(x8141)))+(((IkReal(-1.00000000000000))*(sj5)*(x8138)*(x8149)))+(((IkReal(-1.00000000000000))*(r10)*(x8140)*(x8144)))+(((IkReal(-1.00000000000000))*(x8137)*(x8140)*(x8147)))+(((r11)*(sj0)*(x8148)))+(((IkReal(-1.00000000000000))*(x8134)*(x8150)))+(((r01)*(x8152)))+(((IkReal(-1.00000000000000))*(x8136)*(x8137)*(x8138)))+(((IkReal(-1.00000000000000))*(x8135)*(x8137)*(x8138)))+(((IkReal(-1.00000000000000))*(x8132)*(x8143))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -26281,8 +26194,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -26313,7 +26225,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -26358,14 +26270,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x8176)))+(((x8159)*(x8160)))+(((IkRe
 evalcond[3]=((((IkReal(-1.00000000000000))*(x8158)*(x8168)))+(((IkReal(-1.00000000000000))*(sj5)*(x8161)*(x8163)))+(((sj0)*(x8164)))+(((IkReal(-1.00000000000000))*(x8159)*(x8172)))+(((IkReal(-1.00000000000000))*(x8159)*(x8166)))+(((cj0)*(x8167)))+(((IkReal(-1.00000000000000))*(sj5)*(x8160)*(x8163))));
 evalcond[4]=((x8158)+(((IkReal(-1.00000000000000))*(x8162)*(x8163)*(x8166)))+(((x8159)*(x8174)))+(((sj0)*(x8161)*(x8162)))+(((r11)*(x8177)))+(((IkReal(-1.00000000000000))*(r01)*(x8165)*(x8173)))+(((IkReal(-1.00000000000000))*(x8162)*(x8163)*(x8172)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x8163)))+(((r00)*(sj0)*(x8169)))+(((sj0)*(x8160)*(x8162)))+(((IkReal(-1.00000000000000))*(r10)*(x8163)*(x8169))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x8162)*(x8165)*(x8172)))+(((IkReal(-1.00000000000000))*(r10)*(x8165)*(x8169)))+(((IkReal(-1.00000000000000))*(x8157)*(x8168)))+(((r11)*(sj0)*(x8173)))+(((IkReal(-1.00000000000000))*(x8161)*(x8162)*(x8163)))+(((IkReal(-1.00000000000000))*(sj5)*(x8163)*(x8174)))+(((IkReal(-1.00000000000000))*(x8162)*(x8165)*(x8166)))+(((IkReal(-1.00000000000000))*(x8160)*(x8162)*(x8163)))+(((r01)*(x8177)))+(((IkReal(-1.00000000000000))*(x8159)*(x8175)))+(((IkReal(-1.00000000000000))*(r00)*(x8163)*(x8169))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -26401,8 +26313,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -26432,7 +26343,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -26477,14 +26388,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x8200)))+(((cj0)*(x8188)))+(((x8183)
 evalcond[3]=((((IkReal(-1.00000000000000))*(sj5)*(x8185)*(x8187)))+(((IkReal(-1.00000000000000))*(x8183)*(x8190)))+(((IkReal(-1.00000000000000))*(x8183)*(x8196)))+(((IkReal(-1.00000000000000))*(sj5)*(x8184)*(x8187)))+(((IkReal(-1.00000000000000))*(x8182)*(x8192)))+(((sj0)*(x8188)))+(((cj0)*(x8191))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x8186)*(x8187)*(x8190)))+(((IkReal(-1.00000000000000))*(r01)*(x8189)*(x8197)))+(((IkReal(-1.00000000000000))*(x8186)*(x8187)*(x8196)))+(x8182)+(((sj0)*(x8185)*(x8186)))+(((IkReal(-1.00000000000000))*(r10)*(x8187)*(x8193)))+(((r11)*(x8201)))+(((sj0)*(x8184)*(x8186)))+(((x8183)*(x8198)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x8187)))+(((r00)*(sj0)*(x8193))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r10)*(x8189)*(x8193)))+(((IkReal(-1.00000000000000))*(x8185)*(x8186)*(x8187)))+(((IkReal(-1.00000000000000))*(x8186)*(x8189)*(x8196)))+(((IkReal(-1.00000000000000))*(x8183)*(x8199)))+(((r01)*(x8201)))+(((IkReal(-1.00000000000000))*(sj5)*(x8187)*(x8198)))+(((IkReal(-1.00000000000000))*(x8181)*(x8192)))+(((IkReal(-1.00000000000000))*(x8184)*(x8186)*(x8187)))+(((r11)*(sj0)*(x8197)))+(((IkReal(-1.00000000000000))*(x8186)*(x8189)*(x8190)))+(((IkReal(-1.00000000000000))*(r00)*(x8187)*(x8193))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -26520,8 +26431,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -26642,7 +26552,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -26680,14 +26590,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((IkReal(-1.0000000000
 evalcond[1]=((((cj5)*(r20)*(x8267)))+(((r22)*(x8269)))+(((IkReal(-1.00000000000000))*(r21)*(x8264)))+(((cj5)*(r21)*(x8266)))+(((r20)*(x8263)))+(((IkReal(-1.00000000000000))*(x8257))));
 evalcond[2]=((((r12)*(x8262)))+(((IkReal(-1.00000000000000))*(x8265)*(x8271)))+(((x8258)*(x8260)))+(((IkReal(-1.00000000000000))*(r10)*(x8268)*(x8270)))+(((x8258)*(x8259)))+(x8257)+(((IkReal(-1.00000000000000))*(r02)*(x8261))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r10)*(x8262)*(x8267)))+(((cj4)*(x8259)*(x8261)))+(((r00)*(sj0)*(x8263)))+(((x8264)*(x8265)))+(((IkReal(-1.00000000000000))*(x8272)))+(((IkReal(-1.00000000000000))*(r10)*(x8263)*(x8268)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x8264)))+(((IkReal(-1.00000000000000))*(r12)*(x8268)*(x8269)))+(((cj4)*(r02)*(x8258)))+(((cj4)*(x8260)*(x8261)))+(((IkReal(-1.00000000000000))*(r11)*(x8262)*(x8266))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -26723,8 +26633,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -26789,7 +26698,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -26827,14 +26736,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(r22)*(x8310)))+(x8305)+(((sj5)*(x831
 evalcond[1]=((((x8311)*(x8317)))+(((x8311)*(x8316)))+(((r20)*(x8312)))+(((cj4)*(r22)*(sj5)))+(x8304)+(((IkReal(-1.00000000000000))*(r21)*(x8313))));
 evalcond[2]=((((r12)*(x8309)))+(((IkReal(-1.00000000000000))*(r02)*(sj0)*(x8310)))+(((x8306)*(x8308)))+(((x8306)*(x8307)))+(((IkReal(-1.00000000000000))*(x8318)*(x8319)))+(((IkReal(-1.00000000000000))*(cj6)*(sj5)*(x8314)))+(x8304));
 evalcond[3]=((((sj0)*(x8308)*(x8311)))+(((x8313)*(x8314)))+(((IkReal(-1.00000000000000))*(x8309)*(x8315)*(x8319)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x8313)))+(((sj0)*(x8307)*(x8311)))+(((IkReal(-1.00000000000000))*(x8305)))+(((IkReal(-1.00000000000000))*(cj0)*(r10)*(x8312)))+(((IkReal(-1.00000000000000))*(r12)*(x8315)*(x8318)))+(((cj4)*(r02)*(x8306)))+(((r00)*(sj0)*(x8312)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x8309)*(x8315))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -26870,8 +26779,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -26914,7 +26822,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -26958,14 +26866,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x8336)*(x8343)))+(((x8329)*(x8330)))
 evalcond[3]=((((IkReal(-1.00000000000000))*(x8332)*(x8336)))+(((IkReal(-1.00000000000000))*(x8329)*(x8343)))+(((IkReal(-1.00000000000000))*(x8328)*(x8337)))+(((IkReal(-1.00000000000000))*(x8329)*(x8335)))+(((r02)*(x8333)))+(((IkReal(-1.00000000000000))*(x8330)*(x8336)))+(((r12)*(x8334))));
 evalcond[4]=((((cj4)*(r02)*(x8329)))+(((cj4)*(x8332)*(x8334)))+(((IkReal(-1.00000000000000))*(r12)*(x8331)*(x8336)))+(((IkReal(-1.00000000000000))*(r01)*(x8346)))+(((r00)*(sj0)*(x8338)))+(((cj4)*(x8330)*(x8334)))+(((IkReal(-1.00000000000000))*(x8328)))+(((r11)*(x8345)))+(((IkReal(-1.00000000000000))*(r10)*(x8338)*(x8344)))+(((IkReal(-1.00000000000000))*(x8331)*(x8333)*(x8343)))+(((IkReal(-1.00000000000000))*(x8331)*(x8333)*(x8335))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r12)*(x8329)*(x8331)))+(((IkReal(-1.00000000000000))*(x8331)*(x8334)*(x8343)))+(((IkReal(-1.00000000000000))*(x8331)*(x8332)*(x8333)))+(((IkReal(-1.00000000000000))*(x8330)*(x8331)*(x8333)))+(((IkReal(-1.00000000000000))*(x8327)*(x8337)))+(((r01)*(x8345)))+(((IkReal(-1.00000000000000))*(x8331)*(x8334)*(x8335)))+(((IkReal(-1.00000000000000))*(r02)*(x8331)*(x8336)))+(((r11)*(x8346)))+(((IkReal(-1.00000000000000))*(r00)*(x8338)*(x8344)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x8338))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -27001,8 +26909,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -27033,7 +26940,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -27077,14 +26984,14 @@ evalcond[2]=((((x8353)*(x8356)))+(((IkReal(-1.00000000000000))*(x8360)*(x8367)))
 evalcond[3]=((((r12)*(x8358)))+(((IkReal(-1.00000000000000))*(x8353)*(x8359)))+(((IkReal(-1.00000000000000))*(x8353)*(x8367)))+(((IkReal(-1.00000000000000))*(x8356)*(x8360)))+(((IkReal(-1.00000000000000))*(x8352)*(x8361)))+(((IkReal(-1.00000000000000))*(x8354)*(x8360)))+(((r02)*(x8357))));
 evalcond[4]=((((cj4)*(x8356)*(x8358)))+(((r11)*(x8369)))+(((IkReal(-1.00000000000000))*(r01)*(x8370)))+(((IkReal(-1.00000000000000))*(x8355)*(x8357)*(x8367)))+(((r00)*(sj0)*(x8362)))+(((IkReal(-1.00000000000000))*(x8355)*(x8357)*(x8359)))+(((cj4)*(x8354)*(x8358)))+(((IkReal(-1.00000000000000))*(x8352)))+(((IkReal(-1.00000000000000))*(r12)*(x8355)*(x8360)))+(((IkReal(-1.00000000000000))*(r10)*(x8362)*(x8368)))+(((cj4)*(r02)*(x8353))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x8354)*(x8355)*(x8357)))+(((IkReal(-1.00000000000000))*(r12)*(x8353)*(x8355)))+(((IkReal(-1.00000000000000))*(x8351)*(x8361)))+(((IkReal(-1.00000000000000))*(x8355)*(x8358)*(x8359)))+(((IkReal(-1.00000000000000))*(r02)*(x8355)*(x8360)))+(((r11)*(x8370)))+(((IkReal(-1.00000000000000))*(x8355)*(x8358)*(x8367)))+(((IkReal(-1.00000000000000))*(r00)*(x8362)*(x8368)))+(((IkReal(-1.00000000000000))*(x8355)*(x8356)*(x8357)))+(((r01)*(x8369)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x8362))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -27120,8 +27027,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -27151,7 +27057,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -27195,14 +27101,14 @@ evalcond[2]=((((r12)*(x8380)))+(((IkReal(-1.00000000000000))*(r02)*(x8381)))+(x8
 evalcond[3]=((((IkReal(-1.00000000000000))*(x8376)*(x8390)))+(((r02)*(x8380)))+(((r12)*(x8381)))+(((IkReal(-1.00000000000000))*(x8377)*(x8383)))+(((IkReal(-1.00000000000000))*(x8375)*(x8384)))+(((IkReal(-1.00000000000000))*(x8376)*(x8382)))+(((IkReal(-1.00000000000000))*(x8379)*(x8383))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x8375)))+(((IkReal(-1.00000000000000))*(r12)*(x8378)*(x8383)))+(((IkReal(-1.00000000000000))*(r10)*(x8385)*(x8391)))+(((cj4)*(r02)*(x8376)))+(((r00)*(sj0)*(x8385)))+(((IkReal(-1.00000000000000))*(x8378)*(x8380)*(x8382)))+(((r11)*(x8392)))+(((IkReal(-1.00000000000000))*(x8378)*(x8380)*(x8390)))+(((IkReal(-1.00000000000000))*(r01)*(x8393)))+(((cj4)*(x8377)*(x8381)))+(((cj4)*(x8379)*(x8381))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x8378)*(x8379)*(x8380)))+(((IkReal(-1.00000000000000))*(r12)*(x8376)*(x8378)))+(((IkReal(-1.00000000000000))*(x8377)*(x8378)*(x8380)))+(((IkReal(-1.00000000000000))*(x8378)*(x8381)*(x8390)))+(((r11)*(x8393)))+(((IkReal(-1.00000000000000))*(r02)*(x8378)*(x8383)))+(((IkReal(-1.00000000000000))*(x8378)*(x8381)*(x8382)))+(((IkReal(-1.00000000000000))*(r00)*(x8385)*(x8391)))+(((r01)*(x8392)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x8385)))+(((IkReal(-1.00000000000000))*(x8374)*(x8384))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -27238,8 +27144,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -27294,7 +27199,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -27341,14 +27246,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x8413)*(x8422)))+(((IkReal(-1.000000
 evalcond[3]=((((IkReal(-1.00000000000000))*(x8410)*(x8422)))+(((sj1)*(x8425)))+(((IkReal(-1.00000000000000))*(x8405)*(x8415)))+(((IkReal(-1.00000000000000))*(x8408)*(x8422)))+(((r12)*(x8412)))+(((IkReal(-1.00000000000000))*(x8407)*(x8413)))+(((IkReal(-1.00000000000000))*(x8407)*(x8419)))+(((r02)*(x8411))));
 evalcond[4]=((((cj4)*(x8408)*(x8412)))+(((IkReal(-1.00000000000000))*(r12)*(x8409)*(x8420)))+(((IkReal(-1.00000000000000))*(x8409)*(x8411)*(x8413)))+(((r00)*(sj0)*(x8414)))+(((IkReal(-1.00000000000000))*(r10)*(x8414)*(x8421)))+(((cj4)*(x8410)*(x8412)))+(((r11)*(x8424)))+(((cj4)*(r02)*(x8407)))+(((sj2)*(x8405)))+(((IkReal(-1.00000000000000))*(r01)*(x8426)))+(((IkReal(-1.00000000000000))*(x8409)*(x8411)*(x8419))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r12)*(x8407)*(x8409)))+(((IkReal(-1.00000000000000))*(r00)*(x8414)*(x8421)))+(((IkReal(-1.00000000000000))*(x8409)*(x8412)*(x8413)))+(((IkReal(-1.00000000000000))*(r02)*(x8409)*(x8420)))+(((r11)*(x8426)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x8414)))+(((IkReal(-1.00000000000000))*(cj2)*(x8427)))+(((IkReal(-1.00000000000000))*(x8408)*(x8409)*(x8411)))+(((IkReal(-1.00000000000000))*(x8409)*(x8412)*(x8419)))+(((IkReal(-1.00000000000000))*(x8409)*(x8410)*(x8411)))+(((r01)*(x8424)))+(((IkReal(-1.00000000000000))*(x8406)*(x8415))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -27384,8 +27289,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -27428,7 +27332,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -27475,14 +27379,14 @@ evalcond[2]=((((x8446)*(x8449)))+(((IkReal(-1.00000000000000))*(sj2)*(x8462)))+(
 evalcond[3]=((((IkReal(-1.00000000000000))*(x8446)*(x8458)))+(((r12)*(x8451)))+(((IkReal(-1.00000000000000))*(x8449)*(x8461)))+(((r02)*(x8450)))+(((IkReal(-1.00000000000000))*(x8444)*(x8454)))+(((IkReal(-1.00000000000000))*(x8447)*(x8461)))+(((IkReal(-1.00000000000000))*(x8446)*(x8452)))+(((sj1)*(x8464))));
 evalcond[4]=((((r11)*(x8463)))+(((IkReal(-1.00000000000000))*(x8448)*(x8450)*(x8452)))+(((IkReal(-1.00000000000000))*(r12)*(x8448)*(x8459)))+(((IkReal(-1.00000000000000))*(r01)*(x8465)))+(((IkReal(-1.00000000000000))*(r10)*(x8453)*(x8460)))+(((IkReal(-1.00000000000000))*(x8448)*(x8450)*(x8458)))+(((cj4)*(x8447)*(x8451)))+(((cj4)*(x8449)*(x8451)))+(((sj2)*(x8444)))+(((r00)*(sj0)*(x8453)))+(((cj4)*(r02)*(x8446))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x8448)*(x8451)*(x8452)))+(((IkReal(-1.00000000000000))*(x8447)*(x8448)*(x8450)))+(((IkReal(-1.00000000000000))*(x8445)*(x8454)))+(((IkReal(-1.00000000000000))*(cj2)*(x8466)))+(((r01)*(x8463)))+(((IkReal(-1.00000000000000))*(r02)*(x8448)*(x8459)))+(((IkReal(-1.00000000000000))*(x8448)*(x8449)*(x8450)))+(((IkReal(-1.00000000000000))*(r12)*(x8446)*(x8448)))+(((r11)*(x8465)))+(((IkReal(-1.00000000000000))*(x8448)*(x8451)*(x8458)))+(((IkReal(-1.00000000000000))*(r00)*(x8453)*(x8460)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x8453))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -27518,8 +27422,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -27558,7 +27461,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -27605,14 +27508,14 @@ evalcond[2]=((((x8481)*(x8482)))+(((x8481)*(x8484)))+(((IkReal(-1.00000000000000
 evalcond[3]=((((sj1)*(x8499)))+(((IkReal(-1.00000000000000))*(x8481)*(x8487)))+(((r02)*(x8485)))+(((IkReal(-1.00000000000000))*(x8484)*(x8496)))+(((IkReal(-1.00000000000000))*(x8481)*(x8493)))+(((IkReal(-1.00000000000000))*(x8482)*(x8496)))+(((IkReal(-1.00000000000000))*(x8479)*(x8489)))+(((r12)*(x8486))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x8483)*(x8485)*(x8487)))+(((sj2)*(x8479)))+(((IkReal(-1.00000000000000))*(r12)*(x8483)*(x8494)))+(((IkReal(-1.00000000000000))*(x8483)*(x8485)*(x8493)))+(((IkReal(-1.00000000000000))*(r01)*(x8500)))+(((cj4)*(x8482)*(x8486)))+(((r11)*(x8498)))+(((r00)*(sj0)*(x8488)))+(((IkReal(-1.00000000000000))*(r10)*(x8488)*(x8495)))+(((cj4)*(x8484)*(x8486)))+(((cj4)*(r02)*(x8481))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x8483)*(x8484)*(x8485)))+(((IkReal(-1.00000000000000))*(r12)*(x8481)*(x8483)))+(((r01)*(x8498)))+(((IkReal(-1.00000000000000))*(x8480)*(x8489)))+(((r11)*(x8500)))+(((IkReal(-1.00000000000000))*(x8483)*(x8486)*(x8487)))+(((IkReal(-1.00000000000000))*(cj2)*(x8501)))+(((IkReal(-1.00000000000000))*(r02)*(x8483)*(x8494)))+(((IkReal(-1.00000000000000))*(x8482)*(x8483)*(x8485)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x8488)))+(((IkReal(-1.00000000000000))*(x8483)*(x8486)*(x8493)))+(((IkReal(-1.00000000000000))*(r00)*(x8488)*(x8495))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -27648,8 +27551,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -27697,7 +27599,7 @@ if( j2array[0] > IKPI )
 else if( j2array[0] < -IKPI )
 {    j2array[0]+=IK2PI;
 }
-j2valid[0] = true;
+j2valid[0] = IKinlimits(2,j2array[0]);
 for(int ij2 = 0; ij2 < 1; ++ij2)
 {
 if( !j2valid[ij2] )
@@ -27736,7 +27638,7 @@ IkReal x8528=((cj0)*(cj6)*(x8512));
 evalcond[0]=((((cj1)*(x8525)))+(((IkReal(0.364420000000000))*(sj1)))+(((IkReal(-1.00000000000000))*(r22)*(x8521)))+(((IkReal(-1.00000000000000))*(x8516)*(x8519)))+(pz)+(((IkReal(-1.00000000000000))*(r22)*(x8514)))+(((cj6)*(r21)*(x8512)))+(((x8512)*(x8519)))+(((IkReal(-1.00000000000000))*(r21)*(x8524))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(r10)*(x8512)*(x8513)))+(((IkReal(-1.00000000000000))*(r11)*(x8528)))+(((IkReal(-1.00000000000000))*(x8516)*(x8527)))+(((IkReal(-1.00000000000000))*(r02)*(x8523)))+(((x8512)*(x8527)))+(((x8521)*(x8522)))+(((r10)*(x8513)*(x8516)))+(((IkReal(-1.00000000000000))*(r02)*(sj0)*(x8514)))+(((IkReal(0.0690000000000000))*(IKsin(j2))))+(((IkReal(-1.00000000000000))*(x8518)*(x8524)))+(((IkReal(-1.00000000000000))*(cj0)*(x8517)))+(((px)*(sj0)))+(((cj6)*(x8512)*(x8518)))+(((cj0)*(r11)*(x8524)))+(((x8514)*(x8522))));
 evalcond[2]=((IkReal(0.0690000000000000))+(((x8516)*(x8526)))+(((IkReal(-1.00000000000000))*(cj0)*(px)))+(((r12)*(x8523)))+(((IkReal(-1.00000000000000))*(x8512)*(x8526)))+(((IkReal(-1.00000000000000))*(sj0)*(x8517)))+(((IkReal(-1.00000000000000))*(cj6)*(x8512)*(x8520)))+(((IkReal(-1.00000000000000))*(r01)*(x8528)))+(((r00)*(x8513)*(x8516)))+(((x8515)*(x8521)))+(((IkReal(-1.00000000000000))*(sj1)*(x8525)))+(((IkReal(-1.00000000000000))*(r00)*(x8512)*(x8513)))+(((x8514)*(x8515)))+(((cj0)*(r01)*(x8524)))+(((IkReal(0.364420000000000))*(cj1)))+(((r12)*(sj0)*(x8514)))+(((x8520)*(x8524))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -27964,7 +27866,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -27992,7 +27894,7 @@ IkReal x8685=((cj6)*(r01)*(sj5));
 IkReal x8686=((IkReal(1.00000000000000))*(sj0)*(sj5));
 evalcond[0]=((((IkReal(-1.00000000000000))*(r02)*(x8683)))+(((IkReal(-1.00000000000000))*(sj5)*(x8680)*(x8682)))+(((sj0)*(x8684)))+(((r12)*(x8679)))+(((IkReal(-1.00000000000000))*(IKsin(j3))))+(((IkReal(-1.00000000000000))*(sj5)*(x8680)*(x8681)))+(((sj0)*(x8685))));
 evalcond[1]=((((r02)*(x8679)))+(((IkReal(-1.00000000000000))*(IKcos(j3))))+(((IkReal(-1.00000000000000))*(x8680)*(x8684)))+(((IkReal(-1.00000000000000))*(x8682)*(x8686)))+(((IkReal(-1.00000000000000))*(x8680)*(x8685)))+(((IkReal(-1.00000000000000))*(x8681)*(x8686)))+(((r12)*(x8683))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -28081,7 +27983,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -28132,14 +28034,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x8739)*(x8741)*(x8753)))+(((IkReal(-
 evalcond[3]=((((x8747)*(x8754)))+(((r01)*(x8742)*(x8754)))+(((IkReal(-1.00000000000000))*(r10)*(x8739)*(x8753)))+(((IkReal(-1.00000000000000))*(x8740)*(x8760)))+(((x8752)*(x8754)))+(((IkReal(-1.00000000000000))*(r10)*(x8737)*(x8740)*(x8749)))+(cj3)+(((x8743)*(x8753)))+(((IkReal(-1.00000000000000))*(x8739)*(x8741)*(x8756)))+(((x8745)*(x8751)))+(((IkReal(-1.00000000000000))*(r01)*(x8744)*(x8751))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x8743)*(x8754)))+(((IkReal(-1.00000000000000))*(x8739)*(x8750)*(x8753)))+(((IkReal(-1.00000000000000))*(x8736)*(x8740)*(x8752)))+(((IkReal(-1.00000000000000))*(x8736)*(x8740)*(x8747)))+(((x8748)*(x8754)))+(((IkReal(-1.00000000000000))*(x8746)*(x8751)))+(((IkReal(-1.00000000000000))*(x8739)*(x8741)*(x8751)))+(((x8745)*(x8756)))+(((IkReal(-1.00000000000000))*(x8751)*(x8762)))+(((IkReal(-1.00000000000000))*(x8740)*(x8761))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x8737)*(x8740)*(x8747)))+(((r01)*(sj6)*(x8753)))+(((IkReal(-1.00000000000000))*(x8746)*(x8754)))+(((x8743)*(x8751)))+(((IkReal(-1.00000000000000))*(x8739)*(x8750)*(x8756)))+(((IkReal(-1.00000000000000))*(r00)*(x8739)*(x8753)))+(((IkReal(-1.00000000000000))*(x8737)*(x8740)*(x8752)))+(((IkReal(-1.00000000000000))*(x8739)*(x8741)*(x8754)))+(((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(-1.00000000000000))*(r10)*(x8739)*(x8751)))+(((IkReal(-1.00000000000000))*(x8754)*(x8762))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -28175,8 +28077,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -28203,7 +28104,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -28254,14 +28155,14 @@ evalcond[2]=((((r01)*(sj6)*(x8781)))+(((IkReal(-1.00000000000000))*(r00)*(x8766)
 evalcond[3]=((((r01)*(x8769)*(x8781)))+(((x8770)*(x8780)))+(((x8779)*(x8781)))+(((IkReal(-1.00000000000000))*(r10)*(x8764)*(x8767)*(x8776)))+(((IkReal(-1.00000000000000))*(x8766)*(x8768)*(x8783)))+(((IkReal(-1.00000000000000))*(r01)*(x8771)*(x8778)))+(((IkReal(-1.00000000000000))*(r10)*(x8766)*(x8780)))+(cj3)+(((IkReal(-1.00000000000000))*(x8767)*(x8787)))+(((x8772)*(x8778)))+(((x8774)*(x8781))));
 evalcond[4]=((((x8775)*(x8781)))+(((IkReal(-1.00000000000000))*(x8763)*(x8767)*(x8774)))+(((x8772)*(x8783)))+(((IkReal(-1.00000000000000))*(x8773)*(x8778)))+(((IkReal(-1.00000000000000))*(x8763)*(x8767)*(x8779)))+(((IkReal(-1.00000000000000))*(x8767)*(x8788)))+(((IkReal(-1.00000000000000))*(x8766)*(x8768)*(x8778)))+(((IkReal(-1.00000000000000))*(x8778)*(x8789)))+(((IkReal(-1.00000000000000))*(x8770)*(x8781)))+(((IkReal(-1.00000000000000))*(x8766)*(x8777)*(x8780))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x8764)*(x8767)*(x8779)))+(((IkReal(-1.00000000000000))*(r00)*(x8766)*(x8780)))+(((IkReal(-1.00000000000000))*(x8764)*(x8767)*(x8774)))+(((IkReal(-1.00000000000000))*(r10)*(x8766)*(x8778)))+(((IkReal(-1.00000000000000))*(x8766)*(x8768)*(x8781)))+(((r01)*(sj6)*(x8780)))+(((IkReal(-1.00000000000000))*(x8766)*(x8777)*(x8783)))+(((IkReal(-1.00000000000000))*(x8773)*(x8781)))+(((IkReal(-1.00000000000000))*(sj3)))+(((x8770)*(x8778)))+(((IkReal(-1.00000000000000))*(x8781)*(x8789))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -28297,8 +28198,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -28359,7 +28259,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -28387,7 +28287,7 @@ IkReal x8821=((cj6)*(r01)*(sj5));
 IkReal x8822=((IkReal(1.00000000000000))*(sj0)*(sj5));
 evalcond[0]=((((sj0)*(x8821)))+(((r12)*(x8815)))+(((IkReal(-1.00000000000000))*(r02)*(x8819)))+(((sj0)*(x8820)))+(((IkReal(-1.00000000000000))*(sj5)*(x8816)*(x8817)))+(((IkReal(-1.00000000000000))*(sj5)*(x8816)*(x8818)))+(((IkReal(-1.00000000000000))*(IKsin(j3)))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x8817)*(x8822)))+(((r12)*(x8819)))+(((IkReal(-1.00000000000000))*(x8816)*(x8820)))+(IKcos(j3))+(((IkReal(-1.00000000000000))*(x8818)*(x8822)))+(((r02)*(x8815)))+(((IkReal(-1.00000000000000))*(x8816)*(x8821))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -28482,7 +28382,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -28533,14 +28433,14 @@ evalcond[2]=((((r01)*(x8884)*(x8893)))+(((r01)*(sj6)*(x8896)))+(((IkReal(-1.0000
 evalcond[3]=((((r01)*(x8884)*(x8896)))+(((IkReal(-1.00000000000000))*(r10)*(x8881)*(x8895)))+(((IkReal(-1.00000000000000))*(x8881)*(x8883)*(x8898)))+(((IkReal(-1.00000000000000))*(x8882)*(x8902)))+(((IkReal(-1.00000000000000))*(r01)*(x8886)*(x8893)))+(cj3)+(((x8885)*(x8895)))+(((x8887)*(x8893)))+(((IkReal(-1.00000000000000))*(r10)*(x8879)*(x8882)*(x8891)))+(((x8889)*(x8896)))+(((x8894)*(x8896))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x8881)*(x8892)*(x8895)))+(((IkReal(-1.00000000000000))*(x8878)*(x8882)*(x8894)))+(((IkReal(-1.00000000000000))*(x8878)*(x8882)*(x8889)))+(((x8890)*(x8896)))+(((IkReal(-1.00000000000000))*(x8888)*(x8893)))+(((IkReal(-1.00000000000000))*(x8893)*(x8904)))+(((IkReal(-1.00000000000000))*(x8881)*(x8883)*(x8893)))+(((IkReal(-1.00000000000000))*(x8885)*(x8896)))+(((x8887)*(x8898)))+(((IkReal(-1.00000000000000))*(x8882)*(x8903))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r00)*(x8881)*(x8895)))+(sj3)+(((IkReal(-1.00000000000000))*(x8879)*(x8882)*(x8889)))+(((IkReal(-1.00000000000000))*(x8881)*(x8883)*(x8896)))+(((IkReal(-1.00000000000000))*(x8888)*(x8896)))+(((IkReal(-1.00000000000000))*(x8896)*(x8904)))+(((IkReal(-1.00000000000000))*(x8879)*(x8882)*(x8894)))+(((IkReal(-1.00000000000000))*(r10)*(x8881)*(x8893)))+(((r01)*(sj6)*(x8895)))+(((IkReal(-1.00000000000000))*(x8881)*(x8892)*(x8898)))+(((x8885)*(x8893))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -28576,8 +28476,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -28604,7 +28503,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -28655,14 +28554,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(r10)*(x8905)*(x8909)*(x8918)))+(((Ik
 evalcond[3]=((((IkReal(-1.00000000000000))*(r10)*(x8906)*(x8909)*(x8918)))+(((x8914)*(x8920)))+(((IkReal(-1.00000000000000))*(x8909)*(x8929)))+(((r01)*(x8911)*(x8923)))+(((IkReal(-1.00000000000000))*(r10)*(x8908)*(x8922)))+(((x8921)*(x8923)))+(((IkReal(-1.00000000000000))*(x8908)*(x8910)*(x8925)))+(((x8916)*(x8923)))+(cj3)+(((IkReal(-1.00000000000000))*(r01)*(x8913)*(x8920)))+(((x8912)*(x8922))));
 evalcond[4]=((((x8917)*(x8923)))+(((IkReal(-1.00000000000000))*(x8908)*(x8910)*(x8920)))+(((x8914)*(x8925)))+(((IkReal(-1.00000000000000))*(x8920)*(x8931)))+(((IkReal(-1.00000000000000))*(x8909)*(x8930)))+(((IkReal(-1.00000000000000))*(x8905)*(x8909)*(x8916)))+(((IkReal(-1.00000000000000))*(x8915)*(x8920)))+(((IkReal(-1.00000000000000))*(x8908)*(x8919)*(x8922)))+(((IkReal(-1.00000000000000))*(x8912)*(x8923)))+(((IkReal(-1.00000000000000))*(x8905)*(x8909)*(x8921))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r10)*(x8908)*(x8920)))+(((IkReal(-1.00000000000000))*(x8906)*(x8909)*(x8921)))+(sj3)+(((IkReal(-1.00000000000000))*(r00)*(x8908)*(x8922)))+(((IkReal(-1.00000000000000))*(x8923)*(x8931)))+(((IkReal(-1.00000000000000))*(x8908)*(x8910)*(x8923)))+(((r01)*(sj6)*(x8922)))+(((IkReal(-1.00000000000000))*(x8906)*(x8909)*(x8916)))+(((IkReal(-1.00000000000000))*(x8908)*(x8919)*(x8925)))+(((IkReal(-1.00000000000000))*(x8915)*(x8923)))+(((x8912)*(x8920))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -28698,8 +28597,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -28745,7 +28643,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -28774,7 +28672,7 @@ IkReal x8943=((cj6)*(r11)*(sj5));
 evalcond[0]=((((IkReal(-1.00000000000000))*(sj1)*(x8941)))+(((cj6)*(r21)*(sj5)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((r20)*(x8937))));
 evalcond[1]=((((r00)*(sj0)*(x8937)))+(((IkReal(-1.00000000000000))*(cj5)*(r02)*(x8940)))+(((IkReal(-1.00000000000000))*(r10)*(x8937)*(x8939)))+(((IkReal(-1.00000000000000))*(IKsin(j3))))+(((IkReal(-1.00000000000000))*(x8939)*(x8943)))+(((sj0)*(x8942)))+(((r12)*(x8938))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r10)*(x8937)*(x8940)))+(((IkReal(-1.00000000000000))*(cj1)*(x8941)))+(((cj5)*(r12)*(sj0)))+(((IkReal(-1.00000000000000))*(r00)*(x8937)*(x8939)))+(((IkReal(-1.00000000000000))*(x8940)*(x8943)))+(((IkReal(-1.00000000000000))*(x8939)*(x8942)))+(((r02)*(x8938))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -28869,7 +28767,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -28921,14 +28819,14 @@ evalcond[2]=((((x9012)*(x9020)))+(((IkReal(-1.00000000000000))*(r10)*(x8999)*(x9
 evalcond[3]=((((IkReal(-1.00000000000000))*(x9003)*(x9024)))+(((IkReal(-1.00000000000000))*(r10)*(x9002)*(x9017)))+(((x9011)*(x9018)))+(((x9007)*(x9017)))+(cj3)+(((r01)*(x9005)*(x9018)))+(((IkReal(-1.00000000000000))*(x9002)*(x9004)*(x9020)))+(((IkReal(-1.00000000000000))*(r01)*(x9008)*(x9015)))+(((x9009)*(x9015)))+(((x9016)*(x9018)))+(((IkReal(-1.00000000000000))*(r10)*(x9000)*(x9003)*(x9013))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x8999)*(x9003)*(x9011)))+(((IkReal(-1.00000000000000))*(x9010)*(x9015)))+(((x9012)*(x9018)))+(((x9009)*(x9020)))+(sj1)+(((IkReal(-1.00000000000000))*(x9015)*(x9026)))+(((IkReal(-1.00000000000000))*(x9007)*(x9018)))+(((IkReal(-1.00000000000000))*(x9002)*(x9014)*(x9017)))+(((IkReal(-1.00000000000000))*(x8999)*(x9003)*(x9016)))+(((IkReal(-1.00000000000000))*(x9002)*(x9004)*(x9015)))+(((IkReal(-1.00000000000000))*(x9003)*(x9025))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r00)*(x9002)*(x9017)))+(((IkReal(-1.00000000000000))*(x9002)*(x9014)*(x9020)))+(((IkReal(-1.00000000000000))*(x9000)*(x9003)*(x9011)))+(((IkReal(-1.00000000000000))*(x9010)*(x9018)))+(((IkReal(-1.00000000000000))*(r10)*(x9002)*(x9015)))+(((IkReal(-1.00000000000000))*(x9002)*(x9004)*(x9018)))+(((IkReal(-1.00000000000000))*(x9000)*(x9003)*(x9016)))+(((IkReal(-1.00000000000000))*(cj1)*(x9006)))+(((x9007)*(x9015)))+(((r01)*(sj6)*(x9017)))+(((IkReal(-1.00000000000000))*(x9018)*(x9026))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -28964,8 +28862,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -28999,7 +28896,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -29051,14 +28948,14 @@ evalcond[2]=((((r01)*(x9040)*(x9050)))+(((IkReal(-1.00000000000000))*(x9037)*(x9
 evalcond[3]=((((x9051)*(x9053)))+(((IkReal(-1.00000000000000))*(x9038)*(x9059)))+(((IkReal(-1.00000000000000))*(r10)*(x9035)*(x9038)*(x9048)))+(((IkReal(-1.00000000000000))*(x9037)*(x9039)*(x9055)))+(((x9044)*(x9050)))+(((x9046)*(x9053)))+(cj3)+(((r01)*(x9040)*(x9053)))+(((IkReal(-1.00000000000000))*(r01)*(x9043)*(x9050)))+(((x9042)*(x9052)))+(((IkReal(-1.00000000000000))*(r10)*(x9037)*(x9052))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x9050)*(x9061)))+(((x9044)*(x9055)))+(((x9047)*(x9053)))+(((IkReal(-1.00000000000000))*(x9034)*(x9038)*(x9051)))+(sj1)+(((IkReal(-1.00000000000000))*(x9034)*(x9038)*(x9046)))+(((IkReal(-1.00000000000000))*(x9037)*(x9049)*(x9052)))+(((IkReal(-1.00000000000000))*(x9045)*(x9050)))+(((IkReal(-1.00000000000000))*(x9042)*(x9053)))+(((IkReal(-1.00000000000000))*(x9037)*(x9039)*(x9050)))+(((IkReal(-1.00000000000000))*(x9038)*(x9060))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r10)*(x9037)*(x9050)))+(((IkReal(-1.00000000000000))*(x9035)*(x9038)*(x9046)))+(((IkReal(-1.00000000000000))*(x9037)*(x9039)*(x9053)))+(((IkReal(-1.00000000000000))*(cj1)*(x9041)))+(((IkReal(-1.00000000000000))*(r00)*(x9037)*(x9052)))+(((x9042)*(x9050)))+(((IkReal(-1.00000000000000))*(x9035)*(x9038)*(x9051)))+(((IkReal(-1.00000000000000))*(x9053)*(x9061)))+(((r01)*(sj6)*(x9052)))+(((IkReal(-1.00000000000000))*(x9045)*(x9053)))+(((IkReal(-1.00000000000000))*(x9037)*(x9049)*(x9055))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -29094,8 +28991,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -29136,7 +29032,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -29171,7 +29067,7 @@ IkReal x9083=((r11)*(sj6)*(x9071));
 evalcond[0]=((((IkReal(-1.00000000000000))*(r20)*(x9080)))+(((r20)*(sj6)*(x9079)))+(((r21)*(sj6)*(x9071)))+(((cj6)*(r21)*(x9079)))+(((IkReal(-1.00000000000000))*(cj1)))+(((r22)*(x9077))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(cj6)*(r11)*(x9074)*(x9079)))+(((IkReal(-1.00000000000000))*(r12)*(x9074)*(x9077)))+(((r02)*(sj0)*(x9077)))+(((IkReal(-1.00000000000000))*(x9074)*(x9076)*(x9079)))+(((sj0)*(x9082)))+(((IkReal(-1.00000000000000))*(x9074)*(x9083)))+(((x9073)*(x9081)))+(((IkReal(-1.00000000000000))*(r00)*(x9075)*(x9080)))+(((x9072)*(x9081)))+(((cj0)*(r10)*(x9080))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x9074)*(x9082)))+(((r10)*(sj0)*(x9080)))+(((IkReal(-1.00000000000000))*(x9072)*(x9074)*(x9079)))+(((IkReal(-1.00000000000000))*(x9073)*(x9074)*(x9079)))+(((IkReal(-1.00000000000000))*(r12)*(x9075)*(x9077)))+(sj1)+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x9075)*(x9079)))+(((IkReal(-1.00000000000000))*(x9075)*(x9076)*(x9079)))+(((IkReal(-1.00000000000000))*(r02)*(x9074)*(x9077)))+(((cj0)*(r00)*(x9080)))+(((IkReal(-1.00000000000000))*(x9075)*(x9083))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -29253,7 +29149,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -29291,14 +29187,14 @@ evalcond[0]=((((r21)*(x9128)))+(((r20)*(x9127)))+(((IkReal(-1.00000000000000))*(
 evalcond[1]=((((cj5)*(r20)*(x9124)))+(((cj5)*(r21)*(x9123)))+(((IkReal(-1.00000000000000))*(x9129)))+(((r22)*(x9126)))+(((IkReal(-1.00000000000000))*(r21)*(x9121)))+(((r20)*(x9120))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x9122)*(x9128)))+(((IkReal(-1.00000000000000))*(x9129)))+(((r12)*(x9119)))+(((IkReal(-1.00000000000000))*(r02)*(x9118)))+(((x9115)*(x9116)))+(((x9115)*(x9117)))+(((IkReal(-1.00000000000000))*(r10)*(x9125)*(x9127))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r10)*(x9120)*(x9125)))+(((IkReal(-1.00000000000000))*(r11)*(x9119)*(x9123)))+(((cj4)*(r02)*(x9115)))+(((r00)*(sj0)*(x9120)))+(((cj4)*(x9117)*(x9118)))+(x9114)+(((cj4)*(x9116)*(x9118)))+(((x9121)*(x9122)))+(((IkReal(-1.00000000000000))*(r12)*(x9125)*(x9126)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x9121)))+(((IkReal(-1.00000000000000))*(r10)*(x9119)*(x9124))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -29334,8 +29230,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -29400,7 +29295,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -29438,14 +29333,14 @@ evalcond[0]=((((r20)*(x9175)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((r2
 evalcond[1]=((((cj5)*(r21)*(x9171)))+(((r22)*(x9174)))+(((r20)*(x9168)))+(x9161)+(((cj5)*(r20)*(x9172)))+(((IkReal(-1.00000000000000))*(r21)*(x9169))));
 evalcond[2]=((((x9163)*(x9164)))+(((x9163)*(x9165)))+(((IkReal(-1.00000000000000))*(r10)*(x9173)*(x9175)))+(((r12)*(x9167)))+(((IkReal(-1.00000000000000))*(x9161)))+(((IkReal(-1.00000000000000))*(r02)*(x9166)))+(((IkReal(-1.00000000000000))*(x9170)*(x9176))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r01)*(sj0)*(x9169)))+(((IkReal(-1.00000000000000))*(r11)*(x9167)*(x9171)))+(((IkReal(-1.00000000000000))*(r10)*(x9168)*(x9173)))+(((x9169)*(x9170)))+(((cj4)*(x9164)*(x9166)))+(((cj4)*(r02)*(x9163)))+(((r00)*(sj0)*(x9168)))+(((IkReal(-1.00000000000000))*(r12)*(x9173)*(x9174)))+(((IkReal(-1.00000000000000))*(r10)*(x9167)*(x9172)))+(((cj4)*(x9165)*(x9166)))+(x9162));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -29481,8 +29376,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -29551,7 +29445,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -29590,14 +29484,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(r02)*(x9219)))+(((IkReal(-1.00000000
 evalcond[1]=((((IkReal(-1.00000000000000))*(cj6)*(r01)*(x9222)))+(((IkReal(-1.00000000000000))*(x9213)*(x9221)))+(((IkReal(-1.00000000000000))*(x9213)*(x9220)))+(((r12)*(x9219)))+(((IkReal(-1.00000000000000))*(x9214)*(x9222)))+(((IkReal(-1.00000000000000))*(x9212)))+(((r02)*(x9218))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r12)*(x9216)*(x9222)))+(x9212)+(((cj4)*(r02)*(x9213)))+(((IkReal(-1.00000000000000))*(x9223)*(x9226)))+(((x9215)*(x9217)))+(((x9215)*(x9225)))+(((IkReal(-1.00000000000000))*(x9216)*(x9218)*(x9221)))+(((r11)*(x9227)))+(((IkReal(-1.00000000000000))*(r01)*(x9228)))+(((cj4)*(x9214)*(x9219)))+(((IkReal(-1.00000000000000))*(x9216)*(x9218)*(x9220))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x9216)*(x9219)*(x9221)))+(((r01)*(x9227)))+(((r11)*(x9228)))+(((IkReal(-1.00000000000000))*(r02)*(x9216)*(x9222)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x9215)*(x9216)))+(((IkReal(-1.00000000000000))*(x9217)*(x9226)))+(((IkReal(-1.00000000000000))*(x9214)*(x9216)*(x9218)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x9216)*(x9218)))+(((IkReal(-1.00000000000000))*(r12)*(x9213)*(x9216)))+(((IkReal(-1.00000000000000))*(x9224)))+(((IkReal(-1.00000000000000))*(x9215)*(x9223))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -29633,8 +29527,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -29702,7 +29595,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -29741,14 +29634,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x9273)*(x9274)))+(((cj6)*(r01)*(x926
 evalcond[1]=((((r02)*(x9270)))+(((IkReal(-1.00000000000000))*(x9265)*(x9272)))+(x9263)+(((r12)*(x9271)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x9274)))+(((IkReal(-1.00000000000000))*(x9266)*(x9274)))+(((IkReal(-1.00000000000000))*(x9265)*(x9273))));
 evalcond[2]=((((cj4)*(r02)*(x9265)))+(((x9267)*(x9269)))+(x9263)+(((r11)*(x9278)))+(((IkReal(-1.00000000000000))*(x9268)*(x9270)*(x9273)))+(((x9267)*(x9276)))+(((IkReal(-1.00000000000000))*(x9268)*(x9270)*(x9272)))+(((IkReal(-1.00000000000000))*(x9275)*(x9277)))+(((cj4)*(x9266)*(x9271)))+(((IkReal(-1.00000000000000))*(r12)*(x9268)*(x9274)))+(((IkReal(-1.00000000000000))*(r01)*(x9279))));
 evalcond[3]=((((r11)*(x9279)))+(((IkReal(-1.00000000000000))*(x9267)*(x9275)))+(x9264)+(((IkReal(-1.00000000000000))*(x9268)*(x9271)*(x9273)))+(((r01)*(x9278)))+(((IkReal(-1.00000000000000))*(x9266)*(x9268)*(x9270)))+(((IkReal(-1.00000000000000))*(x9269)*(x9277)))+(((IkReal(-1.00000000000000))*(r12)*(x9265)*(x9268)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x9267)*(x9268)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x9268)*(x9270)))+(((IkReal(-1.00000000000000))*(r02)*(x9268)*(x9274))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -29784,8 +29677,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -29831,7 +29723,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -29876,14 +29768,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(sj5)*(x9294)*(x9297)))+(((IkReal(-1.
 evalcond[3]=((((IkReal(-1.00000000000000))*(x9289)*(x9299)))+(((cj0)*(x9298)))+(((sj0)*(x9295)))+(((IkReal(-1.00000000000000))*(sj5)*(x9292)*(x9294)))+(((IkReal(-1.00000000000000))*(x9290)*(x9303)))+(((IkReal(-1.00000000000000))*(x9290)*(x9297)))+(((IkReal(-1.00000000000000))*(sj5)*(x9291)*(x9294))));
 evalcond[4]=((((sj0)*(x9291)*(x9293)))+(((IkReal(-1.00000000000000))*(x9293)*(x9294)*(x9297)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x9294)))+(((r00)*(sj0)*(x9300)))+(((sj0)*(x9292)*(x9293)))+(((IkReal(-1.00000000000000))*(r10)*(x9294)*(x9300)))+(((x9290)*(x9305)))+(((r11)*(x9308)))+(((IkReal(-1.00000000000000))*(x9293)*(x9294)*(x9303)))+(x9289)+(((IkReal(-1.00000000000000))*(r01)*(x9296)*(x9304))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x9291)*(x9293)*(x9294)))+(((r11)*(sj0)*(x9304)))+(((IkReal(-1.00000000000000))*(x9288)*(x9299)))+(((IkReal(-1.00000000000000))*(x9293)*(x9296)*(x9303)))+(((IkReal(-1.00000000000000))*(x9293)*(x9296)*(x9297)))+(((IkReal(-1.00000000000000))*(x9290)*(x9306)))+(((IkReal(-1.00000000000000))*(sj5)*(x9294)*(x9305)))+(((IkReal(-1.00000000000000))*(x9292)*(x9293)*(x9294)))+(((IkReal(-1.00000000000000))*(r00)*(x9294)*(x9300)))+(((IkReal(-1.00000000000000))*(r10)*(x9296)*(x9300)))+(((r01)*(x9308))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -29919,8 +29811,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -29951,7 +29842,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -29996,14 +29887,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x9332)))+(((x9315)*(x9317)))+(((IkRe
 evalcond[3]=((((IkReal(-1.00000000000000))*(x9314)*(x9324)))+(((IkReal(-1.00000000000000))*(sj5)*(x9316)*(x9319)))+(((IkReal(-1.00000000000000))*(x9315)*(x9322)))+(((IkReal(-1.00000000000000))*(x9315)*(x9328)))+(((sj0)*(x9320)))+(((IkReal(-1.00000000000000))*(sj5)*(x9317)*(x9319)))+(((cj0)*(x9323))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r01)*(x9321)*(x9329)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x9319)))+(((r11)*(x9333)))+(((sj0)*(x9316)*(x9318)))+(((IkReal(-1.00000000000000))*(x9318)*(x9319)*(x9322)))+(((IkReal(-1.00000000000000))*(x9318)*(x9319)*(x9328)))+(((IkReal(-1.00000000000000))*(r10)*(x9319)*(x9325)))+(((sj0)*(x9317)*(x9318)))+(((r00)*(sj0)*(x9325)))+(((x9315)*(x9330)))+(x9314));
 evalcond[5]=((((r11)*(sj0)*(x9329)))+(((IkReal(-1.00000000000000))*(x9318)*(x9321)*(x9322)))+(((IkReal(-1.00000000000000))*(r10)*(x9321)*(x9325)))+(((IkReal(-1.00000000000000))*(x9317)*(x9318)*(x9319)))+(((IkReal(-1.00000000000000))*(sj5)*(x9319)*(x9330)))+(((IkReal(-1.00000000000000))*(x9315)*(x9331)))+(((IkReal(-1.00000000000000))*(r00)*(x9319)*(x9325)))+(((IkReal(-1.00000000000000))*(x9313)*(x9324)))+(((IkReal(-1.00000000000000))*(x9316)*(x9318)*(x9319)))+(((r01)*(x9333)))+(((IkReal(-1.00000000000000))*(x9318)*(x9321)*(x9328))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -30039,8 +29930,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -30070,7 +29960,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -30115,14 +30005,14 @@ evalcond[2]=((((x9339)*(x9341)))+(((IkReal(-1.00000000000000))*(x9345)*(x9347)))
 evalcond[3]=((((IkReal(-1.00000000000000))*(x9339)*(x9352)))+(((sj0)*(x9344)))+(((IkReal(-1.00000000000000))*(x9339)*(x9346)))+(((IkReal(-1.00000000000000))*(sj5)*(x9340)*(x9343)))+(((cj0)*(x9347)))+(((IkReal(-1.00000000000000))*(sj5)*(x9341)*(x9343)))+(((IkReal(-1.00000000000000))*(x9338)*(x9348))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x9343)))+(x9338)+(((IkReal(-1.00000000000000))*(x9342)*(x9343)*(x9346)))+(((sj0)*(x9341)*(x9342)))+(((IkReal(-1.00000000000000))*(r01)*(x9345)*(x9353)))+(((r00)*(sj0)*(x9349)))+(((IkReal(-1.00000000000000))*(x9342)*(x9343)*(x9352)))+(((sj0)*(x9340)*(x9342)))+(((x9339)*(x9354)))+(((r11)*(x9357)))+(((IkReal(-1.00000000000000))*(r10)*(x9343)*(x9349))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x9342)*(x9345)*(x9352)))+(((IkReal(-1.00000000000000))*(x9341)*(x9342)*(x9343)))+(((IkReal(-1.00000000000000))*(r00)*(x9343)*(x9349)))+(((IkReal(-1.00000000000000))*(x9342)*(x9345)*(x9346)))+(((IkReal(-1.00000000000000))*(x9337)*(x9348)))+(((r11)*(sj0)*(x9353)))+(((r01)*(x9357)))+(((IkReal(-1.00000000000000))*(r10)*(x9345)*(x9349)))+(((IkReal(-1.00000000000000))*(x9339)*(x9355)))+(((IkReal(-1.00000000000000))*(x9340)*(x9342)*(x9343)))+(((IkReal(-1.00000000000000))*(sj5)*(x9343)*(x9354))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -30158,8 +30048,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -30199,7 +30088,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -30234,7 +30123,7 @@ IkReal x9378=((r11)*(sj6)*(x9366));
 evalcond[0]=((((r20)*(sj6)*(x9374)))+(((IkReal(-1.00000000000000))*(r20)*(x9375)))+(((IkReal(-1.00000000000000))*(cj1)))+(((cj6)*(r21)*(x9374)))+(((r21)*(sj6)*(x9366)))+(((r22)*(x9372))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x9369)*(x9371)*(x9374)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x9369)*(x9374)))+(((IkReal(-1.00000000000000))*(x9369)*(x9378)))+(((x9367)*(x9376)))+(((cj0)*(r10)*(x9375)))+(((IkReal(-1.00000000000000))*(r00)*(x9370)*(x9375)))+(((r02)*(sj0)*(x9372)))+(((sj0)*(x9377)))+(((IkReal(-1.00000000000000))*(r12)*(x9369)*(x9372)))+(((x9368)*(x9376))));
 evalcond[2]=((((r10)*(sj0)*(x9375)))+(sj1)+(((IkReal(-1.00000000000000))*(x9369)*(x9377)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x9370)*(x9374)))+(((IkReal(-1.00000000000000))*(x9370)*(x9371)*(x9374)))+(((IkReal(-1.00000000000000))*(r12)*(x9370)*(x9372)))+(((IkReal(-1.00000000000000))*(r02)*(x9369)*(x9372)))+(((IkReal(-1.00000000000000))*(x9367)*(x9369)*(x9374)))+(((cj0)*(r00)*(x9375)))+(((IkReal(-1.00000000000000))*(x9368)*(x9369)*(x9374)))+(((IkReal(-1.00000000000000))*(x9370)*(x9378))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -30316,7 +30205,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -30354,14 +30243,14 @@ evalcond[0]=((((r20)*(x9422)))+(((r21)*(x9423)))+(((IkReal(-1.00000000000000))*(
 evalcond[1]=((((cj5)*(r20)*(x9419)))+(((r22)*(x9421)))+(((IkReal(-1.00000000000000))*(r21)*(x9416)))+(((IkReal(-1.00000000000000))*(x9424)))+(((cj5)*(r21)*(x9418)))+(((r20)*(x9415))));
 evalcond[2]=((((r12)*(x9414)))+(((x9410)*(x9411)))+(((IkReal(-1.00000000000000))*(x9417)*(x9423)))+(((IkReal(-1.00000000000000))*(r10)*(x9420)*(x9422)))+(((IkReal(-1.00000000000000))*(x9424)))+(((x9410)*(x9412)))+(((IkReal(-1.00000000000000))*(r02)*(x9413))));
 evalcond[3]=((x9409)+(((cj4)*(x9412)*(x9413)))+(((IkReal(-1.00000000000000))*(r11)*(x9414)*(x9418)))+(((cj4)*(r02)*(x9410)))+(((x9416)*(x9417)))+(((IkReal(-1.00000000000000))*(r10)*(x9415)*(x9420)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x9416)))+(((cj4)*(x9411)*(x9413)))+(((r00)*(sj0)*(x9415)))+(((IkReal(-1.00000000000000))*(r12)*(x9420)*(x9421)))+(((IkReal(-1.00000000000000))*(r10)*(x9414)*(x9419))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -30397,8 +30286,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -30463,7 +30351,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -30501,14 +30389,14 @@ evalcond[0]=((((r20)*(x9470)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((r2
 evalcond[1]=((((r22)*(x9469)))+(((cj5)*(r21)*(x9466)))+(x9456)+(((cj5)*(r20)*(x9467)))+(((r20)*(x9463)))+(((IkReal(-1.00000000000000))*(r21)*(x9464))));
 evalcond[2]=((((x9458)*(x9459)))+(((x9458)*(x9460)))+(((IkReal(-1.00000000000000))*(x9465)*(x9471)))+(((r12)*(x9462)))+(((IkReal(-1.00000000000000))*(x9456)))+(((IkReal(-1.00000000000000))*(r10)*(x9468)*(x9470)))+(((IkReal(-1.00000000000000))*(r02)*(x9461))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r11)*(x9462)*(x9466)))+(((cj4)*(r02)*(x9458)))+(((x9464)*(x9465)))+(((cj4)*(x9460)*(x9461)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x9464)))+(((IkReal(-1.00000000000000))*(r10)*(x9463)*(x9468)))+(((IkReal(-1.00000000000000))*(r10)*(x9462)*(x9467)))+(((IkReal(-1.00000000000000))*(r12)*(x9468)*(x9469)))+(((r00)*(sj0)*(x9463)))+(x9457)+(((cj4)*(x9459)*(x9461))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -30544,8 +30432,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -30614,7 +30501,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -30653,14 +30540,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x9515)*(x9517)))+(((IkReal(-1.000000
 evalcond[1]=((((IkReal(-1.00000000000000))*(x9508)*(x9515)))+(((IkReal(-1.00000000000000))*(x9507)))+(((r02)*(x9513)))+(((IkReal(-1.00000000000000))*(x9509)*(x9517)))+(((r12)*(x9514)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x9517)))+(((IkReal(-1.00000000000000))*(x9508)*(x9516))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x9511)*(x9513)*(x9515)))+(((cj4)*(r02)*(x9508)))+(((r11)*(x9522)))+(((IkReal(-1.00000000000000))*(x9518)*(x9521)))+(((x9510)*(x9520)))+(((cj4)*(x9509)*(x9514)))+(((IkReal(-1.00000000000000))*(r01)*(x9523)))+(((IkReal(-1.00000000000000))*(r12)*(x9511)*(x9517)))+(((IkReal(-1.00000000000000))*(x9511)*(x9513)*(x9516)))+(x9507)+(((x9510)*(x9512))));
 evalcond[3]=((((r01)*(x9522)))+(((IkReal(-1.00000000000000))*(x9510)*(x9518)))+(((IkReal(-1.00000000000000))*(x9509)*(x9511)*(x9513)))+(((IkReal(-1.00000000000000))*(x9512)*(x9521)))+(((IkReal(-1.00000000000000))*(r02)*(x9511)*(x9517)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x9511)*(x9513)))+(((r11)*(x9523)))+(((IkReal(-1.00000000000000))*(x9511)*(x9514)*(x9516)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x9510)*(x9511)))+(((IkReal(-1.00000000000000))*(x9519)))+(((IkReal(-1.00000000000000))*(r12)*(x9508)*(x9511))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -30696,8 +30583,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -30765,7 +30651,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -30804,14 +30690,14 @@ evalcond[0]=((((r12)*(x9565)))+(((IkReal(-1.00000000000000))*(x9559)))+(((IkReal
 evalcond[1]=((((IkReal(-1.00000000000000))*(x9560)*(x9567)))+(((r12)*(x9566)))+(((r02)*(x9565)))+(((IkReal(-1.00000000000000))*(x9561)*(x9569)))+(x9558)+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x9569)))+(((IkReal(-1.00000000000000))*(x9560)*(x9568))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r01)*(x9574)))+(((IkReal(-1.00000000000000))*(x9570)*(x9572)))+(((IkReal(-1.00000000000000))*(x9563)*(x9565)*(x9568)))+(x9558)+(((cj4)*(x9561)*(x9566)))+(((x9562)*(x9571)))+(((r11)*(x9573)))+(((cj4)*(r02)*(x9560)))+(((IkReal(-1.00000000000000))*(x9563)*(x9565)*(x9567)))+(((x9562)*(x9564)))+(((IkReal(-1.00000000000000))*(r12)*(x9563)*(x9569))));
 evalcond[3]=((((r01)*(x9573)))+(((IkReal(-1.00000000000000))*(x9564)*(x9572)))+(((IkReal(-1.00000000000000))*(x9563)*(x9566)*(x9568)))+(((r11)*(x9574)))+(((IkReal(-1.00000000000000))*(r02)*(x9563)*(x9569)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x9562)*(x9563)))+(x9559)+(((IkReal(-1.00000000000000))*(x9562)*(x9570)))+(((IkReal(-1.00000000000000))*(r12)*(x9560)*(x9563)))+(((IkReal(-1.00000000000000))*(x9561)*(x9563)*(x9565)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x9563)*(x9565))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -30847,8 +30733,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -30894,7 +30779,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -30939,14 +30824,14 @@ evalcond[2]=((((x9585)*(x9586)))+(((IkReal(-1.00000000000000))*(x9602)))+(((IkRe
 evalcond[3]=((((IkReal(-1.00000000000000))*(x9585)*(x9592)))+(((IkReal(-1.00000000000000))*(x9584)*(x9594)))+(((IkReal(-1.00000000000000))*(sj5)*(x9587)*(x9589)))+(((IkReal(-1.00000000000000))*(sj5)*(x9586)*(x9589)))+(((IkReal(-1.00000000000000))*(x9585)*(x9598)))+(((sj0)*(x9590)))+(((cj0)*(x9593))));
 evalcond[4]=((((r00)*(sj0)*(x9595)))+(((IkReal(-1.00000000000000))*(x9588)*(x9589)*(x9592)))+(((IkReal(-1.00000000000000))*(r01)*(x9591)*(x9599)))+(((r11)*(x9603)))+(x9584)+(((IkReal(-1.00000000000000))*(x9588)*(x9589)*(x9598)))+(((sj0)*(x9586)*(x9588)))+(((IkReal(-1.00000000000000))*(r10)*(x9589)*(x9595)))+(((sj0)*(x9587)*(x9588)))+(((x9585)*(x9600)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x9589))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x9585)*(x9601)))+(((IkReal(-1.00000000000000))*(x9587)*(x9588)*(x9589)))+(((IkReal(-1.00000000000000))*(r00)*(x9589)*(x9595)))+(((IkReal(-1.00000000000000))*(x9583)*(x9594)))+(((r11)*(sj0)*(x9599)))+(((r01)*(x9603)))+(((IkReal(-1.00000000000000))*(r10)*(x9591)*(x9595)))+(((IkReal(-1.00000000000000))*(x9586)*(x9588)*(x9589)))+(((IkReal(-1.00000000000000))*(x9588)*(x9591)*(x9592)))+(((IkReal(-1.00000000000000))*(sj5)*(x9589)*(x9600)))+(((IkReal(-1.00000000000000))*(x9588)*(x9591)*(x9598))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -30982,8 +30867,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -31014,7 +30898,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -31059,14 +30943,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x9616)*(x9618)))+(((x9610)*(x9611)))
 evalcond[3]=((((IkReal(-1.00000000000000))*(x9609)*(x9619)))+(((cj0)*(x9618)))+(((IkReal(-1.00000000000000))*(sj5)*(x9611)*(x9614)))+(((IkReal(-1.00000000000000))*(sj5)*(x9612)*(x9614)))+(((IkReal(-1.00000000000000))*(x9610)*(x9623)))+(((sj0)*(x9615)))+(((IkReal(-1.00000000000000))*(x9610)*(x9617))));
 evalcond[4]=((((x9610)*(x9625)))+(((sj0)*(x9611)*(x9613)))+(((r11)*(x9628)))+(((r00)*(sj0)*(x9620)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x9614)))+(((IkReal(-1.00000000000000))*(r01)*(x9616)*(x9624)))+(((IkReal(-1.00000000000000))*(x9613)*(x9614)*(x9617)))+(((IkReal(-1.00000000000000))*(r10)*(x9614)*(x9620)))+(((IkReal(-1.00000000000000))*(x9613)*(x9614)*(x9623)))+(((sj0)*(x9612)*(x9613)))+(x9609));
 evalcond[5]=((((r11)*(sj0)*(x9624)))+(((IkReal(-1.00000000000000))*(r00)*(x9614)*(x9620)))+(((IkReal(-1.00000000000000))*(x9613)*(x9616)*(x9617)))+(((IkReal(-1.00000000000000))*(x9611)*(x9613)*(x9614)))+(((IkReal(-1.00000000000000))*(x9610)*(x9626)))+(((IkReal(-1.00000000000000))*(r10)*(x9616)*(x9620)))+(((IkReal(-1.00000000000000))*(x9613)*(x9616)*(x9623)))+(((r01)*(x9628)))+(((IkReal(-1.00000000000000))*(sj5)*(x9614)*(x9625)))+(((IkReal(-1.00000000000000))*(x9612)*(x9613)*(x9614)))+(((IkReal(-1.00000000000000))*(x9608)*(x9619))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -31102,8 +30986,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -31133,7 +31016,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -31178,14 +31061,14 @@ evalcond[2]=((((x9634)*(x9636)))+(((IkReal(-1.00000000000000))*(x9640)*(x9642)))
 evalcond[3]=((((IkReal(-1.00000000000000))*(sj5)*(x9636)*(x9638)))+(((sj0)*(x9639)))+(((IkReal(-1.00000000000000))*(sj5)*(x9635)*(x9638)))+(((IkReal(-1.00000000000000))*(x9634)*(x9647)))+(((IkReal(-1.00000000000000))*(x9633)*(x9643)))+(((IkReal(-1.00000000000000))*(x9634)*(x9641)))+(((cj0)*(x9642))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x9637)*(x9638)*(x9641)))+(((IkReal(-1.00000000000000))*(x9637)*(x9638)*(x9647)))+(((IkReal(-1.00000000000000))*(r10)*(x9638)*(x9644)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x9638)))+(x9633)+(((sj0)*(x9636)*(x9637)))+(((x9634)*(x9649)))+(((r00)*(sj0)*(x9644)))+(((sj0)*(x9635)*(x9637)))+(((r11)*(x9652)))+(((IkReal(-1.00000000000000))*(r01)*(x9640)*(x9648))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(sj5)*(x9638)*(x9649)))+(((IkReal(-1.00000000000000))*(x9636)*(x9637)*(x9638)))+(((r01)*(x9652)))+(((IkReal(-1.00000000000000))*(x9637)*(x9640)*(x9641)))+(((IkReal(-1.00000000000000))*(x9634)*(x9650)))+(((IkReal(-1.00000000000000))*(x9637)*(x9640)*(x9647)))+(((IkReal(-1.00000000000000))*(x9635)*(x9637)*(x9638)))+(((IkReal(-1.00000000000000))*(x9632)*(x9643)))+(((IkReal(-1.00000000000000))*(r10)*(x9640)*(x9644)))+(((IkReal(-1.00000000000000))*(r00)*(x9638)*(x9644)))+(((r11)*(sj0)*(x9648))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -31221,8 +31104,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -31384,7 +31266,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -31412,7 +31294,7 @@ IkReal x9754=((cj6)*(r01)*(sj5));
 IkReal x9755=((IkReal(1.00000000000000))*(sj0)*(sj5));
 evalcond[0]=((((IkReal(-1.00000000000000))*(r02)*(x9752)))+(((sj0)*(x9753)))+(((sj0)*(x9754)))+(((IkReal(-1.00000000000000))*(sj5)*(x9749)*(x9751)))+(((IkReal(-1.00000000000000))*(sj5)*(x9749)*(x9750)))+(IKsin(j3))+(((r12)*(x9748))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x9751)*(x9755)))+(((IkReal(-1.00000000000000))*(x9750)*(x9755)))+(((r12)*(x9752)))+(((IkReal(-1.00000000000000))*(IKcos(j3))))+(((IkReal(-1.00000000000000))*(x9749)*(x9753)))+(((r02)*(x9748)))+(((IkReal(-1.00000000000000))*(x9749)*(x9754))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -31507,7 +31389,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -31558,14 +31440,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(r10)*(x9811)*(x9815)*(x9824)))+(((Ik
 evalcond[3]=((((x9820)*(x9826)))+(((IkReal(-1.00000000000000))*(r01)*(x9819)*(x9826)))+(((r01)*(x9817)*(x9829)))+(((IkReal(-1.00000000000000))*(r10)*(x9812)*(x9815)*(x9824)))+(((x9822)*(x9829)))+(((IkReal(-1.00000000000000))*(x9814)*(x9816)*(x9831)))+(((IkReal(-1.00000000000000))*(r10)*(x9814)*(x9828)))+(((x9827)*(x9829)))+(((IkReal(-1.00000000000000))*(cj3)))+(((x9818)*(x9828)))+(((IkReal(-1.00000000000000))*(x9815)*(x9835))));
 evalcond[4]=((((x9820)*(x9831)))+(((IkReal(-1.00000000000000))*(x9814)*(x9816)*(x9826)))+(((IkReal(-1.00000000000000))*(x9811)*(x9815)*(x9822)))+(((IkReal(-1.00000000000000))*(x9818)*(x9829)))+(((IkReal(-1.00000000000000))*(x9821)*(x9826)))+(((x9823)*(x9829)))+(((IkReal(-1.00000000000000))*(x9814)*(x9825)*(x9828)))+(((IkReal(-1.00000000000000))*(x9815)*(x9836)))+(((IkReal(-1.00000000000000))*(x9826)*(x9837)))+(((IkReal(-1.00000000000000))*(x9811)*(x9815)*(x9827))));
 evalcond[5]=((((r01)*(sj6)*(x9828)))+(((IkReal(-1.00000000000000))*(r10)*(x9814)*(x9826)))+(((IkReal(-1.00000000000000))*(x9812)*(x9815)*(x9822)))+(((IkReal(-1.00000000000000))*(x9812)*(x9815)*(x9827)))+(((IkReal(-1.00000000000000))*(x9814)*(x9816)*(x9829)))+(((IkReal(-1.00000000000000))*(x9821)*(x9829)))+(((x9818)*(x9826)))+(((IkReal(-1.00000000000000))*(sj3)))+(((IkReal(-1.00000000000000))*(x9829)*(x9837)))+(((IkReal(-1.00000000000000))*(x9814)*(x9825)*(x9831)))+(((IkReal(-1.00000000000000))*(r00)*(x9814)*(x9828))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -31601,8 +31483,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -31629,7 +31510,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -31680,14 +31561,14 @@ evalcond[2]=((((x9850)*(x9858)))+(((r01)*(x9844)*(x9853)))+(((r01)*(sj6)*(x9856)
 evalcond[3]=((((IkReal(-1.00000000000000))*(x9841)*(x9843)*(x9858)))+(((x9845)*(x9855)))+(((IkReal(-1.00000000000000))*(r01)*(x9846)*(x9853)))+(((IkReal(-1.00000000000000))*(x9842)*(x9862)))+(((x9849)*(x9856)))+(((IkReal(-1.00000000000000))*(r10)*(x9839)*(x9842)*(x9851)))+(((IkReal(-1.00000000000000))*(cj3)))+(((x9847)*(x9853)))+(((r01)*(x9844)*(x9856)))+(((x9854)*(x9856)))+(((IkReal(-1.00000000000000))*(r10)*(x9841)*(x9855))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x9838)*(x9842)*(x9854)))+(((x9850)*(x9856)))+(((IkReal(-1.00000000000000))*(x9841)*(x9852)*(x9855)))+(((IkReal(-1.00000000000000))*(x9845)*(x9856)))+(((IkReal(-1.00000000000000))*(x9842)*(x9863)))+(((IkReal(-1.00000000000000))*(x9848)*(x9853)))+(((x9847)*(x9858)))+(((IkReal(-1.00000000000000))*(x9841)*(x9843)*(x9853)))+(((IkReal(-1.00000000000000))*(x9838)*(x9842)*(x9849)))+(((IkReal(-1.00000000000000))*(x9853)*(x9864))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x9839)*(x9842)*(x9849)))+(((IkReal(-1.00000000000000))*(x9856)*(x9864)))+(((IkReal(-1.00000000000000))*(x9841)*(x9843)*(x9856)))+(((IkReal(-1.00000000000000))*(x9848)*(x9856)))+(((IkReal(-1.00000000000000))*(x9841)*(x9852)*(x9858)))+(((IkReal(-1.00000000000000))*(x9839)*(x9842)*(x9854)))+(((IkReal(-1.00000000000000))*(sj3)))+(((r01)*(sj6)*(x9855)))+(((IkReal(-1.00000000000000))*(r10)*(x9841)*(x9853)))+(((IkReal(-1.00000000000000))*(r00)*(x9841)*(x9855)))+(((x9845)*(x9853))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -31723,8 +31604,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -31783,7 +31663,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -31811,7 +31691,7 @@ IkReal x9894=((cj6)*(r01)*(sj5));
 IkReal x9895=((IkReal(1.00000000000000))*(sj0)*(sj5));
 evalcond[0]=((((sj0)*(x9893)))+(((IkReal(-1.00000000000000))*(sj5)*(x9889)*(x9891)))+(((r12)*(x9888)))+(((sj0)*(x9894)))+(((IkReal(-1.00000000000000))*(sj5)*(x9889)*(x9890)))+(IKsin(j3))+(((IkReal(-1.00000000000000))*(r02)*(x9892))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x9890)*(x9895)))+(((IkReal(-1.00000000000000))*(x9891)*(x9895)))+(((IkReal(-1.00000000000000))*(x9889)*(x9893)))+(((r02)*(x9888)))+(((r12)*(x9892)))+(IKcos(j3))+(((IkReal(-1.00000000000000))*(x9889)*(x9894))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -31900,7 +31780,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -31951,14 +31831,14 @@ evalcond[2]=((((x9960)*(x9961)))+(((IkReal(-1.00000000000000))*(x9946)*(x9949)*(
 evalcond[3]=((((x9961)*(x9963)))+(((IkReal(-1.00000000000000))*(r10)*(x9946)*(x9949)*(x9958)))+(((IkReal(-1.00000000000000))*(r01)*(x9953)*(x9960)))+(((x9952)*(x9962)))+(((x9956)*(x9963)))+(((IkReal(-1.00000000000000))*(x9948)*(x9950)*(x9965)))+(((IkReal(-1.00000000000000))*(cj3)))+(((IkReal(-1.00000000000000))*(r10)*(x9948)*(x9962)))+(((r01)*(x9951)*(x9963)))+(((x9954)*(x9960)))+(((IkReal(-1.00000000000000))*(x9949)*(x9969))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x9945)*(x9949)*(x9956)))+(((IkReal(-1.00000000000000))*(x9945)*(x9949)*(x9961)))+(((IkReal(-1.00000000000000))*(x9948)*(x9959)*(x9962)))+(((IkReal(-1.00000000000000))*(x9952)*(x9963)))+(((IkReal(-1.00000000000000))*(x9949)*(x9970)))+(((x9957)*(x9963)))+(((x9954)*(x9965)))+(((IkReal(-1.00000000000000))*(x9948)*(x9950)*(x9960)))+(((IkReal(-1.00000000000000))*(x9955)*(x9960)))+(((IkReal(-1.00000000000000))*(x9960)*(x9971))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x9963)*(x9971)))+(((IkReal(-1.00000000000000))*(x9955)*(x9963)))+(((IkReal(-1.00000000000000))*(x9948)*(x9950)*(x9963)))+(sj3)+(((IkReal(-1.00000000000000))*(x9946)*(x9949)*(x9956)))+(((x9952)*(x9960)))+(((IkReal(-1.00000000000000))*(x9948)*(x9959)*(x9965)))+(((r01)*(sj6)*(x9962)))+(((IkReal(-1.00000000000000))*(r00)*(x9948)*(x9962)))+(((IkReal(-1.00000000000000))*(r10)*(x9948)*(x9960)))+(((IkReal(-1.00000000000000))*(x9946)*(x9949)*(x9961))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -31994,8 +31874,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -32022,7 +31901,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -32073,14 +31952,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x9972)*(x9976)*(x9982)))+(((IkReal(-
 evalcond[3]=((((IkReal(-1.00000000000000))*(x9976)*(x9996)))+(((x9979)*(x9989)))+(((x9988)*(x9990)))+(((IkReal(-1.00000000000000))*(r10)*(x9973)*(x9976)*(x9985)))+(((IkReal(-1.00000000000000))*(r01)*(x9980)*(x9987)))+(((x9983)*(x9990)))+(((IkReal(-1.00000000000000))*(x9975)*(x9977)*(x9992)))+(((x9981)*(x9987)))+(((IkReal(-1.00000000000000))*(cj3)))+(((r01)*(x9978)*(x9990)))+(((IkReal(-1.00000000000000))*(r10)*(x9975)*(x9989))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x9972)*(x9976)*(x9983)))+(((IkReal(-1.00000000000000))*(x9987)*(x9998)))+(((IkReal(-1.00000000000000))*(x9982)*(x9987)))+(((IkReal(-1.00000000000000))*(x9972)*(x9976)*(x9988)))+(((IkReal(-1.00000000000000))*(x9976)*(x9997)))+(((IkReal(-1.00000000000000))*(x9979)*(x9990)))+(((IkReal(-1.00000000000000))*(x9975)*(x9986)*(x9989)))+(((IkReal(-1.00000000000000))*(x9975)*(x9977)*(x9987)))+(((x9984)*(x9990)))+(((x9981)*(x9992))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x9973)*(x9976)*(x9988)))+(sj3)+(((IkReal(-1.00000000000000))*(x9975)*(x9986)*(x9992)))+(((IkReal(-1.00000000000000))*(x9990)*(x9998)))+(((IkReal(-1.00000000000000))*(r10)*(x9975)*(x9987)))+(((IkReal(-1.00000000000000))*(r00)*(x9975)*(x9989)))+(((x9979)*(x9987)))+(((IkReal(-1.00000000000000))*(x9975)*(x9977)*(x9990)))+(((IkReal(-1.00000000000000))*(x9982)*(x9990)))+(((r01)*(sj6)*(x9989)))+(((IkReal(-1.00000000000000))*(x9973)*(x9976)*(x9983))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -32116,8 +31995,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -32163,7 +32041,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -32192,7 +32070,7 @@ IkReal x10010=((cj6)*(r11)*(sj5));
 evalcond[0]=((((cj6)*(r21)*(sj5)))+(((IkReal(-1.00000000000000))*(sj1)*(x10008)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((r20)*(x10004))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x10006)*(x10010)))+(((sj0)*(x10009)))+(((r12)*(x10005)))+(((IkReal(-1.00000000000000))*(r10)*(x10004)*(x10006)))+(((IkReal(-1.00000000000000))*(cj5)*(r02)*(x10007)))+(IKsin(j3))+(((r00)*(sj0)*(x10004))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x10007)*(x10010)))+(((IkReal(-1.00000000000000))*(r00)*(x10004)*(x10006)))+(((cj5)*(r12)*(sj0)))+(((r02)*(x10005)))+(((IkReal(-1.00000000000000))*(r10)*(x10004)*(x10007)))+(((IkReal(-1.00000000000000))*(cj1)*(x10008)))+(((IkReal(-1.00000000000000))*(x10006)*(x10009))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -32288,7 +32166,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -32340,14 +32218,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x10068)*(x10071)*(x10075)))+(((x1008
 evalcond[3]=((((IkReal(-1.00000000000000))*(r10)*(x10068)*(x10071)*(x10081)))+(((IkReal(-1.00000000000000))*(r10)*(x10070)*(x10085)))+(((IkReal(-1.00000000000000))*(cj3)))+(((x10084)*(x10086)))+(((IkReal(-1.00000000000000))*(r01)*(x10076)*(x10083)))+(((IkReal(-1.00000000000000))*(x10071)*(x10092)))+(((x10079)*(x10086)))+(((IkReal(-1.00000000000000))*(x10070)*(x10073)*(x10088)))+(((x10075)*(x10085)))+(((x10077)*(x10083)))+(((r01)*(x10074)*(x10086))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x10078)*(x10083)))+(((IkReal(-1.00000000000000))*(x10067)*(x10071)*(x10084)))+(((IkReal(-1.00000000000000))*(x10083)*(x10094)))+(((IkReal(-1.00000000000000))*(x10070)*(x10082)*(x10085)))+(((x10077)*(x10088)))+(((IkReal(-1.00000000000000))*(x10067)*(x10071)*(x10079)))+(((IkReal(-1.00000000000000))*(x10070)*(x10073)*(x10083)))+(((IkReal(-1.00000000000000))*(x10075)*(x10086)))+(((IkReal(-1.00000000000000))*(x10071)*(x10093)))+(((x10080)*(x10086)))+(((IkReal(-1.00000000000000))*(x10072))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x10070)*(x10082)*(x10088)))+(((IkReal(-1.00000000000000))*(x10068)*(x10071)*(x10079)))+(((IkReal(-1.00000000000000))*(x10078)*(x10086)))+(((IkReal(-1.00000000000000))*(x10070)*(x10073)*(x10086)))+(((IkReal(-1.00000000000000))*(r00)*(x10070)*(x10085)))+(((IkReal(-1.00000000000000))*(x10086)*(x10094)))+(((IkReal(-1.00000000000000))*(r10)*(x10070)*(x10083)))+(((IkReal(-1.00000000000000))*(cj1)*(sj3)))+(((r01)*(sj6)*(x10085)))+(((IkReal(-1.00000000000000))*(x10068)*(x10071)*(x10084)))+(((x10075)*(x10083))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -32383,8 +32261,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -32418,7 +32295,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -32470,14 +32347,14 @@ evalcond[2]=((((r01)*(sj6)*(x10121)))+(((x10114)*(x10118)))+(((IkReal(-1.0000000
 evalcond[3]=((((IkReal(-1.00000000000000))*(x10105)*(x10108)*(x10123)))+(((x10110)*(x10120)))+(((IkReal(-1.00000000000000))*(r10)*(x10103)*(x10106)*(x10116)))+(((x10112)*(x10118)))+(((IkReal(-1.00000000000000))*(r01)*(x10111)*(x10118)))+(((IkReal(-1.00000000000000))*(cj3)))+(((x10119)*(x10121)))+(((x10114)*(x10121)))+(((r01)*(x10109)*(x10121)))+(((IkReal(-1.00000000000000))*(x10106)*(x10127)))+(((IkReal(-1.00000000000000))*(r10)*(x10105)*(x10120))));
 evalcond[4]=((((x10112)*(x10123)))+(((IkReal(-1.00000000000000))*(x10113)*(x10118)))+(((IkReal(-1.00000000000000))*(x10106)*(x10128)))+(((IkReal(-1.00000000000000))*(x10102)*(x10106)*(x10119)))+(((x10115)*(x10121)))+(((IkReal(-1.00000000000000))*(x10105)*(x10117)*(x10120)))+(((IkReal(-1.00000000000000))*(x10107)))+(((IkReal(-1.00000000000000))*(x10118)*(x10129)))+(((IkReal(-1.00000000000000))*(x10110)*(x10121)))+(((IkReal(-1.00000000000000))*(x10105)*(x10108)*(x10118)))+(((IkReal(-1.00000000000000))*(x10102)*(x10106)*(x10114))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x10103)*(x10106)*(x10119)))+(((IkReal(-1.00000000000000))*(r10)*(x10105)*(x10118)))+(((IkReal(-1.00000000000000))*(x10121)*(x10129)))+(((IkReal(-1.00000000000000))*(r00)*(x10105)*(x10120)))+(((IkReal(-1.00000000000000))*(x10105)*(x10108)*(x10121)))+(((r01)*(sj6)*(x10120)))+(((IkReal(-1.00000000000000))*(cj1)*(sj3)))+(((IkReal(-1.00000000000000))*(x10113)*(x10121)))+(((IkReal(-1.00000000000000))*(x10103)*(x10106)*(x10114)))+(((IkReal(-1.00000000000000))*(x10105)*(x10117)*(x10123)))+(((x10110)*(x10118))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -32513,8 +32390,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -32554,7 +32430,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -32589,7 +32465,7 @@ IkReal x10150=((r11)*(sj6)*(x10138));
 evalcond[0]=((((r21)*(sj6)*(x10138)))+(((cj6)*(r21)*(x10146)))+(cj1)+(((r22)*(x10144)))+(((r20)*(sj6)*(x10146)))+(((IkReal(-1.00000000000000))*(r20)*(x10147))));
 evalcond[1]=((((x10139)*(x10148)))+(((IkReal(-1.00000000000000))*(x10141)*(x10150)))+(((cj0)*(r10)*(x10147)))+(((IkReal(-1.00000000000000))*(r00)*(x10142)*(x10147)))+(((IkReal(-1.00000000000000))*(x10141)*(x10143)*(x10146)))+(((r02)*(sj0)*(x10144)))+(((x10140)*(x10148)))+(((IkReal(-1.00000000000000))*(r12)*(x10141)*(x10144)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x10141)*(x10146)))+(((sj0)*(x10149))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r02)*(x10141)*(x10144)))+(((IkReal(-1.00000000000000))*(x10140)*(x10141)*(x10146)))+(((IkReal(-1.00000000000000))*(x10139)*(x10141)*(x10146)))+(((IkReal(-1.00000000000000))*(r12)*(x10142)*(x10144)))+(((IkReal(-1.00000000000000))*(x10141)*(x10149)))+(((cj0)*(r00)*(x10147)))+(((r10)*(sj0)*(x10147)))+(((IkReal(-1.00000000000000))*(x10142)*(x10143)*(x10146)))+(((IkReal(-1.00000000000000))*(sj1)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x10142)*(x10146)))+(((IkReal(-1.00000000000000))*(x10142)*(x10150))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -32671,7 +32547,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -32709,14 +32585,14 @@ evalcond[0]=((((r20)*(x10194)))+(((IkReal(-1.00000000000000))*(x10196)))+(((r21)
 evalcond[1]=((((IkReal(-1.00000000000000))*(r21)*(x10188)))+(((cj5)*(r20)*(x10191)))+(((cj5)*(r21)*(x10190)))+(((r22)*(x10193)))+(((r20)*(x10187)))+(((IkReal(-1.00000000000000))*(x10181))));
 evalcond[2]=((((x10182)*(x10184)))+(((x10182)*(x10183)))+(((IkReal(-1.00000000000000))*(x10189)*(x10195)))+(x10181)+(((IkReal(-1.00000000000000))*(r02)*(x10185)))+(((IkReal(-1.00000000000000))*(r10)*(x10192)*(x10194)))+(((r12)*(x10186))));
 evalcond[3]=((((cj4)*(x10183)*(x10185)))+(((cj4)*(x10184)*(x10185)))+(((IkReal(-1.00000000000000))*(x10196)))+(((r00)*(sj0)*(x10187)))+(((IkReal(-1.00000000000000))*(r10)*(x10187)*(x10192)))+(((IkReal(-1.00000000000000))*(r11)*(x10186)*(x10190)))+(((x10188)*(x10189)))+(((cj4)*(r02)*(x10182)))+(((IkReal(-1.00000000000000))*(r12)*(x10192)*(x10193)))+(((IkReal(-1.00000000000000))*(r10)*(x10186)*(x10191)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x10188))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -32752,8 +32628,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -32818,7 +32693,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -32856,14 +32731,14 @@ evalcond[0]=((((sj5)*(x10240)))+(((sj5)*(x10241)))+(((IkReal(-1.00000000000000))
 evalcond[1]=((((x10235)*(x10240)))+(x10228)+(((IkReal(-1.00000000000000))*(r21)*(x10237)))+(((cj4)*(r22)*(sj5)))+(((x10235)*(x10241)))+(((r20)*(x10236))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r02)*(sj0)*(x10234)))+(((IkReal(-1.00000000000000))*(cj6)*(sj5)*(x10238)))+(((IkReal(-1.00000000000000))*(x10242)*(x10243)))+(x10228)+(((r12)*(x10233)))+(((x10230)*(x10232)))+(((x10230)*(x10231))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(cj6)*(r11)*(x10233)*(x10239)))+(((r00)*(sj0)*(x10236)))+(((IkReal(-1.00000000000000))*(x10229)))+(((x10237)*(x10238)))+(((cj4)*(r02)*(x10230)))+(((IkReal(-1.00000000000000))*(r12)*(x10239)*(x10242)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x10237)))+(((sj0)*(x10232)*(x10235)))+(((sj0)*(x10231)*(x10235)))+(((IkReal(-1.00000000000000))*(cj0)*(r10)*(x10236)))+(((IkReal(-1.00000000000000))*(x10233)*(x10239)*(x10243))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -32899,8 +32774,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -32968,7 +32842,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -33007,14 +32881,14 @@ evalcond[0]=((x10278)+(((r12)*(x10284)))+(((x10279)*(x10280)))+(((x10279)*(x1028
 evalcond[1]=((((r12)*(x10286)))+(((IkReal(-1.00000000000000))*(x10279)*(x10289)))+(((r02)*(x10284)))+(((IkReal(-1.00000000000000))*(x10291)))+(((IkReal(-1.00000000000000))*(x10285)*(x10287)))+(((IkReal(-1.00000000000000))*(x10280)*(x10287)))+(((IkReal(-1.00000000000000))*(x10279)*(x10288))));
 evalcond[2]=((((cj4)*(r02)*(x10279)))+(((IkReal(-1.00000000000000))*(x10290)*(x10294)))+(((IkReal(-1.00000000000000))*(x10291)))+(((IkReal(-1.00000000000000))*(r12)*(x10281)*(x10287)))+(((IkReal(-1.00000000000000))*(x10281)*(x10284)*(x10288)))+(((IkReal(-1.00000000000000))*(r01)*(x10293)))+(((r11)*(x10292)))+(((cj4)*(cj5)*(r01)*(x10282)))+(((IkReal(-1.00000000000000))*(x10281)*(x10284)*(x10289)))+(((x10282)*(x10283)))+(((cj4)*(x10280)*(x10286))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x10281)*(x10284)*(x10285)))+(((IkReal(-1.00000000000000))*(r12)*(x10279)*(x10281)))+(((IkReal(-1.00000000000000))*(x10281)*(x10286)*(x10289)))+(((r01)*(x10292)))+(((IkReal(-1.00000000000000))*(x10283)*(x10294)))+(((IkReal(-1.00000000000000))*(r02)*(x10281)*(x10287)))+(((IkReal(-1.00000000000000))*(x10282)*(x10290)))+(((IkReal(-1.00000000000000))*(x10280)*(x10281)*(x10284)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x10281)*(x10282)))+(((r11)*(x10293)))+(((IkReal(-1.00000000000000))*(x10278))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -33050,8 +32924,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -33117,7 +32990,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -33156,14 +33029,14 @@ evalcond[0]=((x10328)+(((x10329)*(x10330)))+(((IkReal(-1.00000000000000))*(r02)*
 evalcond[1]=((((r12)*(x10336)))+(x10327)+(((IkReal(-1.00000000000000))*(x10330)*(x10337)))+(((IkReal(-1.00000000000000))*(x10329)*(x10338)))+(((IkReal(-1.00000000000000))*(x10335)*(x10337)))+(((r02)*(x10334)))+(((IkReal(-1.00000000000000))*(x10329)*(x10339))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x10331)*(x10334)*(x10339)))+(((IkReal(-1.00000000000000))*(x10340)*(x10343)))+(((IkReal(-1.00000000000000))*(x10331)*(x10334)*(x10338)))+(((x10332)*(x10333)))+(((IkReal(-1.00000000000000))*(r12)*(x10331)*(x10337)))+(((IkReal(-1.00000000000000))*(r01)*(x10342)))+(((cj4)*(r02)*(x10329)))+(((cj4)*(x10330)*(x10336)))+(((IkReal(-1.00000000000000))*(x10327)))+(((cj4)*(cj5)*(r01)*(x10332)))+(((r11)*(x10341))));
 evalcond[3]=((((r11)*(x10342)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x10331)*(x10332)))+(x10328)+(((IkReal(-1.00000000000000))*(x10330)*(x10331)*(x10334)))+(((IkReal(-1.00000000000000))*(r12)*(x10329)*(x10331)))+(((IkReal(-1.00000000000000))*(r02)*(x10331)*(x10337)))+(((r01)*(x10341)))+(((IkReal(-1.00000000000000))*(x10331)*(x10334)*(x10335)))+(((IkReal(-1.00000000000000))*(x10331)*(x10336)*(x10339)))+(((IkReal(-1.00000000000000))*(x10333)*(x10343)))+(((IkReal(-1.00000000000000))*(x10332)*(x10340))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -33199,8 +33072,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -33245,7 +33117,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -33289,14 +33161,14 @@ evalcond[2]=((((r12)*(x10357)))+(((x10353)*(x10356)))+(((IkReal(-1.0000000000000
 evalcond[3]=((((IkReal(-1.00000000000000))*(x10352)*(x10361)))+(((r12)*(x10358)))+(((IkReal(-1.00000000000000))*(x10353)*(x10359)))+(((IkReal(-1.00000000000000))*(x10354)*(x10360)))+(((r02)*(x10357)))+(((IkReal(-1.00000000000000))*(x10353)*(x10367)))+(((IkReal(-1.00000000000000))*(x10356)*(x10360))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x10355)*(x10357)*(x10367)))+(((IkReal(-1.00000000000000))*(x10355)*(x10357)*(x10359)))+(((r11)*(x10369)))+(((cj4)*(r02)*(x10353)))+(((cj4)*(x10354)*(x10358)))+(((cj4)*(x10356)*(x10358)))+(((r00)*(sj0)*(x10362)))+(((IkReal(-1.00000000000000))*(r10)*(x10362)*(x10368)))+(((IkReal(-1.00000000000000))*(r01)*(x10370)))+(((IkReal(-1.00000000000000))*(r12)*(x10355)*(x10360)))+(((IkReal(-1.00000000000000))*(x10352))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x10354)*(x10355)*(x10357)))+(((IkReal(-1.00000000000000))*(r02)*(x10355)*(x10360)))+(((IkReal(-1.00000000000000))*(x10351)*(x10361)))+(((IkReal(-1.00000000000000))*(r12)*(x10353)*(x10355)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x10362)))+(((IkReal(-1.00000000000000))*(x10355)*(x10356)*(x10357)))+(((IkReal(-1.00000000000000))*(x10355)*(x10358)*(x10367)))+(((r01)*(x10369)))+(((IkReal(-1.00000000000000))*(r00)*(x10362)*(x10368)))+(((r11)*(x10370)))+(((IkReal(-1.00000000000000))*(x10355)*(x10358)*(x10359))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -33332,8 +33204,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -33364,7 +33235,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -33408,14 +33279,14 @@ evalcond[2]=((((x10377)*(x10378)))+(((IkReal(-1.00000000000000))*(x10384)*(x1039
 evalcond[3]=((((IkReal(-1.00000000000000))*(x10377)*(x10391)))+(((IkReal(-1.00000000000000))*(x10378)*(x10384)))+(((IkReal(-1.00000000000000))*(x10376)*(x10385)))+(((IkReal(-1.00000000000000))*(x10377)*(x10383)))+(((r12)*(x10382)))+(((IkReal(-1.00000000000000))*(x10380)*(x10384)))+(((r02)*(x10381))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x10379)*(x10381)*(x10391)))+(((cj4)*(x10380)*(x10382)))+(((r00)*(sj0)*(x10386)))+(((cj4)*(x10378)*(x10382)))+(((cj4)*(r02)*(x10377)))+(((IkReal(-1.00000000000000))*(r12)*(x10379)*(x10384)))+(((IkReal(-1.00000000000000))*(r10)*(x10386)*(x10392)))+(((IkReal(-1.00000000000000))*(x10379)*(x10381)*(x10383)))+(((IkReal(-1.00000000000000))*(r01)*(x10394)))+(((r11)*(x10393)))+(((IkReal(-1.00000000000000))*(x10376))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x10379)*(x10380)*(x10381)))+(((IkReal(-1.00000000000000))*(x10379)*(x10382)*(x10383)))+(((IkReal(-1.00000000000000))*(x10378)*(x10379)*(x10381)))+(((IkReal(-1.00000000000000))*(x10375)*(x10385)))+(((IkReal(-1.00000000000000))*(r12)*(x10377)*(x10379)))+(((r01)*(x10393)))+(((r11)*(x10394)))+(((IkReal(-1.00000000000000))*(r02)*(x10379)*(x10384)))+(((IkReal(-1.00000000000000))*(x10379)*(x10382)*(x10391)))+(((IkReal(-1.00000000000000))*(r00)*(x10386)*(x10392)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x10386))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -33451,8 +33322,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -33482,7 +33352,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -33526,14 +33396,14 @@ evalcond[2]=((((x10400)*(x10403)))+(((IkReal(-1.00000000000000))*(x10407)*(x1041
 evalcond[3]=((((r12)*(x10405)))+(((r02)*(x10404)))+(((IkReal(-1.00000000000000))*(x10400)*(x10406)))+(((IkReal(-1.00000000000000))*(x10403)*(x10407)))+(((IkReal(-1.00000000000000))*(x10399)*(x10408)))+(((IkReal(-1.00000000000000))*(x10401)*(x10407)))+(((IkReal(-1.00000000000000))*(x10400)*(x10414))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r10)*(x10409)*(x10415)))+(((r00)*(sj0)*(x10409)))+(((IkReal(-1.00000000000000))*(x10402)*(x10404)*(x10406)))+(((r11)*(x10416)))+(((IkReal(-1.00000000000000))*(x10399)))+(((cj4)*(x10403)*(x10405)))+(((IkReal(-1.00000000000000))*(r01)*(x10417)))+(((IkReal(-1.00000000000000))*(r12)*(x10402)*(x10407)))+(((cj4)*(x10401)*(x10405)))+(((cj4)*(r02)*(x10400)))+(((IkReal(-1.00000000000000))*(x10402)*(x10404)*(x10414))));
 evalcond[5]=((((r11)*(x10417)))+(((IkReal(-1.00000000000000))*(x10401)*(x10402)*(x10404)))+(((IkReal(-1.00000000000000))*(x10402)*(x10405)*(x10414)))+(((IkReal(-1.00000000000000))*(x10402)*(x10405)*(x10406)))+(((IkReal(-1.00000000000000))*(x10402)*(x10403)*(x10404)))+(((r01)*(x10416)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x10409)))+(((IkReal(-1.00000000000000))*(x10398)*(x10408)))+(((IkReal(-1.00000000000000))*(r00)*(x10409)*(x10415)))+(((IkReal(-1.00000000000000))*(r02)*(x10402)*(x10407)))+(((IkReal(-1.00000000000000))*(r12)*(x10400)*(x10402))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -33569,8 +33439,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -33610,7 +33479,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -33645,7 +33514,7 @@ IkReal x10438=((r11)*(sj6)*(x10426));
 evalcond[0]=((((r22)*(x10432)))+(((r20)*(sj6)*(x10434)))+(((cj6)*(r21)*(x10434)))+(cj1)+(((IkReal(-1.00000000000000))*(r20)*(x10435)))+(((r21)*(sj6)*(x10426))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(r12)*(x10429)*(x10432)))+(((sj0)*(x10437)))+(((IkReal(-1.00000000000000))*(x10429)*(x10431)*(x10434)))+(((cj0)*(r10)*(x10435)))+(((r02)*(sj0)*(x10432)))+(((IkReal(-1.00000000000000))*(r00)*(x10430)*(x10435)))+(((x10427)*(x10436)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x10429)*(x10434)))+(((x10428)*(x10436)))+(((IkReal(-1.00000000000000))*(x10429)*(x10438))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(cj6)*(r11)*(x10430)*(x10434)))+(((IkReal(-1.00000000000000))*(x10430)*(x10438)))+(((IkReal(-1.00000000000000))*(x10429)*(x10437)))+(((IkReal(-1.00000000000000))*(sj1)))+(((r10)*(sj0)*(x10435)))+(((IkReal(-1.00000000000000))*(r12)*(x10430)*(x10432)))+(((cj0)*(r00)*(x10435)))+(((IkReal(-1.00000000000000))*(x10428)*(x10429)*(x10434)))+(((IkReal(-1.00000000000000))*(r02)*(x10429)*(x10432)))+(((IkReal(-1.00000000000000))*(x10427)*(x10429)*(x10434)))+(((IkReal(-1.00000000000000))*(x10430)*(x10431)*(x10434))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -33727,7 +33596,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -33765,14 +33634,14 @@ evalcond[0]=((((r21)*(x10483)))+(((r20)*(x10482)))+(((IkReal(-1.00000000000000))
 evalcond[1]=((((cj5)*(r20)*(x10479)))+(((IkReal(-1.00000000000000))*(x10469)))+(((IkReal(-1.00000000000000))*(r21)*(x10476)))+(((r22)*(x10481)))+(((cj5)*(r21)*(x10478)))+(((r20)*(x10475))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r02)*(x10473)))+(((IkReal(-1.00000000000000))*(r10)*(x10480)*(x10482)))+(((r12)*(x10474)))+(((IkReal(-1.00000000000000))*(x10477)*(x10483)))+(((x10470)*(x10471)))+(((x10470)*(x10472)))+(x10469));
 evalcond[3]=((((r00)*(sj0)*(x10475)))+(((IkReal(-1.00000000000000))*(r12)*(x10480)*(x10481)))+(((cj4)*(x10471)*(x10473)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x10476)))+(((IkReal(-1.00000000000000))*(r10)*(x10474)*(x10479)))+(((cj4)*(r02)*(x10470)))+(((x10476)*(x10477)))+(((cj4)*(x10472)*(x10473)))+(((IkReal(-1.00000000000000))*(r10)*(x10475)*(x10480)))+(((IkReal(-1.00000000000000))*(x10484)))+(((IkReal(-1.00000000000000))*(r11)*(x10474)*(x10478))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -33808,8 +33677,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -33874,7 +33742,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -33912,14 +33780,14 @@ evalcond[0]=((((sj5)*(x10528)))+(x10517)+(((sj5)*(x10529)))+(((IkReal(-1.0000000
 evalcond[1]=((((r20)*(x10524)))+(((cj4)*(r22)*(sj5)))+(((IkReal(-1.00000000000000))*(r21)*(x10525)))+(x10516)+(((x10523)*(x10529)))+(((x10523)*(x10528))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(cj6)*(sj5)*(x10526)))+(((r12)*(x10521)))+(((x10518)*(x10519)))+(((IkReal(-1.00000000000000))*(x10530)*(x10531)))+(x10516)+(((x10518)*(x10520)))+(((IkReal(-1.00000000000000))*(r02)*(sj0)*(x10522))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(cj0)*(r10)*(x10524)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x10521)*(x10527)))+(((cj4)*(r02)*(x10518)))+(((IkReal(-1.00000000000000))*(r12)*(x10527)*(x10530)))+(((x10525)*(x10526)))+(((sj0)*(x10519)*(x10523)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x10525)))+(((IkReal(-1.00000000000000))*(x10517)))+(((IkReal(-1.00000000000000))*(x10521)*(x10527)*(x10531)))+(((sj0)*(x10520)*(x10523)))+(((r00)*(sj0)*(x10524))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -33955,8 +33823,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -34024,7 +33891,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -34063,14 +33930,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(r02)*(x10574)))+(((r12)*(x10572)))+(
 evalcond[1]=((((r12)*(x10574)))+(((IkReal(-1.00000000000000))*(x10568)*(x10575)))+(((IkReal(-1.00000000000000))*(x10567)*(x10576)))+(((IkReal(-1.00000000000000))*(x10579)))+(((IkReal(-1.00000000000000))*(x10573)*(x10575)))+(((IkReal(-1.00000000000000))*(x10567)*(x10577)))+(((r02)*(x10572))));
 evalcond[2]=((((x10570)*(x10571)))+(((IkReal(-1.00000000000000))*(x10578)*(x10582)))+(((IkReal(-1.00000000000000))*(x10579)))+(((IkReal(-1.00000000000000))*(r12)*(x10569)*(x10575)))+(((IkReal(-1.00000000000000))*(x10569)*(x10572)*(x10576)))+(((cj4)*(cj5)*(r01)*(x10570)))+(((IkReal(-1.00000000000000))*(r01)*(x10581)))+(((r11)*(x10580)))+(((IkReal(-1.00000000000000))*(x10569)*(x10572)*(x10577)))+(((cj4)*(x10568)*(x10574)))+(((cj4)*(r02)*(x10567))));
 evalcond[3]=((((r01)*(x10580)))+(((IkReal(-1.00000000000000))*(r12)*(x10567)*(x10569)))+(((IkReal(-1.00000000000000))*(x10569)*(x10572)*(x10573)))+(((IkReal(-1.00000000000000))*(x10569)*(x10574)*(x10577)))+(((IkReal(-1.00000000000000))*(x10566)))+(((IkReal(-1.00000000000000))*(x10568)*(x10569)*(x10572)))+(((r11)*(x10581)))+(((IkReal(-1.00000000000000))*(r02)*(x10569)*(x10575)))+(((IkReal(-1.00000000000000))*(x10570)*(x10578)))+(((IkReal(-1.00000000000000))*(x10571)*(x10582)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x10569)*(x10570))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -34106,8 +33973,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -34173,7 +34039,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -34212,14 +34078,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x10625)*(x10627)))+(((x10617)*(x1061
 evalcond[1]=((((IkReal(-1.00000000000000))*(x10618)*(x10625)))+(((IkReal(-1.00000000000000))*(x10623)*(x10625)))+(((r02)*(x10622)))+(((IkReal(-1.00000000000000))*(x10617)*(x10627)))+(((r12)*(x10624)))+(x10615)+(((IkReal(-1.00000000000000))*(x10617)*(x10626))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x10628)*(x10631)))+(((IkReal(-1.00000000000000))*(r12)*(x10619)*(x10625)))+(((r11)*(x10629)))+(((cj4)*(cj5)*(r01)*(x10620)))+(((cj4)*(x10618)*(x10624)))+(((IkReal(-1.00000000000000))*(x10615)))+(((IkReal(-1.00000000000000))*(x10619)*(x10622)*(x10626)))+(((cj4)*(r02)*(x10617)))+(((IkReal(-1.00000000000000))*(x10619)*(x10622)*(x10627)))+(((IkReal(-1.00000000000000))*(r01)*(x10630)))+(((x10620)*(x10621))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(cj5)*(r11)*(x10619)*(x10620)))+(((IkReal(-1.00000000000000))*(x10620)*(x10628)))+(((r11)*(x10630)))+(((IkReal(-1.00000000000000))*(x10619)*(x10624)*(x10627)))+(x10616)+(((r01)*(x10629)))+(((IkReal(-1.00000000000000))*(x10621)*(x10631)))+(((IkReal(-1.00000000000000))*(x10619)*(x10622)*(x10623)))+(((IkReal(-1.00000000000000))*(r02)*(x10619)*(x10625)))+(((IkReal(-1.00000000000000))*(x10618)*(x10619)*(x10622)))+(((IkReal(-1.00000000000000))*(r12)*(x10617)*(x10619))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -34255,8 +34121,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -34301,7 +34166,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -34345,14 +34210,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x10648)*(x10655)))+(((IkReal(-1.0000
 evalcond[3]=((((IkReal(-1.00000000000000))*(x10641)*(x10655)))+(((IkReal(-1.00000000000000))*(x10641)*(x10647)))+(((r12)*(x10646)))+(((IkReal(-1.00000000000000))*(x10642)*(x10648)))+(((IkReal(-1.00000000000000))*(x10640)*(x10649)))+(((r02)*(x10645)))+(((IkReal(-1.00000000000000))*(x10644)*(x10648))));
 evalcond[4]=((((cj4)*(x10644)*(x10646)))+(((r11)*(x10657)))+(((IkReal(-1.00000000000000))*(r10)*(x10650)*(x10656)))+(((IkReal(-1.00000000000000))*(r01)*(x10658)))+(((IkReal(-1.00000000000000))*(x10640)))+(((IkReal(-1.00000000000000))*(x10643)*(x10645)*(x10647)))+(((cj4)*(x10642)*(x10646)))+(((cj4)*(r02)*(x10641)))+(((IkReal(-1.00000000000000))*(x10643)*(x10645)*(x10655)))+(((r00)*(sj0)*(x10650)))+(((IkReal(-1.00000000000000))*(r12)*(x10643)*(x10648))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x10639)*(x10649)))+(((IkReal(-1.00000000000000))*(x10643)*(x10646)*(x10655)))+(((IkReal(-1.00000000000000))*(x10643)*(x10646)*(x10647)))+(((IkReal(-1.00000000000000))*(r02)*(x10643)*(x10648)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x10650)))+(((IkReal(-1.00000000000000))*(r12)*(x10641)*(x10643)))+(((r11)*(x10658)))+(((IkReal(-1.00000000000000))*(r00)*(x10650)*(x10656)))+(((r01)*(x10657)))+(((IkReal(-1.00000000000000))*(x10643)*(x10644)*(x10645)))+(((IkReal(-1.00000000000000))*(x10642)*(x10643)*(x10645))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -34388,8 +34253,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -34420,7 +34284,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -34464,14 +34328,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x10671)*(x10672)))+(((x10665)*(x1066
 evalcond[3]=((((IkReal(-1.00000000000000))*(x10664)*(x10673)))+(((IkReal(-1.00000000000000))*(x10666)*(x10672)))+(((r12)*(x10670)))+(((IkReal(-1.00000000000000))*(x10668)*(x10672)))+(((IkReal(-1.00000000000000))*(x10665)*(x10679)))+(((r02)*(x10669)))+(((IkReal(-1.00000000000000))*(x10665)*(x10671))));
 evalcond[4]=((((cj4)*(x10666)*(x10670)))+(((IkReal(-1.00000000000000))*(x10667)*(x10669)*(x10671)))+(((IkReal(-1.00000000000000))*(r12)*(x10667)*(x10672)))+(((IkReal(-1.00000000000000))*(r10)*(x10674)*(x10680)))+(((cj4)*(r02)*(x10665)))+(((r11)*(x10681)))+(((IkReal(-1.00000000000000))*(x10664)))+(((IkReal(-1.00000000000000))*(r01)*(x10682)))+(((IkReal(-1.00000000000000))*(x10667)*(x10669)*(x10679)))+(((cj4)*(x10668)*(x10670)))+(((r00)*(sj0)*(x10674))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r00)*(x10674)*(x10680)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x10674)))+(((r01)*(x10681)))+(((IkReal(-1.00000000000000))*(x10667)*(x10670)*(x10671)))+(((IkReal(-1.00000000000000))*(r02)*(x10667)*(x10672)))+(((IkReal(-1.00000000000000))*(r12)*(x10665)*(x10667)))+(((IkReal(-1.00000000000000))*(x10666)*(x10667)*(x10669)))+(((IkReal(-1.00000000000000))*(x10667)*(x10670)*(x10679)))+(((IkReal(-1.00000000000000))*(x10667)*(x10668)*(x10669)))+(((IkReal(-1.00000000000000))*(x10663)*(x10673)))+(((r11)*(x10682))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -34507,8 +34371,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -34538,7 +34401,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -34582,14 +34445,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x10695)*(x10702)))+(((IkReal(-1.0000
 evalcond[3]=((((r12)*(x10693)))+(((IkReal(-1.00000000000000))*(x10689)*(x10695)))+(((IkReal(-1.00000000000000))*(x10687)*(x10696)))+(((IkReal(-1.00000000000000))*(x10688)*(x10694)))+(((IkReal(-1.00000000000000))*(x10691)*(x10695)))+(((IkReal(-1.00000000000000))*(x10688)*(x10702)))+(((r02)*(x10692))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r01)*(x10705)))+(((r00)*(sj0)*(x10697)))+(((r11)*(x10704)))+(((cj4)*(x10691)*(x10693)))+(((IkReal(-1.00000000000000))*(x10690)*(x10692)*(x10702)))+(((cj4)*(x10689)*(x10693)))+(((cj4)*(r02)*(x10688)))+(((IkReal(-1.00000000000000))*(x10687)))+(((IkReal(-1.00000000000000))*(r10)*(x10697)*(x10703)))+(((IkReal(-1.00000000000000))*(r12)*(x10690)*(x10695)))+(((IkReal(-1.00000000000000))*(x10690)*(x10692)*(x10694))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x10690)*(x10691)*(x10692)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x10697)))+(((r01)*(x10704)))+(((IkReal(-1.00000000000000))*(x10689)*(x10690)*(x10692)))+(((IkReal(-1.00000000000000))*(r02)*(x10690)*(x10695)))+(((IkReal(-1.00000000000000))*(x10690)*(x10693)*(x10694)))+(((r11)*(x10705)))+(((IkReal(-1.00000000000000))*(x10686)*(x10696)))+(((IkReal(-1.00000000000000))*(r12)*(x10688)*(x10690)))+(((IkReal(-1.00000000000000))*(x10690)*(x10693)*(x10702)))+(((IkReal(-1.00000000000000))*(r00)*(x10697)*(x10703))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -34625,8 +34488,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -34688,7 +34550,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -34719,7 +34581,7 @@ IkReal x10731=((cj6)*(r11)*(sj5));
 evalcond[0]=((((IkReal(-1.00000000000000))*(sj1)*(x10728)))+(((cj6)*(r21)*(sj5)))+(((IkReal(-1.00000000000000))*(cj1)*(cj2)*(x10729)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((r20)*(x10724))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(sj2)*(x10729)))+(((sj0)*(x10730)))+(((IkReal(-1.00000000000000))*(x10726)*(x10731)))+(((r00)*(sj0)*(x10724)))+(((IkReal(-1.00000000000000))*(cj5)*(r02)*(x10727)))+(((r12)*(x10725)))+(((IkReal(-1.00000000000000))*(r10)*(x10724)*(x10726))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x10727)*(x10731)))+(((IkReal(-1.00000000000000))*(x10726)*(x10730)))+(((cj5)*(r12)*(sj0)))+(((IkReal(-1.00000000000000))*(r00)*(x10724)*(x10726)))+(((IkReal(-1.00000000000000))*(r10)*(x10724)*(x10727)))+(((cj2)*(sj1)*(x10722)))+(((r02)*(x10725)))+(((IkReal(-1.00000000000000))*(cj1)*(x10728))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -34814,7 +34676,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -34867,14 +34729,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x10791)*(x10800)*(x10809)))+(((IkRea
 evalcond[3]=((((cj5)*(x10789)*(x10810)))+(((IkReal(-1.00000000000000))*(sj5)*(x10790)*(x10808)))+(((x10801)*(x10811)))+(((IkReal(-1.00000000000000))*(x10797)*(x10811)))+(((cj5)*(x10792)*(x10810)))+(((x10796)*(x10809)))+(((cj3)*(sj2)))+(((IkReal(-1.00000000000000))*(r10)*(x10791)*(x10809)))+(((IkReal(-1.00000000000000))*(x10798)*(x10799)*(x10808)))+(((x10803)*(x10810)))+(((IkReal(-1.00000000000000))*(x10791)*(x10800)*(x10808))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(sj0)*(x10790)*(x10807)))+(((IkReal(-1.00000000000000))*(x10797)*(x10808)))+(((IkReal(-1.00000000000000))*(x10791)*(x10800)*(x10811)))+(((IkReal(-1.00000000000000))*(x10798)*(x10799)*(x10811)))+(((IkReal(-1.00000000000000))*(x10796)*(x10810)))+(((sj1)*(sj2)))+(((x10801)*(x10808)))+(((IkReal(-1.00000000000000))*(x10803)*(x10809)))+(((IkReal(-1.00000000000000))*(x10789)*(x10798)*(x10809)))+(((IkReal(-1.00000000000000))*(x10791)*(x10806)*(x10809)))+(((x10804)*(x10810))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x10791)*(x10800)*(x10810)))+(((IkReal(-1.00000000000000))*(x10789)*(x10798)*(x10808)))+(((x10797)*(x10809)))+(((IkReal(-1.00000000000000))*(sj3)*(x10793)))+(((x10796)*(x10811)))+(((IkReal(-1.00000000000000))*(x10803)*(x10808)))+(((IkReal(-1.00000000000000))*(r00)*(x10791)*(x10809)))+(((IkReal(-1.00000000000000))*(x10791)*(x10806)*(x10808)))+(((IkReal(-1.00000000000000))*(sj5)*(x10790)*(x10810)))+(((IkReal(-1.00000000000000))*(r10)*(x10791)*(x10811)))+(((IkReal(-1.00000000000000))*(x10794)*(x10795)))+(((IkReal(-1.00000000000000))*(x10798)*(x10799)*(x10810))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -34910,8 +34772,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -34947,7 +34808,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -35000,14 +34861,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x10834)*(x10846)))+(((x10842)*(x1084
 evalcond[3]=((((IkReal(-1.00000000000000))*(r10)*(x10829)*(x10847)))+(((IkReal(-1.00000000000000))*(x10829)*(x10838)*(x10846)))+(((x10839)*(x10849)))+(((cj5)*(x10830)*(x10848)))+(((IkReal(-1.00000000000000))*(x10836)*(x10837)*(x10846)))+(((x10834)*(x10847)))+(((cj3)*(sj2)))+(((IkReal(-1.00000000000000))*(x10835)*(x10849)))+(((x10841)*(x10848)))+(((cj5)*(x10827)*(x10848)))+(((IkReal(-1.00000000000000))*(sj5)*(x10828)*(x10846))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x10836)*(x10837)*(x10849)))+(((IkReal(-1.00000000000000))*(x10834)*(x10848)))+(((IkReal(-1.00000000000000))*(x10835)*(x10846)))+(((IkReal(-1.00000000000000))*(x10841)*(x10847)))+(((IkReal(-1.00000000000000))*(sj0)*(x10828)*(x10845)))+(((IkReal(-1.00000000000000))*(x10829)*(x10844)*(x10847)))+(((x10842)*(x10848)))+(((IkReal(-1.00000000000000))*(x10827)*(x10836)*(x10847)))+(((IkReal(-1.00000000000000))*(x10829)*(x10838)*(x10849)))+(((sj1)*(sj2)))+(((x10839)*(x10846))));
 evalcond[5]=((((x10834)*(x10849)))+(((IkReal(-1.00000000000000))*(x10829)*(x10838)*(x10848)))+(((IkReal(-1.00000000000000))*(x10836)*(x10837)*(x10848)))+(((IkReal(-1.00000000000000))*(r00)*(x10829)*(x10847)))+(((IkReal(-1.00000000000000))*(x10829)*(x10844)*(x10846)))+(((IkReal(-1.00000000000000))*(sj3)*(x10831)))+(((IkReal(-1.00000000000000))*(r10)*(x10829)*(x10849)))+(((IkReal(-1.00000000000000))*(x10832)*(x10833)))+(((IkReal(-1.00000000000000))*(x10827)*(x10836)*(x10846)))+(((IkReal(-1.00000000000000))*(sj5)*(x10828)*(x10848)))+(((IkReal(-1.00000000000000))*(x10841)*(x10846)))+(((x10835)*(x10847))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -35043,8 +34904,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -35088,7 +34948,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -35123,7 +34983,7 @@ IkReal x10878=((r11)*(sj6)*(x10866));
 evalcond[0]=((((IkReal(-1.00000000000000))*(r20)*(x10875)))+(((cj6)*(r21)*(x10874)))+(((IkReal(-1.00000000000000))*(cj1)*(sj2)))+(((r21)*(sj6)*(x10866)))+(((r20)*(sj6)*(x10874)))+(((r22)*(x10872))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(x10869)*(x10878)))+(((cj0)*(r10)*(x10875)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x10869)*(x10874)))+(((sj0)*(x10877)))+(((IkReal(-1.00000000000000))*(r12)*(x10869)*(x10872)))+(((x10868)*(x10876)))+(((IkReal(-1.00000000000000))*(x10869)*(x10871)*(x10874)))+(cj2)+(((r02)*(sj0)*(x10872)))+(((x10867)*(x10876)))+(((IkReal(-1.00000000000000))*(r00)*(x10870)*(x10875))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x10869)*(x10877)))+(((cj0)*(r00)*(x10875)))+(((IkReal(-1.00000000000000))*(r02)*(x10869)*(x10872)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x10870)*(x10874)))+(((IkReal(-1.00000000000000))*(x10870)*(x10878)))+(((sj1)*(sj2)))+(((IkReal(-1.00000000000000))*(x10867)*(x10869)*(x10874)))+(((IkReal(-1.00000000000000))*(x10868)*(x10869)*(x10874)))+(((IkReal(-1.00000000000000))*(r12)*(x10870)*(x10872)))+(((IkReal(-1.00000000000000))*(x10870)*(x10871)*(x10874)))+(((r10)*(sj0)*(x10875))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -35242,7 +35102,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -35285,14 +35145,14 @@ evalcond[0]=((((sj5)*(x10939)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((I
 evalcond[1]=((x10941)+(((x10937)*(x10939)))+(((r20)*(x10935)))+(((IkReal(-1.00000000000000))*(sj1)*(x10943)))+(((cj4)*(r22)*(sj5)))+(((IkReal(-1.00000000000000))*(r21)*(x10936)))+(((x10937)*(x10938))));
 evalcond[2]=((((r02)*(x10930)))+(((IkReal(-1.00000000000000))*(x10929)*(x10933)))+(((sj1)*(x10927)))+(((IkReal(-1.00000000000000))*(x10931)*(x10942)))+(((IkReal(-1.00000000000000))*(x10932)*(x10942)))+(((IkReal(-1.00000000000000))*(x10929)*(x10940)))+(((IkReal(-1.00000000000000))*(x10941)))+(((r12)*(x10934))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x10928)*(x10930)*(x10931)))+(((IkReal(-1.00000000000000))*(x10928)*(x10934)*(x10940)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x10928)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x10935)))+(((cj0)*(r01)*(x10936)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x10935)))+(((IkReal(-1.00000000000000))*(x10946)))+(((IkReal(-1.00000000000000))*(x10928)*(x10930)*(x10932)))+(((IkReal(-1.00000000000000))*(x10928)*(x10933)*(x10934)))+(((r11)*(sj0)*(x10936)))+(((IkReal(-1.00000000000000))*(r12)*(x10928)*(x10929))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -35328,8 +35188,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -35366,7 +35225,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -35409,14 +35268,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x10977)))+(((sj5)*(x10969)))+(((IkRe
 evalcond[1]=((((r20)*(x10966)))+(((x10968)*(x10969)))+(((IkReal(-1.00000000000000))*(sj1)*(x10974)))+(((x10968)*(x10970)))+(((cj4)*(r22)*(sj5)))+(((IkReal(-1.00000000000000))*(r21)*(x10967)))+(x10972));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x10972)))+(((r12)*(x10965)))+(((IkReal(-1.00000000000000))*(x10963)*(x10973)))+(((IkReal(-1.00000000000000))*(x10962)*(x10973)))+(((r02)*(x10961)))+(((IkReal(-1.00000000000000))*(x10960)*(x10964)))+(((sj1)*(x10958)))+(((IkReal(-1.00000000000000))*(x10960)*(x10971))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x10977)))+(((IkReal(-1.00000000000000))*(x10959)*(x10961)*(x10963)))+(((IkReal(-1.00000000000000))*(x10959)*(x10964)*(x10965)))+(((IkReal(-1.00000000000000))*(x10959)*(x10961)*(x10962)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x10966)))+(((r11)*(sj0)*(x10967)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x10966)))+(((IkReal(-1.00000000000000))*(r12)*(x10959)*(x10960)))+(((IkReal(-1.00000000000000))*(x10959)*(x10965)*(x10971)))+(((cj0)*(r01)*(x10967)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x10959))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -35452,8 +35311,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -35556,7 +35414,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -35599,14 +35457,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(sj1)*(x11042)))+(((sj5)*(x11037)))+(
 evalcond[1]=((((IkReal(-1.00000000000000))*(r21)*(x11035)))+(((r20)*(x11034)))+(((cj4)*(r22)*(sj5)))+(((IkReal(-1.00000000000000))*(x11045)))+(((x11036)*(x11037)))+(((x11036)*(x11038))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x11028)*(x11039)))+(((r02)*(x11029)))+(((IkReal(-1.00000000000000))*(x11028)*(x11032)))+(((r12)*(x11033)))+(((IkReal(-1.00000000000000))*(x11045)))+(((IkReal(-1.00000000000000))*(x11031)*(x11041)))+(((IkReal(-1.00000000000000))*(x11030)*(x11041))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r12)*(x11027)*(x11028)))+(((sj1)*(x11026)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x11034)))+(((IkReal(-1.00000000000000))*(x11027)*(x11029)*(x11030)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x11034)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x11027)))+(((IkReal(-1.00000000000000))*(x11027)*(x11032)*(x11033)))+(((IkReal(-1.00000000000000))*(x11040)))+(((IkReal(-1.00000000000000))*(x11027)*(x11033)*(x11039)))+(((IkReal(-1.00000000000000))*(x11027)*(x11029)*(x11031)))+(((r11)*(sj0)*(x11035)))+(((cj0)*(r01)*(x11035))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -35642,8 +35500,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -35680,7 +35537,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -35723,14 +35580,14 @@ evalcond[0]=((x11071)+(((sj5)*(x11068)))+(((IkReal(-1.00000000000000))*(cj5)*(r2
 evalcond[1]=((((x11067)*(x11069)))+(((IkReal(-1.00000000000000))*(x11076)))+(((cj4)*(r22)*(sj5)))+(((r20)*(x11065)))+(((x11067)*(x11068)))+(((IkReal(-1.00000000000000))*(r21)*(x11066))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x11061)*(x11072)))+(((IkReal(-1.00000000000000))*(x11062)*(x11072)))+(((IkReal(-1.00000000000000))*(x11059)*(x11063)))+(((IkReal(-1.00000000000000))*(x11076)))+(((r02)*(x11060)))+(((IkReal(-1.00000000000000))*(x11059)*(x11070)))+(((r12)*(x11064))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x11058)*(x11063)*(x11064)))+(((IkReal(-1.00000000000000))*(x11058)*(x11064)*(x11070)))+(((cj0)*(r01)*(x11066)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x11065)))+(((r11)*(sj0)*(x11066)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x11058)))+(((IkReal(-1.00000000000000))*(x11058)*(x11060)*(x11062)))+(((IkReal(-1.00000000000000))*(x11058)*(x11060)*(x11061)))+(((IkReal(-1.00000000000000))*(r12)*(x11058)*(x11059)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x11065)))+(((sj1)*(x11057)))+(((IkReal(-1.00000000000000))*(x11071))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -35766,8 +35623,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -35894,7 +35750,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -35932,14 +35788,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x11152)))+(((IkReal(-1.0000000000000
 evalcond[1]=((((x11148)*(x11149)))+(((x11148)*(x11150)))+(((cj4)*(r22)*(sj5)))+(((r20)*(x11146)))+(((IkReal(-1.00000000000000))*(r21)*(x11147)))+(x11138));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x11138)))+(((r02)*(x11141)))+(((IkReal(-1.00000000000000))*(x11140)*(x11144)))+(((IkReal(-1.00000000000000))*(x11142)*(x11153)))+(((r12)*(x11145)))+(((IkReal(-1.00000000000000))*(x11143)*(x11153)))+(((IkReal(-1.00000000000000))*(x11140)*(x11151))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x11139)*(x11141)*(x11142)))+(((IkReal(-1.00000000000000))*(x11139)*(x11141)*(x11143)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x11146)))+(((IkReal(-1.00000000000000))*(x11152)))+(((r11)*(sj0)*(x11147)))+(((cj0)*(r01)*(x11147)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x11139)))+(((IkReal(-1.00000000000000))*(x11139)*(x11145)*(x11151)))+(((IkReal(-1.00000000000000))*(r12)*(x11139)*(x11140)))+(((IkReal(-1.00000000000000))*(x11139)*(x11144)*(x11145)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x11146))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -35975,8 +35831,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -36047,7 +35902,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -36085,14 +35940,14 @@ evalcond[0]=((x11191)+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((sj5)*(x1120
 evalcond[1]=((((r20)*(x11199)))+(((x11201)*(x11202)))+(((IkReal(-1.00000000000000))*(x11205)))+(((cj4)*(r22)*(sj5)))+(((x11201)*(x11203)))+(((IkReal(-1.00000000000000))*(r21)*(x11200))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x11196)*(x11206)))+(((IkReal(-1.00000000000000))*(x11205)))+(((IkReal(-1.00000000000000))*(x11195)*(x11206)))+(((IkReal(-1.00000000000000))*(x11193)*(x11204)))+(((IkReal(-1.00000000000000))*(x11193)*(x11197)))+(((r02)*(x11194)))+(((r12)*(x11198))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r10)*(sj0)*(x11199)))+(((cj0)*(r01)*(x11200)))+(((IkReal(-1.00000000000000))*(x11192)*(x11197)*(x11198)))+(((IkReal(-1.00000000000000))*(x11192)*(x11194)*(x11196)))+(((r11)*(sj0)*(x11200)))+(((IkReal(-1.00000000000000))*(x11191)))+(((IkReal(-1.00000000000000))*(r12)*(x11192)*(x11193)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x11199)))+(((IkReal(-1.00000000000000))*(x11192)*(x11194)*(x11195)))+(((IkReal(-1.00000000000000))*(x11192)*(x11198)*(x11204)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x11192))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -36128,8 +35983,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -36198,7 +36052,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -36237,14 +36091,14 @@ evalcond[0]=((((cj6)*(r01)*(x11243)))+(((x11243)*(x11244)))+(((IkReal(-1.0000000
 evalcond[1]=((((r12)*(x11249)))+(((r02)*(x11248)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x11252)))+(((IkReal(-1.00000000000000))*(x11242)))+(((IkReal(-1.00000000000000))*(x11243)*(x11250)))+(((IkReal(-1.00000000000000))*(x11243)*(x11251)))+(((IkReal(-1.00000000000000))*(x11244)*(x11252))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r01)*(x11258)))+(((r11)*(x11257)))+(((cj4)*(r02)*(x11243)))+(((IkReal(-1.00000000000000))*(x11246)*(x11248)*(x11251)))+(((IkReal(-1.00000000000000))*(r12)*(x11246)*(x11252)))+(((IkReal(-1.00000000000000))*(x11253)*(x11256)))+(x11242)+(((IkReal(-1.00000000000000))*(x11246)*(x11248)*(x11250)))+(((cj4)*(x11244)*(x11249)))+(((x11245)*(x11255)))+(((x11245)*(x11247))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x11245)*(x11253)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x11245)*(x11246)))+(((IkReal(-1.00000000000000))*(x11244)*(x11246)*(x11248)))+(((r01)*(x11257)))+(((IkReal(-1.00000000000000))*(x11254)))+(((IkReal(-1.00000000000000))*(x11246)*(x11249)*(x11251)))+(((r11)*(x11258)))+(((IkReal(-1.00000000000000))*(x11247)*(x11256)))+(((IkReal(-1.00000000000000))*(r12)*(x11243)*(x11246)))+(((IkReal(-1.00000000000000))*(r02)*(x11246)*(x11252)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x11246)*(x11248))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -36280,8 +36134,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -36349,7 +36202,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -36388,14 +36241,14 @@ evalcond[0]=((((x11294)*(x11300)))+(((IkReal(-1.00000000000000))*(x11302)*(x1130
 evalcond[1]=((((IkReal(-1.00000000000000))*(x11294)*(x11304)))+(((IkReal(-1.00000000000000))*(x11300)*(x11302)))+(((IkReal(-1.00000000000000))*(x11295)*(x11302)))+(((IkReal(-1.00000000000000))*(x11294)*(x11303)))+(((r02)*(x11299)))+(((r12)*(x11301)))+(((IkReal(-1.00000000000000))*(x11306))));
 evalcond[2]=((((cj4)*(r02)*(x11294)))+(((cj4)*(x11295)*(x11301)))+(((IkReal(-1.00000000000000))*(x11296)*(x11299)*(x11303)))+(((cj4)*(cj5)*(r01)*(x11297)))+(((IkReal(-1.00000000000000))*(x11305)*(x11309)))+(((IkReal(-1.00000000000000))*(x11296)*(x11299)*(x11304)))+(((IkReal(-1.00000000000000))*(r12)*(x11296)*(x11302)))+(((IkReal(-1.00000000000000))*(r01)*(x11308)))+(((r11)*(x11307)))+(((IkReal(-1.00000000000000))*(x11306)))+(((x11297)*(x11298))));
 evalcond[3]=((((r11)*(x11308)))+(((IkReal(-1.00000000000000))*(x11297)*(x11305)))+(((r01)*(x11307)))+(((IkReal(-1.00000000000000))*(x11298)*(x11309)))+(((IkReal(-1.00000000000000))*(x11293)))+(((IkReal(-1.00000000000000))*(x11296)*(x11299)*(x11300)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x11296)*(x11297)))+(((IkReal(-1.00000000000000))*(x11296)*(x11301)*(x11304)))+(((IkReal(-1.00000000000000))*(x11295)*(x11296)*(x11299)))+(((IkReal(-1.00000000000000))*(r02)*(x11296)*(x11302)))+(((IkReal(-1.00000000000000))*(r12)*(x11294)*(x11296))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -36431,8 +36284,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -36478,7 +36330,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -36521,14 +36373,14 @@ evalcond[2]=((((x11320)*(x11323)))+(((x11320)*(x11321)))+(((r12)*(x11324)))+(((I
 evalcond[3]=((((r12)*(x11325)))+(((IkReal(-1.00000000000000))*(x11320)*(x11326)))+(((IkReal(-1.00000000000000))*(x11320)*(x11332)))+(((IkReal(-1.00000000000000))*(x11321)*(x11327)))+(((IkReal(-1.00000000000000))*(x11323)*(x11327)))+(((r02)*(x11324)))+(((IkReal(-1.00000000000000))*(x11319))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r10)*(x11328)*(x11333)))+(((IkReal(-1.00000000000000))*(r01)*(x11336)))+(((r11)*(x11335)))+(((cj4)*(r02)*(x11320)))+(((r00)*(sj0)*(x11328)))+(((IkReal(-1.00000000000000))*(x11322)*(x11324)*(x11332)))+(((IkReal(-1.00000000000000))*(r12)*(x11322)*(x11327)))+(((sj2)*(x11319)))+(((cj4)*(x11321)*(x11325)))+(((IkReal(-1.00000000000000))*(x11322)*(x11324)*(x11326)))+(((cj4)*(x11323)*(x11325))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x11322)*(x11325)*(x11332)))+(((IkReal(-1.00000000000000))*(r02)*(x11322)*(x11327)))+(((IkReal(-1.00000000000000))*(x11322)*(x11323)*(x11324)))+(((r11)*(x11336)))+(((IkReal(-1.00000000000000))*(x11322)*(x11325)*(x11326)))+(((IkReal(-1.00000000000000))*(r12)*(x11320)*(x11322)))+(((r01)*(x11335)))+(((IkReal(-1.00000000000000))*(x11334)))+(((IkReal(-1.00000000000000))*(r00)*(x11328)*(x11333)))+(((IkReal(-1.00000000000000))*(x11321)*(x11322)*(x11324)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x11328))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -36564,8 +36416,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -36594,7 +36445,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -36637,14 +36488,14 @@ evalcond[2]=((((x11341)*(x11342)))+(((r12)*(x11345)))+(((IkReal(-1.0000000000000
 evalcond[3]=((((IkReal(-1.00000000000000))*(x11342)*(x11348)))+(((IkReal(-1.00000000000000))*(x11340)))+(((IkReal(-1.00000000000000))*(x11341)*(x11353)))+(((IkReal(-1.00000000000000))*(x11344)*(x11348)))+(((IkReal(-1.00000000000000))*(x11341)*(x11347)))+(((r12)*(x11346)))+(((r02)*(x11345))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r10)*(x11349)*(x11354)))+(((IkReal(-1.00000000000000))*(x11343)*(x11345)*(x11347)))+(((cj4)*(x11344)*(x11346)))+(((cj4)*(r02)*(x11341)))+(((sj2)*(x11340)))+(((IkReal(-1.00000000000000))*(x11343)*(x11345)*(x11353)))+(((IkReal(-1.00000000000000))*(r01)*(x11357)))+(((r00)*(sj0)*(x11349)))+(((r11)*(x11356)))+(((cj4)*(x11342)*(x11346)))+(((IkReal(-1.00000000000000))*(r12)*(x11343)*(x11348))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x11343)*(x11346)*(x11347)))+(((IkReal(-1.00000000000000))*(x11355)))+(((r01)*(x11356)))+(((IkReal(-1.00000000000000))*(x11343)*(x11344)*(x11345)))+(((IkReal(-1.00000000000000))*(r12)*(x11341)*(x11343)))+(((IkReal(-1.00000000000000))*(r02)*(x11343)*(x11348)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x11349)))+(((IkReal(-1.00000000000000))*(x11343)*(x11346)*(x11353)))+(((IkReal(-1.00000000000000))*(x11342)*(x11343)*(x11345)))+(((r11)*(x11357)))+(((IkReal(-1.00000000000000))*(r00)*(x11349)*(x11354))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -36680,8 +36531,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -36711,7 +36561,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -36754,14 +36604,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(sj2)*(x11377)))+(((r12)*(x11367)))+(
 evalcond[3]=((((IkReal(-1.00000000000000))*(x11363)*(x11369)))+(((IkReal(-1.00000000000000))*(x11362)))+(((IkReal(-1.00000000000000))*(x11366)*(x11370)))+(((r02)*(x11367)))+(((r12)*(x11368)))+(((IkReal(-1.00000000000000))*(x11363)*(x11375)))+(((IkReal(-1.00000000000000))*(x11364)*(x11370))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x11365)*(x11367)*(x11369)))+(((r11)*(x11378)))+(((IkReal(-1.00000000000000))*(x11365)*(x11367)*(x11375)))+(((IkReal(-1.00000000000000))*(r01)*(x11379)))+(((cj4)*(x11364)*(x11368)))+(((cj4)*(r02)*(x11363)))+(((r00)*(sj0)*(x11371)))+(((sj2)*(x11362)))+(((IkReal(-1.00000000000000))*(r12)*(x11365)*(x11370)))+(((cj4)*(x11366)*(x11368)))+(((IkReal(-1.00000000000000))*(r10)*(x11371)*(x11376))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x11365)*(x11368)*(x11369)))+(((IkReal(-1.00000000000000))*(r02)*(x11365)*(x11370)))+(((IkReal(-1.00000000000000))*(r12)*(x11363)*(x11365)))+(((r11)*(x11379)))+(((IkReal(-1.00000000000000))*(x11365)*(x11368)*(x11375)))+(((IkReal(-1.00000000000000))*(x11364)*(x11365)*(x11367)))+(((IkReal(-1.00000000000000))*(x11377)))+(((r01)*(x11378)))+(((IkReal(-1.00000000000000))*(x11365)*(x11366)*(x11367)))+(((IkReal(-1.00000000000000))*(r00)*(x11371)*(x11376)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x11371))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -36797,8 +36647,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -36926,7 +36775,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -36964,14 +36813,14 @@ evalcond[0]=((((sj5)*(x11454)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((s
 evalcond[1]=((((IkReal(-1.00000000000000))*(r21)*(x11452)))+(((IkReal(-1.00000000000000))*(x11442)))+(((cj4)*(r22)*(sj5)))+(((x11453)*(x11454)))+(((r20)*(x11451)))+(((x11453)*(x11455))));
 evalcond[2]=((((r02)*(x11446)))+(((IkReal(-1.00000000000000))*(x11447)*(x11457)))+(((IkReal(-1.00000000000000))*(x11445)*(x11449)))+(((IkReal(-1.00000000000000))*(x11448)*(x11457)))+(((r12)*(x11450)))+(x11442)+(((IkReal(-1.00000000000000))*(x11445)*(x11456))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x11444)*(x11446)*(x11447)))+(((cj0)*(r01)*(x11452)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x11451)))+(((IkReal(-1.00000000000000))*(x11444)*(x11446)*(x11448)))+(((IkReal(-1.00000000000000))*(x11444)*(x11449)*(x11450)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x11451)))+(((IkReal(-1.00000000000000))*(x11444)*(x11450)*(x11456)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x11444)))+(((IkReal(-1.00000000000000))*(r12)*(x11444)*(x11445)))+(((r11)*(sj0)*(x11452)))+(x11443));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -37007,8 +36856,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -37079,7 +36927,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -37117,14 +36965,14 @@ evalcond[0]=((((sj5)*(x11507)))+(((IkReal(-1.00000000000000))*(x11496)))+(((IkRe
 evalcond[1]=((((cj4)*(r22)*(sj5)))+(((x11506)*(x11507)))+(((IkReal(-1.00000000000000))*(r21)*(x11505)))+(x11495)+(((r20)*(x11504)))+(((x11506)*(x11508))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x11498)*(x11509)))+(((r12)*(x11503)))+(((IkReal(-1.00000000000000))*(x11500)*(x11510)))+(((IkReal(-1.00000000000000))*(x11501)*(x11510)))+(((IkReal(-1.00000000000000))*(x11498)*(x11502)))+(((r02)*(x11499)))+(x11495));
 evalcond[3]=((((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x11497)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x11504)))+(((r11)*(sj0)*(x11505)))+(((IkReal(-1.00000000000000))*(x11497)*(x11499)*(x11500)))+(((IkReal(-1.00000000000000))*(r12)*(x11497)*(x11498)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x11504)))+(((IkReal(-1.00000000000000))*(x11497)*(x11502)*(x11503)))+(((cj0)*(r01)*(x11505)))+(((IkReal(-1.00000000000000))*(x11497)*(x11499)*(x11501)))+(x11496)+(((IkReal(-1.00000000000000))*(x11497)*(x11503)*(x11509))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -37160,8 +37008,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -37229,7 +37076,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -37268,14 +37115,14 @@ evalcond[0]=((((r12)*(x11552)))+(((cj6)*(r01)*(x11547)))+(((x11547)*(x11548)))+(
 evalcond[1]=((((IkReal(-1.00000000000000))*(x11548)*(x11556)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x11556)))+(((IkReal(-1.00000000000000))*(x11547)*(x11554)))+(x11545)+(((IkReal(-1.00000000000000))*(x11547)*(x11555)))+(((r12)*(x11553)))+(((r02)*(x11552))));
 evalcond[2]=((((cj4)*(x11548)*(x11553)))+(((IkReal(-1.00000000000000))*(r12)*(x11550)*(x11556)))+(((x11549)*(x11551)))+(((IkReal(-1.00000000000000))*(x11550)*(x11552)*(x11555)))+(((r11)*(x11560)))+(x11545)+(((IkReal(-1.00000000000000))*(r01)*(x11561)))+(((IkReal(-1.00000000000000))*(x11557)*(x11559)))+(((cj4)*(r02)*(x11547)))+(((x11549)*(x11558)))+(((IkReal(-1.00000000000000))*(x11550)*(x11552)*(x11554))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r02)*(x11550)*(x11556)))+(((r11)*(x11561)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x11550)*(x11552)))+(((IkReal(-1.00000000000000))*(x11549)*(x11557)))+(x11546)+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x11549)*(x11550)))+(((IkReal(-1.00000000000000))*(x11550)*(x11553)*(x11555)))+(((r01)*(x11560)))+(((IkReal(-1.00000000000000))*(x11548)*(x11550)*(x11552)))+(((IkReal(-1.00000000000000))*(r12)*(x11547)*(x11550)))+(((IkReal(-1.00000000000000))*(x11551)*(x11559))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -37311,8 +37158,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -37378,7 +37224,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -37417,14 +37263,14 @@ evalcond[0]=((x11595)+(((r12)*(x11601)))+(((x11596)*(x11602)))+(((IkReal(-1.0000
 evalcond[1]=((x11594)+(((IkReal(-1.00000000000000))*(x11602)*(x11604)))+(((r02)*(x11601)))+(((IkReal(-1.00000000000000))*(x11597)*(x11604)))+(((IkReal(-1.00000000000000))*(x11596)*(x11605)))+(((r12)*(x11603)))+(((IkReal(-1.00000000000000))*(x11596)*(x11606))));
 evalcond[2]=((((cj4)*(x11597)*(x11603)))+(((cj4)*(cj5)*(r01)*(x11599)))+(((IkReal(-1.00000000000000))*(x11607)*(x11610)))+(((IkReal(-1.00000000000000))*(r12)*(x11598)*(x11604)))+(((x11599)*(x11600)))+(((IkReal(-1.00000000000000))*(x11594)))+(((IkReal(-1.00000000000000))*(x11598)*(x11601)*(x11606)))+(((IkReal(-1.00000000000000))*(r01)*(x11609)))+(((r11)*(x11608)))+(((IkReal(-1.00000000000000))*(x11598)*(x11601)*(x11605)))+(((cj4)*(r02)*(x11596))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(cj5)*(r11)*(x11598)*(x11599)))+(x11595)+(((IkReal(-1.00000000000000))*(x11600)*(x11610)))+(((IkReal(-1.00000000000000))*(x11598)*(x11603)*(x11606)))+(((IkReal(-1.00000000000000))*(x11597)*(x11598)*(x11601)))+(((IkReal(-1.00000000000000))*(r02)*(x11598)*(x11604)))+(((IkReal(-1.00000000000000))*(r12)*(x11596)*(x11598)))+(((r11)*(x11609)))+(((IkReal(-1.00000000000000))*(x11599)*(x11607)))+(((IkReal(-1.00000000000000))*(x11598)*(x11601)*(x11602)))+(((r01)*(x11608))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -37460,8 +37306,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -37506,7 +37351,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -37548,14 +37393,14 @@ evalcond[2]=((((x11620)*(x11623)))+(((IkReal(-1.00000000000000))*(r02)*(x11625))
 evalcond[3]=((((IkReal(-1.00000000000000))*(x11623)*(x11628)))+(((IkReal(-1.00000000000000))*(x11621)*(x11628)))+(((IkReal(-1.00000000000000))*(x11620)*(x11626)))+(((r12)*(x11625)))+(((r02)*(x11624)))+(((IkReal(-1.00000000000000))*(x11620)*(x11632)))+(x11619));
 evalcond[4]=((((cj4)*(x11621)*(x11625)))+(((cj4)*(r02)*(x11620)))+(((IkReal(-1.00000000000000))*(r12)*(x11622)*(x11628)))+(((IkReal(-1.00000000000000))*(x11622)*(x11624)*(x11632)))+(((IkReal(-1.00000000000000))*(r01)*(x11635)))+(((sj2)*(x11619)))+(((cj4)*(x11623)*(x11625)))+(((IkReal(-1.00000000000000))*(r10)*(x11627)*(x11633)))+(((r11)*(x11634)))+(((r00)*(sj0)*(x11627)))+(((IkReal(-1.00000000000000))*(x11622)*(x11624)*(x11626))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x11621)*(x11622)*(x11624)))+(((IkReal(-1.00000000000000))*(r00)*(x11627)*(x11633)))+(((IkReal(-1.00000000000000))*(x11622)*(x11625)*(x11632)))+(((r01)*(x11634)))+(((IkReal(-1.00000000000000))*(r12)*(x11620)*(x11622)))+(((IkReal(-1.00000000000000))*(x11622)*(x11625)*(x11626)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x11627)))+(((r11)*(x11635)))+(((IkReal(-1.00000000000000))*(x11622)*(x11623)*(x11624)))+(((IkReal(-1.00000000000000))*(r02)*(x11622)*(x11628)))+(x11618));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -37591,8 +37436,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -37622,7 +37466,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -37664,14 +37508,14 @@ evalcond[2]=((((r12)*(x11645)))+(((IkReal(-1.00000000000000))*(x11647)*(x11649))
 evalcond[3]=((((r12)*(x11646)))+(((IkReal(-1.00000000000000))*(x11642)*(x11649)))+(((IkReal(-1.00000000000000))*(x11641)*(x11653)))+(((IkReal(-1.00000000000000))*(x11644)*(x11649)))+(((IkReal(-1.00000000000000))*(x11641)*(x11647)))+(x11640)+(((r02)*(x11645))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x11643)*(x11645)*(x11647)))+(((cj4)*(x11642)*(x11646)))+(((cj4)*(x11644)*(x11646)))+(((IkReal(-1.00000000000000))*(r12)*(x11643)*(x11649)))+(((cj4)*(r02)*(x11641)))+(((IkReal(-1.00000000000000))*(r01)*(x11656)))+(((sj2)*(x11640)))+(((IkReal(-1.00000000000000))*(r10)*(x11648)*(x11654)))+(((r11)*(x11655)))+(((IkReal(-1.00000000000000))*(x11643)*(x11645)*(x11653)))+(((r00)*(sj0)*(x11648))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x11643)*(x11646)*(x11653)))+(((IkReal(-1.00000000000000))*(r00)*(x11648)*(x11654)))+(((IkReal(-1.00000000000000))*(r02)*(x11643)*(x11649)))+(x11639)+(((IkReal(-1.00000000000000))*(x11642)*(x11643)*(x11645)))+(((r11)*(x11656)))+(((IkReal(-1.00000000000000))*(x11643)*(x11646)*(x11647)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x11648)))+(((IkReal(-1.00000000000000))*(x11643)*(x11644)*(x11645)))+(((IkReal(-1.00000000000000))*(r12)*(x11641)*(x11643)))+(((r01)*(x11655))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -37707,8 +37551,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -37738,7 +37581,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -37780,14 +37623,14 @@ evalcond[2]=((((x11662)*(x11663)))+(((IkReal(-1.00000000000000))*(x11670)*(x1167
 evalcond[3]=((x11661)+(((IkReal(-1.00000000000000))*(x11663)*(x11670)))+(((r12)*(x11667)))+(((IkReal(-1.00000000000000))*(x11662)*(x11668)))+(((IkReal(-1.00000000000000))*(x11665)*(x11670)))+(((IkReal(-1.00000000000000))*(x11662)*(x11674)))+(((r02)*(x11666))));
 evalcond[4]=((((cj4)*(r02)*(x11662)))+(((r00)*(sj0)*(x11669)))+(((cj4)*(x11665)*(x11667)))+(((sj2)*(x11661)))+(((cj4)*(x11663)*(x11667)))+(((IkReal(-1.00000000000000))*(x11664)*(x11666)*(x11674)))+(((IkReal(-1.00000000000000))*(r01)*(x11677)))+(((IkReal(-1.00000000000000))*(r10)*(x11669)*(x11675)))+(((r11)*(x11676)))+(((IkReal(-1.00000000000000))*(x11664)*(x11666)*(x11668)))+(((IkReal(-1.00000000000000))*(r12)*(x11664)*(x11670))));
 evalcond[5]=((((r01)*(x11676)))+(((IkReal(-1.00000000000000))*(x11664)*(x11667)*(x11668)))+(x11660)+(((IkReal(-1.00000000000000))*(x11663)*(x11664)*(x11666)))+(((IkReal(-1.00000000000000))*(r12)*(x11662)*(x11664)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x11669)))+(((r11)*(x11677)))+(((IkReal(-1.00000000000000))*(x11664)*(x11665)*(x11666)))+(((IkReal(-1.00000000000000))*(r00)*(x11669)*(x11675)))+(((IkReal(-1.00000000000000))*(x11664)*(x11667)*(x11674)))+(((IkReal(-1.00000000000000))*(r02)*(x11664)*(x11670))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -37823,8 +37666,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -37945,7 +37787,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -37983,14 +37825,14 @@ evalcond[0]=((((r20)*(x11746)))+(((IkReal(-1.00000000000000))*(x11733)))+(((r21)
 evalcond[1]=((((cj5)*(r21)*(x11742)))+(((IkReal(-1.00000000000000))*(r21)*(x11740)))+(((cj5)*(r20)*(x11743)))+(((r22)*(x11745)))+(((IkReal(-1.00000000000000))*(x11748)))+(((r20)*(x11739))));
 evalcond[2]=((((x11734)*(x11735)))+(((x11734)*(x11736)))+(((IkReal(-1.00000000000000))*(r10)*(x11744)*(x11746)))+(((r12)*(x11738)))+(((IkReal(-1.00000000000000))*(r02)*(x11737)))+(((IkReal(-1.00000000000000))*(x11748)))+(((IkReal(-1.00000000000000))*(x11741)*(x11747))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r11)*(x11738)*(x11742)))+(((cj4)*(x11736)*(x11737)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x11740)))+(((r00)*(sj0)*(x11739)))+(((IkReal(-1.00000000000000))*(r10)*(x11738)*(x11743)))+(((x11740)*(x11741)))+(((cj4)*(r02)*(x11734)))+(x11733)+(((IkReal(-1.00000000000000))*(r10)*(x11739)*(x11744)))+(((IkReal(-1.00000000000000))*(r12)*(x11744)*(x11745)))+(((cj4)*(x11735)*(x11737))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -38026,8 +37868,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -38092,7 +37933,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -38130,14 +37971,14 @@ evalcond[0]=((x11781)+(((r20)*(x11794)))+(((IkReal(-1.00000000000000))*(cj5)*(r2
 evalcond[1]=((x11780)+(((IkReal(-1.00000000000000))*(r21)*(x11788)))+(((cj5)*(r21)*(x11790)))+(((cj5)*(r20)*(x11791)))+(((r20)*(x11787)))+(((r22)*(x11793))));
 evalcond[2]=((((x11782)*(x11784)))+(((IkReal(-1.00000000000000))*(r02)*(x11785)))+(((IkReal(-1.00000000000000))*(x11780)))+(((x11782)*(x11783)))+(((r12)*(x11786)))+(((IkReal(-1.00000000000000))*(r10)*(x11792)*(x11794)))+(((IkReal(-1.00000000000000))*(x11789)*(x11795))));
 evalcond[3]=((x11781)+(((IkReal(-1.00000000000000))*(r10)*(x11786)*(x11791)))+(((r00)*(sj0)*(x11787)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x11788)))+(((IkReal(-1.00000000000000))*(r12)*(x11792)*(x11793)))+(((x11788)*(x11789)))+(((cj4)*(x11784)*(x11785)))+(((cj4)*(x11783)*(x11785)))+(((IkReal(-1.00000000000000))*(r10)*(x11787)*(x11792)))+(((IkReal(-1.00000000000000))*(r11)*(x11786)*(x11790)))+(((cj4)*(r02)*(x11782))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -38173,8 +38014,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -38218,7 +38058,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -38263,14 +38103,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(sj5)*(x11810)*(x11813)))+(((IkReal(-
 evalcond[3]=((((IkReal(-1.00000000000000))*(sj5)*(x11808)*(x11810)))+(((sj0)*(x11811)))+(((IkReal(-1.00000000000000))*(sj5)*(x11807)*(x11810)))+(((cj0)*(x11814)))+(((IkReal(-1.00000000000000))*(x11806)*(x11819)))+(((IkReal(-1.00000000000000))*(x11806)*(x11813)))+(((IkReal(-1.00000000000000))*(x11805)*(x11815))));
 evalcond[4]=((((r11)*(x11824)))+(((x11806)*(x11821)))+(((IkReal(-1.00000000000000))*(r01)*(x11812)*(x11820)))+(((sj0)*(x11807)*(x11809)))+(((r00)*(sj0)*(x11816)))+(((sj0)*(x11808)*(x11809)))+(((IkReal(-1.00000000000000))*(r10)*(x11810)*(x11816)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x11810)))+(((IkReal(-1.00000000000000))*(x11809)*(x11810)*(x11819)))+(x11805)+(((IkReal(-1.00000000000000))*(x11809)*(x11810)*(x11813))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(sj5)*(x11810)*(x11821)))+(((IkReal(-1.00000000000000))*(x11808)*(x11809)*(x11810)))+(((r11)*(sj0)*(x11820)))+(((IkReal(-1.00000000000000))*(x11806)*(x11822)))+(((IkReal(-1.00000000000000))*(r00)*(x11810)*(x11816)))+(((IkReal(-1.00000000000000))*(r10)*(x11812)*(x11816)))+(((IkReal(-1.00000000000000))*(x11804)*(x11815)))+(((IkReal(-1.00000000000000))*(x11807)*(x11809)*(x11810)))+(((IkReal(-1.00000000000000))*(x11809)*(x11812)*(x11819)))+(((IkReal(-1.00000000000000))*(x11809)*(x11812)*(x11813)))+(((r01)*(x11824))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -38306,8 +38146,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -38338,7 +38177,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -38383,14 +38222,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(sj5)*(x11835)*(x11844)))+(((IkReal(-
 evalcond[3]=((((IkReal(-1.00000000000000))*(x11830)*(x11840)))+(((IkReal(-1.00000000000000))*(sj5)*(x11833)*(x11835)))+(((cj0)*(x11839)))+(((IkReal(-1.00000000000000))*(x11831)*(x11838)))+(((IkReal(-1.00000000000000))*(sj5)*(x11832)*(x11835)))+(((sj0)*(x11836)))+(((IkReal(-1.00000000000000))*(x11831)*(x11844))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x11835)))+(((IkReal(-1.00000000000000))*(r10)*(x11835)*(x11841)))+(((sj0)*(x11833)*(x11834)))+(((x11831)*(x11846)))+(((IkReal(-1.00000000000000))*(r01)*(x11837)*(x11845)))+(((r11)*(x11849)))+(((IkReal(-1.00000000000000))*(x11834)*(x11835)*(x11838)))+(((IkReal(-1.00000000000000))*(x11834)*(x11835)*(x11844)))+(x11830)+(((sj0)*(x11832)*(x11834)))+(((r00)*(sj0)*(x11841))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x11834)*(x11837)*(x11844)))+(((IkReal(-1.00000000000000))*(x11832)*(x11834)*(x11835)))+(((IkReal(-1.00000000000000))*(x11834)*(x11837)*(x11838)))+(((r01)*(x11849)))+(((IkReal(-1.00000000000000))*(x11831)*(x11847)))+(((IkReal(-1.00000000000000))*(r10)*(x11837)*(x11841)))+(((IkReal(-1.00000000000000))*(x11833)*(x11834)*(x11835)))+(((IkReal(-1.00000000000000))*(r00)*(x11835)*(x11841)))+(((r11)*(sj0)*(x11845)))+(((IkReal(-1.00000000000000))*(sj5)*(x11835)*(x11846)))+(((IkReal(-1.00000000000000))*(x11829)*(x11840))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -38426,8 +38265,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -38457,7 +38295,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -38502,14 +38340,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(sj5)*(x11859)*(x11862)))+(((IkReal(-
 evalcond[3]=((((IkReal(-1.00000000000000))*(sj5)*(x11857)*(x11859)))+(((IkReal(-1.00000000000000))*(x11854)*(x11864)))+(((IkReal(-1.00000000000000))*(x11855)*(x11862)))+(((IkReal(-1.00000000000000))*(sj5)*(x11856)*(x11859)))+(((IkReal(-1.00000000000000))*(x11855)*(x11868)))+(((sj0)*(x11860)))+(((cj0)*(x11863))));
 evalcond[4]=((((r00)*(sj0)*(x11865)))+(((IkReal(-1.00000000000000))*(x11858)*(x11859)*(x11868)))+(((sj0)*(x11857)*(x11858)))+(((IkReal(-1.00000000000000))*(x11858)*(x11859)*(x11862)))+(((r11)*(x11873)))+(((x11855)*(x11870)))+(((IkReal(-1.00000000000000))*(r01)*(x11861)*(x11869)))+(((IkReal(-1.00000000000000))*(r10)*(x11859)*(x11865)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x11859)))+(x11854)+(((sj0)*(x11856)*(x11858))));
 evalcond[5]=((((r01)*(x11873)))+(((IkReal(-1.00000000000000))*(x11858)*(x11861)*(x11862)))+(((IkReal(-1.00000000000000))*(x11855)*(x11871)))+(((IkReal(-1.00000000000000))*(x11856)*(x11858)*(x11859)))+(((IkReal(-1.00000000000000))*(x11857)*(x11858)*(x11859)))+(((r11)*(sj0)*(x11869)))+(((IkReal(-1.00000000000000))*(x11858)*(x11861)*(x11868)))+(((IkReal(-1.00000000000000))*(r00)*(x11859)*(x11865)))+(((IkReal(-1.00000000000000))*(r10)*(x11861)*(x11865)))+(((IkReal(-1.00000000000000))*(sj5)*(x11859)*(x11870)))+(((IkReal(-1.00000000000000))*(x11853)*(x11864))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -38545,8 +38383,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -38667,7 +38504,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -38705,14 +38542,14 @@ evalcond[0]=((((r21)*(x11943)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((r
 evalcond[1]=((((r22)*(x11941)))+(((r20)*(x11935)))+(((IkReal(-1.00000000000000))*(r21)*(x11936)))+(((IkReal(-1.00000000000000))*(x11929)))+(((cj5)*(r20)*(x11939)))+(((cj5)*(r21)*(x11938))));
 evalcond[2]=((((r12)*(x11934)))+(((x11930)*(x11932)))+(((IkReal(-1.00000000000000))*(x11937)*(x11943)))+(((x11930)*(x11931)))+(x11929)+(((IkReal(-1.00000000000000))*(r02)*(x11933)))+(((IkReal(-1.00000000000000))*(r10)*(x11940)*(x11942))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r01)*(sj0)*(x11936)))+(((cj4)*(x11931)*(x11933)))+(((x11936)*(x11937)))+(((cj4)*(x11932)*(x11933)))+(((cj4)*(r02)*(x11930)))+(((IkReal(-1.00000000000000))*(r11)*(x11934)*(x11938)))+(((r00)*(sj0)*(x11935)))+(((IkReal(-1.00000000000000))*(r10)*(x11934)*(x11939)))+(((IkReal(-1.00000000000000))*(x11944)))+(((IkReal(-1.00000000000000))*(r10)*(x11935)*(x11940)))+(((IkReal(-1.00000000000000))*(r12)*(x11940)*(x11941))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -38748,8 +38585,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -38814,7 +38650,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -38852,14 +38688,14 @@ evalcond[0]=((((sj5)*(x11988)))+(((sj5)*(x11989)))+(x11977)+(((IkReal(-1.0000000
 evalcond[1]=((((IkReal(-1.00000000000000))*(r21)*(x11985)))+(((r20)*(x11984)))+(((x11983)*(x11989)))+(x11976)+(((cj4)*(r22)*(sj5)))+(((x11983)*(x11988))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(cj6)*(sj5)*(x11986)))+(((r12)*(x11981)))+(((IkReal(-1.00000000000000))*(x11990)*(x11991)))+(((x11978)*(x11979)))+(x11976)+(((x11978)*(x11980)))+(((IkReal(-1.00000000000000))*(r02)*(sj0)*(x11982))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r01)*(sj0)*(x11985)))+(((IkReal(-1.00000000000000))*(r12)*(x11987)*(x11990)))+(((IkReal(-1.00000000000000))*(cj0)*(r10)*(x11984)))+(((IkReal(-1.00000000000000))*(x11981)*(x11987)*(x11991)))+(((sj0)*(x11979)*(x11983)))+(((x11985)*(x11986)))+(((cj4)*(r02)*(x11978)))+(((IkReal(-1.00000000000000))*(x11977)))+(((sj0)*(x11980)*(x11983)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x11981)*(x11987)))+(((r00)*(sj0)*(x11984))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -38895,8 +38731,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -38939,7 +38774,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -38983,14 +38818,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x12008)*(x12015)))+(((IkReal(-1.0000
 evalcond[3]=((((IkReal(-1.00000000000000))*(x12001)*(x12007)))+(((IkReal(-1.00000000000000))*(x12001)*(x12015)))+(((IkReal(-1.00000000000000))*(x12004)*(x12008)))+(((r02)*(x12005)))+(((r12)*(x12006)))+(((IkReal(-1.00000000000000))*(x12000)*(x12009)))+(((IkReal(-1.00000000000000))*(x12002)*(x12008))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r10)*(x12010)*(x12016)))+(((IkReal(-1.00000000000000))*(x12003)*(x12005)*(x12015)))+(((IkReal(-1.00000000000000))*(r01)*(x12018)))+(((cj4)*(x12004)*(x12006)))+(((r11)*(x12017)))+(((cj4)*(x12002)*(x12006)))+(((IkReal(-1.00000000000000))*(x12003)*(x12005)*(x12007)))+(((IkReal(-1.00000000000000))*(x12000)))+(((IkReal(-1.00000000000000))*(r12)*(x12003)*(x12008)))+(((r00)*(sj0)*(x12010)))+(((cj4)*(r02)*(x12001))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x12003)*(x12006)*(x12007)))+(((IkReal(-1.00000000000000))*(x11999)*(x12009)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x12010)))+(((IkReal(-1.00000000000000))*(r12)*(x12001)*(x12003)))+(((IkReal(-1.00000000000000))*(x12002)*(x12003)*(x12005)))+(((IkReal(-1.00000000000000))*(x12003)*(x12006)*(x12015)))+(((r01)*(x12017)))+(((IkReal(-1.00000000000000))*(r00)*(x12010)*(x12016)))+(((r11)*(x12018)))+(((IkReal(-1.00000000000000))*(r02)*(x12003)*(x12008)))+(((IkReal(-1.00000000000000))*(x12003)*(x12004)*(x12005))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -39026,8 +38861,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -39058,7 +38892,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -39102,14 +38936,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x12032)*(x12039)))+(((x12025)*(x1202
 evalcond[3]=((((IkReal(-1.00000000000000))*(x12028)*(x12032)))+(((IkReal(-1.00000000000000))*(x12026)*(x12032)))+(((IkReal(-1.00000000000000))*(x12025)*(x12039)))+(((r02)*(x12029)))+(((IkReal(-1.00000000000000))*(x12024)*(x12033)))+(((IkReal(-1.00000000000000))*(x12025)*(x12031)))+(((r12)*(x12030))));
 evalcond[4]=((((cj4)*(x12028)*(x12030)))+(((IkReal(-1.00000000000000))*(r12)*(x12027)*(x12032)))+(((r11)*(x12041)))+(((IkReal(-1.00000000000000))*(r01)*(x12042)))+(((IkReal(-1.00000000000000))*(r10)*(x12034)*(x12040)))+(((r00)*(sj0)*(x12034)))+(((IkReal(-1.00000000000000))*(x12024)))+(((IkReal(-1.00000000000000))*(x12027)*(x12029)*(x12031)))+(((cj4)*(x12026)*(x12030)))+(((cj4)*(r02)*(x12025)))+(((IkReal(-1.00000000000000))*(x12027)*(x12029)*(x12039))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x12027)*(x12028)*(x12029)))+(((IkReal(-1.00000000000000))*(x12023)*(x12033)))+(((IkReal(-1.00000000000000))*(x12026)*(x12027)*(x12029)))+(((IkReal(-1.00000000000000))*(x12027)*(x12030)*(x12031)))+(((IkReal(-1.00000000000000))*(r02)*(x12027)*(x12032)))+(((IkReal(-1.00000000000000))*(r00)*(x12034)*(x12040)))+(((r11)*(x12042)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x12034)))+(((r01)*(x12041)))+(((IkReal(-1.00000000000000))*(x12027)*(x12030)*(x12039)))+(((IkReal(-1.00000000000000))*(r12)*(x12025)*(x12027))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -39145,8 +38979,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -39176,7 +39009,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -39220,14 +39053,14 @@ evalcond[2]=((((x12048)*(x12049)))+(x12046)+(((IkReal(-1.00000000000000))*(x1205
 evalcond[3]=((((IkReal(-1.00000000000000))*(x12047)*(x12056)))+(((r12)*(x12053)))+(((IkReal(-1.00000000000000))*(x12049)*(x12055)))+(((IkReal(-1.00000000000000))*(x12051)*(x12055)))+(((r02)*(x12052)))+(((IkReal(-1.00000000000000))*(x12048)*(x12054)))+(((IkReal(-1.00000000000000))*(x12048)*(x12062))));
 evalcond[4]=((((r11)*(x12064)))+(((cj4)*(r02)*(x12048)))+(((IkReal(-1.00000000000000))*(x12050)*(x12052)*(x12062)))+(((cj4)*(x12049)*(x12053)))+(((IkReal(-1.00000000000000))*(x12050)*(x12052)*(x12054)))+(((IkReal(-1.00000000000000))*(x12047)))+(((IkReal(-1.00000000000000))*(r01)*(x12065)))+(((IkReal(-1.00000000000000))*(r12)*(x12050)*(x12055)))+(((IkReal(-1.00000000000000))*(r10)*(x12057)*(x12063)))+(((r00)*(sj0)*(x12057)))+(((cj4)*(x12051)*(x12053))));
 evalcond[5]=((((r11)*(x12065)))+(((r01)*(x12064)))+(((IkReal(-1.00000000000000))*(r02)*(x12050)*(x12055)))+(((IkReal(-1.00000000000000))*(x12050)*(x12053)*(x12062)))+(((IkReal(-1.00000000000000))*(x12050)*(x12053)*(x12054)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x12057)))+(((IkReal(-1.00000000000000))*(r00)*(x12057)*(x12063)))+(((IkReal(-1.00000000000000))*(r12)*(x12048)*(x12050)))+(((IkReal(-1.00000000000000))*(x12049)*(x12050)*(x12052)))+(((IkReal(-1.00000000000000))*(x12046)*(x12056)))+(((IkReal(-1.00000000000000))*(x12050)*(x12051)*(x12052))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -39263,8 +39096,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -39319,7 +39151,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -39366,14 +39198,14 @@ evalcond[2]=((((r12)*(x12083)))+(((x12079)*(x12080)))+(((IkReal(-1.0000000000000
 evalcond[3]=((((r12)*(x12084)))+(((IkReal(-1.00000000000000))*(x12079)*(x12085)))+(((IkReal(-1.00000000000000))*(x12077)*(x12087)))+(((IkReal(-1.00000000000000))*(x12082)*(x12094)))+(((r02)*(x12083)))+(((IkReal(-1.00000000000000))*(x12079)*(x12091)))+(((IkReal(-1.00000000000000))*(x12080)*(x12094)))+(((sj1)*(x12097))));
 evalcond[4]=((((sj2)*(x12077)))+(((cj4)*(r02)*(x12079)))+(((IkReal(-1.00000000000000))*(x12081)*(x12083)*(x12085)))+(((IkReal(-1.00000000000000))*(x12081)*(x12083)*(x12091)))+(((r00)*(sj0)*(x12086)))+(((IkReal(-1.00000000000000))*(r12)*(x12081)*(x12092)))+(((cj4)*(x12082)*(x12084)))+(((cj4)*(x12080)*(x12084)))+(((r11)*(x12096)))+(((IkReal(-1.00000000000000))*(r01)*(x12098)))+(((IkReal(-1.00000000000000))*(r10)*(x12086)*(x12093))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r02)*(x12081)*(x12092)))+(((IkReal(-1.00000000000000))*(cj2)*(x12099)))+(((IkReal(-1.00000000000000))*(r00)*(x12086)*(x12093)))+(((IkReal(-1.00000000000000))*(x12081)*(x12082)*(x12083)))+(((IkReal(-1.00000000000000))*(x12078)*(x12087)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x12086)))+(((IkReal(-1.00000000000000))*(x12081)*(x12084)*(x12085)))+(((r11)*(x12098)))+(((IkReal(-1.00000000000000))*(r12)*(x12079)*(x12081)))+(((IkReal(-1.00000000000000))*(x12081)*(x12084)*(x12091)))+(((IkReal(-1.00000000000000))*(x12080)*(x12081)*(x12083)))+(((r01)*(x12096))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -39409,8 +39241,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -39453,7 +39284,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -39500,14 +39331,14 @@ evalcond[2]=((((x12118)*(x12121)))+(((IkReal(-1.00000000000000))*(x12124)*(x1213
 evalcond[3]=((((IkReal(-1.00000000000000))*(x12119)*(x12133)))+(((r02)*(x12122)))+(((r12)*(x12123)))+(((IkReal(-1.00000000000000))*(x12118)*(x12124)))+(((IkReal(-1.00000000000000))*(x12116)*(x12126)))+(((sj1)*(x12136)))+(((IkReal(-1.00000000000000))*(x12118)*(x12130)))+(((IkReal(-1.00000000000000))*(x12121)*(x12133))));
 evalcond[4]=((((cj4)*(x12119)*(x12123)))+(((cj4)*(x12121)*(x12123)))+(((sj2)*(x12116)))+(((IkReal(-1.00000000000000))*(r01)*(x12137)))+(((IkReal(-1.00000000000000))*(x12120)*(x12122)*(x12124)))+(((cj4)*(r02)*(x12118)))+(((r00)*(sj0)*(x12125)))+(((IkReal(-1.00000000000000))*(r10)*(x12125)*(x12132)))+(((r11)*(x12135)))+(((IkReal(-1.00000000000000))*(r12)*(x12120)*(x12131)))+(((IkReal(-1.00000000000000))*(x12120)*(x12122)*(x12130))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x12117)*(x12126)))+(((IkReal(-1.00000000000000))*(r02)*(x12120)*(x12131)))+(((r11)*(x12137)))+(((IkReal(-1.00000000000000))*(x12120)*(x12123)*(x12124)))+(((IkReal(-1.00000000000000))*(r00)*(x12125)*(x12132)))+(((IkReal(-1.00000000000000))*(x12119)*(x12120)*(x12122)))+(((IkReal(-1.00000000000000))*(r12)*(x12118)*(x12120)))+(((IkReal(-1.00000000000000))*(x12120)*(x12121)*(x12122)))+(((IkReal(-1.00000000000000))*(cj2)*(x12138)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x12125)))+(((r01)*(x12135)))+(((IkReal(-1.00000000000000))*(x12120)*(x12123)*(x12130))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -39543,8 +39374,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -39583,7 +39413,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -39630,14 +39460,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x12165)*(x12168)))+(((x12153)*(x1215
 evalcond[3]=((((IkReal(-1.00000000000000))*(x12153)*(x12165)))+(((IkReal(-1.00000000000000))*(x12151)*(x12161)))+(((r12)*(x12158)))+(((IkReal(-1.00000000000000))*(x12156)*(x12168)))+(((IkReal(-1.00000000000000))*(x12153)*(x12159)))+(((sj1)*(x12171)))+(((IkReal(-1.00000000000000))*(x12154)*(x12168)))+(((r02)*(x12157))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r01)*(x12172)))+(((sj2)*(x12151)))+(((IkReal(-1.00000000000000))*(r12)*(x12155)*(x12166)))+(((cj4)*(r02)*(x12153)))+(((r00)*(sj0)*(x12160)))+(((IkReal(-1.00000000000000))*(r10)*(x12160)*(x12167)))+(((r11)*(x12170)))+(((cj4)*(x12154)*(x12158)))+(((IkReal(-1.00000000000000))*(x12155)*(x12157)*(x12165)))+(((cj4)*(x12156)*(x12158)))+(((IkReal(-1.00000000000000))*(x12155)*(x12157)*(x12159))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x12154)*(x12155)*(x12157)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x12160)))+(((IkReal(-1.00000000000000))*(x12155)*(x12158)*(x12165)))+(((IkReal(-1.00000000000000))*(r12)*(x12153)*(x12155)))+(((IkReal(-1.00000000000000))*(r00)*(x12160)*(x12167)))+(((r11)*(x12172)))+(((IkReal(-1.00000000000000))*(x12155)*(x12156)*(x12157)))+(((IkReal(-1.00000000000000))*(x12152)*(x12161)))+(((IkReal(-1.00000000000000))*(r02)*(x12155)*(x12166)))+(((IkReal(-1.00000000000000))*(cj2)*(x12173)))+(((r01)*(x12170)))+(((IkReal(-1.00000000000000))*(x12155)*(x12158)*(x12159))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -39673,8 +39503,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -39715,7 +39544,7 @@ if( j4array[0] > IKPI )
 else if( j4array[0] < -IKPI )
 {    j4array[0]+=IK2PI;
 }
-j4valid[0] = true;
+j4valid[0] = IKinlimits(4,j4array[0]);
 for(int ij4 = 0; ij4 < 1; ++ij4)
 {
 if( !j4valid[ij4] )
@@ -39750,7 +39579,7 @@ IkReal x12195=((r11)*(sj6)*(x12183));
 evalcond[0]=((((IkReal(-1.00000000000000))*(r20)*(x12192)))+(((IkReal(-1.00000000000000))*(cj1)*(sj2)))+(((r22)*(x12189)))+(((r20)*(sj6)*(x12191)))+(((r21)*(sj6)*(x12183)))+(((cj6)*(r21)*(x12191))));
 evalcond[1]=((((IkReal(-1.00000000000000))*(r12)*(x12186)*(x12189)))+(((x12184)*(x12193)))+(((IkReal(-1.00000000000000))*(x12186)*(x12188)*(x12191)))+(((x12185)*(x12193)))+(((sj0)*(x12194)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x12186)*(x12191)))+(cj2)+(((IkReal(-1.00000000000000))*(x12186)*(x12195)))+(((IkReal(-1.00000000000000))*(r00)*(x12187)*(x12192)))+(((r02)*(sj0)*(x12189)))+(((cj0)*(r10)*(x12192))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r12)*(x12187)*(x12189)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x12187)*(x12191)))+(((IkReal(-1.00000000000000))*(x12187)*(x12195)))+(((r10)*(sj0)*(x12192)))+(((IkReal(-1.00000000000000))*(x12186)*(x12194)))+(((IkReal(-1.00000000000000))*(r02)*(x12186)*(x12189)))+(((sj1)*(sj2)))+(((cj0)*(r00)*(x12192)))+(((IkReal(-1.00000000000000))*(x12187)*(x12188)*(x12191)))+(((IkReal(-1.00000000000000))*(x12185)*(x12186)*(x12191)))+(((IkReal(-1.00000000000000))*(x12184)*(x12186)*(x12191))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
@@ -39869,7 +39698,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -39912,14 +39741,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x12263)))+(((IkReal(-1.0000000000000
 evalcond[1]=((x12258)+(((x12254)*(x12255)))+(((x12254)*(x12256)))+(((cj4)*(r22)*(sj5)))+(((IkReal(-1.00000000000000))*(r21)*(x12253)))+(((IkReal(-1.00000000000000))*(sj1)*(x12260)))+(((r20)*(x12252))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x12249)*(x12259)))+(((r02)*(x12247)))+(((sj1)*(x12244)))+(((IkReal(-1.00000000000000))*(x12248)*(x12259)))+(((IkReal(-1.00000000000000))*(x12258)))+(((IkReal(-1.00000000000000))*(x12246)*(x12250)))+(((r12)*(x12251)))+(((IkReal(-1.00000000000000))*(x12246)*(x12257))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r12)*(x12245)*(x12246)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x12252)))+(((cj0)*(r01)*(x12253)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x12252)))+(((IkReal(-1.00000000000000))*(x12245)*(x12247)*(x12249)))+(((IkReal(-1.00000000000000))*(x12245)*(x12250)*(x12251)))+(((IkReal(-1.00000000000000))*(x12263)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x12245)))+(((IkReal(-1.00000000000000))*(x12245)*(x12247)*(x12248)))+(((r11)*(sj0)*(x12253)))+(((IkReal(-1.00000000000000))*(x12245)*(x12251)*(x12257))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -39955,8 +39784,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -39993,7 +39821,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -40036,14 +39864,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x12294)))+(((sj5)*(x12287)))+(((IkRe
 evalcond[1]=((((IkReal(-1.00000000000000))*(r21)*(x12284)))+(((x12285)*(x12286)))+(((cj4)*(r22)*(sj5)))+(((r20)*(x12283)))+(x12289)+(((x12285)*(x12287)))+(((IkReal(-1.00000000000000))*(sj1)*(x12291))));
 evalcond[2]=((((r12)*(x12282)))+(((IkReal(-1.00000000000000))*(x12279)*(x12290)))+(((IkReal(-1.00000000000000))*(x12289)))+(((r02)*(x12278)))+(((IkReal(-1.00000000000000))*(x12277)*(x12288)))+(((sj1)*(x12275)))+(((IkReal(-1.00000000000000))*(x12277)*(x12281)))+(((IkReal(-1.00000000000000))*(x12280)*(x12290))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x12294)))+(((r11)*(sj0)*(x12284)))+(((IkReal(-1.00000000000000))*(r12)*(x12276)*(x12277)))+(((IkReal(-1.00000000000000))*(x12276)*(x12278)*(x12280)))+(((IkReal(-1.00000000000000))*(x12276)*(x12278)*(x12279)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x12283)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x12283)))+(((cj0)*(r01)*(x12284)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x12276)))+(((IkReal(-1.00000000000000))*(x12276)*(x12282)*(x12288)))+(((IkReal(-1.00000000000000))*(x12276)*(x12281)*(x12282))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -40079,8 +39907,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -40183,7 +40010,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -40226,14 +40053,14 @@ evalcond[0]=((((sj5)*(x12355)))+(((sj5)*(x12354)))+(((IkReal(-1.00000000000000))
 evalcond[1]=((((IkReal(-1.00000000000000))*(r21)*(x12352)))+(((cj4)*(r22)*(sj5)))+(((IkReal(-1.00000000000000))*(x12362)))+(((x12353)*(x12354)))+(((r20)*(x12351)))+(((x12353)*(x12355))));
 evalcond[2]=((((r02)*(x12346)))+(((IkReal(-1.00000000000000))*(x12348)*(x12358)))+(((IkReal(-1.00000000000000))*(x12362)))+(((IkReal(-1.00000000000000))*(x12345)*(x12356)))+(((r12)*(x12350)))+(((IkReal(-1.00000000000000))*(x12347)*(x12358)))+(((IkReal(-1.00000000000000))*(x12345)*(x12349))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r12)*(x12344)*(x12345)))+(((sj1)*(x12343)))+(((IkReal(-1.00000000000000))*(x12357)))+(((IkReal(-1.00000000000000))*(x12344)*(x12349)*(x12350)))+(((IkReal(-1.00000000000000))*(x12344)*(x12346)*(x12348)))+(((IkReal(-1.00000000000000))*(x12344)*(x12346)*(x12347)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x12344)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x12351)))+(((r11)*(sj0)*(x12352)))+(((cj0)*(r01)*(x12352)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x12351)))+(((IkReal(-1.00000000000000))*(x12344)*(x12350)*(x12356))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -40269,8 +40096,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -40307,7 +40133,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -40350,14 +40176,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(sj1)*(x12390)))+(((IkReal(-1.0000000
 evalcond[1]=((((IkReal(-1.00000000000000))*(r21)*(x12383)))+(((x12384)*(x12386)))+(((cj4)*(r22)*(sj5)))+(((r20)*(x12382)))+(((IkReal(-1.00000000000000))*(x12393)))+(((x12384)*(x12385))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x12379)*(x12389)))+(((r12)*(x12381)))+(((IkReal(-1.00000000000000))*(x12376)*(x12380)))+(((r02)*(x12377)))+(((IkReal(-1.00000000000000))*(x12378)*(x12389)))+(((IkReal(-1.00000000000000))*(x12393)))+(((IkReal(-1.00000000000000))*(x12376)*(x12387))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x12375)))+(((IkReal(-1.00000000000000))*(x12375)*(x12377)*(x12378)))+(((IkReal(-1.00000000000000))*(x12388)))+(((cj0)*(r01)*(x12383)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x12382)))+(((IkReal(-1.00000000000000))*(x12375)*(x12377)*(x12379)))+(((IkReal(-1.00000000000000))*(x12375)*(x12381)*(x12387)))+(((r11)*(sj0)*(x12383)))+(((sj1)*(x12374)))+(((IkReal(-1.00000000000000))*(x12375)*(x12380)*(x12381)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x12382)))+(((IkReal(-1.00000000000000))*(r12)*(x12375)*(x12376))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -40393,8 +40219,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -40521,7 +40346,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -40559,14 +40384,14 @@ evalcond[0]=((((sj5)*(x12466)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((s
 evalcond[1]=((((x12465)*(x12467)))+(((x12465)*(x12466)))+(((IkReal(-1.00000000000000))*(r21)*(x12464)))+(((r20)*(x12463)))+(((cj4)*(r22)*(sj5)))+(x12455));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x12457)*(x12468)))+(((IkReal(-1.00000000000000))*(x12459)*(x12470)))+(((IkReal(-1.00000000000000))*(x12457)*(x12461)))+(((IkReal(-1.00000000000000))*(x12460)*(x12470)))+(((r02)*(x12458)))+(((r12)*(x12462)))+(((IkReal(-1.00000000000000))*(x12455))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x12456)*(x12461)*(x12462)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x12463)))+(((IkReal(-1.00000000000000))*(x12456)*(x12458)*(x12460)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x12463)))+(((IkReal(-1.00000000000000))*(r12)*(x12456)*(x12457)))+(((cj0)*(r01)*(x12464)))+(((IkReal(-1.00000000000000))*(x12469)))+(((IkReal(-1.00000000000000))*(x12456)*(x12462)*(x12468)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x12456)))+(((r11)*(sj0)*(x12464)))+(((IkReal(-1.00000000000000))*(x12456)*(x12458)*(x12459))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -40602,8 +40427,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -40674,7 +40498,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -40712,14 +40536,14 @@ evalcond[0]=((((sj5)*(x12520)))+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((s
 evalcond[1]=((((r20)*(x12516)))+(((x12518)*(x12520)))+(((cj4)*(r22)*(sj5)))+(((x12518)*(x12519)))+(((IkReal(-1.00000000000000))*(x12522)))+(((IkReal(-1.00000000000000))*(r21)*(x12517))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x12512)*(x12523)))+(((r12)*(x12515)))+(((IkReal(-1.00000000000000))*(x12510)*(x12514)))+(((IkReal(-1.00000000000000))*(x12513)*(x12523)))+(((IkReal(-1.00000000000000))*(x12510)*(x12521)))+(((IkReal(-1.00000000000000))*(x12522)))+(((r02)*(x12511))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r10)*(sj0)*(x12516)))+(((r11)*(sj0)*(x12517)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x12509)))+(((IkReal(-1.00000000000000))*(x12509)*(x12515)*(x12521)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x12516)))+(((IkReal(-1.00000000000000))*(x12509)*(x12511)*(x12512)))+(((IkReal(-1.00000000000000))*(x12508)))+(((IkReal(-1.00000000000000))*(x12509)*(x12514)*(x12515)))+(((cj0)*(r01)*(x12517)))+(((IkReal(-1.00000000000000))*(r12)*(x12509)*(x12510)))+(((IkReal(-1.00000000000000))*(x12509)*(x12511)*(x12513))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -40755,8 +40579,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -40825,7 +40648,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -40864,14 +40687,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x12567)*(x12569)))+(((x12560)*(x1256
 evalcond[1]=((((r02)*(x12565)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x12569)))+(((IkReal(-1.00000000000000))*(x12561)*(x12569)))+(((r12)*(x12566)))+(((IkReal(-1.00000000000000))*(x12560)*(x12568)))+(((IkReal(-1.00000000000000))*(x12560)*(x12567)))+(((IkReal(-1.00000000000000))*(x12559))));
 evalcond[2]=((x12559)+(((IkReal(-1.00000000000000))*(x12563)*(x12565)*(x12567)))+(((x12562)*(x12564)))+(((cj4)*(x12561)*(x12566)))+(((IkReal(-1.00000000000000))*(x12563)*(x12565)*(x12568)))+(((x12562)*(x12572)))+(((IkReal(-1.00000000000000))*(x12570)*(x12573)))+(((r11)*(x12574)))+(((IkReal(-1.00000000000000))*(r01)*(x12575)))+(((cj4)*(r02)*(x12560)))+(((IkReal(-1.00000000000000))*(r12)*(x12563)*(x12569))));
 evalcond[3]=((((r01)*(x12574)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x12562)*(x12563)))+(((IkReal(-1.00000000000000))*(x12561)*(x12563)*(x12565)))+(((IkReal(-1.00000000000000))*(r12)*(x12560)*(x12563)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x12563)*(x12565)))+(((IkReal(-1.00000000000000))*(x12563)*(x12566)*(x12568)))+(((IkReal(-1.00000000000000))*(x12562)*(x12570)))+(((IkReal(-1.00000000000000))*(r02)*(x12563)*(x12569)))+(((IkReal(-1.00000000000000))*(x12571)))+(((IkReal(-1.00000000000000))*(x12564)*(x12573)))+(((r11)*(x12575))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -40907,8 +40730,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -40976,7 +40798,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -41015,14 +40837,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x12619)*(x12621)))+(((IkReal(-1.0000
 evalcond[1]=((((IkReal(-1.00000000000000))*(x12617)*(x12619)))+(((r12)*(x12618)))+(((IkReal(-1.00000000000000))*(x12612)*(x12619)))+(((IkReal(-1.00000000000000))*(x12623)))+(((r02)*(x12616)))+(((IkReal(-1.00000000000000))*(x12611)*(x12620)))+(((IkReal(-1.00000000000000))*(x12611)*(x12621))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r12)*(x12613)*(x12619)))+(((IkReal(-1.00000000000000))*(x12622)*(x12626)))+(((IkReal(-1.00000000000000))*(x12623)))+(((x12614)*(x12615)))+(((r11)*(x12624)))+(((cj4)*(cj5)*(r01)*(x12614)))+(((cj4)*(x12612)*(x12618)))+(((IkReal(-1.00000000000000))*(r01)*(x12625)))+(((cj4)*(r02)*(x12611)))+(((IkReal(-1.00000000000000))*(x12613)*(x12616)*(x12620)))+(((IkReal(-1.00000000000000))*(x12613)*(x12616)*(x12621))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x12615)*(x12626)))+(((IkReal(-1.00000000000000))*(x12614)*(x12622)))+(((IkReal(-1.00000000000000))*(x12613)*(x12618)*(x12621)))+(((IkReal(-1.00000000000000))*(x12610)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x12613)*(x12614)))+(((IkReal(-1.00000000000000))*(x12613)*(x12616)*(x12617)))+(((IkReal(-1.00000000000000))*(x12612)*(x12613)*(x12616)))+(((r11)*(x12625)))+(((IkReal(-1.00000000000000))*(r12)*(x12611)*(x12613)))+(((r01)*(x12624)))+(((IkReal(-1.00000000000000))*(r02)*(x12613)*(x12619))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -41058,8 +40880,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -41105,7 +40926,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -41148,14 +40969,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(sj2)*(x12651)))+(((IkReal(-1.0000000
 evalcond[3]=((((IkReal(-1.00000000000000))*(x12636)))+(((r02)*(x12641)))+(((r12)*(x12642)))+(((IkReal(-1.00000000000000))*(x12637)*(x12649)))+(((IkReal(-1.00000000000000))*(x12638)*(x12644)))+(((IkReal(-1.00000000000000))*(x12640)*(x12644)))+(((IkReal(-1.00000000000000))*(x12637)*(x12643))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r01)*(x12653)))+(((sj2)*(x12636)))+(((cj4)*(r02)*(x12637)))+(((cj4)*(x12638)*(x12642)))+(((IkReal(-1.00000000000000))*(r12)*(x12639)*(x12644)))+(((r11)*(x12652)))+(((IkReal(-1.00000000000000))*(x12639)*(x12641)*(x12649)))+(((cj4)*(x12640)*(x12642)))+(((IkReal(-1.00000000000000))*(r10)*(x12645)*(x12650)))+(((IkReal(-1.00000000000000))*(x12639)*(x12641)*(x12643)))+(((r00)*(sj0)*(x12645))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x12639)*(x12640)*(x12641)))+(((IkReal(-1.00000000000000))*(x12639)*(x12642)*(x12649)))+(((IkReal(-1.00000000000000))*(x12651)))+(((r01)*(x12652)))+(((IkReal(-1.00000000000000))*(x12638)*(x12639)*(x12641)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x12645)))+(((IkReal(-1.00000000000000))*(r00)*(x12645)*(x12650)))+(((IkReal(-1.00000000000000))*(r02)*(x12639)*(x12644)))+(((r11)*(x12653)))+(((IkReal(-1.00000000000000))*(r12)*(x12637)*(x12639)))+(((IkReal(-1.00000000000000))*(x12639)*(x12642)*(x12643))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -41191,8 +41012,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -41221,7 +41041,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -41264,14 +41084,14 @@ evalcond[2]=((((x12658)*(x12661)))+(((IkReal(-1.00000000000000))*(x12664)*(x1266
 evalcond[3]=((((r02)*(x12662)))+(((IkReal(-1.00000000000000))*(x12659)*(x12665)))+(((IkReal(-1.00000000000000))*(x12658)*(x12670)))+(((IkReal(-1.00000000000000))*(x12658)*(x12664)))+(((r12)*(x12663)))+(((IkReal(-1.00000000000000))*(x12661)*(x12665)))+(((IkReal(-1.00000000000000))*(x12657))));
 evalcond[4]=((((sj2)*(x12657)))+(((cj4)*(r02)*(x12658)))+(((cj4)*(x12661)*(x12663)))+(((r11)*(x12673)))+(((cj4)*(x12659)*(x12663)))+(((IkReal(-1.00000000000000))*(r01)*(x12674)))+(((IkReal(-1.00000000000000))*(x12660)*(x12662)*(x12664)))+(((r00)*(sj0)*(x12666)))+(((IkReal(-1.00000000000000))*(r10)*(x12666)*(x12671)))+(((IkReal(-1.00000000000000))*(x12660)*(x12662)*(x12670)))+(((IkReal(-1.00000000000000))*(r12)*(x12660)*(x12665))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x12672)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x12666)))+(((IkReal(-1.00000000000000))*(x12660)*(x12661)*(x12662)))+(((r11)*(x12674)))+(((IkReal(-1.00000000000000))*(x12660)*(x12663)*(x12664)))+(((IkReal(-1.00000000000000))*(r12)*(x12658)*(x12660)))+(((r01)*(x12673)))+(((IkReal(-1.00000000000000))*(r00)*(x12666)*(x12671)))+(((IkReal(-1.00000000000000))*(x12660)*(x12663)*(x12670)))+(((IkReal(-1.00000000000000))*(r02)*(x12660)*(x12665)))+(((IkReal(-1.00000000000000))*(x12659)*(x12660)*(x12662))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -41307,8 +41127,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -41338,7 +41157,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -41381,14 +41200,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(sj2)*(x12694)))+(((x12680)*(x12683))
 evalcond[3]=((((IkReal(-1.00000000000000))*(x12679)))+(((r12)*(x12685)))+(((r02)*(x12684)))+(((IkReal(-1.00000000000000))*(x12680)*(x12692)))+(((IkReal(-1.00000000000000))*(x12681)*(x12687)))+(((IkReal(-1.00000000000000))*(x12680)*(x12686)))+(((IkReal(-1.00000000000000))*(x12683)*(x12687))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x12682)*(x12684)*(x12692)))+(((cj4)*(x12683)*(x12685)))+(((r00)*(sj0)*(x12688)))+(((r11)*(x12695)))+(((cj4)*(x12681)*(x12685)))+(((cj4)*(r02)*(x12680)))+(((sj2)*(x12679)))+(((IkReal(-1.00000000000000))*(r10)*(x12688)*(x12693)))+(((IkReal(-1.00000000000000))*(r01)*(x12696)))+(((IkReal(-1.00000000000000))*(r12)*(x12682)*(x12687)))+(((IkReal(-1.00000000000000))*(x12682)*(x12684)*(x12686))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x12681)*(x12682)*(x12684)))+(((IkReal(-1.00000000000000))*(x12682)*(x12685)*(x12692)))+(((r01)*(x12695)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x12688)))+(((IkReal(-1.00000000000000))*(x12682)*(x12685)*(x12686)))+(((IkReal(-1.00000000000000))*(r12)*(x12680)*(x12682)))+(((r11)*(x12696)))+(((IkReal(-1.00000000000000))*(r02)*(x12682)*(x12687)))+(((IkReal(-1.00000000000000))*(x12694)))+(((IkReal(-1.00000000000000))*(x12682)*(x12683)*(x12684)))+(((IkReal(-1.00000000000000))*(r00)*(x12688)*(x12693))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -41424,8 +41243,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -41553,7 +41371,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -41591,14 +41409,14 @@ evalcond[0]=((x12760)+(((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((sj5)*(x1277
 evalcond[1]=((((r20)*(x12768)))+(((x12770)*(x12772)))+(((x12770)*(x12771)))+(((cj4)*(r22)*(sj5)))+(((IkReal(-1.00000000000000))*(r21)*(x12769)))+(((IkReal(-1.00000000000000))*(x12759))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(x12762)*(x12766)))+(((r02)*(x12763)))+(((r12)*(x12767)))+(((IkReal(-1.00000000000000))*(x12765)*(x12774)))+(((IkReal(-1.00000000000000))*(x12762)*(x12773)))+(((IkReal(-1.00000000000000))*(x12764)*(x12774)))+(x12759));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x12761)*(x12763)*(x12765)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x12768)))+(((IkReal(-1.00000000000000))*(cj0)*(r00)*(x12768)))+(((IkReal(-1.00000000000000))*(x12761)*(x12763)*(x12764)))+(x12760)+(((IkReal(-1.00000000000000))*(x12761)*(x12766)*(x12767)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x12761)))+(((IkReal(-1.00000000000000))*(x12761)*(x12767)*(x12773)))+(((cj0)*(r01)*(x12769)))+(((IkReal(-1.00000000000000))*(r12)*(x12761)*(x12762)))+(((r11)*(sj0)*(x12769))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -41634,8 +41452,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -41706,7 +41523,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -41744,14 +41561,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((sj5)*(x12825)))+(((I
 evalcond[1]=((((x12823)*(x12825)))+(((x12823)*(x12824)))+(((cj4)*(r22)*(sj5)))+(x12812)+(((r20)*(x12821)))+(((IkReal(-1.00000000000000))*(r21)*(x12822))));
 evalcond[2]=((((r12)*(x12820)))+(((r02)*(x12816)))+(((IkReal(-1.00000000000000))*(x12815)*(x12826)))+(((IkReal(-1.00000000000000))*(x12818)*(x12827)))+(x12812)+(((IkReal(-1.00000000000000))*(x12817)*(x12827)))+(((IkReal(-1.00000000000000))*(x12815)*(x12819))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(cj0)*(r00)*(x12821)))+(((IkReal(-1.00000000000000))*(x12814)*(x12820)*(x12826)))+(((r11)*(sj0)*(x12822)))+(((IkReal(-1.00000000000000))*(x12814)*(x12816)*(x12818)))+(x12813)+(((IkReal(-1.00000000000000))*(x12814)*(x12816)*(x12817)))+(((IkReal(-1.00000000000000))*(cj0)*(r02)*(sj5)*(x12814)))+(((cj0)*(r01)*(x12822)))+(((IkReal(-1.00000000000000))*(x12814)*(x12819)*(x12820)))+(((IkReal(-1.00000000000000))*(r12)*(x12814)*(x12815)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x12821))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -41787,8 +41604,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -41856,7 +41672,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -41895,14 +41711,14 @@ evalcond[0]=((((cj6)*(r01)*(x12864)))+(((IkReal(-1.00000000000000))*(x12871)*(x1
 evalcond[1]=((((r02)*(x12869)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x12873)))+(((IkReal(-1.00000000000000))*(x12864)*(x12871)))+(((IkReal(-1.00000000000000))*(x12865)*(x12873)))+(((IkReal(-1.00000000000000))*(x12864)*(x12872)))+(x12862)+(((r12)*(x12870))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r12)*(x12867)*(x12873)))+(((cj4)*(r02)*(x12864)))+(((cj4)*(x12865)*(x12870)))+(((IkReal(-1.00000000000000))*(r01)*(x12878)))+(((IkReal(-1.00000000000000))*(x12867)*(x12869)*(x12872)))+(((IkReal(-1.00000000000000))*(x12874)*(x12876)))+(((r11)*(x12877)))+(((x12866)*(x12875)))+(((IkReal(-1.00000000000000))*(x12867)*(x12869)*(x12871)))+(((x12866)*(x12868)))+(x12862));
 evalcond[3]=((((r01)*(x12877)))+(((r11)*(x12878)))+(((IkReal(-1.00000000000000))*(r02)*(x12867)*(x12873)))+(((IkReal(-1.00000000000000))*(x12866)*(x12874)))+(((IkReal(-1.00000000000000))*(x12868)*(x12876)))+(((IkReal(-1.00000000000000))*(cj6)*(r01)*(x12867)*(x12869)))+(((IkReal(-1.00000000000000))*(r12)*(x12864)*(x12867)))+(((IkReal(-1.00000000000000))*(cj5)*(r11)*(x12866)*(x12867)))+(((IkReal(-1.00000000000000))*(x12867)*(x12870)*(x12872)))+(((IkReal(-1.00000000000000))*(x12865)*(x12867)*(x12869)))+(x12863));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -41938,8 +41754,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -42005,7 +41820,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -42044,14 +41859,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x12921)*(x12922)))+(((x12913)*(x1291
 evalcond[1]=((((r12)*(x12920)))+(((IkReal(-1.00000000000000))*(x12913)*(x12922)))+(((IkReal(-1.00000000000000))*(x12913)*(x12923)))+(((IkReal(-1.00000000000000))*(x12919)*(x12921)))+(x12911)+(((IkReal(-1.00000000000000))*(x12914)*(x12921)))+(((r02)*(x12918))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r01)*(x12926)))+(((cj4)*(x12914)*(x12920)))+(((IkReal(-1.00000000000000))*(x12924)*(x12927)))+(((IkReal(-1.00000000000000))*(x12911)))+(((r11)*(x12925)))+(((cj4)*(r02)*(x12913)))+(((IkReal(-1.00000000000000))*(x12915)*(x12918)*(x12922)))+(((x12916)*(x12917)))+(((IkReal(-1.00000000000000))*(r12)*(x12915)*(x12921)))+(((cj4)*(cj5)*(r01)*(x12916)))+(((IkReal(-1.00000000000000))*(x12915)*(x12918)*(x12923))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(cj5)*(r11)*(x12915)*(x12916)))+(((IkReal(-1.00000000000000))*(x12914)*(x12915)*(x12918)))+(((r11)*(x12926)))+(((IkReal(-1.00000000000000))*(x12915)*(x12920)*(x12923)))+(((IkReal(-1.00000000000000))*(x12917)*(x12927)))+(((IkReal(-1.00000000000000))*(x12916)*(x12924)))+(x12912)+(((IkReal(-1.00000000000000))*(r02)*(x12915)*(x12921)))+(((r01)*(x12925)))+(((IkReal(-1.00000000000000))*(x12915)*(x12918)*(x12919)))+(((IkReal(-1.00000000000000))*(r12)*(x12913)*(x12915))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -42087,8 +41902,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -42133,7 +41947,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -42175,14 +41989,14 @@ evalcond[2]=((((r12)*(x12941)))+(((IkReal(-1.00000000000000))*(r02)*(x12942)))+(
 evalcond[3]=((((IkReal(-1.00000000000000))*(x12937)*(x12943)))+(x12936)+(((r12)*(x12942)))+(((IkReal(-1.00000000000000))*(x12937)*(x12949)))+(((IkReal(-1.00000000000000))*(x12938)*(x12945)))+(((IkReal(-1.00000000000000))*(x12940)*(x12945)))+(((r02)*(x12941))));
 evalcond[4]=((((sj2)*(x12936)))+(((cj4)*(r02)*(x12937)))+(((cj4)*(x12940)*(x12942)))+(((r11)*(x12951)))+(((IkReal(-1.00000000000000))*(x12939)*(x12941)*(x12949)))+(((IkReal(-1.00000000000000))*(r12)*(x12939)*(x12945)))+(((IkReal(-1.00000000000000))*(r10)*(x12944)*(x12950)))+(((cj4)*(x12938)*(x12942)))+(((IkReal(-1.00000000000000))*(r01)*(x12952)))+(((r00)*(sj0)*(x12944)))+(((IkReal(-1.00000000000000))*(x12939)*(x12941)*(x12943))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r00)*(x12944)*(x12950)))+(((r11)*(x12952)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x12944)))+(((IkReal(-1.00000000000000))*(x12939)*(x12942)*(x12943)))+(((IkReal(-1.00000000000000))*(x12938)*(x12939)*(x12941)))+(x12935)+(((IkReal(-1.00000000000000))*(x12939)*(x12942)*(x12949)))+(((IkReal(-1.00000000000000))*(x12939)*(x12940)*(x12941)))+(((IkReal(-1.00000000000000))*(r12)*(x12937)*(x12939)))+(((IkReal(-1.00000000000000))*(r02)*(x12939)*(x12945)))+(((r01)*(x12951))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -42218,8 +42032,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -42249,7 +42062,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -42291,14 +42104,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(sj2)*(x12956)))+(((IkReal(-1.0000000
 evalcond[3]=((((IkReal(-1.00000000000000))*(x12958)*(x12964)))+(((r12)*(x12963)))+(((IkReal(-1.00000000000000))*(x12961)*(x12966)))+(((r02)*(x12962)))+(((IkReal(-1.00000000000000))*(x12958)*(x12970)))+(((IkReal(-1.00000000000000))*(x12959)*(x12966)))+(x12957));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x12960)*(x12962)*(x12970)))+(((cj4)*(r02)*(x12958)))+(((IkReal(-1.00000000000000))*(r10)*(x12965)*(x12971)))+(((IkReal(-1.00000000000000))*(x12960)*(x12962)*(x12964)))+(((r00)*(sj0)*(x12965)))+(((cj4)*(x12959)*(x12963)))+(((cj4)*(x12961)*(x12963)))+(((IkReal(-1.00000000000000))*(r12)*(x12960)*(x12966)))+(((IkReal(-1.00000000000000))*(r01)*(x12973)))+(((sj2)*(x12957)))+(((r11)*(x12972))));
 evalcond[5]=((((r11)*(x12973)))+(((r01)*(x12972)))+(((IkReal(-1.00000000000000))*(x12960)*(x12961)*(x12962)))+(((IkReal(-1.00000000000000))*(x12960)*(x12963)*(x12964)))+(((IkReal(-1.00000000000000))*(r12)*(x12958)*(x12960)))+(((IkReal(-1.00000000000000))*(r00)*(x12965)*(x12971)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x12965)))+(((IkReal(-1.00000000000000))*(x12959)*(x12960)*(x12962)))+(((IkReal(-1.00000000000000))*(x12960)*(x12963)*(x12970)))+(x12956)+(((IkReal(-1.00000000000000))*(r02)*(x12960)*(x12966))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -42334,8 +42147,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -42365,7 +42177,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -42407,14 +42219,14 @@ evalcond[2]=((((r12)*(x12983)))+(((x12979)*(x12982)))+(((IkReal(-1.0000000000000
 evalcond[3]=((((r02)*(x12983)))+(((IkReal(-1.00000000000000))*(x12982)*(x12987)))+(x12978)+(((IkReal(-1.00000000000000))*(x12979)*(x12991)))+(((IkReal(-1.00000000000000))*(x12979)*(x12985)))+(((IkReal(-1.00000000000000))*(x12980)*(x12987)))+(((r12)*(x12984))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x12981)*(x12983)*(x12985)))+(((IkReal(-1.00000000000000))*(r12)*(x12981)*(x12987)))+(((sj2)*(x12978)))+(((cj4)*(x12980)*(x12984)))+(((cj4)*(r02)*(x12979)))+(((IkReal(-1.00000000000000))*(r10)*(x12986)*(x12992)))+(((IkReal(-1.00000000000000))*(x12981)*(x12983)*(x12991)))+(((cj4)*(x12982)*(x12984)))+(((IkReal(-1.00000000000000))*(r01)*(x12994)))+(((r11)*(x12993)))+(((r00)*(sj0)*(x12986))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x12980)*(x12981)*(x12983)))+(((r01)*(x12993)))+(((r11)*(x12994)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x12986)))+(((IkReal(-1.00000000000000))*(x12981)*(x12984)*(x12985)))+(x12977)+(((IkReal(-1.00000000000000))*(r02)*(x12981)*(x12987)))+(((IkReal(-1.00000000000000))*(x12981)*(x12984)*(x12991)))+(((IkReal(-1.00000000000000))*(x12981)*(x12982)*(x12983)))+(((IkReal(-1.00000000000000))*(r00)*(x12986)*(x12992)))+(((IkReal(-1.00000000000000))*(r12)*(x12979)*(x12981))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -42450,8 +42262,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -42572,7 +42383,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -42610,14 +42421,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(x13050)))+(((r21)*(x13064)))+(((IkRe
 evalcond[1]=((((r22)*(x13062)))+(((IkReal(-1.00000000000000))*(r21)*(x13057)))+(((IkReal(-1.00000000000000))*(x13065)))+(((r20)*(x13056)))+(((cj5)*(r20)*(x13060)))+(((cj5)*(r21)*(x13059))));
 evalcond[2]=((((r12)*(x13055)))+(((x13051)*(x13052)))+(((IkReal(-1.00000000000000))*(x13058)*(x13064)))+(((x13051)*(x13053)))+(((IkReal(-1.00000000000000))*(x13065)))+(((IkReal(-1.00000000000000))*(r10)*(x13061)*(x13063)))+(((IkReal(-1.00000000000000))*(r02)*(x13054))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r01)*(sj0)*(x13057)))+(((x13057)*(x13058)))+(((r00)*(sj0)*(x13056)))+(((IkReal(-1.00000000000000))*(r10)*(x13056)*(x13061)))+(((IkReal(-1.00000000000000))*(r12)*(x13061)*(x13062)))+(((cj4)*(r02)*(x13051)))+(((IkReal(-1.00000000000000))*(r11)*(x13055)*(x13059)))+(((IkReal(-1.00000000000000))*(r10)*(x13055)*(x13060)))+(((cj4)*(x13053)*(x13054)))+(x13050)+(((cj4)*(x13052)*(x13054))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -42653,8 +42464,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -42719,7 +42529,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -42757,14 +42567,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(cj5)*(r22)))+(((r20)*(x13111)))+(x13
 evalcond[1]=((((cj5)*(r21)*(x13107)))+(((IkReal(-1.00000000000000))*(r21)*(x13105)))+(((r22)*(x13110)))+(x13097)+(((cj5)*(r20)*(x13108)))+(((r20)*(x13104))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r02)*(x13102)))+(((IkReal(-1.00000000000000))*(x13106)*(x13112)))+(((x13099)*(x13100)))+(((IkReal(-1.00000000000000))*(r10)*(x13109)*(x13111)))+(((x13099)*(x13101)))+(((IkReal(-1.00000000000000))*(x13097)))+(((r12)*(x13103))));
 evalcond[3]=((((IkReal(-1.00000000000000))*(r10)*(x13103)*(x13108)))+(((cj4)*(r02)*(x13099)))+(((IkReal(-1.00000000000000))*(r11)*(x13103)*(x13107)))+(((IkReal(-1.00000000000000))*(r10)*(x13104)*(x13109)))+(((x13105)*(x13106)))+(((r00)*(sj0)*(x13104)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x13105)))+(((IkReal(-1.00000000000000))*(r12)*(x13109)*(x13110)))+(x13098)+(((cj4)*(x13100)*(x13102)))+(((cj4)*(x13101)*(x13102))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -42800,8 +42610,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -42845,7 +42654,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -42890,14 +42699,14 @@ evalcond[2]=((((cj0)*(x13128)))+(((x13123)*(x13125)))+(((IkReal(-1.0000000000000
 evalcond[3]=((((IkReal(-1.00000000000000))*(x13123)*(x13130)))+(((IkReal(-1.00000000000000))*(sj5)*(x13125)*(x13127)))+(((sj0)*(x13128)))+(((IkReal(-1.00000000000000))*(x13123)*(x13136)))+(((cj0)*(x13131)))+(((IkReal(-1.00000000000000))*(sj5)*(x13124)*(x13127)))+(((IkReal(-1.00000000000000))*(x13122)*(x13132))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r10)*(x13127)*(x13133)))+(((r00)*(sj0)*(x13133)))+(((x13123)*(x13138)))+(((IkReal(-1.00000000000000))*(x13126)*(x13127)*(x13136)))+(((r11)*(x13141)))+(((IkReal(-1.00000000000000))*(x13126)*(x13127)*(x13130)))+(((sj0)*(x13125)*(x13126)))+(((sj0)*(x13124)*(x13126)))+(((IkReal(-1.00000000000000))*(r01)*(x13129)*(x13137)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x13127)))+(x13122));
 evalcond[5]=((((r11)*(sj0)*(x13137)))+(((IkReal(-1.00000000000000))*(x13121)*(x13132)))+(((r01)*(x13141)))+(((IkReal(-1.00000000000000))*(r10)*(x13129)*(x13133)))+(((IkReal(-1.00000000000000))*(x13126)*(x13129)*(x13136)))+(((IkReal(-1.00000000000000))*(x13125)*(x13126)*(x13127)))+(((IkReal(-1.00000000000000))*(x13124)*(x13126)*(x13127)))+(((IkReal(-1.00000000000000))*(x13126)*(x13129)*(x13130)))+(((IkReal(-1.00000000000000))*(sj5)*(x13127)*(x13138)))+(((IkReal(-1.00000000000000))*(x13123)*(x13139)))+(((IkReal(-1.00000000000000))*(r00)*(x13127)*(x13133))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -42933,8 +42742,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -42965,7 +42773,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -43010,14 +42818,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x13165)))+(((IkReal(-1.0000000000000
 evalcond[3]=((((sj0)*(x13153)))+(((IkReal(-1.00000000000000))*(x13147)*(x13157)))+(((IkReal(-1.00000000000000))*(sj5)*(x13150)*(x13152)))+(((IkReal(-1.00000000000000))*(sj5)*(x13149)*(x13152)))+(((cj0)*(x13156)))+(((IkReal(-1.00000000000000))*(x13148)*(x13161)))+(((IkReal(-1.00000000000000))*(x13148)*(x13155))));
 evalcond[4]=((((r11)*(x13166)))+(((x13148)*(x13163)))+(((r00)*(sj0)*(x13158)))+(((sj0)*(x13149)*(x13151)))+(x13147)+(((IkReal(-1.00000000000000))*(x13151)*(x13152)*(x13155)))+(((IkReal(-1.00000000000000))*(r01)*(x13154)*(x13162)))+(((IkReal(-1.00000000000000))*(x13151)*(x13152)*(x13161)))+(((IkReal(-1.00000000000000))*(r10)*(x13152)*(x13158)))+(((sj0)*(x13150)*(x13151)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x13152))));
 evalcond[5]=((((r01)*(x13166)))+(((IkReal(-1.00000000000000))*(x13149)*(x13151)*(x13152)))+(((IkReal(-1.00000000000000))*(sj5)*(x13152)*(x13163)))+(((IkReal(-1.00000000000000))*(r00)*(x13152)*(x13158)))+(((IkReal(-1.00000000000000))*(x13150)*(x13151)*(x13152)))+(((IkReal(-1.00000000000000))*(r10)*(x13154)*(x13158)))+(((IkReal(-1.00000000000000))*(x13151)*(x13154)*(x13155)))+(((IkReal(-1.00000000000000))*(x13146)*(x13157)))+(((r11)*(sj0)*(x13162)))+(((IkReal(-1.00000000000000))*(x13148)*(x13164)))+(((IkReal(-1.00000000000000))*(x13151)*(x13154)*(x13161))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -43053,8 +42861,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -43084,7 +42891,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -43129,14 +42936,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x13178)*(x13180)))+(((x13172)*(x1317
 evalcond[3]=((((IkReal(-1.00000000000000))*(x13171)*(x13181)))+(((IkReal(-1.00000000000000))*(sj5)*(x13174)*(x13176)))+(((IkReal(-1.00000000000000))*(x13172)*(x13179)))+(((IkReal(-1.00000000000000))*(x13172)*(x13185)))+(((IkReal(-1.00000000000000))*(sj5)*(x13173)*(x13176)))+(((sj0)*(x13177)))+(((cj0)*(x13180))));
 evalcond[4]=((x13171)+(((r00)*(sj0)*(x13182)))+(((IkReal(-1.00000000000000))*(x13175)*(x13176)*(x13185)))+(((IkReal(-1.00000000000000))*(r10)*(x13176)*(x13182)))+(((IkReal(-1.00000000000000))*(r01)*(x13178)*(x13186)))+(((IkReal(-1.00000000000000))*(x13175)*(x13176)*(x13179)))+(((x13172)*(x13187)))+(((IkReal(-1.00000000000000))*(cj4)*(r12)*(sj5)*(x13176)))+(((r11)*(x13190)))+(((sj0)*(x13173)*(x13175)))+(((sj0)*(x13174)*(x13175))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x13175)*(x13178)*(x13179)))+(((IkReal(-1.00000000000000))*(x13173)*(x13175)*(x13176)))+(((IkReal(-1.00000000000000))*(x13172)*(x13188)))+(((IkReal(-1.00000000000000))*(r00)*(x13176)*(x13182)))+(((IkReal(-1.00000000000000))*(x13174)*(x13175)*(x13176)))+(((r01)*(x13190)))+(((IkReal(-1.00000000000000))*(x13170)*(x13181)))+(((IkReal(-1.00000000000000))*(x13175)*(x13178)*(x13185)))+(((IkReal(-1.00000000000000))*(r10)*(x13178)*(x13182)))+(((r11)*(sj0)*(x13186)))+(((IkReal(-1.00000000000000))*(sj5)*(x13176)*(x13187))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -43172,8 +42979,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -43294,7 +43100,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -43332,14 +43138,14 @@ evalcond[0]=((((r21)*(x13260)))+(((IkReal(-1.00000000000000))*(x13261)))+(((r20)
 evalcond[1]=((((IkReal(-1.00000000000000))*(r21)*(x13253)))+(((r20)*(x13252)))+(((cj5)*(r20)*(x13256)))+(((IkReal(-1.00000000000000))*(x13246)))+(((r22)*(x13258)))+(((cj5)*(r21)*(x13255))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r02)*(x13250)))+(x13246)+(((x13247)*(x13249)))+(((IkReal(-1.00000000000000))*(r10)*(x13257)*(x13259)))+(((IkReal(-1.00000000000000))*(x13254)*(x13260)))+(((r12)*(x13251)))+(((x13247)*(x13248))));
 evalcond[3]=((((cj4)*(x13249)*(x13250)))+(((cj4)*(x13248)*(x13250)))+(((IkReal(-1.00000000000000))*(r11)*(x13251)*(x13255)))+(((IkReal(-1.00000000000000))*(r10)*(x13251)*(x13256)))+(((IkReal(-1.00000000000000))*(x13261)))+(((r00)*(sj0)*(x13252)))+(((IkReal(-1.00000000000000))*(r10)*(x13252)*(x13257)))+(((IkReal(-1.00000000000000))*(r12)*(x13257)*(x13258)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x13253)))+(((cj4)*(r02)*(x13247)))+(((x13253)*(x13254))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -43375,8 +43181,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -43441,7 +43246,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -43479,14 +43284,14 @@ evalcond[0]=((((IkReal(-1.00000000000000))*(r22)*(x13299)))+(((sj5)*(x13306)))+(
 evalcond[1]=((((r20)*(x13301)))+(((x13300)*(x13305)))+(((x13300)*(x13306)))+(((cj4)*(r22)*(sj5)))+(x13293)+(((IkReal(-1.00000000000000))*(r21)*(x13302))));
 evalcond[2]=((((IkReal(-1.00000000000000))*(r02)*(sj0)*(x13299)))+(((x13295)*(x13296)))+(((r12)*(x13298)))+(((x13295)*(x13297)))+(((IkReal(-1.00000000000000))*(cj6)*(sj5)*(x13303)))+(((IkReal(-1.00000000000000))*(x13307)*(x13308)))+(x13293));
 evalcond[3]=((((IkReal(-1.00000000000000))*(x13298)*(x13304)*(x13308)))+(((sj0)*(x13296)*(x13300)))+(((IkReal(-1.00000000000000))*(r01)*(sj0)*(x13302)))+(((IkReal(-1.00000000000000))*(cj0)*(r10)*(x13301)))+(((sj0)*(x13297)*(x13300)))+(((cj4)*(r02)*(x13295)))+(((x13302)*(x13303)))+(((IkReal(-1.00000000000000))*(r12)*(x13304)*(x13307)))+(((IkReal(-1.00000000000000))*(cj6)*(r11)*(x13298)*(x13304)))+(((IkReal(-1.00000000000000))*(x13294)))+(((r00)*(sj0)*(x13301))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -43522,8 +43327,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -43566,7 +43370,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -43610,14 +43414,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(r02)*(x13323)))+(((IkReal(-1.0000000
 evalcond[3]=((((r12)*(x13323)))+(((IkReal(-1.00000000000000))*(x13321)*(x13325)))+(((IkReal(-1.00000000000000))*(x13317)*(x13326)))+(((IkReal(-1.00000000000000))*(x13319)*(x13325)))+(((r02)*(x13322)))+(((IkReal(-1.00000000000000))*(x13318)*(x13324)))+(((IkReal(-1.00000000000000))*(x13318)*(x13332))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x13320)*(x13322)*(x13332)))+(((cj4)*(x13321)*(x13323)))+(((cj4)*(x13319)*(x13323)))+(((r11)*(x13334)))+(((IkReal(-1.00000000000000))*(x13317)))+(((IkReal(-1.00000000000000))*(r01)*(x13335)))+(((IkReal(-1.00000000000000))*(x13320)*(x13322)*(x13324)))+(((IkReal(-1.00000000000000))*(r12)*(x13320)*(x13325)))+(((r00)*(sj0)*(x13327)))+(((cj4)*(r02)*(x13318)))+(((IkReal(-1.00000000000000))*(r10)*(x13327)*(x13333))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x13320)*(x13323)*(x13332)))+(((IkReal(-1.00000000000000))*(r12)*(x13318)*(x13320)))+(((IkReal(-1.00000000000000))*(x13316)*(x13326)))+(((IkReal(-1.00000000000000))*(r00)*(x13327)*(x13333)))+(((r11)*(x13335)))+(((IkReal(-1.00000000000000))*(r02)*(x13320)*(x13325)))+(((IkReal(-1.00000000000000))*(x13320)*(x13321)*(x13322)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x13327)))+(((IkReal(-1.00000000000000))*(x13320)*(x13323)*(x13324)))+(((IkReal(-1.00000000000000))*(x13319)*(x13320)*(x13322)))+(((r01)*(x13334))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -43653,8 +43457,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -43685,7 +43488,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -43729,14 +43532,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x13349)*(x13356)))+(((r12)*(x13346))
 evalcond[3]=((((IkReal(-1.00000000000000))*(x13341)*(x13350)))+(((IkReal(-1.00000000000000))*(x13342)*(x13348)))+(((IkReal(-1.00000000000000))*(x13342)*(x13356)))+(((IkReal(-1.00000000000000))*(x13343)*(x13349)))+(((r12)*(x13347)))+(((r02)*(x13346)))+(((IkReal(-1.00000000000000))*(x13345)*(x13349))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x13344)*(x13346)*(x13348)))+(((IkReal(-1.00000000000000))*(x13341)))+(((IkReal(-1.00000000000000))*(r10)*(x13351)*(x13357)))+(((IkReal(-1.00000000000000))*(x13344)*(x13346)*(x13356)))+(((cj4)*(x13345)*(x13347)))+(((cj4)*(x13343)*(x13347)))+(((r11)*(x13358)))+(((IkReal(-1.00000000000000))*(r01)*(x13359)))+(((cj4)*(r02)*(x13342)))+(((IkReal(-1.00000000000000))*(r12)*(x13344)*(x13349)))+(((r00)*(sj0)*(x13351))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r10)*(sj0)*(x13351)))+(((IkReal(-1.00000000000000))*(x13340)*(x13350)))+(((IkReal(-1.00000000000000))*(r12)*(x13342)*(x13344)))+(((IkReal(-1.00000000000000))*(x13344)*(x13345)*(x13346)))+(((IkReal(-1.00000000000000))*(x13344)*(x13347)*(x13348)))+(((IkReal(-1.00000000000000))*(r02)*(x13344)*(x13349)))+(((r01)*(x13358)))+(((r11)*(x13359)))+(((IkReal(-1.00000000000000))*(r00)*(x13351)*(x13357)))+(((IkReal(-1.00000000000000))*(x13344)*(x13347)*(x13356)))+(((IkReal(-1.00000000000000))*(x13343)*(x13344)*(x13346))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -43772,8 +43575,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -43803,7 +43605,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -43847,14 +43649,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(x13371)*(x13372)))+(((IkReal(-1.0000
 evalcond[3]=((((IkReal(-1.00000000000000))*(x13365)*(x13379)))+(((r02)*(x13369)))+(((IkReal(-1.00000000000000))*(x13365)*(x13371)))+(((IkReal(-1.00000000000000))*(x13366)*(x13372)))+(((r12)*(x13370)))+(((IkReal(-1.00000000000000))*(x13368)*(x13372)))+(((IkReal(-1.00000000000000))*(x13364)*(x13373))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r01)*(x13382)))+(((cj4)*(x13368)*(x13370)))+(((cj4)*(x13366)*(x13370)))+(((IkReal(-1.00000000000000))*(r12)*(x13367)*(x13372)))+(((IkReal(-1.00000000000000))*(x13367)*(x13369)*(x13379)))+(((cj4)*(r02)*(x13365)))+(((r11)*(x13381)))+(((IkReal(-1.00000000000000))*(x13364)))+(((IkReal(-1.00000000000000))*(r10)*(x13374)*(x13380)))+(((r00)*(sj0)*(x13374)))+(((IkReal(-1.00000000000000))*(x13367)*(x13369)*(x13371))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r12)*(x13365)*(x13367)))+(((IkReal(-1.00000000000000))*(r00)*(x13374)*(x13380)))+(((IkReal(-1.00000000000000))*(x13367)*(x13370)*(x13379)))+(((IkReal(-1.00000000000000))*(x13366)*(x13367)*(x13369)))+(((IkReal(-1.00000000000000))*(r02)*(x13367)*(x13372)))+(((r11)*(x13382)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x13374)))+(((IkReal(-1.00000000000000))*(x13367)*(x13370)*(x13371)))+(((IkReal(-1.00000000000000))*(x13367)*(x13368)*(x13369)))+(((IkReal(-1.00000000000000))*(x13363)*(x13373)))+(((r01)*(x13381))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -43890,8 +43692,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -43946,7 +43747,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -43993,14 +43794,14 @@ evalcond[2]=((((x13396)*(x13399)))+(((r12)*(x13400)))+(((IkReal(-1.0000000000000
 evalcond[3]=((((IkReal(-1.00000000000000))*(x13396)*(x13402)))+(((IkReal(-1.00000000000000))*(x13394)*(x13404)))+(((r12)*(x13401)))+(((IkReal(-1.00000000000000))*(x13399)*(x13411)))+(((IkReal(-1.00000000000000))*(x13396)*(x13408)))+(((r02)*(x13400)))+(((IkReal(-1.00000000000000))*(x13397)*(x13411)))+(((sj1)*(x13414))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(x13398)*(x13400)*(x13402)))+(((cj4)*(x13399)*(x13401)))+(((cj4)*(r02)*(x13396)))+(((cj4)*(x13397)*(x13401)))+(((IkReal(-1.00000000000000))*(x13398)*(x13400)*(x13408)))+(((IkReal(-1.00000000000000))*(r01)*(x13415)))+(((sj2)*(x13394)))+(((IkReal(-1.00000000000000))*(r12)*(x13398)*(x13409)))+(((r00)*(sj0)*(x13403)))+(((IkReal(-1.00000000000000))*(r10)*(x13403)*(x13410)))+(((r11)*(x13413))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x13398)*(x13401)*(x13402)))+(((IkReal(-1.00000000000000))*(x13398)*(x13401)*(x13408)))+(((IkReal(-1.00000000000000))*(r00)*(x13403)*(x13410)))+(((r01)*(x13413)))+(((IkReal(-1.00000000000000))*(cj2)*(x13416)))+(((IkReal(-1.00000000000000))*(r02)*(x13398)*(x13409)))+(((IkReal(-1.00000000000000))*(x13395)*(x13404)))+(((IkReal(-1.00000000000000))*(r12)*(x13396)*(x13398)))+(((IkReal(-1.00000000000000))*(x13397)*(x13398)*(x13400)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x13403)))+(((r11)*(x13415)))+(((IkReal(-1.00000000000000))*(x13398)*(x13399)*(x13400))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -44036,8 +43837,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -44080,7 +43880,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -44127,14 +43927,14 @@ evalcond[2]=((((IkReal(-1.00000000000000))*(r02)*(x13440)))+(((IkReal(-1.0000000
 evalcond[3]=((((sj1)*(x13453)))+(((IkReal(-1.00000000000000))*(x13438)*(x13450)))+(((r02)*(x13439)))+(((IkReal(-1.00000000000000))*(x13433)*(x13443)))+(((IkReal(-1.00000000000000))*(x13436)*(x13450)))+(((IkReal(-1.00000000000000))*(x13435)*(x13441)))+(((r12)*(x13440)))+(((IkReal(-1.00000000000000))*(x13435)*(x13447))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r10)*(x13442)*(x13449)))+(((cj4)*(r02)*(x13435)))+(((sj2)*(x13433)))+(((r11)*(x13452)))+(((cj4)*(x13436)*(x13440)))+(((IkReal(-1.00000000000000))*(x13437)*(x13439)*(x13441)))+(((IkReal(-1.00000000000000))*(r01)*(x13454)))+(((r00)*(sj0)*(x13442)))+(((IkReal(-1.00000000000000))*(r12)*(x13437)*(x13448)))+(((cj4)*(x13438)*(x13440)))+(((IkReal(-1.00000000000000))*(x13437)*(x13439)*(x13447))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(r02)*(x13437)*(x13448)))+(((IkReal(-1.00000000000000))*(x13434)*(x13443)))+(((IkReal(-1.00000000000000))*(r12)*(x13435)*(x13437)))+(((IkReal(-1.00000000000000))*(x13436)*(x13437)*(x13439)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x13442)))+(((IkReal(-1.00000000000000))*(x13437)*(x13438)*(x13439)))+(((IkReal(-1.00000000000000))*(x13437)*(x13440)*(x13447)))+(((r01)*(x13452)))+(((IkReal(-1.00000000000000))*(cj2)*(x13455)))+(((IkReal(-1.00000000000000))*(r00)*(x13442)*(x13449)))+(((IkReal(-1.00000000000000))*(x13437)*(x13440)*(x13441)))+(((r11)*(x13454))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -44170,8 +43970,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -44210,7 +44009,7 @@ if( j3array[0] > IKPI )
 else if( j3array[0] < -IKPI )
 {    j3array[0]+=IK2PI;
 }
-j3valid[0] = true;
+j3valid[0] = IKinlimits(3,j3array[0]);
 for(int ij3 = 0; ij3 < 1; ++ij3)
 {
 if( !j3valid[ij3] )
@@ -44257,14 +44056,14 @@ evalcond[2]=((((x13470)*(x13471)))+(((IkReal(-1.00000000000000))*(x13482)*(x1348
 evalcond[3]=((((sj1)*(x13488)))+(((IkReal(-1.00000000000000))*(x13470)*(x13476)))+(((IkReal(-1.00000000000000))*(x13468)*(x13478)))+(((r02)*(x13474)))+(((IkReal(-1.00000000000000))*(x13471)*(x13485)))+(((IkReal(-1.00000000000000))*(x13470)*(x13482)))+(((IkReal(-1.00000000000000))*(x13473)*(x13485)))+(((r12)*(x13475))));
 evalcond[4]=((((IkReal(-1.00000000000000))*(r10)*(x13477)*(x13484)))+(((IkReal(-1.00000000000000))*(r12)*(x13472)*(x13483)))+(((cj4)*(x13471)*(x13475)))+(((IkReal(-1.00000000000000))*(x13472)*(x13474)*(x13476)))+(((IkReal(-1.00000000000000))*(x13472)*(x13474)*(x13482)))+(((r00)*(sj0)*(x13477)))+(((r11)*(x13487)))+(((sj2)*(x13468)))+(((cj4)*(x13473)*(x13475)))+(((IkReal(-1.00000000000000))*(r01)*(x13489)))+(((cj4)*(r02)*(x13470))));
 evalcond[5]=((((IkReal(-1.00000000000000))*(x13471)*(x13472)*(x13474)))+(((IkReal(-1.00000000000000))*(cj2)*(x13490)))+(((r11)*(x13489)))+(((IkReal(-1.00000000000000))*(x13472)*(x13475)*(x13482)))+(((IkReal(-1.00000000000000))*(x13469)*(x13478)))+(((IkReal(-1.00000000000000))*(r10)*(sj0)*(x13477)))+(((IkReal(-1.00000000000000))*(r02)*(x13472)*(x13483)))+(((r01)*(x13487)))+(((IkReal(-1.00000000000000))*(x13472)*(x13475)*(x13476)))+(((IkReal(-1.00000000000000))*(r12)*(x13470)*(x13472)))+(((IkReal(-1.00000000000000))*(r00)*(x13477)*(x13484)))+(((IkReal(-1.00000000000000))*(x13472)*(x13473)*(x13474))));
-if( IKabs(evalcond[0]) > 0.000001  || IKabs(evalcond[1]) > 0.000001  || IKabs(evalcond[2]) > 0.000001  || IKabs(evalcond[3]) > 0.000001  || IKabs(evalcond[4]) > 0.000001  || IKabs(evalcond[5]) > 0.000001  )
+if( IKabs(evalcond[0]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[1]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[2]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[3]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[4]) > IKFAST_EVALCOND_THRESH  || IKabs(evalcond[5]) > IKFAST_EVALCOND_THRESH  )
 {
 continue;
 }
 }
 
 {
-std::vector<IkSingleDOFSolutionBase<IkReal> > vinfos(7);
+IkSingleDOFSolutionBase<IkReal> vinfos[7];
 vinfos[0].jointtype = 1;
 vinfos[0].foffset = j0;
 vinfos[0].indices[0] = _ij0[0];
@@ -44300,8 +44099,7 @@ vinfos[6].foffset = j6;
 vinfos[6].indices[0] = _ij6[0];
 vinfos[6].indices[1] = _ij6[1];
 vinfos[6].maxsolutions = _nj6;
-std::vector<int> vfree(0);
-solutions.AddSolution(vinfos,vfree);
+solutions.AddSolution(vinfos,7,NULL,0);
 }
 }
 }
@@ -44323,7 +44121,7 @@ solutions.AddSolution(vinfos,vfree);
 }
     }
 }
-return solutions.GetNumSolutions()>0;
+return IKcheckerrors(numerrors, solutions.GetNumSolutions()>0, solutions);
 }
 
 static inline bool checkconsistency8(const IkReal* Breal)
@@ -44332,25 +44130,25 @@ static inline bool checkconsistency8(const IkReal* Breal)
     for(int i = 0; i < 7; ++i) {
         norm += IKabs(Breal[i]);
     }
-    IkReal tol = 1e-5*norm; // have to increase the threshold since many computations are involved
+    IkReal tol = IKFAST_CONSISTENCY_THRESH*norm; // have to increase the threshold since many computations are involved
     return IKabs(Breal[0]*Breal[1]-Breal[2]) < tol && IKabs(Breal[1]*Breal[1]-Breal[3]) < tol && IKabs(Breal[0]*Breal[3]-Breal[4]) < tol && IKabs(Breal[1]*Breal[3]-Breal[5]) < tol && IKabs(Breal[0]*Breal[5]-Breal[6]) < tol;
 }
 /// \brief Solve the det Ax^2+Bx+C = 0 problem using the Manocha and Canny method (1994)
 ///
-/// matcoeffs is of length 54*3, for 3 matrices
+/// matcoeffs is of length 54*3, for 3 matrices. The LU decomposition and the eigen decomposition use fixed
+/// size Eigen solvers, so nothing is allocated and the matrices stay on the stack.
 static inline void solvedialyticpoly8qep(const IkReal* matcoeffs, IkReal* rawroots, int& numroots)
 {
+    typedef Eigen::Matrix<IkReal,8,8> Matrix8;
+    typedef Eigen::Matrix<IkReal,16,16> Matrix16;
     const IkReal tol = 128.0*std::numeric_limits<IkReal>::epsilon();
     IkReal IKFAST_ALIGNED16(M[16*16]) = {0};
     IkReal IKFAST_ALIGNED16(A[8*8]);
-    IkReal IKFAST_ALIGNED16(work[16*16*15]);
-    int ipiv[8];
-    int info, coeffindex;
-    const int worksize=16*16*15;
+    int coeffindex;
     const int matrixdim = 8;
     const int matrixdim2 = 16;
     numroots = 0;
-    // first setup M = [0 I; -C -B] and A
+    // first setup M = [0 I; -C -B] and A, both column major
     coeffindex = 0;
     for(int j = 0; j < 4; ++j) {
         for(int k = 0; k < 6; ++k) {
@@ -44373,20 +44171,19 @@ static inline void solvedialyticpoly8qep(const IkReal* matcoeffs, IkReal* rawroo
     const IkReal lfpossibilities[4][4] = {{1,-1,1,1},{1,0,-2,1},{1,1,2,0},{1,-1,4,1}};
     int lfindex = -1;
     bool bsingular = true;
+    Eigen::PartialPivLU<Matrix8> lu;
     do {
-        dgetrf_(&matrixdim,&matrixdim,A,&matrixdim,&ipiv[0],&info);
-        if( info == 0 ) {
-            bsingular = false;
-            for(int j = 0; j < matrixdim; ++j) {
-                if( IKabs(A[j*matrixdim+j]) < 100*tol ) {
-                    bsingular = true;
-                    break;
-                }
-            }
-            if( !bsingular ) {
+        lu.compute(Eigen::Map<Matrix8>(A));
+        bsingular = false;
+        for(int j = 0; j < matrixdim; ++j) {
+            if( IKabs(lu.matrixLU()(j,j)) < 100*tol ) {
+                bsingular = true;
                 break;
             }
         }
+        if( !bsingular ) {
+            break;
+        }
         if( lfindex == 3 ) {
             break;
         }
@@ -44412,22 +44209,32 @@ static inline void solvedialyticpoly8qep(const IkReal* matcoeffs, IkReal* rawroo
     if( bsingular ) {
         return;
     }
-    dgetrs_("No transpose", &matrixdim, &matrixdim2, A, &matrixdim, &ipiv[0], &M[matrixdim], &matrixdim2, &info);
-    if( info != 0 ) {
-        return;
-    }
+    Eigen::Map<Matrix16> Mmap(M);
+    const Eigen::Matrix<IkReal,8,16> B = Mmap.bottomRows<8>();
+    Mmap.bottomRows<8>() = lu.solve(B);
 
     // set identity in upper corner
     for(int j = 0; j < matrixdim; ++j) {
         M[matrixdim*2*matrixdim+j+matrixdim*2*j] = 1;
     }
+    Eigen::EigenSolver<Matrix16> eigensolver(Mmap, true);
+    if( eigensolver.info() != Eigen::Success ) {
+        return;
+    }
     IkReal IKFAST_ALIGNED16(wr[16]);
     IkReal IKFAST_ALIGNED16(wi[16]);
     IkReal IKFAST_ALIGNED16(vr[16*16]);
-    int one=1;
-    dgeev_("N", "V", &matrixdim2, M, &matrixdim2, wr, wi,NULL, &one, vr, &matrixdim2, work, &worksize, &info);
-    if( info != 0 ) {
-        return;
+    // for a real eigenvalue the column of the pseudo eigenvectors is its eigenvector, scaled to unit norm like
+    // the ones of dgeev. the columns of complex eigenvalues are not used.
+    const Matrix16& pseudovectors = eigensolver.pseudoEigenvectors();
+    for(int i = 0; i < matrixdim2; ++i) {
+        wr[i] = eigensolver.eigenvalues()(i).real();
+        wi[i] = eigensolver.eigenvalues()(i).imag();
+        IkReal norm = pseudovectors.col(i).norm();
+        IkReal inorm = norm > 0 ? 1/norm : 0;
+        for(int j = 0; j < matrixdim2; ++j) {
+            vr[matrixdim2*i+j] = pseudovectors(j,i)*inorm;
+        }
     }
     IkReal Breal[matrixdim-1];
     for(int i = 0; i < matrixdim2; ++i) {
@@ -44483,6 +44290,15 @@ IKSolver solver;
 return solver.ComputeIk(eetrans,eerot,pfree,solutions);
 }
 
+/// solves the inverse kinematics equations, skipping every branch with a joint outside [lower,upper].
+/// \param lower, upper joint limits in [-pi,pi]
+IKFAST_API bool ComputeIkLimited(const IkReal* eetrans, const IkReal* eerot, const IkReal* pfree, const IkReal* lower, const IkReal* upper, IkSolutionListBase<IkReal>& solutions) {
+IKSolver solver;
+solver.SetJointLimits(lower,upper);
+return solver.ComputeIk(eetrans,eerot,pfree,solutions);
+}
+
+/// generated from the left arm, the right arm chain is identical relative to its mount so both arms share this solver
 IKFAST_API const char* GetKinematicsHash() { return "<robot:genericrobot - baxter (92388cabb79ce4a7e4498b08e3e28901)>"; }
 
 IKFAST_API const char* GetIkFastVersion() { return IKFAST_STRINGIZE(IKFAST_VERSION); }
@@ -0,0 +1,118 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+/* Desc:   Compares the batched all-frames FK of the Baxter arm against one ComputeFk call per joint vector
+*/
+
+#include <ros/ros.h>
+
+#include <baxter_ikfast_plugin/ikfast_kinematics_plugin.h>
+#include <baxter_ikfast_plugin/arm_forward_kinematics.h>
+
+#include <cstdlib>
+
+namespace baxter_ikfast
+{
+
+double fRand(double fMin, double fMax)
+{
+  double f = (double)rand() / RAND_MAX;
+  return fMin + f * (fMax - fMin);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  ros::init(argc, argv, "fk_batch_benchmark");
+  ros::NodeHandle nh("~");
+
+  int num_configurations, num_runs;
+  nh.param("num_configurations", num_configurations, 1000);
+  nh.param("num_runs", num_runs, 20);
+
+  using baxter_ikfast_plugin::ARM_FK_NUM_JOINTS;
+  using baxter_ikfast_plugin::ARM_FK_NUM_FRAMES;
+  using baxter_ikfast_plugin::ARM_FK_FRAME_SIZE;
+  const std::size_t n = num_configurations;
+
+  srand(ros::Time::now().toSec());
+  std::vector<double> joints(ARM_FK_NUM_JOINTS*n);
+  for (std::size_t i = 0; i < joints.size(); ++i)
+    joints[i] = baxter_ikfast::fRand(-M_PI, M_PI);
+
+  // One ComputeFk call per joint vector, for the tip only
+  std::vector<ikfast_kinematics_plugin::IkReal> tip_frames(n*ARM_FK_FRAME_SIZE);
+  ikfast_kinematics_plugin::IkReal joint_vector[ARM_FK_NUM_JOINTS];
+  double single_duration = 0;
+  for (int run = 0; run <= num_runs; ++run)
+  {
+    ros::WallTime start_time = ros::WallTime::now();
+    for (std::size_t k = 0; k < n; ++k)
+    {
+      for (int j = 0; j < ARM_FK_NUM_JOINTS; ++j)
+        joint_vector[j] = joints[j*n+k];
+      ikfast_kinematics_plugin::ComputeFk(joint_vector, &tip_frames[k*ARM_FK_FRAME_SIZE+9], &tip_frames[k*ARM_FK_FRAME_SIZE]);
+    }
+    if( run > 0 )
+      single_duration += (ros::WallTime::now() - start_time).toSec();
+  }
+
+  // All frames of the whole batch
+  std::vector<double> frames(ARM_FK_NUM_FRAMES*ARM_FK_FRAME_SIZE*n);
+  double batch_duration = 0;
+  for (int run = 0; run <= num_runs; ++run)
+  {
+    ros::WallTime start_time = ros::WallTime::now();
+    baxter_ikfast_plugin::computeArmFK(&joints[0], n, &frames[0]);
+    if( run > 0 )
+      batch_duration += (ros::WallTime::now() - start_time).toSec();
+  }
+
+  // The tip frame has to agree with the FK of the solver
+  double max_error = 0;
+  const double *tip = &frames[(ARM_FK_NUM_FRAMES-1)*ARM_FK_FRAME_SIZE*n];
+  for (std::size_t k = 0; k < n; ++k)
+    for (int c = 0; c < ARM_FK_FRAME_SIZE; ++c)
+      max_error = std::max(max_error, std::fabs(tip[c*n+k] - tip_frames[k*ARM_FK_FRAME_SIZE+c]));
+
+  const double num_queries = double(n) * num_runs;
+  ROS_INFO_STREAM_NAMED("fk_batch_benchmark", n << " joint vectors x " << num_runs << " runs");
+  ROS_INFO_STREAM_NAMED("fk_batch_benchmark", "ComputeFk, tip only:          " << single_duration / num_queries * 1e9 << " ns/vector");
+  ROS_INFO_STREAM_NAMED("fk_batch_benchmark", "computeArmFK, " << ARM_FK_NUM_FRAMES << " frames:      "
+                        << batch_duration / num_queries * 1e9 << " ns/vector");
+  ROS_INFO_STREAM_NAMED("fk_batch_benchmark", "largest difference of the tip frames: " << max_error);
+  std::cout << single_duration / num_queries * 1e9 << "\t" << batch_duration / num_queries * 1e9 << "\t" << max_error << std::endl;
+
+  return 0;
+}
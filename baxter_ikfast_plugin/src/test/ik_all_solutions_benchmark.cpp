@@ -0,0 +1,255 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Desc:   Runs getAllPositionIK on reachable poses and checks its answers: every solution reaches the pose, no
+           two are within dedup_tolerance, the deduplication keeps the same solutions as a brute force pass over
+           all of them, and a sweep cut short by the timeout returns the first solutions of the complete sweep
+*/
+
+#include <ros/ros.h>
+
+#include <baxter_ikfast_plugin/ikfast_kinematics_plugin.h>
+#include <baxter_ikfast_plugin/arm_forward_kinematics.h>
+#include <tf_conversions/tf_kdl.h>
+
+#include <cstdlib>
+
+namespace baxter_ikfast
+{
+
+typedef ikfast_kinematics_plugin::IKFastKinematicsPlugin Plugin;
+
+double fRand(double fMin, double fMax)
+{
+  double f = (double)rand() / RAND_MAX;
+  return fMin + f * (fMax - fMin);
+}
+
+// Reachable poses are made by running FK on random joint values, the seeds are other random joint values
+void generatePoses(std::size_t num_poses, std::size_t num_joints,
+                   std::vector<geometry_msgs::Pose> &poses, std::vector<std::vector<double> > &seeds)
+{
+  poses.resize(num_poses);
+  seeds.resize(num_poses, std::vector<double>(num_joints));
+
+  ikfast_kinematics_plugin::IkReal joints[ikfast_kinematics_plugin::IKFAST_MAX_JOINTS];
+  ikfast_kinematics_plugin::IkReal eetrans[3], eerot[9];
+  KDL::Frame frame;
+  for (std::size_t p = 0; p < num_poses; ++p)
+  {
+    for (std::size_t i = 0; i < num_joints; ++i)
+    {
+      joints[i] = fRand(-1.0, 1.0);
+      seeds[p][i] = fRand(-1.0, 1.0);
+    }
+    ikfast_kinematics_plugin::ComputeFk(joints, eetrans, eerot);
+
+    for (std::size_t i = 0; i < 3; ++i)
+      frame.p.data[i] = eetrans[i];
+    for (std::size_t i = 0; i < 9; ++i)
+      frame.M.data[i] = eerot[i];
+    tf::poseKDLToMsg(frame, poses[p]);
+  }
+}
+
+// Largest difference between the tip frame of solution and pose, in the units of the frame elements
+double tipError(const double *solution, const geometry_msgs::Pose &pose)
+{
+  using baxter_ikfast_plugin::ARM_FK_NUM_FRAMES;
+  using baxter_ikfast_plugin::ARM_FK_FRAME_SIZE;
+
+  double frames[ARM_FK_NUM_FRAMES*ARM_FK_FRAME_SIZE];
+  baxter_ikfast_plugin::computeArmFK(solution, 1, frames);
+  const double *tip = frames + (ARM_FK_NUM_FRAMES-1)*ARM_FK_FRAME_SIZE;
+
+  KDL::Frame frame;
+  tf::poseMsgToKDL(pose, frame);
+  double error = 0.0;
+  for (int i = 0; i < 9; ++i)
+    error = std::max(error, std::fabs(tip[i] - frame.M.data[i]));
+  for (int i = 0; i < 3; ++i)
+    error = std::max(error, std::fabs(tip[9+i] - frame.p.data[i]));
+  return error;
+}
+
+// Largest joint difference of two solutions, with the angle differences wrapped like getAllPositionIK does
+double jointDistance(const double *a, const double *b, std::size_t num_joints)
+{
+  double distance = 0.0;
+  for (std::size_t i = 0; i < num_joints; ++i)
+  {
+    const double d = a[i] - b[i];
+    distance = std::max(distance, std::fabs(d - 2*M_PI*std::floor((d + M_PI) / (2*M_PI))));
+  }
+  return distance;
+}
+
+// Keeps the solutions of all, in order, that are not within tolerance of one kept before them
+void deduplicate(const std::vector<double> &all, std::size_t num_joints, double tolerance, std::vector<double> &kept)
+{
+  kept.clear();
+  for (std::size_t s = 0; s < all.size(); s += num_joints)
+  {
+    bool duplicate = false;
+    for (std::size_t k = 0; k < kept.size() && !duplicate; k += num_joints)
+      duplicate = jointDistance(&all[s], &kept[k], num_joints) <= tolerance;
+    if (!duplicate)
+      kept.insert(kept.end(), all.begin() + s, all.begin() + s + num_joints);
+  }
+}
+
+struct CheckResult
+{
+  std::size_t num_solutions;
+  std::size_t num_incomplete;   // sweeps cut short although the timeout was generous
+  std::size_t num_wrong;        // solutions that do not reach their pose
+  std::size_t num_duplicates;   // pairs of solutions within the dedup tolerance
+  std::size_t num_bad_index;    // queries whose index is not sorted or does not cover every solution once
+  std::size_t num_mismatched;   // queries that kept other solutions than the brute force deduplication
+  std::size_t num_timed_out;    // queries cut short by a zero timeout
+  std::size_t num_not_prefix;   // cut short queries that are not the start of the complete sweep
+};
+
+// Checks one answer of getAllPositionIK, reference holds the solutions of the same query with zero dedup tolerance
+void checkSolutions(const Plugin::IKSolutionsBuffer &buffer, const std::vector<double> &reference,
+                    const geometry_msgs::Pose &pose, std::size_t num_joints, double dedup_tolerance,
+                    double tolerance, CheckResult &result)
+{
+  const std::size_t n = buffer.num_solutions;
+  result.num_solutions += n;
+  if (!buffer.complete)
+    ++result.num_incomplete;
+
+  for (std::size_t s = 0; s < n; ++s)
+  {
+    if (tipError(&buffer.solutions[s*num_joints], pose) > tolerance)
+      ++result.num_wrong;
+    for (std::size_t t = s+1; t < n; ++t)
+      if (jointDistance(&buffer.solutions[s*num_joints], &buffer.solutions[t*num_joints], num_joints) <= dedup_tolerance)
+        ++result.num_duplicates;
+  }
+
+  std::vector<int> seen(n, 0);
+  bool bad_index = buffer.index.size() != n;
+  for (std::size_t i = 0; i < buffer.index.size() && !bad_index; ++i)
+  {
+    const std::size_t row = buffer.index[i].second;
+    bad_index = row >= n || seen[row]++ || buffer.index[i].first != buffer.solutions[row*num_joints] ||
+                (i > 0 && buffer.index[i-1].first > buffer.index[i].first);
+  }
+  if (bad_index)
+    ++result.num_bad_index;
+
+  std::vector<double> kept;
+  deduplicate(reference, num_joints, dedup_tolerance, kept);
+  if (kept.size() != n*num_joints || !std::equal(kept.begin(), kept.end(), buffer.solutions.begin()))
+    ++result.num_mismatched;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  ros::init(argc, argv, "ik_all_solutions_benchmark");
+  ros::NodeHandle nh("~");
+
+  int num_poses;
+  double timeout, dedup_tolerance, tolerance;
+  std::string group, base_frame, tip_frame;
+  nh.param("num_poses", num_poses, 200);
+  nh.param("timeout", timeout, 5.0);
+  nh.param("dedup_tolerance", dedup_tolerance, 0.02);
+  nh.param("tolerance", tolerance, 1e-4);
+  nh.param("group", group, std::string("left_arm"));
+  nh.param("base_frame", base_frame, std::string("left_arm_mount"));
+  nh.param("tip_frame", tip_frame, std::string("left_gripper"));
+
+  baxter_ikfast::Plugin plugin;
+  kinematics::KinematicsBase &solver = plugin;
+  if( !solver.initialize("robot_description", group, base_frame, tip_frame, 0.005) )
+  {
+    ROS_ERROR_STREAM_NAMED("ik_all_solutions_benchmark","Unable to initialize the IKFast plugin");
+    return 1;
+  }
+  const std::size_t num_joints = ikfast_kinematics_plugin::GetNumJoints();
+
+  srand(ros::Time::now().toSec());
+  std::vector<geometry_msgs::Pose> poses;
+  std::vector<std::vector<double> > seeds;
+  baxter_ikfast::generatePoses(num_poses, num_joints, poses, seeds);
+
+  const std::vector<double> no_consistency_limits;
+  baxter_ikfast::Plugin::IKSolutionsBuffer buffer, reference, partial;
+  baxter_ikfast::CheckResult result = baxter_ikfast::CheckResult();
+  double duration = 0.0;
+  for (std::size_t p = 0; p < poses.size(); ++p)
+  {
+    // Zero tolerance only drops identical solutions, the brute force deduplication starts from these
+    plugin.getAllPositionIK(poses[p], seeds[p], timeout, no_consistency_limits, 0.0, reference);
+
+    ros::WallTime start_time = ros::WallTime::now();
+    plugin.getAllPositionIK(poses[p], seeds[p], timeout, no_consistency_limits, dedup_tolerance, buffer);
+    duration += (ros::WallTime::now() - start_time).toSec();
+    baxter_ikfast::checkSolutions(buffer, reference.solutions, poses[p], num_joints, dedup_tolerance, tolerance, result);
+
+    // A zero timeout stops the sweep after the first free joint value, those solutions come first in the full sweep
+    plugin.getAllPositionIK(poses[p], seeds[p], 0.0, no_consistency_limits, dedup_tolerance, partial);
+    if (!partial.complete)
+      ++result.num_timed_out;
+    if (partial.num_solutions > buffer.num_solutions ||
+        !std::equal(partial.solutions.begin(), partial.solutions.end(), buffer.solutions.begin()))
+      ++result.num_not_prefix;
+  }
+
+  ROS_INFO_STREAM_NAMED("ik_all_solutions_benchmark", poses.size() << " poses: " << duration / poses.size() * 1e6
+                        << " us/query, " << double(result.num_solutions) / poses.size() << " solutions/pose, "
+                        << result.num_wrong << " wrong, " << result.num_duplicates << " duplicates, "
+                        << result.num_bad_index << " bad indices, " << result.num_mismatched
+                        << " differ from brute force, " << result.num_incomplete << " incomplete, "
+                        << result.num_timed_out << " cut short by a zero timeout, " << result.num_not_prefix
+                        << " of them not a prefix");
+  std::cout << "poses\tus_per_query\tsolutions_per_pose\twrong\tduplicates\tbad_index\tmismatched\tincomplete\ttimed_out\tnot_prefix" << std::endl;
+  std::cout << poses.size() << "\t" << duration / poses.size() * 1e6 << "\t" << double(result.num_solutions) / poses.size()
+            << "\t" << result.num_wrong << "\t" << result.num_duplicates << "\t" << result.num_bad_index << "\t"
+            << result.num_mismatched << "\t" << result.num_incomplete << "\t" << result.num_timed_out << "\t"
+            << result.num_not_prefix << std::endl;
+
+  if (result.num_wrong || result.num_duplicates || result.num_bad_index || result.num_mismatched ||
+      result.num_incomplete || result.num_not_prefix || result.num_timed_out == 0)
+  {
+    ROS_ERROR_STREAM_NAMED("ik_all_solutions_benchmark", "getAllPositionIK failed a check");
+    return 1;
+  }
+  return 0;
+}
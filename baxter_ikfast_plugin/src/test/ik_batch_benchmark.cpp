@@ -0,0 +1,187 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+
+/* Desc:   Compares the per-pose getPositionIK path of the IKFast plugin against getPositionIKBatch
+*/
+
+#include <ros/ros.h>
+
+#include <baxter_ikfast_plugin/ikfast_kinematics_plugin.h>
+#include <tf_conversions/tf_kdl.h>
+
+#include <cstdlib>
+#include <new>
+
+// Count heap allocations so the benchmark can show the batch path does not allocate
+static std::size_t num_allocations = 0;
+
+void* operator new(std::size_t size)
+{
+  ++num_allocations;
+  void* p = std::malloc(size);
+  if(!p)
+    throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void* p) throw()
+{
+  std::free(p);
+}
+
+namespace baxter_ikfast
+{
+
+typedef ikfast_kinematics_plugin::IKFastKinematicsPlugin Plugin;
+
+double fRand(double fMin, double fMax)
+{
+  double f = (double)rand() / RAND_MAX;
+  return fMin + f * (fMax - fMin);
+}
+
+// Reachable poses are made by running FK on random joint values. The joint values double as the
+// seeds, so the free joint is set to a value for which a solution is known to exist.
+void generatePoses(std::size_t num_poses, std::size_t num_joints,
+                   std::vector<geometry_msgs::Pose> &poses, std::vector<double> &seeds)
+{
+  poses.resize(num_poses);
+  seeds.resize(num_poses*num_joints);
+
+  ikfast_kinematics_plugin::IkReal joints[ikfast_kinematics_plugin::IKFAST_MAX_JOINTS];
+  ikfast_kinematics_plugin::IkReal eetrans[3], eerot[9];
+  KDL::Frame frame;
+  for (std::size_t p = 0; p < num_poses; ++p)
+  {
+    for (std::size_t i = 0; i < num_joints; ++i)
+    {
+      joints[i] = fRand(-1.0, 1.0);
+      seeds[p*num_joints+i] = joints[i];
+    }
+    ikfast_kinematics_plugin::ComputeFk(joints, eetrans, eerot);
+
+    for (std::size_t i = 0; i < 3; ++i)
+      frame.p.data[i] = eetrans[i];
+    for (std::size_t i = 0; i < 9; ++i)
+      frame.M.data[i] = eerot[i];
+    tf::poseKDLToMsg(frame, poses[p]);
+  }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  ros::init(argc, argv, "ik_batch_benchmark");
+  ros::NodeHandle nh("~");
+
+  int num_poses, num_runs;
+  std::string group, base_frame, tip_frame;
+  nh.param("num_poses", num_poses, 500);
+  nh.param("num_runs", num_runs, 20);
+  nh.param("group", group, std::string("left_arm"));
+  nh.param("base_frame", base_frame, std::string("left_arm_mount"));
+  nh.param("tip_frame", tip_frame, std::string("left_gripper"));
+
+  baxter_ikfast::Plugin plugin;
+  kinematics::KinematicsBase &solver = plugin;
+  if( !solver.initialize("robot_description", group, base_frame, tip_frame, 0.005) )
+  {
+    ROS_ERROR_STREAM_NAMED("ik_batch_benchmark","Unable to initialize the IKFast plugin");
+    return 1;
+  }
+  const std::size_t num_joints = ikfast_kinematics_plugin::GetNumJoints();
+
+  srand(ros::Time::now().toSec());
+  std::vector<geometry_msgs::Pose> poses;
+  std::vector<double> seeds;
+  baxter_ikfast::generatePoses(num_poses, num_joints, poses, seeds);
+
+  // Per-pose path, warmed up once so both paths are measured in steady state
+  std::vector<double> seed(num_joints);
+  std::vector<double> solution;
+  moveit_msgs::MoveItErrorCodes error_code;
+  std::size_t single_found = 0;
+  std::size_t single_allocations = 0;
+  ros::WallTime start_time;
+  double single_duration = 0;
+  for (int run = 0; run <= num_runs; ++run)
+  {
+    std::size_t allocations_before = num_allocations;
+    start_time = ros::WallTime::now();
+    single_found = 0;
+    for (std::size_t p = 0; p < poses.size(); ++p)
+    {
+      std::copy(seeds.begin()+p*num_joints, seeds.begin()+(p+1)*num_joints, seed.begin());
+      if( plugin.getPositionIK(poses[p], seed, solution, error_code) )
+        ++single_found;
+    }
+    if( run > 0 )
+    {
+      single_duration += (ros::WallTime::now() - start_time).toSec();
+      single_allocations += num_allocations - allocations_before;
+    }
+  }
+
+  // Batch path
+  baxter_ikfast::Plugin::IKBatchBuffer buffer;
+  std::size_t batch_found = 0;
+  std::size_t batch_allocations = 0;
+  double batch_duration = 0;
+  for (int run = 0; run <= num_runs; ++run)
+  {
+    std::size_t allocations_before = num_allocations;
+    start_time = ros::WallTime::now();
+    batch_found = plugin.getPositionIKBatch(poses, seeds, buffer);
+    if( run > 0 )
+    {
+      batch_duration += (ros::WallTime::now() - start_time).toSec();
+      batch_allocations += num_allocations - allocations_before;
+    }
+  }
+
+  const double num_queries = double(num_poses) * num_runs;
+  ROS_INFO_STREAM_NAMED("ik_batch_benchmark", num_poses << " poses x " << num_runs << " runs");
+  ROS_INFO_STREAM_NAMED("ik_batch_benchmark", "getPositionIK:      " << single_duration / num_queries * 1e6
+                        << " us/pose, " << single_allocations / num_queries << " allocations/pose, "
+                        << single_found << " solved");
+  ROS_INFO_STREAM_NAMED("ik_batch_benchmark", "getPositionIKBatch: " << batch_duration / num_queries * 1e6
+                        << " us/pose, " << batch_allocations / num_queries << " allocations/pose, "
+                        << batch_found << " solved");
+  std::cout << single_duration / num_queries * 1e6 << "\t" << batch_duration / num_queries * 1e6 << "\t"
+            << single_allocations / num_queries << "\t" << batch_allocations / num_queries << std::endl;
+
+  return 0;
+}
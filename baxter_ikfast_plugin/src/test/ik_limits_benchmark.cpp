@@ -0,0 +1,162 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+/* Desc:   Measures how much of the IKFast solution tree is skipped when the solver prunes branches outside
+           the joint limits, for poses inside the workspace and poses near its edge
+*/
+
+#include <ros/ros.h>
+
+#include <baxter_ikfast_plugin/ikfast_kinematics_plugin.h>
+
+#include <cstdlib>
+
+namespace baxter_ikfast
+{
+
+using ikfast_kinematics_plugin::IkReal;
+using ikfast_kinematics_plugin::IKFAST_MAX_JOINTS;
+
+// Joint limits of the Baxter arms from baxter.urdf, s0 s1 e0 e1 w0 w1 w2
+const IkReal JOINT_MIN[IKFAST_MAX_JOINTS] = {-1.70168, -2.147, -3.05418, -0.05, -3.059, -1.5708, -3.059};
+const IkReal JOINT_MAX[IKFAST_MAX_JOINTS] = {1.70168, 1.047, 3.05418, 2.618, 3.059, 2.094, 3.059};
+
+double fRand(double fMin, double fMax)
+{
+  double f = (double)rand() / RAND_MAX;
+  return fMin + f * (fMax - fMin);
+}
+
+// Reachable end effector transforms, made by running FK on joint values within the limits. With an edge_fraction
+// above zero every joint is drawn from that fraction of its range next to one of its limits instead.
+void generatePoses(std::size_t num_poses, double edge_fraction, std::vector<IkReal> &eetrans, std::vector<IkReal> &eerot,
+                   std::vector<IkReal> &free_values)
+{
+  eetrans.resize(num_poses*3);
+  eerot.resize(num_poses*9);
+  free_values.resize(num_poses);
+
+  IkReal joints[IKFAST_MAX_JOINTS];
+  for (std::size_t p = 0; p < num_poses; ++p)
+  {
+    for (int i = 0; i < ikfast_kinematics_plugin::GetNumJoints(); ++i)
+    {
+      const double band = edge_fraction * (JOINT_MAX[i] - JOINT_MIN[i]);
+      if( band <= 0 )
+        joints[i] = fRand(JOINT_MIN[i], JOINT_MAX[i]);
+      else if( rand() % 2 )
+        joints[i] = fRand(JOINT_MAX[i] - band, JOINT_MAX[i]);
+      else
+        joints[i] = fRand(JOINT_MIN[i], JOINT_MIN[i] + band);
+    }
+    ikfast_kinematics_plugin::ComputeFk(joints, &eetrans[p*3], &eerot[p*9]);
+    free_values[p] = joints[ikfast_kinematics_plugin::GetFreeParameters()[0]];
+  }
+}
+
+bool withinLimits(const ikfast_kinematics_plugin::IkSolutionBase<IkReal> &solution)
+{
+  IkReal values[IKFAST_MAX_JOINTS];
+  solution.GetSolution(values, NULL);
+  for (int i = 0; i < ikfast_kinematics_plugin::GetNumJoints(); ++i)
+    if( values[i] < JOINT_MIN[i] || values[i] > JOINT_MAX[i] )
+      return false;
+  return true;
+}
+
+// Times ComputeIk followed by a limit check of the solutions against ComputeIkLimited
+void runBenchmark(const std::string &name, int num_poses, int num_runs, double edge_fraction)
+{
+  std::vector<IkReal> eetrans, eerot, free_values;
+  generatePoses(num_poses, edge_fraction, eetrans, eerot, free_values);
+
+  ikfast_kinematics_plugin::IKFastSolutionList solutions;
+  std::size_t all_solutions = 0, valid_solutions = 0, limited_solutions = 0;
+  double full_duration = 0, limited_duration = 0;
+  // Run 0 warms up both paths and is not timed
+  for (int run = 0; run <= num_runs; ++run)
+  {
+    ros::WallTime start_time = ros::WallTime::now();
+    all_solutions = 0;
+    valid_solutions = 0;
+    for (int p = 0; p < num_poses; ++p)
+    {
+      ikfast_kinematics_plugin::ComputeIk(&eetrans[p*3], &eerot[p*9], &free_values[p], solutions);
+      all_solutions += solutions.GetNumSolutions();
+      for (std::size_t s = 0; s < solutions.GetNumSolutions(); ++s)
+        valid_solutions += withinLimits(solutions.GetSolution(s));
+    }
+    if( run > 0 )
+      full_duration += (ros::WallTime::now() - start_time).toSec();
+
+    start_time = ros::WallTime::now();
+    limited_solutions = 0;
+    for (int p = 0; p < num_poses; ++p)
+    {
+      ikfast_kinematics_plugin::ComputeIkLimited(&eetrans[p*3], &eerot[p*9], &free_values[p], JOINT_MIN, JOINT_MAX, solutions);
+      limited_solutions += solutions.GetNumSolutions();
+    }
+    if( run > 0 )
+      limited_duration += (ros::WallTime::now() - start_time).toSec();
+  }
+
+  const double num_queries = double(num_poses) * num_runs;
+  ROS_INFO_STREAM_NAMED("ik_limits_benchmark", name << ": " << num_poses << " poses x " << num_runs << " runs, "
+                        << all_solutions << " solutions, " << valid_solutions << " within limits");
+  ROS_INFO_STREAM_NAMED("ik_limits_benchmark", "  ComputeIk + limit check: " << full_duration / num_queries * 1e6 << " us/pose");
+  ROS_INFO_STREAM_NAMED("ik_limits_benchmark", "  ComputeIkLimited:        " << limited_duration / num_queries * 1e6
+                        << " us/pose, " << limited_solutions << " solutions");
+  if( limited_solutions != valid_solutions )
+    ROS_WARN_STREAM_NAMED("ik_limits_benchmark", "  pruning kept " << limited_solutions << " solutions instead of " << valid_solutions);
+  std::cout << name << "\t" << full_duration / num_queries * 1e6 << "\t" << limited_duration / num_queries * 1e6 << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  ros::init(argc, argv, "ik_limits_benchmark");
+  ros::NodeHandle nh("~");
+
+  int num_poses, num_runs;
+  double edge_fraction;
+  nh.param("num_poses", num_poses, 1000);
+  nh.param("num_runs", num_runs, 5);
+  nh.param("edge_fraction", edge_fraction, 0.1);
+
+  srand(ros::Time::now().toSec());
+  baxter_ikfast::runBenchmark("workspace", num_poses, num_runs, 0.0);
+  baxter_ikfast::runBenchmark("edge", num_poses, num_runs, edge_fraction);
+
+  return 0;
+}
@@ -0,0 +1,237 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Desc:   Compares solving straight line Cartesian paths with getPositionIKPath against one searchPositionIK call
+           per waypoint seeded with the previous solution, and checks every solution with FK
+*/
+
+#include <ros/ros.h>
+
+#include <baxter_ikfast_plugin/ikfast_kinematics_plugin.h>
+#include <baxter_ikfast_plugin/arm_forward_kinematics.h>
+#include <tf_conversions/tf_kdl.h>
+
+#include <cstdlib>
+
+namespace baxter_ikfast
+{
+
+typedef ikfast_kinematics_plugin::IKFastKinematicsPlugin Plugin;
+using ikfast_kinematics_plugin::IKFAST_MAX_JOINTS;
+using baxter_ikfast_plugin::ARM_FK_NUM_FRAMES;
+using baxter_ikfast_plugin::ARM_FK_FRAME_SIZE;
+
+// Joint limits of the Baxter arms from baxter.urdf, s0 s1 e0 e1 w0 w1 w2
+const double JOINT_MIN[IKFAST_MAX_JOINTS] = {-1.70168, -2.147, -3.05418, -0.05, -3.059, -1.5708, -3.059};
+const double JOINT_MAX[IKFAST_MAX_JOINTS] = {1.70168, 1.047, 3.05418, 2.618, 3.059, 2.094, 3.059};
+
+double fRand(double fMin, double fMax)
+{
+  double f = (double)rand() / RAND_MAX;
+  return fMin + f * (fMax - fMin);
+}
+
+// Tip frame of the arm at joints
+KDL::Frame tipFrame(const double *joints)
+{
+  double frames[ARM_FK_NUM_FRAMES*ARM_FK_FRAME_SIZE];
+  baxter_ikfast_plugin::computeArmFK(joints, 1, frames);
+  const double *tip = frames + (ARM_FK_NUM_FRAMES-1)*ARM_FK_FRAME_SIZE;
+
+  KDL::Frame frame;
+  for (int i = 0; i < 9; ++i)
+    frame.M.data[i] = tip[i];
+  for (int i = 0; i < 3; ++i)
+    frame.p.data[i] = tip[9+i];
+  return frame;
+}
+
+// Largest difference between the tip frame of solution and frame, in the units of the frame elements
+double tipError(const double *solution, const KDL::Frame &frame)
+{
+  const KDL::Frame tip = tipFrame(solution);
+  double error = 0.0;
+  for (int i = 0; i < 9; ++i)
+    error = std::max(error, std::fabs(tip.M.data[i] - frame.M.data[i]));
+  for (int i = 0; i < 3; ++i)
+    error = std::max(error, std::fabs(tip.p.data[i] - frame.p.data[i]));
+  return error;
+}
+
+// A path that starts at the tip frame of a random state away from the joint limits and moves the tip along a
+// random direction at a fixed orientation, one step per waypoint
+void generatePath(std::size_t num_joints, int num_steps, double step, std::vector<double> &start,
+                  std::vector<KDL::Frame> &frames, std::vector<geometry_msgs::Pose> &poses)
+{
+  start.resize(num_joints);
+  for (std::size_t i = 0; i < num_joints; ++i)
+    start[i] = JOINT_MIN[i] + (JOINT_MAX[i] - JOINT_MIN[i]) * fRand(0.15, 0.85);
+  const KDL::Frame tip = tipFrame(&start[0]);
+
+  double direction[3], norm = 0.0;
+  for (int i = 0; i < 3; ++i)
+  {
+    direction[i] = fRand(-1.0, 1.0);
+    norm += direction[i]*direction[i];
+  }
+  norm = std::sqrt(norm);
+
+  frames.resize(num_steps);
+  poses.resize(num_steps);
+  for (int s = 0; s < num_steps; ++s)
+  {
+    frames[s] = tip;
+    for (int i = 0; i < 3; ++i)
+      frames[s].p.data[i] += (s+1) * step * direction[i] / norm;
+    tf::poseKDLToMsg(frames[s], poses[s]);
+  }
+}
+
+struct PathResult
+{
+  PathResult() : duration(0.0), num_solved(0), num_continued(0), num_searched(0), max_joint_step(0.0), max_error(0.0) {}
+
+  double duration;
+  std::size_t num_solved;
+  std::size_t num_continued;
+  std::size_t num_searched;
+  double max_joint_step; // largest joint change from one waypoint to the next
+  double max_error;      // largest FK error of a solution
+};
+
+// Joint steps and FK errors of the first num_solved rows of solutions, the path starts at start
+void checkPath(const std::vector<double> &start, const double *solutions, std::size_t num_solved,
+               const std::vector<KDL::Frame> &frames, PathResult &result)
+{
+  const std::size_t num_joints = start.size();
+  for (std::size_t s = 0; s < num_solved; ++s)
+  {
+    const double *solution = solutions + s*num_joints;
+    const double *previous = s ? solution - num_joints : &start[0];
+    for (std::size_t i = 0; i < num_joints; ++i)
+      result.max_joint_step = std::max(result.max_joint_step, std::fabs(solution[i] - previous[i]));
+    result.max_error = std::max(result.max_error, tipError(solution, frames[s]));
+  }
+}
+
+void printResult(const std::string &name, const PathResult &result, std::size_t num_poses)
+{
+  ROS_INFO_STREAM_NAMED("ik_path_benchmark", name << ": " << result.duration / num_poses * 1e6 << " us/pose, "
+                        << result.num_solved << " of " << num_poses << " solved (" << result.num_continued
+                        << " continued, " << result.num_searched << " searched), largest joint step "
+                        << result.max_joint_step << ", largest FK error " << result.max_error);
+  std::cout << name << "\t" << result.duration / num_poses * 1e6 << "\t" << result.num_solved << "\t"
+            << result.num_continued << "\t" << result.num_searched << "\t" << result.max_joint_step << "\t"
+            << result.max_error << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  ros::init(argc, argv, "ik_path_benchmark");
+  ros::NodeHandle nh("~");
+
+  int num_paths, num_steps;
+  double step, timeout, search_discretization, tolerance;
+  std::string group, base_frame, tip_frame;
+  nh.param("num_paths", num_paths, 100);
+  nh.param("num_steps", num_steps, 100);
+  nh.param("step", step, 0.001);
+  nh.param("timeout", timeout, 0.005); // of each searchPositionIK call, getPositionIKPath gets it per waypoint
+  nh.param("search_discretization", search_discretization, 0.01);
+  nh.param("tolerance", tolerance, 1e-4);
+  nh.param("group", group, std::string("left_arm"));
+  nh.param("base_frame", base_frame, std::string("left_arm_mount"));
+  nh.param("tip_frame", tip_frame, std::string("left_gripper"));
+
+  baxter_ikfast::Plugin plugin;
+  kinematics::KinematicsBase &solver = plugin;
+  if( !solver.initialize("robot_description", group, base_frame, tip_frame, search_discretization) )
+  {
+    ROS_ERROR_STREAM_NAMED("ik_path_benchmark","Unable to initialize the IKFast plugin");
+    return 1;
+  }
+  const std::size_t num_joints = ikfast_kinematics_plugin::GetNumJoints();
+
+  srand(ros::Time::now().toSec());
+  const std::vector<double> no_consistency_limits;
+  baxter_ikfast::Plugin::IKPathBuffer buffer;
+  baxter_ikfast::PathResult path_result, search_result;
+  std::vector<double> start, seed, solution, searched;
+  std::vector<KDL::Frame> frames;
+  std::vector<geometry_msgs::Pose> poses;
+  moveit_msgs::MoveItErrorCodes error_code;
+  for (int p = 0; p < num_paths; ++p)
+  {
+    baxter_ikfast::generatePath(num_joints, num_steps, step, start, frames, poses);
+
+    ros::WallTime start_time = ros::WallTime::now();
+    plugin.getPositionIKPath(poses, start, timeout*num_steps, no_consistency_limits, buffer);
+    path_result.duration += (ros::WallTime::now() - start_time).toSec();
+    path_result.num_solved += buffer.num_solved;
+    path_result.num_continued += buffer.num_continued;
+    path_result.num_searched += buffer.num_searched;
+    baxter_ikfast::checkPath(start, &buffer.solutions[0], buffer.num_solved, frames, path_result);
+
+    // Each waypoint seeded with the solution of the previous one, the path stops at the first failure like above
+    seed = start;
+    searched.clear();
+    start_time = ros::WallTime::now();
+    for (int s = 0; s < num_steps; ++s)
+    {
+      if (!plugin.searchPositionIK(poses[s], seed, timeout, solution, error_code))
+        break;
+      searched.insert(searched.end(), solution.begin(), solution.end());
+      seed = solution;
+    }
+    search_result.duration += (ros::WallTime::now() - start_time).toSec();
+    search_result.num_solved += searched.size() / num_joints;
+    search_result.num_searched += searched.size() / num_joints;
+    if (!searched.empty())
+      baxter_ikfast::checkPath(start, &searched[0], searched.size() / num_joints, frames, search_result);
+  }
+
+  const std::size_t num_poses = num_paths * num_steps;
+  std::cout << "method\tus_per_pose\tsolved\tcontinued\tsearched\tmax_joint_step\tmax_fk_error" << std::endl;
+  baxter_ikfast::printResult("getPositionIKPath", path_result, num_poses);
+  baxter_ikfast::printResult("searchPositionIK", search_result, num_poses);
+
+  if (path_result.max_error > tolerance || search_result.max_error > tolerance)
+  {
+    ROS_ERROR_STREAM_NAMED("ik_path_benchmark", "Solutions do not reach their pose");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,303 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+
+/* Desc:   Latency, success rate and throughput of getPositionIK and searchPositionIK of the IK plugins
+           of both arms, loaded through pluginlib like move_group does
+*/
+
+#include <ros/ros.h>
+#include <moveit/kinematics_base/kinematics_base.h>
+#include <pluginlib/class_loader.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace baxter_ikfast
+{
+
+typedef boost::shared_ptr<kinematics::KinematicsBase> SolverPtr;
+
+const int NUM_JOINTS = 7;
+
+// Joint limits of the Baxter arms from baxter.urdf, s0 s1 e0 e1 w0 w1 w2
+const double JOINT_MIN[NUM_JOINTS] = {-1.70168, -2.147, -3.05418, -0.05, -3.059, -1.5708, -3.059};
+const double JOINT_MAX[NUM_JOINTS] = {1.70168, 1.047, 3.05418, 2.618, 3.059, 2.094, 3.059};
+
+// A solution counts as verified when its FK is this close to the requested pose (meters, and one minus the
+// absolute dot product of the quaternions)
+const double VERIFY_POSITION_TOLERANCE = 1e-4;
+const double VERIFY_ORIENTATION_TOLERANCE = 1e-6;
+
+double fRand(double fMin, double fMax)
+{
+  double f = (double)rand() / RAND_MAX;
+  return fMin + f * (fMax - fMin);
+}
+
+void randomJoints(std::vector<double> &joints)
+{
+  joints.resize(NUM_JOINTS);
+  for (int i = 0; i < NUM_JOINTS; ++i)
+    joints[i] = fRand(JOINT_MIN[i], JOINT_MAX[i]);
+}
+
+bool posesMatch(const geometry_msgs::Pose &a, const geometry_msgs::Pose &b)
+{
+  const double dx = a.position.x - b.position.x, dy = a.position.y - b.position.y, dz = a.position.z - b.position.z;
+  const double dot = a.orientation.x*b.orientation.x + a.orientation.y*b.orientation.y +
+                     a.orientation.z*b.orientation.z + a.orientation.w*b.orientation.w;
+  return std::sqrt(dx*dx + dy*dy + dz*dz) < VERIFY_POSITION_TOLERANCE &&
+         1.0 - std::fabs(dot) < VERIFY_ORIENTATION_TOLERANCE;
+}
+
+// Reachable poses are made by running FK on random joint values within the limits. The seeds are
+// independent random joint values, so neither solver starts at the answer.
+bool generateQueries(const kinematics::KinematicsBase &fk_solver, std::size_t num_poses,
+                     std::vector<geometry_msgs::Pose> &poses, std::vector<std::vector<double> > &seeds)
+{
+  std::vector<std::string> tip(1, fk_solver.getTipFrame());
+  std::vector<geometry_msgs::Pose> fk_poses;
+  std::vector<double> joints;
+  poses.resize(num_poses);
+  seeds.resize(num_poses);
+  for (std::size_t p = 0; p < num_poses; ++p)
+  {
+    randomJoints(joints);
+    if( !fk_solver.getPositionFK(tip, joints, fk_poses) )
+      return false;
+    poses[p] = fk_poses[0];
+    randomJoints(seeds[p]);
+  }
+  return true;
+}
+
+struct Result
+{
+  std::string arm;
+  std::string solver;
+  std::string method;
+  std::size_t queries;
+  std::size_t solved;
+  std::size_t verified;
+  double p50_us;
+  double p99_us;
+  double mean_us;
+  double max_us;
+  double solutions_per_second;
+};
+
+double percentile(const std::vector<double> &sorted, double fraction)
+{
+  if( sorted.empty() )
+    return 0;
+  std::size_t index = static_cast<std::size_t>(fraction * (sorted.size() - 1) + 0.5);
+  return sorted[std::min(index, sorted.size() - 1)];
+}
+
+/**
+ * @brief Runs every query num_runs times through getPositionIK (search false) or searchPositionIK and
+ * summarizes the per-call latencies. The first run only warms up the solver.
+ */
+Result measure(const kinematics::KinematicsBase &solver, const kinematics::KinematicsBase &fk_solver,
+               const std::vector<geometry_msgs::Pose> &poses, const std::vector<std::vector<double> > &seeds,
+               bool search, double timeout, int num_runs)
+{
+  Result result;
+  result.method = search ? "searchPositionIK" : "getPositionIK";
+  result.queries = 0;
+  result.solved = 0;
+  result.verified = 0;
+
+  std::vector<double> latencies;
+  latencies.reserve(poses.size() * num_runs);
+  std::vector<double> solution;
+  std::vector<std::string> tip(1, fk_solver.getTipFrame());
+  std::vector<geometry_msgs::Pose> fk_poses;
+  moveit_msgs::MoveItErrorCodes error_code;
+  double total = 0;
+  for (int run = 0; run <= num_runs; ++run)
+  {
+    for (std::size_t p = 0; p < poses.size(); ++p)
+    {
+      ros::WallTime start_time = ros::WallTime::now();
+      bool found = search ? solver.searchPositionIK(poses[p], seeds[p], timeout, solution, error_code)
+                          : solver.getPositionIK(poses[p], seeds[p], solution, error_code);
+      double duration = (ros::WallTime::now() - start_time).toSec();
+      if( run == 0 )
+        continue;
+
+      latencies.push_back(duration * 1e6);
+      total += duration;
+      ++result.queries;
+      if( !found )
+        continue;
+      ++result.solved;
+      if( fk_solver.getPositionFK(tip, solution, fk_poses) && posesMatch(fk_poses[0], poses[p]) )
+        ++result.verified;
+    }
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+  result.p50_us = percentile(latencies, 0.5);
+  result.p99_us = percentile(latencies, 0.99);
+  result.mean_us = latencies.empty() ? 0 : total * 1e6 / latencies.size();
+  result.max_us = latencies.empty() ? 0 : latencies.back();
+  result.solutions_per_second = total > 0 ? result.solved / total : 0;
+  return result;
+}
+
+void writeResults(std::ostream &out, const std::vector<Result> &results)
+{
+  out << "arm\tsolver\tmethod\tqueries\tsuccess_rate\tverified_rate\tp50_us\tp99_us\tmean_us\tmax_us\tsolutions_per_s\n";
+  for (std::size_t i = 0; i < results.size(); ++i)
+  {
+    const Result &r = results[i];
+    const double queries = r.queries > 0 ? double(r.queries) : 1.0;
+    out << r.arm << "\t" << r.solver << "\t" << r.method << "\t" << r.queries << "\t"
+        << r.solved / queries << "\t" << r.verified / queries << "\t"
+        << r.p50_us << "\t" << r.p99_us << "\t" << r.mean_us << "\t" << r.max_us << "\t"
+        << r.solutions_per_second << "\n";
+  }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  ros::init(argc, argv, "ik_solver_benchmark");
+  ros::NodeHandle nh("~");
+
+  int num_poses, num_runs;
+  double timeout, search_discretization;
+  std::string output_file;
+  std::vector<std::string> arms, solvers;
+  nh.param("num_poses", num_poses, 500);
+  nh.param("num_runs", num_runs, 5);
+  nh.param("timeout", timeout, 0.005);
+  nh.param("search_discretization", search_discretization, 0.005);
+  nh.param("output_file", output_file, std::string());
+  if( !nh.getParam("arms", arms) )
+  {
+    arms.push_back("left");
+    arms.push_back("right");
+  }
+  // Solver names as in kinematics.yaml, <arm> is replaced by the arm. The first one also computes the FK
+  // that makes the poses and verifies the solutions.
+  if( !nh.getParam("solvers", solvers) )
+  {
+    solvers.push_back("baxter_<arm>_arm_kinematics/IKFastKinematicsPlugin");
+    solvers.push_back("kdl_kinematics_plugin/KDLKinematicsPlugin");
+  }
+
+  pluginlib::ClassLoader<kinematics::KinematicsBase> loader("moveit_core", "kinematics::KinematicsBase");
+
+  srand(ros::Time::now().toSec());
+  std::vector<baxter_ikfast::Result> results;
+  for (std::size_t a = 0; a < arms.size(); ++a)
+  {
+    const std::string group = arms[a] + "_arm";
+    std::vector<baxter_ikfast::SolverPtr> instances;
+    std::vector<std::string> names;
+    for (std::size_t s = 0; s < solvers.size(); ++s)
+    {
+      std::string name = solvers[s];
+      std::size_t arm_pos = name.find("<arm>");
+      if( arm_pos != std::string::npos )
+        name.replace(arm_pos, 5, arms[a]);
+
+      baxter_ikfast::SolverPtr solver;
+      try
+      {
+        solver = loader.createInstance(name);
+      }
+      catch(pluginlib::PluginlibException& ex)
+      {
+        ROS_ERROR_STREAM_NAMED("ik_solver_benchmark","Unable to load " << name << ": " << ex.what());
+        continue;
+      }
+      if( !solver || !solver->initialize("robot_description", group, arms[a] + "_arm_mount",
+                                         arms[a] + "_gripper", search_discretization) )
+      {
+        ROS_ERROR_STREAM_NAMED("ik_solver_benchmark","Unable to initialize " << name << " for " << group);
+        continue;
+      }
+      instances.push_back(solver);
+      names.push_back(name);
+    }
+    if( instances.empty() )
+      continue;
+
+    std::vector<geometry_msgs::Pose> poses;
+    std::vector<std::vector<double> > seeds;
+    if( !baxter_ikfast::generateQueries(*instances[0], num_poses, poses, seeds) )
+    {
+      ROS_ERROR_STREAM_NAMED("ik_solver_benchmark","FK of " << names[0] << " failed, skipping " << group);
+      continue;
+    }
+
+    for (std::size_t s = 0; s < instances.size(); ++s)
+    {
+      for (int search = 0; search <= 1; ++search)
+      {
+        baxter_ikfast::Result result = baxter_ikfast::measure(*instances[s], *instances[0], poses, seeds,
+                                                              search, timeout, num_runs);
+        result.arm = arms[a];
+        result.solver = names[s];
+        ROS_INFO_STREAM_NAMED("ik_solver_benchmark", result.arm << " " << result.solver << " " << result.method
+                              << ": p50 " << result.p50_us << " us, p99 " << result.p99_us << " us, "
+                              << result.solved << "/" << result.queries << " solved, "
+                              << result.verified << " verified, " << result.solutions_per_second << " solutions/s");
+        results.push_back(result);
+      }
+    }
+  }
+
+  // Tab separated, one row per arm, solver and method
+  baxter_ikfast::writeResults(std::cout, results);
+  if( !output_file.empty() )
+  {
+    std::ofstream file(output_file.c_str());
+    baxter_ikfast::writeResults(file, results);
+    if( !file )
+    {
+      ROS_ERROR_STREAM_NAMED("ik_solver_benchmark","Unable to write " << output_file);
+      return 1;
+    }
+  }
+
+  return results.empty() ? 1 : 0;
+}
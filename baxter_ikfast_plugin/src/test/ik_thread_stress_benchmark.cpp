@@ -0,0 +1,249 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+
+/* Desc:   Runs searchPositionIK and getPositionIK on one IKFast plugin instance from a growing number of threads,
+           checks every solution with FK and reports the throughput and allocations per query of each thread count
+*/
+
+#include <ros/ros.h>
+
+#include <baxter_ikfast_plugin/ikfast_kinematics_plugin.h>
+#include <baxter_ikfast_plugin/arm_forward_kinematics.h>
+#include <tf_conversions/tf_kdl.h>
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+
+#include <cstdlib>
+#include <new>
+
+// Count heap allocations of all threads so the benchmark can show queries do not allocate once warmed up
+static std::size_t num_allocations = 0;
+
+void* operator new(std::size_t size)
+{
+  __sync_fetch_and_add(&num_allocations, 1);
+  void* p = std::malloc(size);
+  if(!p)
+    throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void* p) throw()
+{
+  std::free(p);
+}
+
+namespace baxter_ikfast
+{
+
+typedef ikfast_kinematics_plugin::IKFastKinematicsPlugin Plugin;
+
+double fRand(double fMin, double fMax)
+{
+  double f = (double)rand() / RAND_MAX;
+  return fMin + f * (fMax - fMin);
+}
+
+// Reachable poses are made by running FK on random joint values. The seeds are other random joint values, so
+// searchPositionIK has to sweep the free joint.
+void generatePoses(std::size_t num_poses, std::size_t num_joints,
+                   std::vector<geometry_msgs::Pose> &poses, std::vector<std::vector<double> > &seeds)
+{
+  poses.resize(num_poses);
+  seeds.resize(num_poses, std::vector<double>(num_joints));
+
+  ikfast_kinematics_plugin::IkReal joints[ikfast_kinematics_plugin::IKFAST_MAX_JOINTS];
+  ikfast_kinematics_plugin::IkReal eetrans[3], eerot[9];
+  KDL::Frame frame;
+  for (std::size_t p = 0; p < num_poses; ++p)
+  {
+    for (std::size_t i = 0; i < num_joints; ++i)
+    {
+      joints[i] = fRand(-1.0, 1.0);
+      seeds[p][i] = fRand(-1.0, 1.0);
+    }
+    ikfast_kinematics_plugin::ComputeFk(joints, eetrans, eerot);
+
+    for (std::size_t i = 0; i < 3; ++i)
+      frame.p.data[i] = eetrans[i];
+    for (std::size_t i = 0; i < 9; ++i)
+      frame.M.data[i] = eerot[i];
+    tf::poseKDLToMsg(frame, poses[p]);
+  }
+}
+
+// Largest difference between the tip frame of solution and pose, in the units of the frame elements
+double tipError(const std::vector<double> &solution, const geometry_msgs::Pose &pose)
+{
+  using baxter_ikfast_plugin::ARM_FK_NUM_FRAMES;
+  using baxter_ikfast_plugin::ARM_FK_FRAME_SIZE;
+
+  double frames[ARM_FK_NUM_FRAMES*ARM_FK_FRAME_SIZE];
+  baxter_ikfast_plugin::computeArmFK(&solution[0], 1, frames);
+  const double *tip = frames + (ARM_FK_NUM_FRAMES-1)*ARM_FK_FRAME_SIZE;
+
+  KDL::Frame frame;
+  tf::poseMsgToKDL(pose, frame);
+  double error = 0.0;
+  for (int i = 0; i < 9; ++i)
+    error = std::max(error, std::fabs(tip[i] - frame.M.data[i]));
+  for (int i = 0; i < 3; ++i)
+    error = std::max(error, std::fabs(tip[9+i] - frame.p.data[i]));
+  return error;
+}
+
+struct WorkerResult
+{
+  std::size_t num_solved;
+  std::size_t num_wrong; // solutions that do not reach their pose
+};
+
+// Queries every pose num_runs times, starting at an offset per thread so the threads do not walk the cache in step.
+// Every thread does the same work whatever the number of threads.
+void runWorker(const Plugin *plugin, const std::vector<geometry_msgs::Pose> *poses,
+               const std::vector<std::vector<double> > *seeds, std::size_t offset, int num_runs,
+               double timeout, double tolerance, boost::barrier *start, WorkerResult *result)
+{
+  const std::size_t num_queries = num_runs * poses->size();
+  std::vector<double> solution;
+  solution.reserve(ikfast_kinematics_plugin::IKFAST_MAX_JOINTS);
+  moveit_msgs::MoveItErrorCodes error_code;
+  result->num_solved = 0;
+  result->num_wrong = 0;
+
+  start->wait();
+  for (std::size_t q = 0; q < num_queries; ++q)
+  {
+    const std::size_t p = (offset + q) % poses->size();
+    // Every other query skips the search, so both entry points run concurrently
+    const bool solved = (q % 2) ?
+      plugin->getPositionIK((*poses)[p], (*seeds)[p], solution, error_code) :
+      plugin->searchPositionIK((*poses)[p], (*seeds)[p], timeout, solution, error_code);
+    if (!solved)
+      continue;
+    ++result->num_solved;
+    if (tipError(solution, (*poses)[p]) > tolerance)
+      ++result->num_wrong;
+  }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  ros::init(argc, argv, "ik_thread_stress_benchmark");
+  ros::NodeHandle nh("~");
+
+  int num_poses, num_runs, max_threads;
+  double timeout, tolerance;
+  std::string group, base_frame, tip_frame;
+  nh.param("num_poses", num_poses, 500);
+  nh.param("num_runs", num_runs, 4);
+  nh.param("max_threads", max_threads, std::max(static_cast<int>(boost::thread::hardware_concurrency()), 1));
+  nh.param("timeout", timeout, 0.05);
+  nh.param("tolerance", tolerance, 1e-4); // loose enough for hits of the IK solution cache
+  nh.param("group", group, std::string("left_arm"));
+  nh.param("base_frame", base_frame, std::string("left_arm_mount"));
+  nh.param("tip_frame", tip_frame, std::string("left_gripper"));
+
+  baxter_ikfast::Plugin plugin;
+  kinematics::KinematicsBase &solver = plugin;
+  if( !solver.initialize("robot_description", group, base_frame, tip_frame, 0.005) )
+  {
+    ROS_ERROR_STREAM_NAMED("ik_thread_stress_benchmark","Unable to initialize the IKFast plugin");
+    return 1;
+  }
+  const std::size_t num_joints = ikfast_kinematics_plugin::GetNumJoints();
+
+  srand(ros::Time::now().toSec());
+  std::vector<geometry_msgs::Pose> poses;
+  std::vector<std::vector<double> > seeds;
+  baxter_ikfast::generatePoses(num_poses, num_joints, poses, seeds);
+
+  // Powers of two up to max_threads, and max_threads itself
+  std::vector<int> thread_counts;
+  for (int num_threads = 1; num_threads < max_threads; num_threads *= 2)
+    thread_counts.push_back(num_threads);
+  thread_counts.push_back(max_threads);
+
+  double single_thread_rate = 0.0;
+  std::size_t total_wrong = 0;
+  std::cout << "threads\tqueries_per_second\tspeedup\tsolved\twrong\tallocations_per_query" << std::endl;
+  for (std::size_t c = 0; c < thread_counts.size(); ++c)
+  {
+    const int num_threads = thread_counts[c];
+    std::vector<baxter_ikfast::WorkerResult> results(num_threads);
+    plugin.clearIKCache(); // every thread count starts cold
+    boost::barrier start(num_threads + 1);
+    boost::thread_group threads;
+    for (int t = 0; t < num_threads; ++t)
+      threads.create_thread(boost::bind(&baxter_ikfast::runWorker, &plugin, &poses, &seeds, t*poses.size()/num_threads,
+                                        num_runs, timeout, tolerance, &start, &results[t]));
+
+    // Counted from the start of the queries, only the first query of each thread creates its scratch
+    start.wait();
+    const std::size_t allocations_before = __sync_fetch_and_add(&num_allocations, 0);
+    ros::WallTime start_time = ros::WallTime::now();
+    threads.join_all();
+    const double duration = (ros::WallTime::now() - start_time).toSec();
+    const std::size_t allocations = __sync_fetch_and_add(&num_allocations, 0) - allocations_before;
+
+    std::size_t solved = 0, wrong = 0;
+    for (int t = 0; t < num_threads; ++t)
+    {
+      solved += results[t].num_solved;
+      wrong += results[t].num_wrong;
+    }
+    total_wrong += wrong;
+
+    const double total_queries = double(num_threads) * num_runs * poses.size();
+    const double rate = total_queries / duration;
+    if (num_threads == 1)
+      single_thread_rate = rate;
+
+    ROS_INFO_STREAM_NAMED("ik_thread_stress_benchmark", num_threads << " threads: " << rate << " queries/s, "
+                          << rate / single_thread_rate << "x one thread, " << solved << " of " << total_queries
+                          << " solved, " << wrong << " wrong, " << allocations / total_queries << " allocations/query");
+    std::cout << num_threads << "\t" << rate << "\t" << rate / single_thread_rate << "\t" << solved << "\t"
+              << wrong << "\t" << allocations / total_queries << std::endl;
+  }
+
+  if (total_wrong > 0)
+  {
+    ROS_ERROR_STREAM_NAMED("ik_thread_stress_benchmark", total_wrong << " solutions do not reach their pose");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,277 @@
+/*********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2013, University of Colorado, Boulder
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of the Univ of CO, Boulder nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *********************************************************************/
+
+/* Desc:   Samples a voxelized workspace and a set of end effector orientations for one Baxter arm with the
+           IKFast solver, and writes the reachability map with the best IK seed of every voxel and orientation
+*/
+
+#include <ros/ros.h>
+
+#include <baxter_ikfast_plugin/ikfast_kinematics_plugin.h>
+#include <baxter_ikfast_plugin/reachability_map.h>
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+
+namespace baxter_ikfast
+{
+
+using ikfast_kinematics_plugin::IkReal;
+using ikfast_kinematics_plugin::IKFAST_MAX_JOINTS;
+using baxter_ikfast_plugin::ReachabilityMapHeader;
+using baxter_ikfast_plugin::ReachabilityMapCell;
+
+// Joint limits of the Baxter arms from baxter.urdf, s0 s1 e0 e1 w0 w1 w2
+const double JOINT_MIN[IKFAST_MAX_JOINTS] = {-1.70168, -2.147, -3.05418, -0.05, -3.059, -1.5708, -3.059};
+const double JOINT_MAX[IKFAST_MAX_JOINTS] = {1.70168, 1.047, 3.05418, 2.618, 3.059, 2.094, 3.059};
+
+/**
+ * @brief End effector rotations in the base frame, row major. The approach (z) axis points straight down, or
+ * is tilted 45 and 90 degrees from down towards num_yaws directions. Each approach axis is combined with
+ * num_rolls rotations about it.
+ */
+void sampleOrientations(int num_yaws, int num_rolls, std::vector<double> &orientations)
+{
+  std::vector<double> approaches;
+  approaches.push_back(0); approaches.push_back(0); approaches.push_back(-1);
+  for (int tilt = 1; tilt <= 2; ++tilt)
+  {
+    for (int yaw = 0; yaw < num_yaws; ++yaw)
+    {
+      const double t = tilt*M_PI/4, y = yaw*2*M_PI/num_yaws;
+      approaches.push_back(std::sin(t)*std::cos(y));
+      approaches.push_back(std::sin(t)*std::sin(y));
+      approaches.push_back(-std::cos(t));
+    }
+  }
+
+  orientations.clear();
+  for (std::size_t a = 0; a < approaches.size(); a += 3)
+  {
+    const double *z = &approaches[a];
+    // x axis at roll 0: the part of the base x axis (or the base z axis, when approaching from the side)
+    // perpendicular to the approach axis
+    double h[3] = {0, 0, 0};
+    h[std::fabs(z[2]) > 0.9 ? 0 : 2] = 1;
+    const double hz = h[0]*z[0] + h[1]*z[1] + h[2]*z[2];
+    double x0[3] = {h[0]-hz*z[0], h[1]-hz*z[1], h[2]-hz*z[2]};
+    const double norm = std::sqrt(x0[0]*x0[0] + x0[1]*x0[1] + x0[2]*x0[2]);
+    for (int i = 0; i < 3; ++i)
+      x0[i] /= norm;
+    const double y0[3] = {z[1]*x0[2]-z[2]*x0[1], z[2]*x0[0]-z[0]*x0[2], z[0]*x0[1]-z[1]*x0[0]};
+
+    for (int roll = 0; roll < num_rolls; ++roll)
+    {
+      const double r = roll*2*M_PI/num_rolls;
+      const double x[3] = {std::cos(r)*x0[0]+std::sin(r)*y0[0], std::cos(r)*x0[1]+std::sin(r)*y0[1], std::cos(r)*x0[2]+std::sin(r)*y0[2]};
+      const double y[3] = {z[1]*x[2]-z[2]*x[1], z[2]*x[0]-z[0]*x[2], z[0]*x[1]-z[1]*x[0]};
+      for (int i = 0; i < 3; ++i)
+      {
+        orientations.push_back(x[i]);
+        orientations.push_back(y[i]);
+        orientations.push_back(z[i]);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Fraction of the joint range between the joint values and the closest limit, negative outside the limits
+ */
+double limitMargin(const IkReal *joints, int num_joints)
+{
+  double margin = 0.5;
+  for (int j = 0; j < num_joints; ++j)
+  {
+    const double range = JOINT_MAX[j] - JOINT_MIN[j];
+    margin = std::min(margin, std::min(joints[j] - JOINT_MIN[j], JOINT_MAX[j] - joints[j]) / range);
+  }
+  return margin;
+}
+
+struct MapBuilder
+{
+  ReachabilityMapHeader header;
+  std::vector<double> orientations;
+  std::vector<IkReal> free_values;
+  std::vector<ReachabilityMapCell> cells;
+  int next_voxel; // next voxel to hand out, atomic
+
+  // Every worker takes voxels until they are exhausted and sweeps the free joint of each of their poses
+  void work()
+  {
+    const int num_joints = ikfast_kinematics_plugin::GetNumJoints();
+    const int num_free = free_values.size();
+    const int num_voxels = static_cast<int>(header.dims[0]*header.dims[1]*header.dims[2]);
+    ikfast_kinematics_plugin::IKFastSolutionList solutions;
+
+    const double *m = header.mount;
+    int voxel;
+    while ((voxel = __sync_fetch_and_add(&next_voxel, 1)) < num_voxels)
+    {
+      const int dims[3] = {static_cast<int>(header.dims[0]), static_cast<int>(header.dims[1]), static_cast<int>(header.dims[2])};
+      const int index[3] = {voxel % dims[0], (voxel / dims[0]) % dims[1], voxel / (dims[0]*dims[1])};
+      double position[3];
+      for (int i = 0; i < 3; ++i)
+        position[i] = header.origin[i] + index[i]*header.resolution;
+
+      // The pose in the mount frame is mount^T * (pose - mount translation)
+      IkReal eetrans[3];
+      for (int i = 0; i < 3; ++i)
+        eetrans[i] = m[0*3+i]*(position[0]-m[9]) + m[1*3+i]*(position[1]-m[10]) + m[2*3+i]*(position[2]-m[11]);
+
+      for (boost::uint32_t o = 0; o < header.num_orientations; ++o)
+      {
+        const double *rotation = &orientations[o*9];
+        IkReal eerot[9];
+        for (int i = 0; i < 3; ++i)
+          for (int j = 0; j < 3; ++j)
+            eerot[i*3+j] = m[0*3+i]*rotation[0*3+j] + m[1*3+i]*rotation[1*3+j] + m[2*3+i]*rotation[2*3+j];
+
+        ReachabilityMapCell &cell = cells[voxel*header.num_orientations + o];
+        cell.margin = -1;
+        for (int f = 0; f < num_free; ++f)
+        {
+          try
+          {
+            ikfast_kinematics_plugin::ComputeIk(eetrans, eerot, &free_values[f], solutions);
+          }
+          catch (const std::exception &e)
+          {
+            continue; // a failed check of the solver, the free value gives no solutions
+          }
+
+          for (std::size_t s = 0; s < solutions.GetNumSolutions(); ++s)
+          {
+            IkReal joints[IKFAST_MAX_JOINTS];
+            solutions.GetSolution(s).GetSolution(joints, &free_values[f]);
+            const double margin = limitMargin(joints, num_joints);
+            if (margin > cell.margin)
+            {
+              cell.margin = margin;
+              for (int j = 0; j < num_joints; ++j)
+                cell.joints[j] = joints[j];
+            }
+          }
+        }
+      }
+    }
+  }
+};
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  ros::init(argc, argv, "build_reachability_map");
+  ros::NodeHandle nh("~");
+
+  // The defaults cover the tables of the baxter_pick_place environments, in the base frame
+  std::string arm, filename;
+  double resolution, min_x, max_x, min_y, max_y, min_z, max_z, free_joint_step;
+  int num_yaws, num_rolls, num_threads;
+  nh.param("arm", arm, std::string("left"));
+  nh.param("file", filename, arm + "_arm_reachability.map");
+  nh.param("resolution", resolution, 0.05);
+  nh.param("min_x", min_x, 0.3);
+  nh.param("max_x", max_x, 1.1);
+  nh.param("min_y", min_y, -1.0);
+  nh.param("max_y", max_y, 1.0);
+  nh.param("min_z", min_z, -0.2);
+  nh.param("max_z", max_z, 0.4);
+  nh.param("num_yaws", num_yaws, 8);
+  nh.param("num_rolls", num_rolls, 4);
+  nh.param("free_joint_step", free_joint_step, 0.05);
+  nh.param("num_threads", num_threads, static_cast<int>(boost::thread::hardware_concurrency()));
+
+  // Arm mount in the base frame, from baxter.urdf
+  const double side = (arm == "right") ? -1.0 : 1.0;
+  double mount_x, mount_y, mount_z, mount_yaw;
+  nh.param("mount_x", mount_x, 0.024645);
+  nh.param("mount_y", mount_y, side*0.219645);
+  nh.param("mount_z", mount_z, 0.118588);
+  nh.param("mount_yaw", mount_yaw, side*0.7854);
+
+  baxter_ikfast::MapBuilder builder;
+  baxter_ikfast_plugin::ReachabilityMapHeader &header = builder.header;
+  std::memset(&header, 0, sizeof(header));
+  header.num_joints = ikfast_kinematics_plugin::GetNumJoints();
+  header.dims[0] = static_cast<boost::uint32_t>(std::floor((max_x - min_x) / resolution)) + 1;
+  header.dims[1] = static_cast<boost::uint32_t>(std::floor((max_y - min_y) / resolution)) + 1;
+  header.dims[2] = static_cast<boost::uint32_t>(std::floor((max_z - min_z) / resolution)) + 1;
+  header.origin[0] = min_x;
+  header.origin[1] = min_y;
+  header.origin[2] = min_z;
+  header.resolution = resolution;
+  const double mount[12] = {std::cos(mount_yaw), -std::sin(mount_yaw), 0,
+                            std::sin(mount_yaw),  std::cos(mount_yaw), 0,
+                            0, 0, 1,
+                            mount_x, mount_y, mount_z};
+  std::copy(mount, mount+12, header.mount);
+
+  baxter_ikfast::sampleOrientations(num_yaws, num_rolls, builder.orientations);
+  header.num_orientations = builder.orientations.size() / 9;
+
+  const int free_joint = ikfast_kinematics_plugin::GetFreeParameters()[0];
+  for (double value = baxter_ikfast::JOINT_MIN[free_joint]; value <= baxter_ikfast::JOINT_MAX[free_joint]; value += free_joint_step)
+    builder.free_values.push_back(value);
+
+  const std::size_t num_voxels = static_cast<std::size_t>(header.dims[0])*header.dims[1]*header.dims[2];
+  builder.cells.resize(num_voxels*header.num_orientations);
+  builder.next_voxel = 0;
+
+  ROS_INFO_STREAM_NAMED("build_reachability_map", "Sampling " << num_voxels << " voxels x " << header.num_orientations
+                        << " orientations x " << builder.free_values.size() << " free joint values for the " << arm
+                        << " arm on " << std::max(num_threads, 1) << " threads");
+  ros::WallTime start_time = ros::WallTime::now();
+  boost::thread_group workers;
+  for (int t = 1; t < num_threads; ++t)
+    workers.create_thread(boost::bind(&baxter_ikfast::MapBuilder::work, &builder));
+  builder.work();
+  workers.join_all();
+  const double duration = (ros::WallTime::now() - start_time).toSec();
+
+  std::size_t num_reachable = 0;
+  for (std::size_t c = 0; c < builder.cells.size(); ++c)
+    num_reachable += builder.cells[c].margin >= 0;
+  ROS_INFO_STREAM_NAMED("build_reachability_map", num_reachable << " of " << builder.cells.size()
+                        << " voxel orientations are reachable, sampled in " << duration << " s");
+
+  if (!baxter_ikfast_plugin::ReachabilityMap::write(filename, header, &builder.orientations[0], &builder.cells[0]))
+  {
+    ROS_ERROR_STREAM_NAMED("build_reachability_map", "Could not write " << filename);
+    return 1;
+  }
+  ROS_INFO_STREAM_NAMED("build_reachability_map", "Wrote " << filename);
+  return 0;
+}